@@ -31,6 +31,8 @@ target("EngineSquaredCore")
     add_headerfiles("src/*.ipp")
 
     add_includedirs("src", { public = true })
+    -- Registries are built on worker threads (see Scene::Utils::AStreamedScene): EnTT must hand out type ids atomically.
+    add_defines("ENTT_USE_ATOMIC", { public = true })
 
     if is_mode("debug") then
         add_defines("DEBUG")
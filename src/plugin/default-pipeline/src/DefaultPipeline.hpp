@@ -4,19 +4,23 @@
 #include "component/GPUDirectionalLight.hpp"
 #include "component/GPUMaterial.hpp"
 #include "component/GPUMesh.hpp"
+#include "component/GPUMeshLOD.hpp"
 #include "component/GPUTransform.hpp"
+#include "component/StaticShadowCaster.hpp"
 
 #include "plugin/PluginDefaultPipeline.hpp"
 
 #include "resource/AmbientLight.hpp"
+#include "resource/GeometryArena.hpp"
+#include "resource/MaterialAtlas.hpp"
+#include "resource/MaterialTable.hpp"
+#include "resource/ShadowAtlas.hpp"
 
 #include "resource/buffer/AmbientLightBuffer.hpp"
 #include "resource/buffer/CameraGPUBuffer.hpp"
-#include "resource/buffer/DirectionalLightBuffer.hpp"
 #include "resource/buffer/DirectionalLightsBuffer.hpp"
-#include "resource/buffer/IndexGPUBuffer.hpp"
-#include "resource/buffer/MaterialGPUBuffer.hpp"
-#include "resource/buffer/PointGPUBuffer.hpp"
+#include "resource/buffer/GeometryBuffer.hpp"
+#include "resource/buffer/PointLightClustersBuffer.hpp"
 #include "resource/buffer/PointLightsBuffer.hpp"
 #include "resource/buffer/TransformGPUBuffer.hpp"
 
@@ -28,6 +32,7 @@
 #include "system/initialization/CreateAmbientLight.hpp"
 #include "system/initialization/CreateDefaultMaterial.hpp"
 #include "system/initialization/CreateDirectionalLights.hpp"
+#include "system/initialization/CreateGeometryArena.hpp"
 #include "system/initialization/CreateLights.hpp"
 #include "system/initialization/CreatePointLights.hpp"
 
@@ -40,9 +45,16 @@
 #include "system/GPUComponentManagement/OnMaterialUpdate.hpp"
 #include "system/GPUComponentManagement/OnMeshCreation.hpp"
 #include "system/GPUComponentManagement/OnMeshDestruction.hpp"
+#include "system/GPUComponentManagement/OnMeshHandleCreation.hpp"
+#include "system/GPUComponentManagement/OnMeshHandleDestruction.hpp"
+#include "system/GPUComponentManagement/OnMeshLODCreation.hpp"
+#include "system/GPUComponentManagement/OnMeshLODDestruction.hpp"
+#include "system/GPUComponentManagement/OnMeshRemoval.hpp"
+#include "system/GPUComponentManagement/OnStaticShadowCasterChange.hpp"
 #include "system/GPUComponentManagement/OnTransformCreation.hpp"
 #include "system/GPUComponentManagement/OnTransformDestruction.hpp"
 
+#include "system/preparation/SelectMeshLODs.hpp"
 #include "system/preparation/UpdateAmbientLight.hpp"
 #include "system/preparation/UpdateDirectionalLights.hpp"
 #include "system/preparation/UpdateGPUCameras.hpp"
@@ -50,7 +62,19 @@
 #include "system/preparation/UpdateGPUMaterials.hpp"
 #include "system/preparation/UpdateGPUMeshes.hpp"
 #include "system/preparation/UpdateGPUTransforms.hpp"
+#include "system/preparation/UpdatePendingMaterialTextures.hpp"
 #include "system/preparation/UpdatePointLights.hpp"
 
 #include "utils/AmbientLight.hpp"
+#include "utils/AssetReload.hpp"
+#include "utils/BoundingSphere.hpp"
+#include "utils/GeometryArena.hpp"
+#include "utils/InterleaveVertices.hpp"
+#include "utils/LightClusterGrid.hpp"
+#include "utils/MeshLOD.hpp"
+#include "utils/MaterialAtlas.hpp"
+#include "utils/MaterialTable.hpp"
+#include "utils/MaterialTexture.hpp"
 #include "utils/PointLights.hpp"
+#include "utils/ShadowCascades.hpp"
+#include "utils/ShelfPacker.hpp"
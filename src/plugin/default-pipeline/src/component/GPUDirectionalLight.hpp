@@ -1,36 +1,39 @@
 #pragma once
 
-#include "Logger.hpp"
-#include "component/DirectionalLight.hpp"
+#include "component/Camera.hpp"
 #include "component/Transform.hpp"
 #include "glm/glm.hpp"
-#include "utils/webgpu.hpp"
-#include <entt/core/hashed_string.hpp>
+#include "utils/ShadowCascades.hpp"
+#include <algorithm>
+#include <array>
+#include <optional>
 
 namespace DefaultPipeline::Component {
 struct GPUDirectionalLight {
-    using Id = entt::hashed_string;
+    /** @brief First of the SHADOW_CASCADE_COUNT layers of the light in the Resource::ShadowAtlas, if it got some. */
+    std::optional<uint32_t> firstCascadeLayer;
+    /** @brief View depth of the far end of each cascade. */
+    glm::vec4 cascadeSplits{0.0f};
+    std::array<Utils::ShadowCascade, Utils::SHADOW_CASCADE_COUNT> cascades{};
 
-    glm::mat4 viewProjectionMatrix;
-    Id buffer{};
-    Id bindGroupData{};
-    Id shadowTextureView{};
-    uint32_t shadowTextureIndex;
-
-    void Update(const Object::Component::DirectionalLight &light, const Object::Component::Transform &transform)
+    /**
+     * @brief Split the view of the camera into cascades and fit one around each split.
+     */
+    void Update(const Object::Component::Transform &transform, const Object::Component::Camera &camera)
     {
-        // Why do we negate the forward vector?
-        glm::vec3 lightDirection = -glm::normalize(transform.GetForwardVector() * transform.GetScale());
-        glm::vec3 posOfLight = transform.GetPosition();
-        glm::mat4 lightProjection = light.projection;
-        glm::vec3 target = posOfLight + glm::normalize(lightDirection) * 10.0f;
-        auto up = glm::abs(glm::dot(glm::normalize(lightDirection), glm::vec3(0.0f, 1.0f, 0.0f))) > 0.99f ?
-                      glm::vec3(1.0f, 0.0f, 0.0f) :
-                      glm::vec3(0.0f, 1.0f, 0.0f);
-        glm::mat4 lightView = glm::lookAt(posOfLight, target, up);
-        glm::mat4 lightSpaceMatrix = lightProjection * lightView;
+        // The light travels along the forward vector, the lighting uses the opposite direction.
+        const glm::vec3 lightDirection = glm::normalize(transform.GetForwardVector() * transform.GetScale());
+        const float shadowDistance = std::min(camera.farPlane, Utils::SHADOW_MAX_DISTANCE);
+        const auto splits = Utils::ComputeCascadeSplits(camera.nearPlane, shadowDistance);
 
-        viewProjectionMatrix = lightSpaceMatrix;
+        float splitNear = camera.nearPlane;
+        for (uint32_t i = 0; i < Utils::SHADOW_CASCADE_COUNT; ++i)
+        {
+            cascades[i] = Utils::ComputeShadowCascade(camera.inverseViewProjection, camera.nearPlane, camera.farPlane,
+                                                      splitNear, splits[i], lightDirection);
+            cascadeSplits[static_cast<glm::length_t>(i)] = splits[i];
+            splitNear = splits[i];
+        }
     }
 };
 }; // namespace DefaultPipeline::Component
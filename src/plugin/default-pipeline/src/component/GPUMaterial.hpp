@@ -1,14 +1,22 @@
 #pragma once
 
+#include "utils/MaterialTable.hpp"
 #include <entt/core/hashed_string.hpp>
+#include <optional>
+#include <string>
 
 namespace DefaultPipeline::Component {
 struct GPUMaterial {
     using Id = entt::hashed_string;
 
-    Id buffer{};
+    /** @brief Slot of the material in the MaterialTable, given to its draws as their first instance. */
+    Utils::MaterialSlot slot = Utils::DEFAULT_MATERIAL_SLOT;
     Id texture{};
-    Id sampler{};
-    Id bindGroup{};
+    /** @brief Texture whose MaterialAtlas region is used by the material, released when it changes texture. */
+    std::optional<entt::id_type> atlasTexture{};
+    /** @brief Bind group of the texture when it could not be packed in the atlas. */
+    std::optional<Id> textureBindGroup{};
+    /** @brief Texture being loaded in the background, bound in place of the default texture once resident. */
+    std::string pendingTexture{};
 };
 } // namespace DefaultPipeline::Component
@@ -1,11 +1,21 @@
 #pragma once
 
-#include <entt/core/hashed_string.hpp>
+#include "utils/GeometryArena.hpp"
+#include <glm/vec4.hpp>
 
 namespace DefaultPipeline::Component {
 struct GPUMesh {
-    using Id = entt::hashed_string;
-    Id pointBufferId{};
-    Id indexBufferId{};
+    /** @brief Ranges of the mesh inside the Resource::GeometryArena buffers. */
+    Utils::GeometryHandle geometry = Utils::INVALID_GEOMETRY_HANDLE;
+    /** @brief Ranges of the level of detail selected for this frame, see Component::GPUMeshLOD. */
+    Utils::GeometryHandle lodGeometry = Utils::INVALID_GEOMETRY_HANDLE;
+    /** @brief Local space bounding sphere of the mesh: xyz is the center, w the radius. */
+    glm::vec4 bounds{0.0f};
+
+    /** @brief Ranges passes should draw: the selected level of detail if any, the mesh otherwise. */
+    [[nodiscard]] Utils::GeometryHandle GetDrawGeometry() const
+    {
+        return lodGeometry != Utils::INVALID_GEOMETRY_HANDLE ? lodGeometry : geometry;
+    }
 };
 }; // namespace DefaultPipeline::Component
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "utils/GeometryArena.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace DefaultPipeline::Component {
+/**
+ * @brief Index ranges of the Object::Component::MeshLOD levels of an entity, drawing the vertices of its GPUMesh.
+ */
+struct GPUMeshLOD {
+    /** @brief Ranges of level i + 1, acquired with Resource::GeometryArena::AcquireIndices. */
+    std::vector<Utils::GeometryHandle> levels;
+    /** @brief Level selected last frame, 0 being the mesh itself. */
+    uint32_t level = 0;
+};
+} // namespace DefaultPipeline::Component
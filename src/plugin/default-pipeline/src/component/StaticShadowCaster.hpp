@@ -0,0 +1,12 @@
+#pragma once
+
+namespace DefaultPipeline::Component {
+/**
+ * @brief Marks a mesh whose transform and geometry do not change.
+ *
+ * Its depth is rendered once into the static cache of each shadow cascade instead of every frame. Adding, removing
+ * the component or changing the mesh invalidates the cache; moving the entity requires a call to
+ * Resource::ShadowAtlas::InvalidateStaticCasters.
+ */
+struct StaticShadowCaster {};
+} // namespace DefaultPipeline::Component
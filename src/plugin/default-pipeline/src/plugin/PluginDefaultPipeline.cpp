@@ -3,6 +3,8 @@
 #include "RenderingPipeline.hpp"
 #include "component/Material.hpp"
 #include "plugin/PluginGraphic.hpp"
+#include "plugin/PluginObject.hpp"
+#include "system/PropagateTransforms.hpp"
 
 template <typename CPUComponent, typename GPUComponent, auto CreationFunction, auto DestructionFunction>
 static void SetupGPUComponent(Engine::Core &core)
@@ -16,14 +18,22 @@ static void SetupGPUComponent(Engine::Core &core)
 
 void DefaultPipeline::Plugin::Bind()
 {
-    RequirePlugins<RenderingPipeline::Plugin, Graphic::Plugin>();
+    RequirePlugins<RenderingPipeline::Plugin, Graphic::Plugin, Object::Plugin>();
 
     RegisterResource(DefaultPipeline::Resource::AmbientLight());
+    RegisterResource(DefaultPipeline::Resource::GeometryArena());
+    RegisterResource(DefaultPipeline::Resource::MaterialAtlas());
+    RegisterResource(DefaultPipeline::Resource::MaterialTable());
+    RegisterResource(DefaultPipeline::Resource::ShadowAtlas());
 
     SetupGPUComponent<Object::Component::Camera, Component::GPUCamera, &System::OnCameraCreation,
                       &System::OnCameraDestruction>(this->GetCore());
-    SetupGPUComponent<Object::Component::Mesh, Component::GPUMesh, &System::OnMeshCreation, &System::OnMeshDestruction>(
+    // Removing a Mesh draws the MeshHandle it overrode again, so its CPU side has its own destruction.
+    this->GetCore().GetRegistry().on_construct<Object::Component::Mesh>().connect<&System::OnMeshCreation>(
         this->GetCore());
+    this->GetCore().GetRegistry().on_destroy<Object::Component::Mesh>().connect<&System::OnMeshRemoval>(
+        this->GetCore());
+    this->GetCore().GetRegistry().on_destroy<Component::GPUMesh>().connect<&System::OnMeshDestruction>(this->GetCore());
     SetupGPUComponent<Object::Component::Transform, Component::GPUTransform, &System::OnTransformCreation,
                       &System::OnTransformDestruction>(this->GetCore());
     SetupGPUComponent<Object::Component::Material, Component::GPUMaterial, &System::OnMaterialCreation,
@@ -32,13 +42,34 @@ void DefaultPipeline::Plugin::Bind()
         this->GetCore());
     SetupGPUComponent<Object::Component::DirectionalLight, Component::GPUDirectionalLight,
                       &System::OnDirectionalLightCreation, &System::OnDirectionalLightDestruction>(this->GetCore());
+    SetupGPUComponent<Object::Component::MeshLOD, Component::GPUMeshLOD, &System::OnMeshLODCreation,
+                      &System::OnMeshLODDestruction>(this->GetCore());
+    this->GetCore().GetRegistry().on_update<Object::Component::MeshLOD>().connect<&System::OnMeshLODCreation>(
+        this->GetCore());
+    // Meshes shared through a MeshHandle reuse the GPUMesh destruction of unique meshes. Their storage is created
+    // after the Mesh one, so a killed entity loses its MeshHandle first and is not given a GPUMesh again.
+    this->GetCore().GetRegistry().on_construct<Object::Component::MeshHandle>().connect<&System::OnMeshHandleCreation>(
+        this->GetCore());
+    this->GetCore().GetRegistry().on_destroy<Object::Component::MeshHandle>().connect<&System::OnMeshHandleDestruction>(
+        this->GetCore());
+    this->GetCore()
+        .GetRegistry()
+        .on_construct<Component::StaticShadowCaster>()
+        .connect<&System::OnStaticShadowCasterChange>(this->GetCore());
+    this->GetCore()
+        .GetRegistry()
+        .on_destroy<Component::StaticShadowCaster>()
+        .connect<&System::OnStaticShadowCasterChange>(this->GetCore());
 
-    RegisterSystems<RenderingPipeline::Setup>(System::Create3DGraph, System::CreateDefaultMaterial,
-                                              System::CreateAmbientLight, System::CreatePointLights,
-                                              System::CreateDirectionalLights, System::CreateLights);
+    RegisterSystems<RenderingPipeline::Setup>(System::CreateGeometryArena, System::Create3DGraph,
+                                              System::CreateDefaultMaterial, System::CreateAmbientLight,
+                                              System::CreatePointLights, System::CreateDirectionalLights,
+                                              System::CreateLights);
 
-    RegisterSystems<RenderingPipeline::Preparation>(System::UpdateGPUTransforms, System::UpdateGPUCameras,
-                                                    System::UpdateGPUMaterials, System::UpdateGPUMeshes,
-                                                    System::UpdateGPUDirectionalLight, System::UpdateAmbientLight,
-                                                    System::UpdatePointLights, System::UpdateDirectionalLights);
+    // The Object plugin propagates the transforms in Update, it is done again for the changes made since then.
+    RegisterSystems<RenderingPipeline::Preparation>(
+        Object::System::PropagateTransforms, System::UpdateGPUTransforms, System::UpdateGPUCameras,
+        System::UpdatePendingMaterialTextures, System::UpdateGPUMaterials, System::UpdateGPUMeshes,
+        System::SelectMeshLODs, System::UpdateGPUDirectionalLight, System::UpdateAmbientLight,
+        System::UpdatePointLights, System::UpdateDirectionalLights);
 }
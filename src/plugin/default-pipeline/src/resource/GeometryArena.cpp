@@ -0,0 +1,528 @@
+#include "GeometryArena.hpp"
+#include "exception/UpdateBufferError.hpp"
+#include "resource/GPUBufferContainer.hpp"
+#include "resource/buffer/GeometryBuffer.hpp"
+#include "utils/InterleaveVertices.hpp"
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+namespace DefaultPipeline::Resource {
+
+namespace {
+template <typename TContainer> std::span<const std::byte> AsBytes(const TContainer &values)
+{
+    return std::as_bytes(std::span(values));
+}
+
+std::array<uint32_t, 2> MeshCounts(const Object::Component::Mesh &mesh)
+{
+    return {static_cast<uint32_t>(mesh.GetVertices().size()), static_cast<uint32_t>(mesh.GetIndices().size())};
+}
+
+/** @brief The counts come first, so that the boundaries between the attributes are part of the key. */
+std::array<std::span<const std::byte>, 5> MeshKey(const Object::Component::Mesh &mesh,
+                                                  const std::array<uint32_t, 2> &counts)
+{
+    return {AsBytes(counts), AsBytes(mesh.GetVertices()), AsBytes(mesh.GetNormals()), AsBytes(mesh.GetTexCoords()),
+            AsBytes(mesh.GetIndices())};
+}
+
+bool KeyEquals(const std::vector<std::byte> &key, std::span<const std::span<const std::byte>> parts)
+{
+    size_t offset = 0;
+    for (const auto &part : parts)
+    {
+        if (key.size() - offset < part.size() || !std::ranges::equal(part, std::span(key).subspan(offset, part.size())))
+            return false;
+        offset += part.size();
+    }
+    return offset == key.size();
+}
+} // namespace
+
+void GeometryArena::Create(Engine::Core &core)
+{
+    if (_isCreated)
+        return;
+
+    auto &bufferContainer = core.GetResource<Graphic::Resource::GPUBufferContainer>();
+
+    auto vertexBuffer = std::make_unique<GeometryBuffer>(
+        Utils::GEOMETRY_ARENA_VERTEX_BUFFER_NAME, wgpu::BufferUsage::Vertex,
+        Utils::GEOMETRY_ARENA_INITIAL_VERTEX_CAPACITY * Utils::GEOMETRY_VERTEX_STRIDE);
+    vertexBuffer->Create(core);
+    bufferContainer.Add(Utils::GEOMETRY_ARENA_VERTEX_BUFFER_ID, std::move(vertexBuffer));
+
+    auto indexBuffer = std::make_unique<GeometryBuffer>(Utils::GEOMETRY_ARENA_INDEX_BUFFER_NAME,
+                                                        wgpu::BufferUsage::Index,
+                                                        Utils::GEOMETRY_ARENA_INITIAL_INDEX_CAPACITY * sizeof(uint32_t));
+    indexBuffer->Create(core);
+    bufferContainer.Add(Utils::GEOMETRY_ARENA_INDEX_BUFFER_ID, std::move(indexBuffer));
+
+    _vertexAllocator.Reset(Utils::GEOMETRY_ARENA_INITIAL_VERTEX_CAPACITY);
+    _indexAllocator.Reset(Utils::GEOMETRY_ARENA_INITIAL_INDEX_CAPACITY);
+    _isCreated = true;
+}
+
+Utils::GeometryHandle GeometryArena::Acquire(Engine::Core &core, const Object::Component::Mesh &mesh)
+{
+    ValidateMesh(mesh);
+    if (!_isCreated)
+        Create(core);
+
+    const uint64_t hash = HashMesh(mesh);
+    const auto counts = MeshCounts(mesh);
+    const auto key = MeshKey(mesh, counts);
+    if (const auto shared = Find(hash, KeyKind::Mesh, key); shared != Utils::INVALID_GEOMETRY_HANDLE)
+    {
+        _entries[shared].refCount++;
+        return shared;
+    }
+
+    const auto allocation = Allocate(core, counts[0], counts[1]);
+    Write(core, allocation, mesh);
+    return Insert(allocation, hash, KeyKind::Mesh, key);
+}
+
+Utils::GeometryHandle GeometryArena::AcquireAsset(Engine::Core &core, entt::id_type asset,
+                                                  const Object::Component::Mesh &mesh)
+{
+    const uint64_t hash = HashAsset(asset);
+    const std::array key = {AsBytes(std::span(&asset, 1))};
+    if (const auto shared = Find(hash, KeyKind::Asset, key); shared != Utils::INVALID_GEOMETRY_HANDLE)
+    {
+        _entries[shared].refCount++;
+        return shared;
+    }
+
+    ValidateMesh(mesh);
+    if (!_isCreated)
+        Create(core);
+
+    const auto counts = MeshCounts(mesh);
+    const auto allocation = Allocate(core, counts[0], counts[1]);
+    Write(core, allocation, mesh);
+    return Insert(allocation, hash, KeyKind::Asset, key);
+}
+
+bool GeometryArena::UpdateAsset(Engine::Core &core, entt::id_type asset, const Object::Component::Mesh &mesh)
+{
+    const std::array key = {AsBytes(std::span(&asset, 1))};
+    const auto handle = Find(HashAsset(asset), KeyKind::Asset, key);
+    if (handle == Utils::INVALID_GEOMETRY_HANDLE)
+        return false;
+
+    ValidateMesh(mesh);
+    const auto vertexCount = static_cast<uint32_t>(mesh.GetVertices().size());
+    const auto indexCount = static_cast<uint32_t>(mesh.GetIndices().size());
+    if (_entries[handle].allocation.vertexCount != vertexCount || _entries[handle].allocation.indexCount != indexCount)
+    {
+        // Allocating may pack the buffers and move the current ranges, which are only freed afterwards.
+        const auto allocation = Allocate(core, vertexCount, indexCount);
+        Free(_entries[handle].allocation);
+        _entries[handle].allocation = allocation;
+        for (auto &entry : _entries)
+        {
+            if (entry.refCount > 0 && entry.parent == handle)
+                entry.allocation.baseVertex = allocation.baseVertex;
+        }
+    }
+
+    Write(core, _entries[handle].allocation, mesh);
+    return true;
+}
+
+Utils::GeometryHandle GeometryArena::Update(Engine::Core &core, Utils::GeometryHandle handle,
+                                            const Object::Component::Mesh &mesh)
+{
+    if (!Contains(handle))
+        return Acquire(core, mesh);
+
+    ValidateMesh(mesh);
+
+    // Shared ranges are never written in place: the other owners keep the old content.
+    if (_entries[handle].refCount > 1)
+    {
+        Release(handle);
+        return Acquire(core, mesh);
+    }
+
+    // Only a few vertices changed: upload them without hashing or repacking the whole mesh. The range is then
+    // private to this mesh and leaves the de-duplication table.
+    if (mesh.IsPartiallyDirty())
+    {
+        auto &entry = _entries[handle];
+        const auto [begin, end] = mesh.GetDirtyVertexRange();
+        if (entry.allocation.vertexCount == mesh.GetVertices().size() && end <= entry.allocation.vertexCount)
+        {
+            Unregister(handle);
+            WriteVertices(core, entry.allocation, mesh, begin, end);
+            return handle;
+        }
+    }
+
+    const uint64_t hash = HashMesh(mesh);
+    const auto counts = MeshCounts(mesh);
+    const auto key = MeshKey(mesh, counts);
+    if (const auto shared = Find(hash, KeyKind::Mesh, key); shared != Utils::INVALID_GEOMETRY_HANDLE)
+    {
+        if (shared == handle)
+            return handle;
+        _entries[shared].refCount++;
+        Release(handle);
+        return shared;
+    }
+
+    auto &entry = _entries[handle];
+    if (entry.allocation.vertexCount != mesh.GetVertices().size() ||
+        entry.allocation.indexCount != mesh.GetIndices().size())
+    {
+        Release(handle);
+        return Acquire(core, mesh);
+    }
+
+    Unregister(handle);
+    Write(core, entry.allocation, mesh);
+    Register(handle, hash, KeyKind::Mesh, key);
+    return handle;
+}
+
+Utils::GeometryHandle GeometryArena::AcquireIndices(Engine::Core &core, Utils::GeometryHandle parent,
+                                                    std::span<const uint32_t> indices)
+{
+    if (!Contains(parent) || _entries[parent].parent != Utils::INVALID_GEOMETRY_HANDLE)
+    {
+        throw Graphic::Exception::UpdateBufferError(
+            fmt::format("GeometryArena: Cannot acquire indices of {}, it is not an acquired mesh.", parent));
+    }
+    const uint32_t vertexCount = _entries[parent].allocation.vertexCount;
+    if (auto it = std::ranges::find_if(indices, [vertexCount](uint32_t index) { return index >= vertexCount; });
+        it != indices.end())
+    {
+        throw Graphic::Exception::UpdateBufferError(fmt::format(
+            "GeometryArena: Index {} is out of the {} vertices of its parent mesh.", *it, vertexCount));
+    }
+
+    const uint64_t hash = HashIndices(parent, indices);
+    // The kind and the parent are compared by Find, the indices alone make the rest of the key.
+    const std::array key = {AsBytes(indices)};
+    if (const auto shared = Find(hash, KeyKind::Indices, key, parent); shared != Utils::INVALID_GEOMETRY_HANDLE)
+    {
+        _entries[shared].refCount++;
+        return shared;
+    }
+
+    auto allocation = Allocate(core, 0, static_cast<uint32_t>(indices.size()));
+    // Allocating may have packed the buffers and moved the parent.
+    allocation.baseVertex = _entries[parent].allocation.baseVertex;
+    GetIndexBuffer(core).Write(core, allocation.firstIndex * sizeof(uint32_t), indices.data(),
+                               indices.size() * sizeof(uint32_t));
+
+    return Insert(allocation, hash, KeyKind::Indices, key, parent);
+}
+
+void GeometryArena::Release(Utils::GeometryHandle handle)
+{
+    if (!Contains(handle))
+        return;
+
+    auto &entry = _entries[handle];
+    if (--entry.refCount > 0)
+        return;
+
+    Unregister(handle);
+    Free(entry.allocation);
+    entry = Entry{};
+    _freeHandles.push_back(handle);
+}
+
+bool GeometryArena::Contains(Utils::GeometryHandle handle) const
+{
+    return handle < _entries.size() && _entries[handle].refCount > 0;
+}
+
+const GeometryArena::Allocation &GeometryArena::Get(Utils::GeometryHandle handle) const
+{
+    return _entries.at(handle).allocation;
+}
+
+uint32_t GeometryArena::GetRefCount(Utils::GeometryHandle handle) const
+{
+    return Contains(handle) ? _entries[handle].refCount : 0;
+}
+
+void GeometryArena::Defragment(Engine::Core &core, uint64_t vertexCapacity, uint64_t indexCapacity)
+{
+    if (!_isCreated)
+        return;
+
+    // Packed ranges are computed aside: the entries only move once the buffers were copied to them.
+    std::vector<Allocation> packed(_entries.size());
+    std::vector<GeometryBuffer::CopyRegion> vertexRegions;
+    std::vector<GeometryBuffer::CopyRegion> indexRegions;
+    uint32_t vertexCursor = 0;
+    uint32_t indexCursor = 0;
+
+    for (size_t handle = 0; handle < _entries.size(); ++handle)
+    {
+        const auto &entry = _entries[handle];
+        if (entry.refCount == 0)
+            continue;
+
+        const auto &allocation = entry.allocation;
+        if (allocation.vertexCount > 0)
+        {
+            vertexRegions.push_back({allocation.baseVertex * Utils::GEOMETRY_VERTEX_STRIDE,
+                                     vertexCursor * Utils::GEOMETRY_VERTEX_STRIDE,
+                                     allocation.vertexCount * Utils::GEOMETRY_VERTEX_STRIDE});
+        }
+        indexRegions.push_back({allocation.firstIndex * sizeof(uint32_t), indexCursor * sizeof(uint32_t),
+                                allocation.indexCount * sizeof(uint32_t)});
+        packed[handle] = allocation;
+        packed[handle].baseVertex = vertexCursor;
+        packed[handle].firstIndex = indexCursor;
+        vertexCursor += allocation.vertexCount;
+        indexCursor += allocation.indexCount;
+    }
+
+    if (vertexCursor > vertexCapacity || indexCursor > indexCapacity)
+    {
+        throw Graphic::Exception::UpdateBufferError(
+            fmt::format("GeometryArena: Cannot pack {} vertices and {} indices into {} vertices and {} indices.",
+                        vertexCursor, indexCursor, vertexCapacity, indexCapacity));
+    }
+
+    GetVertexBuffer(core).Reallocate(core, vertexCapacity * Utils::GEOMETRY_VERTEX_STRIDE, vertexRegions);
+    GetIndexBuffer(core).Reallocate(core, indexCapacity * sizeof(uint32_t), indexRegions);
+
+    for (size_t handle = 0; handle < _entries.size(); ++handle)
+    {
+        auto &entry = _entries[handle];
+        if (entry.refCount == 0)
+            continue;
+        entry.allocation = packed[handle];
+        // Index sets follow the vertices of their parent, which may have moved after them.
+        if (entry.parent != Utils::INVALID_GEOMETRY_HANDLE)
+            entry.allocation.baseVertex = packed[entry.parent].baseVertex;
+    }
+
+    // Every live range now sits in the packed prefix, which is reserved in one go.
+    _vertexAllocator.Reset(vertexCapacity);
+    _indexAllocator.Reset(indexCapacity);
+    (void) _vertexAllocator.Allocate(vertexCursor);
+    (void) _indexAllocator.Allocate(indexCursor);
+}
+
+void GeometryArena::Defragment(Engine::Core &core)
+{
+    Defragment(core, _vertexAllocator.GetCapacity(), _indexAllocator.GetCapacity());
+}
+
+void GeometryArena::Bind(wgpu::RenderPassEncoder &renderPass, Engine::Core &core) const
+{
+    const auto &vertexBuffer = GetVertexBuffer(core).GetBuffer();
+    const auto &indexBuffer = GetIndexBuffer(core).GetBuffer();
+    renderPass.setVertexBuffer(0, vertexBuffer, 0, vertexBuffer.getSize());
+    renderPass.setIndexBuffer(indexBuffer, wgpu::IndexFormat::Uint32, 0, indexBuffer.getSize());
+}
+
+GeometryBuffer &GeometryArena::GetVertexBuffer(Engine::Core &core) const
+{
+    auto &bufferContainer = core.GetResource<Graphic::Resource::GPUBufferContainer>();
+    auto buffer = dynamic_cast<GeometryBuffer *>(bufferContainer.Get(Utils::GEOMETRY_ARENA_VERTEX_BUFFER_ID).get());
+    if (!buffer)
+    {
+        throw Graphic::Exception::UpdateBufferError("Failed to cast AGPUBuffer to GeometryBuffer.");
+    }
+    return *buffer;
+}
+
+GeometryBuffer &GeometryArena::GetIndexBuffer(Engine::Core &core) const
+{
+    auto &bufferContainer = core.GetResource<Graphic::Resource::GPUBufferContainer>();
+    auto buffer = dynamic_cast<GeometryBuffer *>(bufferContainer.Get(Utils::GEOMETRY_ARENA_INDEX_BUFFER_ID).get());
+    if (!buffer)
+    {
+        throw Graphic::Exception::UpdateBufferError("Failed to cast AGPUBuffer to GeometryBuffer.");
+    }
+    return *buffer;
+}
+
+GeometryArena::Allocation GeometryArena::Allocate(Engine::Core &core, uint32_t vertexCount, uint32_t indexCount)
+{
+    auto vertexOffset = _vertexAllocator.Allocate(vertexCount);
+    auto indexOffset = _indexAllocator.Allocate(indexCount);
+
+    if (!vertexOffset.has_value() || !indexOffset.has_value())
+    {
+        if (vertexOffset.has_value())
+            _vertexAllocator.Free(vertexOffset.value(), vertexCount);
+        if (indexOffset.has_value())
+            _indexAllocator.Free(indexOffset.value(), indexCount);
+
+        // Packing alone is enough when the free space is only fragmented, otherwise the buffers are doubled.
+        uint64_t vertexCapacity = std::max<uint64_t>(_vertexAllocator.GetCapacity(), 1);
+        while (vertexCapacity < _vertexAllocator.GetUsedSize() + vertexCount)
+            vertexCapacity *= 2;
+        uint64_t indexCapacity = std::max<uint64_t>(_indexAllocator.GetCapacity(), 1);
+        while (indexCapacity < _indexAllocator.GetUsedSize() + indexCount)
+            indexCapacity *= 2;
+
+        Defragment(core, vertexCapacity, indexCapacity);
+
+        vertexOffset = _vertexAllocator.Allocate(vertexCount);
+        indexOffset = _indexAllocator.Allocate(indexCount);
+        if (!vertexOffset.has_value() || !indexOffset.has_value())
+        {
+            throw Graphic::Exception::UpdateBufferError(
+                fmt::format("GeometryArena: Failed to allocate {} vertices and {} indices.", vertexCount, indexCount));
+        }
+    }
+
+    return Allocation{.baseVertex = static_cast<uint32_t>(vertexOffset.value()),
+                      .vertexCount = vertexCount,
+                      .firstIndex = static_cast<uint32_t>(indexOffset.value()),
+                      .indexCount = indexCount};
+}
+
+void GeometryArena::Free(const Allocation &allocation)
+{
+    _vertexAllocator.Free(allocation.baseVertex, allocation.vertexCount);
+    _indexAllocator.Free(allocation.firstIndex, allocation.indexCount);
+}
+
+void GeometryArena::Write(Engine::Core &core, const Allocation &allocation, const Object::Component::Mesh &mesh)
+{
+    WriteVertices(core, allocation, mesh, 0, mesh.GetVertices().size());
+    GetIndexBuffer(core).Write(core, allocation.firstIndex * sizeof(uint32_t), mesh.GetIndices().data(),
+                               mesh.GetIndices().size() * sizeof(uint32_t));
+}
+
+void GeometryArena::WriteVertices(Engine::Core &core, const Allocation &allocation,
+                                  const Object::Component::Mesh &mesh, size_t begin, size_t end)
+{
+    if (begin >= end)
+        return;
+
+    const size_t count = end - begin;
+    if (_staging.size() < count * Utils::GEOMETRY_VERTEX_FLOATS)
+        _staging.resize(count * Utils::GEOMETRY_VERTEX_FLOATS);
+
+    Utils::InterleaveVertices(_staging.data(), mesh.GetVertices().data() + begin, mesh.GetNormals().data() + begin,
+                              mesh.GetTexCoords().data() + begin, count);
+
+    GetVertexBuffer(core).Write(core, (allocation.baseVertex + begin) * Utils::GEOMETRY_VERTEX_STRIDE, _staging.data(),
+                                count * Utils::GEOMETRY_VERTEX_STRIDE);
+}
+
+Utils::GeometryHandle GeometryArena::Insert(const Allocation &allocation, uint64_t hash, KeyKind kind, KeyParts key,
+                                            Utils::GeometryHandle parent)
+{
+    Utils::GeometryHandle handle;
+    if (!_freeHandles.empty())
+    {
+        handle = _freeHandles.back();
+        _freeHandles.pop_back();
+    }
+    else
+    {
+        handle = static_cast<Utils::GeometryHandle>(_entries.size());
+        _entries.emplace_back();
+    }
+    _entries[handle] = Entry{.allocation = allocation, .refCount = 1, .parent = parent};
+    Register(handle, hash, kind, key);
+    return handle;
+}
+
+Utils::GeometryHandle GeometryArena::Find(uint64_t hash, KeyKind kind, KeyParts key, Utils::GeometryHandle parent) const
+{
+    const auto [begin, end] = _handlesByHash.equal_range(hash);
+    for (auto it = begin; it != end; ++it)
+    {
+        const auto &entry = _entries[it->second];
+        if (entry.kind == kind && entry.parent == parent && KeyEquals(entry.key, key))
+            return it->second;
+    }
+    return Utils::INVALID_GEOMETRY_HANDLE;
+}
+
+void GeometryArena::Register(Utils::GeometryHandle handle, uint64_t hash, KeyKind kind, KeyParts key)
+{
+    auto &entry = _entries[handle];
+    entry.hash = hash;
+    entry.kind = kind;
+    entry.key.clear();
+    for (const auto &part : key)
+        entry.key.insert(entry.key.end(), part.begin(), part.end());
+    _handlesByHash.emplace(hash, handle);
+}
+
+void GeometryArena::Unregister(Utils::GeometryHandle handle)
+{
+    auto &entry = _entries[handle];
+    const auto [begin, end] = _handlesByHash.equal_range(entry.hash);
+    for (auto it = begin; it != end; ++it)
+    {
+        if (it->second == handle)
+        {
+            _handlesByHash.erase(it);
+            break;
+        }
+    }
+    // Private ranges are never looked up again, their key is only memory.
+    entry.key = {};
+}
+
+uint64_t GeometryArena::HashMesh(const Object::Component::Mesh &mesh)
+{
+    auto hashBytes = [](const auto &container) {
+        return std::hash<std::string_view>{}(std::string_view(reinterpret_cast<const char *>(container.data()),
+                                                              container.size() * sizeof(container[0])));
+    };
+
+    uint64_t hash = mesh.GetVertices().size() ^ (static_cast<uint64_t>(mesh.GetIndices().size()) << 32);
+    for (uint64_t part : {hashBytes(mesh.GetVertices()), hashBytes(mesh.GetNormals()), hashBytes(mesh.GetTexCoords()),
+                          hashBytes(mesh.GetIndices())})
+    {
+        hash ^= part + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
+uint64_t GeometryArena::HashAsset(entt::id_type asset)
+{
+    // Mixed differently from HashMesh so that an asset never collides with a mesh by construction.
+    uint64_t hash = static_cast<uint64_t>(asset) ^ 0x4153534554ULL;
+    hash ^= 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+uint64_t GeometryArena::HashIndices(Utils::GeometryHandle parent, std::span<const uint32_t> indices)
+{
+    // Mixed differently from HashMesh so that an index set never collides with a mesh by construction.
+    uint64_t hash = (static_cast<uint64_t>(parent) << 32) ^ indices.size() ^ 0x4c4f44ULL;
+    const auto part = std::hash<std::string_view>{}(
+        std::string_view(reinterpret_cast<const char *>(indices.data()), indices.size() * sizeof(uint32_t)));
+    hash ^= part + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+void GeometryArena::ValidateMesh(const Object::Component::Mesh &mesh)
+{
+    const auto &vertices = mesh.GetVertices();
+
+    if (vertices.empty())
+    {
+        throw Graphic::Exception::UpdateBufferError("Cannot upload a Mesh component with no vertices.");
+    }
+    if (mesh.GetNormals().size() != vertices.size() || mesh.GetTexCoords().size() != vertices.size())
+    {
+        throw Graphic::Exception::UpdateBufferError(
+            "Cannot upload a Mesh component: normals or texCoords size mismatch with vertices.");
+    }
+}
+
+} // namespace DefaultPipeline::Resource
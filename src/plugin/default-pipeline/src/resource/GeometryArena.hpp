@@ -0,0 +1,161 @@
+#pragma once
+
+#include "component/Mesh.hpp"
+#include "core/Core.hpp"
+#include "utils/GeometryArena.hpp"
+#include "utils/RangeAllocator.hpp"
+#include "utils/webgpu.hpp"
+#include <cstddef>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace DefaultPipeline::Resource {
+class GeometryBuffer;
+
+/**
+ * @brief Owns one large vertex buffer and one large index buffer shared by every mesh of the pipeline.
+ *
+ * Each mesh gets a sub-range of both buffers and is drawn with baseVertex / firstIndex, so passes bind the geometry
+ * once instead of once per entity. Meshes with the same content share the same ranges (reference counted); updating
+ * a shared mesh gives it its own copy first. When the buffers are full, live ranges are packed into bigger buffers.
+ *
+ * Index sets can also be acquired on top of an uploaded mesh (e.g. its levels of detail): they only own an index range
+ * and draw the vertices of their parent.
+ */
+class GeometryArena {
+  public:
+    struct Allocation {
+        uint32_t baseVertex = 0;
+        uint32_t vertexCount = 0;
+        uint32_t firstIndex = 0;
+        uint32_t indexCount = 0;
+    };
+
+    GeometryArena() = default;
+    ~GeometryArena() = default;
+
+    void Create(Engine::Core &core);
+    [[nodiscard]] bool IsCreated() const { return _isCreated; }
+
+    /**
+     * @brief Upload a mesh, or share the ranges of an already uploaded mesh with the same content.
+     */
+    [[nodiscard]] Utils::GeometryHandle Acquire(Engine::Core &core, const Object::Component::Mesh &mesh);
+
+    /**
+     * @brief Upload an immutable mesh asset (see Object::Component::MeshHandle), or share its ranges if it is already
+     * uploaded.
+     *
+     * Assets are identified by their id rather than by their content, so sharing them costs no hashing of the mesh.
+     */
+    [[nodiscard]] Utils::GeometryHandle AcquireAsset(Engine::Core &core, entt::id_type asset,
+                                                     const Object::Component::Mesh &mesh);
+
+    /**
+     * @brief Re-upload a mesh asset whose data was replaced (see Object::Utils::ReplaceMeshAsset), keeping its handle.
+     *
+     * The ranges are written in place when the size did not change, otherwise they are reallocated. Index sets
+     * acquired on top of the asset follow its vertices, but still hold the old indices: they should be released.
+     *
+     * @return false if the asset is not uploaded, in which case nothing is done.
+     */
+    bool UpdateAsset(Engine::Core &core, entt::id_type asset, const Object::Component::Mesh &mesh);
+
+    /**
+     * @brief Re-upload a mesh whose content changed.
+     *
+     * If the mesh is only partially dirty (see Mesh::GetDirtyVertexRange) and its ranges are not shared, only the
+     * dirty vertices are packed and uploaded.
+     *
+     * @return the handle to use from now on, which differs from the given one if the ranges had to change (shared
+     * ranges, size change or content now matching another mesh).
+     */
+    [[nodiscard]] Utils::GeometryHandle Update(Engine::Core &core, Utils::GeometryHandle handle,
+                                               const Object::Component::Mesh &mesh);
+
+    /**
+     * @brief Upload another index set drawing the vertices of an acquired mesh, or share an identical one.
+     *
+     * The returned ranges have no vertex of their own: their baseVertex follows the parent mesh. They must be released
+     * before the parent, and acquired again if the parent handle changes after an Update.
+     *
+     * @throw Graphic::Exception::UpdateBufferError if the parent is not acquired or an index is out of its vertices.
+     */
+    [[nodiscard]] Utils::GeometryHandle AcquireIndices(Engine::Core &core, Utils::GeometryHandle parent,
+                                                       std::span<const uint32_t> indices);
+
+    void Release(Utils::GeometryHandle handle);
+
+    [[nodiscard]] bool Contains(Utils::GeometryHandle handle) const;
+    [[nodiscard]] const Allocation &Get(Utils::GeometryHandle handle) const;
+    [[nodiscard]] uint32_t GetRefCount(Utils::GeometryHandle handle) const;
+
+    /**
+     * @brief Pack every live range at the start of the buffers, reallocating them with the given capacities.
+     *
+     * @throw Graphic::Exception::UpdateBufferError if the live ranges do not fit, leaving every range untouched.
+     */
+    void Defragment(Engine::Core &core, uint64_t vertexCapacity, uint64_t indexCapacity);
+    void Defragment(Engine::Core &core);
+
+    /**
+     * @brief Bind the shared vertex and index buffers, to be called once before the draws of a pass.
+     */
+    void Bind(wgpu::RenderPassEncoder &renderPass, Engine::Core &core) const;
+
+  private:
+    /** @brief What identifies a shared entry: its content for meshes and index sets, its id for assets. */
+    enum class KeyKind : uint8_t {
+        Mesh,
+        Asset,
+        Indices,
+    };
+
+    struct Entry {
+        Allocation allocation;
+        uint64_t hash = 0;
+        uint32_t refCount = 0;
+        /** @brief Mesh whose vertices are drawn, for index sets acquired with AcquireIndices. */
+        Utils::GeometryHandle parent = Utils::INVALID_GEOMETRY_HANDLE;
+        KeyKind kind = KeyKind::Mesh;
+        /** @brief Bytes compared on a hash hit, so that two contents with the same hash are never shared. Empty once
+         * the entry left the de-duplication table. */
+        std::vector<std::byte> key;
+    };
+
+    /** @brief Key split into the spans it is made of, so that a lookup copies nothing. */
+    using KeyParts = std::span<const std::span<const std::byte>>;
+
+    GeometryBuffer &GetVertexBuffer(Engine::Core &core) const;
+    GeometryBuffer &GetIndexBuffer(Engine::Core &core) const;
+
+    Allocation Allocate(Engine::Core &core, uint32_t vertexCount, uint32_t indexCount);
+    void Free(const Allocation &allocation);
+    void Write(Engine::Core &core, const Allocation &allocation, const Object::Component::Mesh &mesh);
+    void WriteVertices(Engine::Core &core, const Allocation &allocation, const Object::Component::Mesh &mesh,
+                       size_t begin, size_t end);
+    Utils::GeometryHandle Insert(const Allocation &allocation, uint64_t hash, KeyKind kind, KeyParts key,
+                                 Utils::GeometryHandle parent = Utils::INVALID_GEOMETRY_HANDLE);
+    /** @brief Shared entry with the same hash, kind and key, or INVALID_GEOMETRY_HANDLE. */
+    [[nodiscard]] Utils::GeometryHandle Find(uint64_t hash, KeyKind kind, KeyParts key,
+                                             Utils::GeometryHandle parent = Utils::INVALID_GEOMETRY_HANDLE) const;
+    void Register(Utils::GeometryHandle handle, uint64_t hash, KeyKind kind, KeyParts key);
+    void Unregister(Utils::GeometryHandle handle);
+
+    static uint64_t HashMesh(const Object::Component::Mesh &mesh);
+    static uint64_t HashAsset(entt::id_type asset);
+    static uint64_t HashIndices(Utils::GeometryHandle parent, std::span<const uint32_t> indices);
+    static void ValidateMesh(const Object::Component::Mesh &mesh);
+
+    std::vector<Entry> _entries;
+    std::vector<Utils::GeometryHandle> _freeHandles;
+    /** @brief Several entries can share a hash, they are told apart by their key. */
+    std::unordered_multimap<uint64_t, Utils::GeometryHandle> _handlesByHash;
+    Graphic::Utils::RangeAllocator _vertexAllocator;
+    Graphic::Utils::RangeAllocator _indexAllocator;
+    /** @brief Interleaved upload scratch, kept between updates so re-uploading a mesh does not allocate. */
+    std::vector<float> _staging;
+    bool _isCreated = false;
+};
+} // namespace DefaultPipeline::Resource
@@ -0,0 +1,230 @@
+#include "MaterialAtlas.hpp"
+#include "Logger.hpp"
+#include "resource/DeviceContext.hpp"
+#include "resource/Queue.hpp"
+#include "resource/TextureContainer.hpp"
+#include "resource/TextureViewContainer.hpp"
+#include "utils/EmptyTexture.hpp"
+#include <algorithm>
+
+namespace DefaultPipeline::Resource {
+
+void MaterialAtlas::Create(Engine::Core &core)
+{
+    if (_isCreated)
+        return;
+
+    Reallocate(core, 1);
+    _isCreated = true;
+}
+
+std::optional<MaterialAtlas::Region> MaterialAtlas::Acquire(Engine::Core &core, const entt::hashed_string &textureId)
+{
+    if (!_isCreated)
+        Create(core);
+
+    auto &textureContainer = core.GetResource<Graphic::Resource::TextureContainer>();
+    const entt::hashed_string &sourceId =
+        textureContainer.Contains(textureId) ? textureId : Graphic::Utils::EMPTY_TEXTURE_ID;
+
+    if (auto it = _entries.find(sourceId.value()); it != _entries.end())
+    {
+        it->second.refCount++;
+        return ToRegion(it->second, it->first);
+    }
+    if (!textureContainer.Contains(sourceId))
+        return std::nullopt;
+
+    const auto &source = textureContainer.Get(sourceId).GetWebGPUTexture();
+    if (source.getFormat() != FORMAT || (source.getUsage() & wgpu::TextureUsage::CopySrc) == 0 ||
+        source.getDepthOrArrayLayers() != 1)
+        return std::nullopt;
+
+    // Textures larger than a page are packed from their first mip level that fits.
+    uint32_t mipLevel = 0;
+    auto levelSize = [&source](uint32_t level) {
+        return std::max(std::max(source.getWidth(), source.getHeight()) >> level, 1u);
+    };
+    while (levelSize(mipLevel) > Utils::MATERIAL_ATLAS_PAGE_SIZE && mipLevel + 1 < source.getMipLevelCount())
+        ++mipLevel;
+    if (levelSize(mipLevel) > Utils::MATERIAL_ATLAS_PAGE_SIZE)
+        return std::nullopt;
+
+    const uint32_t width = std::max(source.getWidth() >> mipLevel, 1u);
+    const uint32_t height = std::max(source.getHeight() >> mipLevel, 1u);
+    auto align = [](uint32_t size) {
+        return (size + Utils::MATERIAL_ATLAS_TILE_ALIGNMENT - 1) / Utils::MATERIAL_ATLAS_TILE_ALIGNMENT *
+               Utils::MATERIAL_ATLAS_TILE_ALIGNMENT;
+    };
+    const auto placement = Allocate(core, align(width), align(height));
+    if (!placement.has_value())
+        return std::nullopt;
+
+    const auto &[page, rect] = placement.value();
+    const Entry entry{.rect = rect,
+                      .width = width,
+                      .height = height,
+                      .page = page,
+                      .mipLevels = std::min(Utils::MATERIAL_ATLAS_MIP_LEVELS, source.getMipLevelCount() - mipLevel),
+                      .refCount = 1};
+    Copy(core, source, mipLevel, entry);
+
+    const auto &inserted = _entries.emplace(sourceId.value(), entry).first;
+    return ToRegion(inserted->second, inserted->first);
+}
+
+void MaterialAtlas::Release(entt::id_type texture)
+{
+    auto it = _entries.find(texture);
+    if (it == _entries.end() || --it->second.refCount > 0)
+        return;
+
+    _pages[it->second.page].Free(it->second.rect);
+    _entries.erase(it);
+}
+
+uint32_t MaterialAtlas::GetRefCount(entt::id_type texture) const
+{
+    auto it = _entries.find(texture);
+    return it != _entries.end() ? it->second.refCount : 0;
+}
+
+std::optional<std::pair<uint32_t, Utils::AtlasRect>> MaterialAtlas::Allocate(Engine::Core &core, uint32_t width,
+                                                                             uint32_t height)
+{
+    for (uint32_t page = 0; page < _pages.size(); ++page)
+    {
+        if (auto rect = _pages[page].Allocate(width, height); rect.has_value())
+            return std::make_pair(page, rect.value());
+    }
+
+    if (_pages.size() >= Utils::MATERIAL_ATLAS_MAX_PAGES)
+    {
+        Log::Warning(fmt::format("MaterialAtlas: All {} pages are full, a {}x{} texture is left out of the atlas.",
+                                 Utils::MATERIAL_ATLAS_MAX_PAGES, width, height));
+        return std::nullopt;
+    }
+
+    const uint32_t page = GetPageCount();
+    Reallocate(core, page + 1);
+    if (auto rect = _pages[page].Allocate(width, height); rect.has_value())
+        return std::make_pair(page, rect.value());
+    return std::nullopt;
+}
+
+void MaterialAtlas::Reallocate(Engine::Core &core, uint32_t pageCount)
+{
+    const auto &deviceContext = core.GetResource<Graphic::Resource::DeviceContext>();
+    auto &queue = core.GetResource<Graphic::Resource::Queue>();
+    auto &textureContainer = core.GetResource<Graphic::Resource::TextureContainer>();
+    auto &textureViewContainer = core.GetResource<Graphic::Resource::TextureViewContainer>();
+
+    wgpu::TextureDescriptor textureDesc(wgpu::Default);
+    textureDesc.label = wgpu::StringView(Utils::MATERIAL_ATLAS_TEXTURE_NAME);
+    textureDesc.size = {Utils::MATERIAL_ATLAS_PAGE_SIZE, Utils::MATERIAL_ATLAS_PAGE_SIZE, pageCount};
+    textureDesc.dimension = wgpu::TextureDimension::_2D;
+    textureDesc.mipLevelCount = Utils::MATERIAL_ATLAS_MIP_LEVELS;
+    textureDesc.sampleCount = 1;
+    textureDesc.format = FORMAT;
+    textureDesc.usage =
+        wgpu::TextureUsage::TextureBinding | wgpu::TextureUsage::CopySrc | wgpu::TextureUsage::CopyDst;
+    textureDesc.viewFormats = nullptr;
+    textureDesc.viewFormatCount = 0;
+    Graphic::Resource::Texture texture(deviceContext, textureDesc);
+
+    const uint32_t keptPages = std::min(pageCount, GetPageCount());
+    if (keptPages > 0 && textureContainer.Contains(Utils::MATERIAL_ATLAS_TEXTURE_ID))
+    {
+        wgpu::CommandEncoderDescriptor encoderDesc(wgpu::Default);
+        encoderDesc.label = wgpu::StringView("MaterialAtlas::Reallocate");
+        wgpu::CommandEncoder encoder = deviceContext.GetDevice()->createCommandEncoder(encoderDesc);
+
+        for (uint32_t level = 0; level < Utils::MATERIAL_ATLAS_MIP_LEVELS; ++level)
+        {
+            wgpu::TexelCopyTextureInfo source(wgpu::Default);
+            source.texture = textureContainer.Get(Utils::MATERIAL_ATLAS_TEXTURE_ID).GetWebGPUTexture();
+            source.mipLevel = level;
+            source.origin = {0, 0, 0};
+            source.aspect = wgpu::TextureAspect::All;
+            wgpu::TexelCopyTextureInfo destination = source;
+            destination.texture = texture.GetWebGPUTexture();
+            const uint32_t levelSize = Utils::MATERIAL_ATLAS_PAGE_SIZE >> level;
+            encoder.copyTextureToTexture(source, destination, wgpu::Extent3D(levelSize, levelSize, keptPages));
+        }
+
+        auto commandBuffer = encoder.finish();
+        encoder.release();
+        queue->submit(1, &commandBuffer);
+        commandBuffer.release();
+    }
+
+    // Layers are only sampled through this view: the default view of a single layer texture is not an array.
+    wgpu::TextureViewDescriptor viewDesc(wgpu::Default);
+    viewDesc.label = wgpu::StringView(Utils::MATERIAL_ATLAS_VIEW_NAME);
+    viewDesc.format = FORMAT;
+    viewDesc.dimension = wgpu::TextureViewDimension::_2DArray;
+    viewDesc.baseMipLevel = 0;
+    viewDesc.mipLevelCount = Utils::MATERIAL_ATLAS_MIP_LEVELS;
+    viewDesc.baseArrayLayer = 0;
+    viewDesc.arrayLayerCount = pageCount;
+    viewDesc.aspect = wgpu::TextureAspect::All;
+    auto view = texture.CreateView(viewDesc);
+
+    if (textureViewContainer.Contains(Utils::MATERIAL_ATLAS_VIEW_ID))
+        textureViewContainer.Remove(Utils::MATERIAL_ATLAS_VIEW_ID);
+    textureViewContainer.Add(Utils::MATERIAL_ATLAS_VIEW_ID, std::move(view));
+    if (textureContainer.Contains(Utils::MATERIAL_ATLAS_TEXTURE_ID))
+        textureContainer.Remove(Utils::MATERIAL_ATLAS_TEXTURE_ID);
+    textureContainer.Add(Utils::MATERIAL_ATLAS_TEXTURE_ID, std::move(texture));
+
+    _pages.resize(pageCount, Utils::ShelfPacker(Utils::MATERIAL_ATLAS_PAGE_SIZE));
+    ++_version;
+}
+
+void MaterialAtlas::Copy(Engine::Core &core, const wgpu::Texture &source, uint32_t mipLevel, const Entry &entry) const
+{
+    const auto &deviceContext = core.GetResource<Graphic::Resource::DeviceContext>();
+    auto &queue = core.GetResource<Graphic::Resource::Queue>();
+    const auto &atlas = core.GetResource<Graphic::Resource::TextureContainer>().Get(Utils::MATERIAL_ATLAS_TEXTURE_ID);
+
+    wgpu::CommandEncoderDescriptor encoderDesc(wgpu::Default);
+    encoderDesc.label = wgpu::StringView("MaterialAtlas::Copy");
+    wgpu::CommandEncoder encoder = deviceContext.GetDevice()->createCommandEncoder(encoderDesc);
+
+    // The rectangle is aligned on 2^(levels - 1) texels: each level of the source lands on whole texels of the atlas.
+    for (uint32_t level = 0; level < entry.mipLevels; ++level)
+    {
+        wgpu::TexelCopyTextureInfo sourceInfo(wgpu::Default);
+        sourceInfo.texture = source;
+        sourceInfo.mipLevel = mipLevel + level;
+        sourceInfo.origin = {0, 0, 0};
+        sourceInfo.aspect = wgpu::TextureAspect::All;
+        wgpu::TexelCopyTextureInfo destinationInfo(wgpu::Default);
+        destinationInfo.texture = atlas.GetWebGPUTexture();
+        destinationInfo.mipLevel = level;
+        destinationInfo.origin = {entry.rect.x >> level, entry.rect.y >> level, entry.page};
+        destinationInfo.aspect = wgpu::TextureAspect::All;
+        encoder.copyTextureToTexture(
+            sourceInfo, destinationInfo,
+            wgpu::Extent3D(std::max(entry.width >> level, 1u), std::max(entry.height >> level, 1u), 1));
+    }
+
+    auto commandBuffer = encoder.finish();
+    encoder.release();
+    queue->submit(1, &commandBuffer);
+    commandBuffer.release();
+}
+
+MaterialAtlas::Region MaterialAtlas::ToRegion(const Entry &entry, entt::id_type texture)
+{
+    constexpr float pageSize = static_cast<float>(Utils::MATERIAL_ATLAS_PAGE_SIZE);
+    return Region{.uvRect = glm::vec4(static_cast<float>(entry.rect.x) / pageSize,
+                                      static_cast<float>(entry.rect.y) / pageSize,
+                                      static_cast<float>(entry.width) / pageSize,
+                                      static_cast<float>(entry.height) / pageSize),
+                  .layer = entry.page,
+                  .maxLod = static_cast<float>(entry.mipLevels - 1),
+                  .texture = texture};
+}
+
+} // namespace DefaultPipeline::Resource
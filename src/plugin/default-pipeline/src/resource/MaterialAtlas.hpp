@@ -0,0 +1,92 @@
+#pragma once
+
+#include "core/Core.hpp"
+#include "utils/MaterialAtlas.hpp"
+#include "utils/ShelfPacker.hpp"
+#include "utils/webgpu.hpp"
+#include <entt/core/hashed_string.hpp>
+#include <glm/vec4.hpp>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace DefaultPipeline::Resource {
+
+/**
+ * @brief Packs the textures of the materials into the pages of one 2D texture array.
+ *
+ * Textures are copied on the GPU into a free rectangle of a page, so every material samples the same texture and
+ * draws can share one material bind group. A texture used by several materials is copied once (reference counted).
+ * Textures larger than a page are copied from their first mip level that fits. The array gains pages as needed, up
+ * to MATERIAL_ATLAS_MAX_PAGES, its texture and view are then replaced and GetVersion changes.
+ *
+ * The atlas has MATERIAL_ATLAS_MIP_LEVELS mip levels. After a texture is packed, its own mip levels are copied into
+ * the matching levels of its rectangle, so minification never averages neighbouring textures together. Rectangles
+ * are padded to MATERIAL_ATLAS_TILE_ALIGNMENT texels, and shaders clamp both the UVs inside the rectangle and the LOD
+ * to the levels copied for the texture (Region::maxLod): a texture without a mip chain is only sampled at level 0.
+ */
+class MaterialAtlas {
+  public:
+    struct Region {
+        /** @brief Offset (xy) and scale (zw) mapping the UVs of the texture to the UVs of its page. */
+        glm::vec4 uvRect{0.0f, 0.0f, 1.0f, 1.0f};
+        uint32_t layer = 0;
+        /** @brief Last mip level of the atlas holding a copy of the texture. */
+        float maxLod = 0.0f;
+        /** @brief Id of the texture the region was copied from, to give to Release. */
+        entt::id_type texture = 0;
+    };
+
+    MaterialAtlas() = default;
+    ~MaterialAtlas() = default;
+
+    void Create(Engine::Core &core);
+    [[nodiscard]] bool IsCreated() const { return _isCreated; }
+
+    /**
+     * @brief Copy a texture of the TextureContainer into the atlas, or share the region of a texture already copied.
+     *
+     * Unknown ids resolve to the empty texture, like bind groups do.
+     *
+     * @return the region of the texture, or std::nullopt if it cannot be packed: format other than RGBA8UnormSrgb
+     * (e.g. block-compressed textures), too large without a fitting mip level, or atlas full.
+     */
+    [[nodiscard]] std::optional<Region> Acquire(Engine::Core &core, const entt::hashed_string &textureId);
+
+    void Release(entt::id_type texture);
+
+    [[nodiscard]] bool Contains(entt::id_type texture) const { return _entries.contains(texture); }
+    [[nodiscard]] uint32_t GetRefCount(entt::id_type texture) const;
+    [[nodiscard]] uint32_t GetPageCount() const { return static_cast<uint32_t>(_pages.size()); }
+    /** @brief Changes every time the atlas texture is replaced, bind groups using it must then be refreshed. */
+    [[nodiscard]] uint64_t GetVersion() const { return _version; }
+
+    static inline const wgpu::TextureFormat FORMAT = wgpu::TextureFormat::RGBA8UnormSrgb;
+
+  private:
+    struct Entry {
+        /** @brief Rectangle allocated in the page, padded to MATERIAL_ATLAS_TILE_ALIGNMENT. */
+        Utils::AtlasRect rect;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint32_t page = 0;
+        uint32_t mipLevels = 1;
+        uint32_t refCount = 0;
+    };
+
+    /** @brief Find room for a rectangle, adding a page if the existing ones are full. */
+    std::optional<std::pair<uint32_t, Utils::AtlasRect>> Allocate(Engine::Core &core, uint32_t width,
+                                                                  uint32_t height);
+    /** @brief Replace the atlas texture by one of the given page count, keeping the content of the current pages. */
+    void Reallocate(Engine::Core &core, uint32_t pageCount);
+    /** @brief Copy the mip levels of the source, from mipLevel, into the levels of the entry rectangle. */
+    void Copy(Engine::Core &core, const wgpu::Texture &source, uint32_t mipLevel, const Entry &entry) const;
+
+    static Region ToRegion(const Entry &entry, entt::id_type texture);
+
+    std::unordered_map<entt::id_type, Entry> _entries;
+    std::vector<Utils::ShelfPacker> _pages;
+    uint64_t _version = 0;
+    bool _isCreated = false;
+};
+} // namespace DefaultPipeline::Resource
@@ -0,0 +1,208 @@
+#include "MaterialTable.hpp"
+#include "exception/UpdateBufferError.hpp"
+#include "resource/BindGroup.hpp"
+#include "resource/BindGroupManager.hpp"
+#include "resource/GPUBufferContainer.hpp"
+#include "resource/ShaderContainer.hpp"
+#include "resource/buffer/GeometryBuffer.hpp"
+#include "resource/pass/GBuffer.hpp"
+#include "utils/SharedSampler.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace DefaultPipeline::Resource {
+
+static wgpu::SamplerDescriptor CreateAtlasSamplerDescriptor()
+{
+    wgpu::SamplerDescriptor samplerDesc(wgpu::Default);
+    samplerDesc.maxAnisotropy = 1;
+    samplerDesc.magFilter = wgpu::FilterMode::Linear;
+    samplerDesc.minFilter = wgpu::FilterMode::Linear;
+    samplerDesc.mipmapFilter = wgpu::MipmapFilterMode::Linear;
+    samplerDesc.addressModeU = wgpu::AddressMode::ClampToEdge;
+    samplerDesc.addressModeV = wgpu::AddressMode::ClampToEdge;
+    samplerDesc.addressModeW = wgpu::AddressMode::ClampToEdge;
+    return samplerDesc;
+}
+
+void MaterialTable::Create(Engine::Core &core)
+{
+    if (_isCreated)
+        return;
+
+    auto buffer = std::make_unique<GeometryBuffer>(Utils::MATERIAL_TABLE_BUFFER_NAME, wgpu::BufferUsage::Storage,
+                                                   Utils::MATERIAL_TABLE_INITIAL_CAPACITY *
+                                                       uint64_t{MaterialTransfer::GPUSize()});
+    buffer->Create(core);
+    core.GetResource<Graphic::Resource::GPUBufferContainer>().Add(Utils::MATERIAL_TABLE_BUFFER_ID, std::move(buffer));
+    _capacity = Utils::MATERIAL_TABLE_INITIAL_CAPACITY;
+    _isCreated = true;
+    ReserveDefaultSlot();
+}
+
+Utils::MaterialSlot MaterialTable::Allocate()
+{
+    ReserveDefaultSlot();
+
+    Utils::MaterialSlot slot;
+    if (!_freeSlots.empty())
+    {
+        slot = _freeSlots.back();
+        _freeSlots.pop_back();
+    }
+    else
+    {
+        slot = static_cast<Utils::MaterialSlot>(_materials.size());
+        _materials.emplace_back();
+        _used.push_back(false);
+    }
+    _materials[slot] = MaterialTransfer{};
+    _used[slot] = true;
+    MarkDirty(slot);
+    return slot;
+}
+
+void MaterialTable::Free(Utils::MaterialSlot slot)
+{
+    // The default material lives as long as the table.
+    if (!Contains(slot) || slot == Utils::DEFAULT_MATERIAL_SLOT)
+        return;
+
+    _used[slot] = false;
+    _freeSlots.push_back(slot);
+}
+
+void MaterialTable::SetMaterial(Utils::MaterialSlot slot, const Object::Component::Material &material)
+{
+    MaterialTransfer transfer = _materials.at(slot);
+    transfer.ambient = glm::vec4(material.ambient, 1.0f);
+    transfer.diffuse = glm::vec4(material.diffuse, 1.0f);
+    transfer.specular = glm::vec4(material.specular, 1.0f);
+    transfer.transmittance = glm::vec4(material.transmittance, 1.0f);
+    transfer.emission = glm::vec4(material.emission, 1.0f);
+    transfer.shininess = material.shininess;
+    Write(slot, transfer);
+}
+
+void MaterialTable::SetTexture(Utils::MaterialSlot slot, const MaterialAtlas::Region &region)
+{
+    MaterialTransfer transfer = _materials.at(slot);
+    transfer.uvRect = region.uvRect;
+    transfer.layer = region.layer;
+    transfer.maxLod = region.maxLod;
+    transfer.flags &= ~Utils::MATERIAL_FLAG_STANDALONE_TEXTURE;
+    Write(slot, transfer);
+}
+
+void MaterialTable::SetStandaloneTexture(Utils::MaterialSlot slot)
+{
+    MaterialTransfer transfer = _materials.at(slot);
+    transfer.flags |= Utils::MATERIAL_FLAG_STANDALONE_TEXTURE;
+    Write(slot, transfer);
+}
+
+bool MaterialTable::Contains(Utils::MaterialSlot slot) const { return slot < _used.size() && _used[slot]; }
+
+uint32_t MaterialTable::GetMaterialCount() const
+{
+    return static_cast<uint32_t>(std::ranges::count(_used, true));
+}
+
+void MaterialTable::Upload(Engine::Core &core)
+{
+    if (!_isCreated)
+        return;
+
+    auto &buffer = GetBuffer(core);
+    if (_materials.size() > _capacity)
+    {
+        while (_capacity < _materials.size())
+            _capacity *= 2;
+        // Every slot is rewritten below, nothing has to be copied from the old buffer.
+        buffer.Reallocate(core, _capacity * uint64_t{MaterialTransfer::GPUSize()}, {});
+        _dirtyBegin = 0;
+        _dirtyEnd = static_cast<uint32_t>(_materials.size());
+        _bufferReplaced = true;
+    }
+
+    if (_dirtyBegin < _dirtyEnd)
+    {
+        buffer.Write(core, _dirtyBegin * uint64_t{MaterialTransfer::GPUSize()}, _materials.data() + _dirtyBegin,
+                     (_dirtyEnd - _dirtyBegin) * uint64_t{MaterialTransfer::GPUSize()});
+        _dirtyBegin = 0;
+        _dirtyEnd = 0;
+    }
+
+    auto &atlas = core.GetResource<MaterialAtlas>();
+    if (!atlas.IsCreated())
+        atlas.Create(core);
+
+    auto &bindGroupManager = core.GetResource<Graphic::Resource::BindGroupManager>();
+    if (!bindGroupManager.Contains(Utils::MATERIAL_TABLE_BIND_GROUP_ID))
+    {
+        // The layout comes from the GBuffer shader, which may still be compiling.
+        if (!core.GetResource<Graphic::Resource::ShaderContainer>().Contains(GBUFFER_SHADER_ID))
+            return;
+
+        const auto samplerId = Graphic::Utils::GetSharedSampler(core, CreateAtlasSamplerDescriptor());
+        Graphic::Resource::BindGroup bindGroup(
+            core, Utils::MATERIAL_TABLE_BIND_GROUP_NAME, GBUFFER_SHADER_ID, 2,
+            {
+                {0, Graphic::Resource::BindGroup::Asset::Type::Buffer, Utils::MATERIAL_TABLE_BUFFER_ID, 0},
+                {1, Graphic::Resource::BindGroup::Asset::Type::TextureView, Utils::MATERIAL_ATLAS_VIEW_ID, 0},
+                {2, Graphic::Resource::BindGroup::Asset::Type::Sampler, samplerId, 0},
+        });
+        bindGroupManager.Add(Utils::MATERIAL_TABLE_BIND_GROUP_ID, std::move(bindGroup));
+    }
+    else if (_bufferReplaced || _atlasVersion != atlas.GetVersion())
+    {
+        bindGroupManager.Get(Utils::MATERIAL_TABLE_BIND_GROUP_ID).Refresh(core);
+    }
+    _bufferReplaced = false;
+    _atlasVersion = atlas.GetVersion();
+}
+
+GeometryBuffer &MaterialTable::GetBuffer(Engine::Core &core) const
+{
+    auto &bufferContainer = core.GetResource<Graphic::Resource::GPUBufferContainer>();
+    auto buffer = dynamic_cast<GeometryBuffer *>(bufferContainer.Get(Utils::MATERIAL_TABLE_BUFFER_ID).get());
+    if (!buffer)
+    {
+        throw Graphic::Exception::UpdateBufferError("Failed to cast AGPUBuffer to GeometryBuffer.");
+    }
+    return *buffer;
+}
+
+void MaterialTable::ReserveDefaultSlot()
+{
+    if (!_materials.empty())
+        return;
+
+    _materials.emplace_back();
+    _used.push_back(true);
+    MarkDirty(Utils::DEFAULT_MATERIAL_SLOT);
+}
+
+void MaterialTable::MarkDirty(Utils::MaterialSlot slot)
+{
+    if (_dirtyBegin == _dirtyEnd)
+    {
+        _dirtyBegin = slot;
+        _dirtyEnd = slot + 1;
+        return;
+    }
+    _dirtyBegin = std::min(_dirtyBegin, slot);
+    _dirtyEnd = std::max(_dirtyEnd, slot + 1);
+}
+
+void MaterialTable::Write(Utils::MaterialSlot slot, const MaterialTransfer &material)
+{
+    // Materials are set every frame: unchanged ones must not be uploaded again.
+    if (std::memcmp(&_materials[slot], &material, sizeof(MaterialTransfer)) == 0)
+        return;
+
+    _materials[slot] = material;
+    MarkDirty(slot);
+}
+
+} // namespace DefaultPipeline::Resource
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "component/Material.hpp"
+#include "core/Core.hpp"
+#include "resource/MaterialAtlas.hpp"
+#include "utils/MaterialTable.hpp"
+#include <glm/vec4.hpp>
+#include <vector>
+
+namespace DefaultPipeline::Resource {
+class GeometryBuffer;
+
+/**
+ * @brief Stores the parameters of every material in one storage buffer, indexed by the slot of the material.
+ *
+ * Draws pass the slot as their first instance, so the whole GBuffer pass binds a single material bind group (the
+ * table, the MaterialAtlas and one shared sampler) whatever the number of materials. Only the slots that changed
+ * since the last Upload are written, in one contiguous range; the buffer doubles when the slots run out.
+ */
+class MaterialTable {
+  public:
+    struct MaterialTransfer {
+        glm::vec4 ambient{1.0f};
+        glm::vec4 diffuse{1.0f};
+        glm::vec4 specular{0.0f, 0.0f, 0.0f, 1.0f};
+        glm::vec4 transmittance{0.0f, 0.0f, 0.0f, 1.0f};
+        glm::vec4 emission{0.0f, 0.0f, 0.0f, 1.0f};
+        /** @brief Offset (xy) and scale (zw) of the texture in its atlas page. */
+        glm::vec4 uvRect{0.0f, 0.0f, 1.0f, 1.0f};
+        float shininess = 0.0f;
+        uint32_t layer = 0;
+        uint32_t flags = 0;
+        /** @brief Last mip level of the atlas holding the texture, see MaterialAtlas::Region. */
+        float maxLod = 0.0f;
+
+        static uint32_t GPUSize() { return sizeof(MaterialTransfer); }
+    };
+
+    static_assert(sizeof(MaterialTransfer) == 112, "MaterialTransfer must be 112 bytes for proper GPU alignment.");
+
+    MaterialTable() = default;
+    ~MaterialTable() = default;
+
+    /**
+     * @brief Create the storage buffer and reserve the slot of the default material.
+     */
+    void Create(Engine::Core &core);
+    [[nodiscard]] bool IsCreated() const { return _isCreated; }
+
+    [[nodiscard]] Utils::MaterialSlot Allocate();
+    void Free(Utils::MaterialSlot slot);
+
+    void SetMaterial(Utils::MaterialSlot slot, const Object::Component::Material &material);
+    /** @brief Sample the material texture from the given region of the atlas. */
+    void SetTexture(Utils::MaterialSlot slot, const MaterialAtlas::Region &region);
+    /** @brief Sample the material texture from the standalone texture bind group instead of the atlas. */
+    void SetStandaloneTexture(Utils::MaterialSlot slot);
+
+    [[nodiscard]] bool Contains(Utils::MaterialSlot slot) const;
+    [[nodiscard]] const MaterialTransfer &Get(Utils::MaterialSlot slot) const { return _materials.at(slot); }
+    [[nodiscard]] uint32_t GetMaterialCount() const;
+    [[nodiscard]] uint32_t GetCapacity() const { return _capacity; }
+
+    /**
+     * @brief Write the changed slots to the GPU and (re)create the material bind group if the buffer or the atlas
+     * texture was replaced.
+     */
+    void Upload(Engine::Core &core);
+
+  private:
+    GeometryBuffer &GetBuffer(Engine::Core &core) const;
+    /** @brief Slots are handed out from 1, the first one always holds the default material. */
+    void ReserveDefaultSlot();
+    void MarkDirty(Utils::MaterialSlot slot);
+    void Write(Utils::MaterialSlot slot, const MaterialTransfer &material);
+
+    std::vector<MaterialTransfer> _materials;
+    std::vector<bool> _used;
+    std::vector<Utils::MaterialSlot> _freeSlots;
+    uint32_t _capacity = 0;
+    uint32_t _dirtyBegin = 0;
+    uint32_t _dirtyEnd = 0;
+    bool _bufferReplaced = false;
+    uint64_t _atlasVersion = 0;
+    bool _isCreated = false;
+};
+} // namespace DefaultPipeline::Resource
@@ -0,0 +1,272 @@
+#include "ShadowAtlas.hpp"
+#include "Logger.hpp"
+#include "exception/UpdateBufferError.hpp"
+#include "resource/BindGroup.hpp"
+#include "resource/BindGroupManager.hpp"
+#include "resource/DeviceContext.hpp"
+#include "resource/GPUBufferContainer.hpp"
+#include "resource/ShaderContainer.hpp"
+#include "resource/TextureContainer.hpp"
+#include "resource/TextureViewContainer.hpp"
+#include "resource/buffer/GeometryBuffer.hpp"
+#include "resource/pass/Shadow.hpp"
+#include "utils/Lights.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace DefaultPipeline::Resource {
+
+static Graphic::Resource::Texture CreateLayeredTexture(const Graphic::Resource::DeviceContext &deviceContext,
+                                                       std::string_view name, wgpu::TextureUsage usage,
+                                                       uint32_t layerCount)
+{
+    wgpu::TextureDescriptor textureDesc(wgpu::Default);
+    textureDesc.label = wgpu::StringView(name);
+    textureDesc.size = {Utils::SHADOW_CASCADE_RESOLUTION, Utils::SHADOW_CASCADE_RESOLUTION, layerCount};
+    textureDesc.dimension = wgpu::TextureDimension::_2D;
+    textureDesc.mipLevelCount = 1;
+    textureDesc.sampleCount = 1;
+    textureDesc.format = wgpu::TextureFormat::Depth32Float;
+    textureDesc.usage = usage;
+    textureDesc.viewFormats = nullptr;
+    textureDesc.viewFormatCount = 0;
+    return Graphic::Resource::Texture(deviceContext, textureDesc);
+}
+
+static Graphic::Resource::TextureView CreateLayerView(const Graphic::Resource::Texture &texture, std::string_view name,
+                                                      wgpu::TextureViewDimension dimension, uint32_t baseLayer,
+                                                      uint32_t layerCount)
+{
+    wgpu::TextureViewDescriptor viewDesc(wgpu::Default);
+    viewDesc.label = wgpu::StringView(name);
+    viewDesc.format = wgpu::TextureFormat::Depth32Float;
+    viewDesc.dimension = dimension;
+    viewDesc.aspect = wgpu::TextureAspect::DepthOnly;
+    viewDesc.baseMipLevel = 0;
+    viewDesc.mipLevelCount = 1;
+    viewDesc.baseArrayLayer = baseLayer;
+    viewDesc.arrayLayerCount = layerCount;
+    return texture.CreateView(viewDesc);
+}
+
+void ShadowAtlas::Create(Engine::Core &core)
+{
+    if (_isCreated)
+        return;
+
+    auto buffer = std::make_unique<GeometryBuffer>(Utils::SHADOW_CASCADES_BUFFER_NAME, wgpu::BufferUsage::Storage,
+                                                   Utils::MAX_SHADOW_CASCADE_LAYERS *
+                                                       uint64_t{CascadeTransfer::GPUSize()});
+    buffer->Create(core);
+    core.GetResource<Graphic::Resource::GPUBufferContainer>().Add(Utils::SHADOW_CASCADES_BUFFER_ID, std::move(buffer));
+
+    Reallocate(core, Utils::SHADOW_CASCADE_COUNT);
+    _isCreated = true;
+}
+
+std::optional<uint32_t> ShadowAtlas::Acquire(Engine::Core &core)
+{
+    if (!_isCreated)
+        Create(core);
+
+    auto block = std::ranges::find(_usedBlocks, false);
+    if (block == _usedBlocks.end())
+    {
+        if (GetLayerCount() >= Utils::MAX_SHADOW_CASCADE_LAYERS)
+        {
+            Log::Warning(fmt::format("ShadowAtlas: All {} layers are used, a directional light casts no shadow.",
+                                     Utils::MAX_SHADOW_CASCADE_LAYERS));
+            return std::nullopt;
+        }
+        const auto blockIndex = _usedBlocks.size();
+        Reallocate(core, std::min(GetLayerCount() * 2, Utils::MAX_SHADOW_CASCADE_LAYERS));
+        block = _usedBlocks.begin() + static_cast<std::ptrdiff_t>(blockIndex);
+    }
+    *block = true;
+    return static_cast<uint32_t>(std::distance(_usedBlocks.begin(), block)) * Utils::SHADOW_CASCADE_COUNT;
+}
+
+void ShadowAtlas::Release(uint32_t firstLayer)
+{
+    const uint32_t block = firstLayer / Utils::SHADOW_CASCADE_COUNT;
+    if (block >= _usedBlocks.size())
+        return;
+
+    _usedBlocks[block] = false;
+    for (uint32_t layer = firstLayer; layer < firstLayer + Utils::SHADOW_CASCADE_COUNT; ++layer)
+        ResetLayer(layer);
+}
+
+void ShadowAtlas::SetCascade(uint32_t layer, const Utils::ShadowCascade &cascade)
+{
+    auto &entry = _layers.at(layer);
+    if (entry.cascade.viewProjection != cascade.viewProjection)
+    {
+        entry.cacheValid = false;
+        entry.atlasIsStatic = false;
+    }
+    entry.cascade = cascade;
+
+    CascadeTransfer transfer;
+    transfer.viewProjection = cascade.viewProjection;
+    transfer.params = glm::vec4(cascade.texelSize, cascade.depthRange, 0.0f, 0.0f);
+    if (std::memcmp(&_cascades[layer], &transfer, sizeof(CascadeTransfer)) == 0)
+        return;
+    _cascades[layer] = transfer;
+    MarkDirty(layer);
+}
+
+bool ShadowAtlas::IsStaticCacheValid(uint32_t layer) const
+{
+    const auto &entry = _layers.at(layer);
+    return entry.cacheValid && entry.cacheVersion == _staticVersion;
+}
+
+void ShadowAtlas::SetStaticCache(uint32_t layer, bool empty)
+{
+    auto &entry = _layers.at(layer);
+    entry.cacheValid = true;
+    entry.cacheVersion = _staticVersion;
+    entry.cacheEmpty = empty;
+    // The atlas layer still holds the previous content, it has to be refreshed from the new cache.
+    entry.atlasIsStatic = false;
+}
+
+entt::hashed_string ShadowAtlas::GetLayerView(uint32_t layer) const
+{
+    const auto &name = _layerViewNames.at(layer);
+    return entt::hashed_string{name.data(), name.size()};
+}
+
+entt::hashed_string ShadowAtlas::GetCacheLayerView(uint32_t layer) const
+{
+    const auto &name = _cacheLayerViewNames.at(layer);
+    return entt::hashed_string{name.data(), name.size()};
+}
+
+uint32_t ShadowAtlas::GetUsedLayerCount() const
+{
+    return static_cast<uint32_t>(std::ranges::count(_usedBlocks, true)) * Utils::SHADOW_CASCADE_COUNT;
+}
+
+void ShadowAtlas::Upload(Engine::Core &core)
+{
+    if (!_isCreated)
+        return;
+
+    if (_dirtyBegin < _dirtyEnd)
+    {
+        GetBuffer(core).Write(core, _dirtyBegin * uint64_t{CascadeTransfer::GPUSize()}, _cascades.data() + _dirtyBegin,
+                              (_dirtyEnd - _dirtyBegin) * uint64_t{CascadeTransfer::GPUSize()});
+        _dirtyBegin = 0;
+        _dirtyEnd = 0;
+    }
+
+    auto &bindGroupManager = core.GetResource<Graphic::Resource::BindGroupManager>();
+    // The layout comes from the Shadow shader, which may still be compiling.
+    if (!bindGroupManager.Contains(Utils::SHADOW_CASCADES_BIND_GROUP_ID) &&
+        core.GetResource<Graphic::Resource::ShaderContainer>().Contains(SHADOW_SHADER_ID))
+    {
+        Graphic::Resource::BindGroup bindGroup(
+            core, Utils::SHADOW_CASCADES_BIND_GROUP_NAME, SHADOW_SHADER_ID, 0,
+            {
+                {0, Graphic::Resource::BindGroup::Asset::Type::Buffer, Utils::SHADOW_CASCADES_BUFFER_ID, 0},
+        });
+        bindGroupManager.Add(Utils::SHADOW_CASCADES_BIND_GROUP_ID, std::move(bindGroup));
+    }
+
+    if (_uploadedVersion != _version && bindGroupManager.Contains(Utils::LIGHTS_BIND_GROUP_ID))
+    {
+        bindGroupManager.Get(Utils::LIGHTS_BIND_GROUP_ID).Refresh(core);
+        _uploadedVersion = _version;
+    }
+}
+
+GeometryBuffer &ShadowAtlas::GetBuffer(Engine::Core &core) const
+{
+    auto &bufferContainer = core.GetResource<Graphic::Resource::GPUBufferContainer>();
+    auto buffer = dynamic_cast<GeometryBuffer *>(bufferContainer.Get(Utils::SHADOW_CASCADES_BUFFER_ID).get());
+    if (!buffer)
+    {
+        throw Graphic::Exception::UpdateBufferError("Failed to cast AGPUBuffer to GeometryBuffer.");
+    }
+    return *buffer;
+}
+
+void ShadowAtlas::Reallocate(Engine::Core &core, uint32_t layerCount)
+{
+    const auto &deviceContext = core.GetResource<Graphic::Resource::DeviceContext>();
+    auto &textureContainer = core.GetResource<Graphic::Resource::TextureContainer>();
+    auto &textureViewContainer = core.GetResource<Graphic::Resource::TextureViewContainer>();
+
+    // Both textures are redrawn before being sampled again: their content is not copied.
+    auto atlas = CreateLayeredTexture(deviceContext, Utils::DIRECTIONAL_LIGHTS_SHADOW_TEXTURE_NAME,
+                                      wgpu::TextureUsage::TextureBinding | wgpu::TextureUsage::RenderAttachment |
+                                          wgpu::TextureUsage::CopySrc | wgpu::TextureUsage::CopyDst,
+                                      layerCount);
+    auto cache = CreateLayeredTexture(deviceContext, Utils::DIRECTIONAL_LIGHTS_SHADOW_CACHE_TEXTURE_NAME,
+                                      wgpu::TextureUsage::RenderAttachment | wgpu::TextureUsage::CopySrc, layerCount);
+
+    for (const auto &name : _layerViewNames)
+        textureViewContainer.Remove(name);
+    for (const auto &name : _cacheLayerViewNames)
+        textureViewContainer.Remove(name);
+    _layerViewNames.clear();
+    _cacheLayerViewNames.clear();
+
+    for (uint32_t layer = 0; layer < layerCount; ++layer)
+    {
+        const auto &layerName = _layerViewNames.emplace_back(fmt::format("DIRECTIONAL_LIGHTS_SHADOW_LAYER_{}", layer));
+        textureViewContainer.Add(layerName,
+                                 CreateLayerView(atlas, layerName, wgpu::TextureViewDimension::_2D, layer, 1));
+        const auto &cacheName =
+            _cacheLayerViewNames.emplace_back(fmt::format("DIRECTIONAL_LIGHTS_SHADOW_CACHE_LAYER_{}", layer));
+        textureViewContainer.Add(cacheName,
+                                 CreateLayerView(cache, cacheName, wgpu::TextureViewDimension::_2D, layer, 1));
+    }
+
+    // Layers are only sampled through this view: the default view of a single layer texture is not an array.
+    if (textureViewContainer.Contains(Utils::DIRECTIONAL_LIGHTS_SHADOW_VIEW_ID))
+        textureViewContainer.Remove(Utils::DIRECTIONAL_LIGHTS_SHADOW_VIEW_ID);
+    textureViewContainer.Add(Utils::DIRECTIONAL_LIGHTS_SHADOW_VIEW_ID,
+                             CreateLayerView(atlas, Utils::DIRECTIONAL_LIGHTS_SHADOW_VIEW_NAME,
+                                             wgpu::TextureViewDimension::_2DArray, 0, layerCount));
+
+    if (textureContainer.Contains(Utils::DIRECTIONAL_LIGHTS_SHADOW_TEXTURE_ID))
+        textureContainer.Remove(Utils::DIRECTIONAL_LIGHTS_SHADOW_TEXTURE_ID);
+    textureContainer.Add(Utils::DIRECTIONAL_LIGHTS_SHADOW_TEXTURE_ID, std::move(atlas));
+    if (textureContainer.Contains(Utils::DIRECTIONAL_LIGHTS_SHADOW_CACHE_TEXTURE_ID))
+        textureContainer.Remove(Utils::DIRECTIONAL_LIGHTS_SHADOW_CACHE_TEXTURE_ID);
+    textureContainer.Add(Utils::DIRECTIONAL_LIGHTS_SHADOW_CACHE_TEXTURE_ID, std::move(cache));
+
+    _layers.resize(layerCount);
+    for (uint32_t layer = 0; layer < layerCount; ++layer)
+        ResetLayer(layer);
+    _cascades.resize(layerCount);
+    _usedBlocks.resize(layerCount / Utils::SHADOW_CASCADE_COUNT, false);
+    _dirtyBegin = 0;
+    _dirtyEnd = layerCount;
+    ++_version;
+}
+
+void ShadowAtlas::ResetLayer(uint32_t layer)
+{
+    auto &entry = _layers.at(layer);
+    entry.cacheValid = false;
+    entry.cacheEmpty = true;
+    entry.atlasIsStatic = false;
+}
+
+void ShadowAtlas::MarkDirty(uint32_t layer)
+{
+    if (_dirtyBegin == _dirtyEnd)
+    {
+        _dirtyBegin = layer;
+        _dirtyEnd = layer + 1;
+        return;
+    }
+    _dirtyBegin = std::min(_dirtyBegin, layer);
+    _dirtyEnd = std::max(_dirtyEnd, layer + 1);
+}
+
+} // namespace DefaultPipeline::Resource
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "core/Core.hpp"
+#include "utils/ShadowCascades.hpp"
+#include "utils/webgpu.hpp"
+#include <entt/core/hashed_string.hpp>
+#include <glm/glm.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace DefaultPipeline::Resource {
+class GeometryBuffer;
+
+/**
+ * @brief Owns the shadow maps of the directional lights: one layer of a depth texture array per cascade.
+ *
+ * Each light acquires SHADOW_CASCADE_COUNT consecutive layers. The array gains layers as lights are added, up to
+ * MAX_SHADOW_CASCADE_LAYERS, its texture and views are then replaced and GetVersion changes.
+ *
+ * A second array caches the depth of the static casters (see Component::StaticShadowCaster) of each layer. The cache
+ * of a layer stays valid until its cascade moves or InvalidateStaticCasters is called, the Shadow pass then only
+ * copies it into the atlas and draws the dynamic casters on top.
+ *
+ * Layers are used instead of rectangles of a single texture because depth textures can only be copied as whole
+ * subresources.
+ */
+class ShadowAtlas {
+  public:
+    struct CascadeTransfer {
+        glm::mat4 viewProjection{1.0f};
+        /** @brief x: width of a texel in world units, y: depth range in world units. */
+        glm::vec4 params{0.0f};
+
+        static uint32_t GPUSize() { return sizeof(CascadeTransfer); }
+    };
+
+    static_assert(sizeof(CascadeTransfer) == 80, "CascadeTransfer must be 80 bytes for proper GPU alignment.");
+
+    ShadowAtlas() = default;
+    ~ShadowAtlas() = default;
+
+    /**
+     * @brief Create the textures with the layers of a single light, and the cascades storage buffer.
+     */
+    void Create(Engine::Core &core);
+    [[nodiscard]] bool IsCreated() const { return _isCreated; }
+
+    /**
+     * @brief Reserve the layers of the cascades of a light.
+     *
+     * @return the first of its SHADOW_CASCADE_COUNT layers, or std::nullopt if every layer is used.
+     */
+    [[nodiscard]] std::optional<uint32_t> Acquire(Engine::Core &core);
+    void Release(uint32_t firstLayer);
+
+    /**
+     * @brief Set the cascade rendered into a layer, invalidating its cached static depth if the cascade moved.
+     */
+    void SetCascade(uint32_t layer, const Utils::ShadowCascade &cascade);
+    [[nodiscard]] const Utils::ShadowCascade &GetCascade(uint32_t layer) const { return _layers.at(layer).cascade; }
+
+    /**
+     * @brief Redraw the static casters of every layer, to be called when a static caster is added, removed or moved.
+     */
+    void InvalidateStaticCasters() { ++_staticVersion; }
+    [[nodiscard]] uint64_t GetStaticVersion() const { return _staticVersion; }
+
+    [[nodiscard]] bool IsStaticCacheValid(uint32_t layer) const;
+    /** @brief Whether the static cache of the layer holds no caster: the atlas layer is then cleared instead. */
+    [[nodiscard]] bool IsStaticCacheEmpty(uint32_t layer) const { return _layers.at(layer).cacheEmpty; }
+    void SetStaticCache(uint32_t layer, bool empty);
+
+    /**
+     * @brief Whether the atlas layer already holds its static depth and nothing else, so it can be left untouched.
+     */
+    [[nodiscard]] bool IsLayerStatic(uint32_t layer) const { return _layers.at(layer).atlasIsStatic; }
+    void SetLayerStatic(uint32_t layer, bool isStatic) { _layers.at(layer).atlasIsStatic = isStatic; }
+
+    /** @brief View of a single layer of the atlas, to render into. */
+    [[nodiscard]] entt::hashed_string GetLayerView(uint32_t layer) const;
+    /** @brief View of a single layer of the static cache, to render into. */
+    [[nodiscard]] entt::hashed_string GetCacheLayerView(uint32_t layer) const;
+
+    [[nodiscard]] uint32_t GetLayerCount() const { return static_cast<uint32_t>(_layers.size()); }
+    [[nodiscard]] uint32_t GetUsedLayerCount() const;
+    /** @brief Changes every time the atlas texture is replaced, bind groups using it must then be refreshed. */
+    [[nodiscard]] uint64_t GetVersion() const { return _version; }
+
+    /**
+     * @brief Write the cascades that changed to the GPU, create the cascades bind group and refresh the lights bind
+     * group if the atlas texture was replaced.
+     */
+    void Upload(Engine::Core &core);
+
+  private:
+    struct Layer {
+        Utils::ShadowCascade cascade;
+        uint64_t cacheVersion = 0;
+        bool cacheValid = false;
+        bool cacheEmpty = true;
+        bool atlasIsStatic = false;
+    };
+
+    GeometryBuffer &GetBuffer(Engine::Core &core) const;
+    /** @brief Replace both textures by ones of the given layer count. Every layer has to be redrawn. */
+    void Reallocate(Engine::Core &core, uint32_t layerCount);
+    void ResetLayer(uint32_t layer);
+    void MarkDirty(uint32_t layer);
+
+    std::vector<Layer> _layers;
+    std::vector<CascadeTransfer> _cascades;
+    std::vector<bool> _usedBlocks;
+    std::vector<std::string> _layerViewNames;
+    std::vector<std::string> _cacheLayerViewNames;
+    uint64_t _staticVersion = 0;
+    uint64_t _version = 0;
+    uint64_t _uploadedVersion = 0;
+    uint32_t _dirtyBegin = 0;
+    uint32_t _dirtyEnd = 0;
+    bool _isCreated = false;
+};
+} // namespace DefaultPipeline::Resource
@@ -2,6 +2,7 @@
 
 #include "component/Camera.hpp"
 #include "component/GPUCamera.hpp"
+#include "component/GlobalTransform.hpp"
 #include "component/Transform.hpp"
 #include "entity/Entity.hpp"
 #include "exception/UpdateBufferError.hpp"
@@ -18,9 +19,9 @@ class CameraGPUBuffer final : public Graphic::Resource::AGPUBuffer {
         glm::mat4 invViewProjectionMatrix;
         glm::vec3 position;
 
-        explicit CameraTransfer(const Object::Component::Camera &camera, const Object::Component::Transform &transform)
+        explicit CameraTransfer(const Object::Component::Camera &camera, const glm::vec3 &position)
             : viewProjectionMatrix(camera.viewProjection), invViewProjectionMatrix(camera.inverseViewProjection),
-              position(transform.GetPosition())
+              position(position)
         {
         }
 
@@ -34,12 +35,11 @@ class CameraGPUBuffer final : public Graphic::Resource::AGPUBuffer {
     void Create(Engine::Core &core) override
     {
         const auto &camera = _entity.GetComponents<Object::Component::Camera>();
-        const auto &transform = _entity.GetComponents<Object::Component::Transform>();
         const auto &deviceContext = core.GetResource<Graphic::Resource::DeviceContext>();
         const auto &queue = core.GetResource<Graphic::Resource::Queue>();
 
         _buffer = _CreateBuffer(deviceContext);
-        _UpdateBuffer(camera, transform, queue);
+        _UpdateBuffer(camera, _GetPosition(), queue);
         _isCreated = true;
     }
 
@@ -63,9 +63,8 @@ class CameraGPUBuffer final : public Graphic::Resource::AGPUBuffer {
             throw Graphic::Exception::UpdateBufferError("Cannot update a GPU camera buffer that is not created.");
         }
         const auto &cameraComponent = _entity.GetComponents<Object::Component::Camera>();
-        const auto &transform = _entity.GetComponents<Object::Component::Transform>();
         const auto &queue = core.GetResource<Graphic::Resource::Queue>();
-        _UpdateBuffer(cameraComponent, transform, queue);
+        _UpdateBuffer(cameraComponent, _GetPosition(), queue);
     }
 
     const wgpu::Buffer &GetBuffer() const override { return _buffer; }
@@ -82,10 +81,20 @@ class CameraGPUBuffer final : public Graphic::Resource::AGPUBuffer {
         return context.GetDevice()->createBuffer(bufferDesc);
     }
 
-    void _UpdateBuffer(const Object::Component::Camera &camera, const Object::Component::Transform &transform,
+    /**
+     * @brief World position of the camera: its GlobalTransform once propagated, its local Transform before that.
+     */
+    glm::vec3 _GetPosition()
+    {
+        if (_entity.HasComponents<Object::Component::GlobalTransform>())
+            return _entity.GetComponents<Object::Component::GlobalTransform>().GetPosition();
+        return _entity.GetComponents<Object::Component::Transform>().GetPosition();
+    }
+
+    void _UpdateBuffer(const Object::Component::Camera &camera, const glm::vec3 &position,
                        const Graphic::Resource::Queue &queue)
     {
-        const CameraTransfer cameraTransfer(camera, transform);
+        const CameraTransfer cameraTransfer(camera, position);
         queue->writeBuffer(_buffer, 0, std::addressof(cameraTransfer), CameraTransfer::CPUSize());
     }
 
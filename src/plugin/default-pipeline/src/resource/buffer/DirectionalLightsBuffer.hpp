@@ -2,12 +2,15 @@
 
 #include "component/DirectionalLight.hpp"
 #include "component/GPUDirectionalLight.hpp"
+#include "component/GlobalTransform.hpp"
 #include "component/Transform.hpp"
 #include "entity/Entity.hpp"
 #include "exception/UpdateBufferError.hpp"
 #include "resource/AGPUBuffer.hpp"
 #include "resource/DeviceContext.hpp"
 #include "utils/DirectionalLights.hpp"
+#include "utils/ShadowCascades.hpp"
+#include <array>
 #include <glm/gtc/type_ptr.hpp>
 #include <vector>
 
@@ -17,12 +20,19 @@ class DirectionalLightsBuffer : public Graphic::Resource::AGPUBuffer {
     static inline std::string _debugName = "DirectionalLightsBuffer";
 
     struct GPUDirectionalLight {
-        glm::mat4 viewProjectionMatrix;
+        /** @brief View depth of the far end of each cascade. */
+        glm::vec4 cascadeSplits;
         glm::vec4 color;
         glm::vec3 direction;
-        uint32_t shadowIndex;
+        /** @brief Layer of the first cascade in the shadow atlas. */
+        uint32_t firstCascade;
+        /** @brief Zero for lights without shadow. */
+        uint32_t cascadeCount;
+        std::array<uint32_t, 3> _padding;
     };
 
+    static_assert(sizeof(GPUDirectionalLight) == 64, "GPUDirectionalLight must match DEFERRED_SHADE_CONTENT.");
+
     struct GPUDirectionalLights {
         std::array<GPUDirectionalLight, Utils::MAX_DIRECTIONAL_LIGHTS> lights;
         uint32_t count;
@@ -69,27 +79,31 @@ class DirectionalLightsBuffer : public Graphic::Resource::AGPUBuffer {
 
         const auto &queue = core.GetResource<Graphic::Resource::Queue>();
         GPUDirectionalLights data{};
-        auto view = core.GetRegistry()
-                        .view<Object::Component::DirectionalLight, Component::GPUDirectionalLight,
-                              Object::Component::Transform>();
+        const auto &registry = core.GetRegistry();
+        auto view = registry.view<Object::Component::DirectionalLight, Component::GPUDirectionalLight,
+                                  Object::Component::Transform>();
 
         uint32_t index = 0;
         uint32_t skippedCount = 0;
-        view.each([&data, &index, &skippedCount](auto, const Object::Component::DirectionalLight &light,
-                                                 const Component::GPUDirectionalLight &gpuLight,
-                                                 const Object::Component::Transform &transform) {
+        view.each([&registry, &data, &index, &skippedCount](auto entity,
+                                                            const Object::Component::DirectionalLight &light,
+                                                            const Component::GPUDirectionalLight &gpuLight,
+                                                            const Object::Component::Transform &localTransform) {
             if (index >= Utils::MAX_DIRECTIONAL_LIGHTS)
             {
                 skippedCount++;
                 return;
             }
-            const auto &viewProjectionMatrix = gpuLight.viewProjectionMatrix;
+            const auto *globalTransform = registry.try_get<Object::Component::GlobalTransform>(entity);
+            const auto transform = globalTransform ? globalTransform->ToTransform() : localTransform;
             const auto &color = light.color;
             const auto &direction = -glm::normalize(transform.GetForwardVector() * transform.GetScale());
-            data.lights[index].viewProjectionMatrix = viewProjectionMatrix;
+            data.lights[index].cascadeSplits = gpuLight.cascadeSplits;
             data.lights[index].color = color;
             data.lights[index].direction = direction;
-            data.lights[index].shadowIndex = gpuLight.shadowTextureIndex;
+            data.lights[index].firstCascade = gpuLight.firstCascadeLayer.value_or(0);
+            data.lights[index].cascadeCount =
+                gpuLight.firstCascadeLayer.has_value() ? Utils::SHADOW_CASCADE_COUNT : 0;
             index++;
         });
         data.count = index;
@@ -0,0 +1,128 @@
+#pragma once
+
+#include "exception/UpdateBufferError.hpp"
+#include "resource/AGPUBuffer.hpp"
+#include "resource/DeviceContext.hpp"
+#include "resource/Queue.hpp"
+#include <span>
+#include <string>
+
+namespace DefaultPipeline::Resource {
+
+/**
+ * Large GPU buffer backing the GeometryArena and the MaterialTable. Its content is written range by range by its
+ * owner, which also decides when the buffer has to be reallocated.
+ */
+class GeometryBuffer : public Graphic::Resource::AGPUBuffer {
+  public:
+    struct CopyRegion {
+        uint64_t sourceOffset;
+        uint64_t destinationOffset;
+        uint64_t size;
+    };
+
+    GeometryBuffer(std::string_view name, wgpu::BufferUsage usage, uint64_t size)
+        : _name(name), _usage(usage), _size(size)
+    {
+    }
+    ~GeometryBuffer() override { Destroy(); }
+
+    void Create(Engine::Core &core) override
+    {
+        const auto &deviceContext = core.GetResource<Graphic::Resource::DeviceContext>();
+        _buffer = _CreateBuffer(deviceContext, _size);
+        _isCreated = true;
+    }
+
+    void Destroy(Engine::Core &core) override { Destroy(); }
+
+    void Destroy()
+    {
+        if (_isCreated)
+        {
+            _isCreated = false;
+            _buffer.release();
+        }
+    }
+
+    bool IsCreated(Engine::Core &core) const override { return _isCreated; }
+
+    // Ranges are written by the GeometryArena, there is nothing to pull from the registry.
+    void Update(Engine::Core &core) override {}
+
+    void Write(Engine::Core &core, uint64_t offset, const void *data, uint64_t size)
+    {
+        if (!_isCreated)
+        {
+            throw Graphic::Exception::UpdateBufferError("Cannot write to a geometry buffer that is not created.");
+        }
+        if (size == 0)
+        {
+            return;
+        }
+        core.GetResource<Graphic::Resource::Queue>()->writeBuffer(_buffer, offset, data, size);
+    }
+
+    /**
+     * @brief Replace the buffer by a new one of the given size, moving the given regions on the GPU.
+     *
+     * Used both to grow the buffer and to compact it: regions can be moved to any offset of the new buffer.
+     */
+    void Reallocate(Engine::Core &core, uint64_t newSize, std::span<const CopyRegion> regions)
+    {
+        if (!_isCreated)
+        {
+            throw Graphic::Exception::UpdateBufferError("Cannot reallocate a geometry buffer that is not created.");
+        }
+
+        const auto &deviceContext = core.GetResource<Graphic::Resource::DeviceContext>();
+        auto &queue = core.GetResource<Graphic::Resource::Queue>();
+        wgpu::Buffer newBuffer = _CreateBuffer(deviceContext, newSize);
+
+        if (!regions.empty())
+        {
+            wgpu::CommandEncoderDescriptor encoderDesc(wgpu::Default);
+            std::string encoderLabel = fmt::format("{}::Reallocate", _name);
+            encoderDesc.label = wgpu::StringView(encoderLabel);
+            wgpu::CommandEncoder encoder = deviceContext.GetDevice()->createCommandEncoder(encoderDesc);
+            for (const auto &region : regions)
+            {
+                if (region.size > 0)
+                {
+                    encoder.copyBufferToBuffer(_buffer, region.sourceOffset, newBuffer, region.destinationOffset,
+                                               region.size);
+                }
+            }
+            auto commandBuffer = encoder.finish();
+            encoder.release();
+            queue->submit(1, &commandBuffer);
+            commandBuffer.release();
+        }
+
+        _buffer.release();
+        _buffer = newBuffer;
+        _size = newSize;
+    }
+
+    const wgpu::Buffer &GetBuffer() const override { return _buffer; }
+
+    uint64_t GetSize() const { return _size; }
+
+  private:
+    wgpu::Buffer _CreateBuffer(const Graphic::Resource::DeviceContext &context, uint64_t size) const
+    {
+        wgpu::BufferDescriptor bufferDesc(wgpu::Default);
+        bufferDesc.usage = _usage | wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::CopySrc;
+        bufferDesc.size = size;
+        bufferDesc.label = wgpu::StringView(_name);
+
+        return context.GetDevice()->createBuffer(bufferDesc);
+    }
+
+    std::string _name;
+    wgpu::BufferUsage _usage;
+    uint64_t _size = 0;
+    wgpu::Buffer _buffer;
+    bool _isCreated = false;
+};
+} // namespace DefaultPipeline::Resource
@@ -0,0 +1,146 @@
+#pragma once
+
+#include "component/Camera.hpp"
+#include "component/GPUCamera.hpp"
+#include "component/Transform.hpp"
+#include "exception/UpdateBufferError.hpp"
+#include "resource/AGPUBuffer.hpp"
+#include "resource/DeviceContext.hpp"
+#include "resource/GPUBufferContainer.hpp"
+#include "resource/buffer/PointLightsBuffer.hpp"
+#include "utils/LightClusterGrid.hpp"
+#include "utils/PointLights.hpp"
+
+namespace DefaultPipeline::Resource {
+
+/**
+ * Storage buffer holding the froxel grid of the main camera: grid parameters, one (offset, count) range per cluster
+ * and the light index list the ranges point into. Indices refer to lights of the PointLightsBuffer, which must be
+ * updated before this buffer.
+ */
+class PointLightClustersBuffer : public Graphic::Resource::AGPUBuffer {
+  private:
+    static inline std::string _debugName = "PointLightClustersBuffer";
+
+    struct ClustersHeader {
+        std::array<uint32_t, 4> gridSize; // x, y, z slices, index count
+        std::array<float, 4> depthParams; // near, far, slice scale, slice bias
+    };
+
+    static_assert(sizeof(ClustersHeader) == 32, "ClustersHeader must be 32 bytes for proper GPU alignment.");
+
+    static constexpr uint64_t RANGES_OFFSET = sizeof(ClustersHeader);
+    static constexpr uint64_t INDICES_OFFSET =
+        RANGES_OFFSET + sizeof(Utils::LightClusterGrid::Range) * Utils::LIGHT_CLUSTER_COUNT;
+
+  public:
+    PointLightClustersBuffer() = default;
+    ~PointLightClustersBuffer() override { Destroy(); }
+
+    void Create(Engine::Core &core) override
+    {
+        const auto &deviceContext = core.GetResource<Graphic::Resource::DeviceContext>();
+        const auto &queue = core.GetResource<Graphic::Resource::Queue>();
+
+        _buffer = _CreateBuffer(deviceContext);
+        _isCreated = true;
+
+        _grid.Build(glm::mat4(1.0f), glm::mat4(1.0f), 0.1f, 100.0f, {});
+        _Write(queue);
+    }
+
+    void Destroy(Engine::Core &core) override { Destroy(); }
+
+    void Destroy()
+    {
+        if (_isCreated)
+        {
+            _isCreated = false;
+            _buffer.release();
+        }
+    }
+
+    bool IsCreated(Engine::Core &core) const override { return _isCreated; }
+
+    void Update(Engine::Core &core) override
+    {
+        if (!_isCreated)
+        {
+            throw Graphic::Exception::UpdateBufferError(
+                "Cannot update a GPU point light clusters buffer that is not created.");
+        }
+
+        // Same camera selection as the Deferred pass, so the grid matches the shaded view.
+        const auto cameraEntity = core.GetRegistry().view<Component::GPUCamera>().front();
+        if (cameraEntity == entt::null)
+        {
+            return;
+        }
+        const auto &camera = core.GetRegistry().get<Object::Component::Camera>(cameraEntity);
+
+        auto &bufferContainer = core.GetResource<Graphic::Resource::GPUBufferContainer>();
+        const auto *pointLightsBuffer =
+            dynamic_cast<const PointLightsBuffer *>(bufferContainer.Get(Utils::POINT_LIGHTS_BUFFER_ID).get());
+        if (!pointLightsBuffer)
+        {
+            throw Graphic::Exception::UpdateBufferError("Failed to cast AGPUBuffer to PointLightsBuffer.");
+        }
+
+        _grid.Build(camera.view, camera.projection, camera.nearPlane, camera.farPlane,
+                    pointLightsBuffer->GetLightSpheres());
+
+        if (_grid.GetDroppedIndexCount() > 0)
+        {
+            Log::Warning(fmt::format("Maximum number of clustered light indices ({}) reached. {} index(es) dropped.",
+                                     Utils::MAX_LIGHT_CLUSTER_INDICES, _grid.GetDroppedIndexCount()));
+        }
+
+        _Write(core.GetResource<Graphic::Resource::Queue>());
+    }
+
+    const wgpu::Buffer &GetBuffer() const override { return _buffer; }
+
+    const Utils::LightClusterGrid &GetGrid() const { return _grid; }
+
+    static uint64_t GPUSize() { return INDICES_OFFSET + sizeof(uint32_t) * Utils::MAX_LIGHT_CLUSTER_INDICES; }
+
+    /**
+     * @brief Smallest valid binding size: the header, every range and a single index.
+     */
+    static uint64_t MinBindingSize() { return INDICES_OFFSET + sizeof(uint32_t); }
+
+  private:
+    wgpu::Buffer _CreateBuffer(const Graphic::Resource::DeviceContext &context)
+    {
+        wgpu::BufferDescriptor bufferDesc(wgpu::Default);
+        bufferDesc.usage = wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::Storage;
+        bufferDesc.size = GPUSize();
+        bufferDesc.label = wgpu::StringView(_debugName);
+
+        return context.GetDevice()->createBuffer(bufferDesc);
+    }
+
+    void _Write(const Graphic::Resource::Queue &queue)
+    {
+        const auto &ranges = _grid.GetRanges();
+        const auto &indices = _grid.GetIndices();
+
+        ClustersHeader header{};
+        header.gridSize = {Utils::LIGHT_CLUSTER_GRID_X, Utils::LIGHT_CLUSTER_GRID_Y, Utils::LIGHT_CLUSTER_GRID_Z,
+                           static_cast<uint32_t>(indices.size())};
+        header.depthParams = {_grid.GetNearPlane(), _grid.GetFarPlane(), _grid.GetSliceScale(), _grid.GetSliceBias()};
+
+        queue->writeBuffer(_buffer, 0, &header, sizeof(ClustersHeader));
+        queue->writeBuffer(_buffer, RANGES_OFFSET, ranges.data(),
+                           ranges.size() * sizeof(Utils::LightClusterGrid::Range));
+        if (!indices.empty())
+        {
+            queue->writeBuffer(_buffer, INDICES_OFFSET, indices.data(), indices.size() * sizeof(uint32_t));
+        }
+    }
+
+    wgpu::Buffer _buffer;
+    bool _isCreated = false;
+    Utils::LightClusterGrid _grid;
+};
+} // namespace DefaultPipeline::Resource
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "component/GlobalTransform.hpp"
 #include "component/PointLight.hpp"
 #include "component/Transform.hpp"
 #include "entity/Entity.hpp"
@@ -26,14 +27,12 @@ class PointLightsBuffer : public Graphic::Resource::AGPUBuffer {
 
     static_assert(sizeof(GPUPointLight) == 48, "GPUPointLight must be 48 bytes for proper GPU alignment.");
 
-    struct PointLightsData {
-        std::array<GPUPointLight, Utils::MAX_POINT_LIGHTS> lights; // 64 * 48 = 3072 bytes
-        uint32_t count;                                            // 4 bytes (3076 bytes)
-        std::array<float, 3> _padding;                             // 12 bytes (3088 bytes)
+    struct PointLightsHeader {
+        uint32_t count;                // 4 bytes
+        std::array<float, 3> _padding; // 12 bytes (16 bytes)
     };
 
-    static_assert(sizeof(PointLightsData) == (48 * Utils::MAX_POINT_LIGHTS + 16),
-                  "PointLightsData size does not match expected GPU requirements.");
+    static_assert(sizeof(PointLightsHeader) == 16, "PointLightsHeader must be 16 bytes for proper GPU alignment.");
 
   public:
     PointLightsBuffer() = default;
@@ -47,9 +46,12 @@ class PointLightsBuffer : public Graphic::Resource::AGPUBuffer {
         _buffer = _CreateBuffer(deviceContext);
         _isCreated = true;
 
-        PointLightsData data{};
-        data.count = 0;
-        queue->writeBuffer(_buffer, 0, &data, sizeof(PointLightsData));
+        _lights.reserve(Utils::MAX_POINT_LIGHTS);
+        _lightSpheres.reserve(Utils::MAX_POINT_LIGHTS);
+
+        PointLightsHeader header{};
+        header.count = 0;
+        queue->writeBuffer(_buffer, 0, &header, sizeof(PointLightsHeader));
     }
 
     void Destroy(Engine::Core &core) override { Destroy(); }
@@ -73,30 +75,32 @@ class PointLightsBuffer : public Graphic::Resource::AGPUBuffer {
         }
 
         const auto &queue = core.GetResource<Graphic::Resource::Queue>();
-        PointLightsData data{};
+        _lights.clear();
+        _lightSpheres.clear();
 
-        auto view = core.GetRegistry().view<Object::Component::PointLight, Object::Component::Transform>();
+        const auto &registry = core.GetRegistry();
+        auto view = registry.view<Object::Component::PointLight, Object::Component::Transform>();
 
-        uint32_t index = 0;
         uint32_t skippedCount = 0;
-        view.each([&data, &index, &skippedCount](auto, const Object::Component::PointLight &light,
-                                                 const Object::Component::Transform &transform) {
-            if (index >= Utils::MAX_POINT_LIGHTS)
+        view.each([this, &registry, &skippedCount](auto entity, const Object::Component::PointLight &light,
+                                                   const Object::Component::Transform &transform) {
+            if (_lights.size() >= Utils::MAX_POINT_LIGHTS)
             {
                 skippedCount++;
                 return;
             }
-            const glm::vec3 &position = transform.GetPosition();
+            const auto *globalTransform = registry.try_get<Object::Component::GlobalTransform>(entity);
+            const glm::vec3 position = globalTransform ? globalTransform->GetPosition() : transform.GetPosition();
             const glm::vec3 &color = light.color;
 
-            data.lights[index].position = {position.x, position.y, position.z};
-            data.lights[index].intensity = light.intensity;
-            data.lights[index].color = {color.x, color.y, color.z};
-            data.lights[index].radius = light.radius;
-            data.lights[index].falloff = light.falloff;
-            index++;
+            GPUPointLight &gpuLight = _lights.emplace_back();
+            gpuLight.position = {position.x, position.y, position.z};
+            gpuLight.intensity = light.intensity;
+            gpuLight.color = {color.x, color.y, color.z};
+            gpuLight.radius = light.radius;
+            gpuLight.falloff = light.falloff;
+            _lightSpheres.emplace_back(position, light.radius);
         });
-        data.count = index;
 
         if (skippedCount > 0)
         {
@@ -104,21 +108,39 @@ class PointLightsBuffer : public Graphic::Resource::AGPUBuffer {
                                      Utils::MAX_POINT_LIGHTS, skippedCount));
         }
 
-        queue->writeBuffer(_buffer, 0, &data, sizeof(PointLightsData));
+        PointLightsHeader header{};
+        header.count = static_cast<uint32_t>(_lights.size());
+        queue->writeBuffer(_buffer, 0, &header, sizeof(PointLightsHeader));
+        if (!_lights.empty())
+        {
+            queue->writeBuffer(_buffer, sizeof(PointLightsHeader), _lights.data(),
+                               _lights.size() * sizeof(GPUPointLight));
+        }
     }
 
+    /**
+     * @brief Bounding spheres of the lights uploaded by the last update, in the same order as on the GPU.
+     * xyz is the world position, w the radius.
+     */
+    const std::vector<glm::vec4> &GetLightSpheres() const { return _lightSpheres; }
+
     const wgpu::Buffer &GetBuffer() const override { return _buffer; }
 
     std::string_view GetDebugName() const { return _debugName; }
 
-    static uint32_t GPUSize() { return sizeof(PointLightsData); }
+    static uint32_t GPUSize() { return sizeof(PointLightsHeader) + sizeof(GPUPointLight) * Utils::MAX_POINT_LIGHTS; }
+
+    /**
+     * @brief Smallest valid binding size: the header followed by a single light.
+     */
+    static uint32_t MinBindingSize() { return sizeof(PointLightsHeader) + sizeof(GPUPointLight); }
 
   private:
     wgpu::Buffer _CreateBuffer(const Graphic::Resource::DeviceContext &context)
     {
         wgpu::BufferDescriptor bufferDesc(wgpu::Default);
-        bufferDesc.usage = wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::Uniform;
-        bufferDesc.size = sizeof(PointLightsData);
+        bufferDesc.usage = wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::Storage;
+        bufferDesc.size = GPUSize();
         bufferDesc.label = wgpu::StringView(_debugName);
 
         return context.GetDevice()->createBuffer(bufferDesc);
@@ -126,5 +148,7 @@ class PointLightsBuffer : public Graphic::Resource::AGPUBuffer {
 
     wgpu::Buffer _buffer;
     bool _isCreated = false;
+    std::vector<GPUPointLight> _lights;
+    std::vector<glm::vec4> _lightSpheres;
 };
 } // namespace DefaultPipeline::Resource
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "component/GlobalTransform.hpp"
 #include "component/Mesh.hpp"
 #include "component/Transform.hpp"
 #include "entity/Entity.hpp"
@@ -33,12 +34,11 @@ class TransformGPUBuffer : public Graphic::Resource::AGPUBuffer {
     ~TransformGPUBuffer() override { Destroy(); };
     void Create(Engine::Core &core) override
     {
-        const auto &transformComponent = _entity.GetComponents<Object::Component::Transform>();
         const auto &queue = core.GetResource<Graphic::Resource::Queue>();
         const auto &deviceContext = core.GetResource<Graphic::Resource::DeviceContext>();
 
         _buffer = _CreateBuffer(deviceContext);
-        _UpdateBuffer(transformComponent, queue);
+        _UpdateBuffer(_GetModelMatrix(), queue);
         _isCreated = true;
     };
     void Destroy(Engine::Core &core) override { Destroy(); };
@@ -60,9 +60,8 @@ class TransformGPUBuffer : public Graphic::Resource::AGPUBuffer {
             throw Graphic::Exception::UpdateBufferError("Cannot update a GPU transform buffer that is not created.");
         }
 
-        const auto &transformComponent = _entity.GetComponents<Object::Component::Transform>();
         const auto &queue = core.GetResource<Graphic::Resource::Queue>();
-        _UpdateBuffer(transformComponent, queue);
+        _UpdateBuffer(_GetModelMatrix(), queue);
     };
 
     const wgpu::Buffer &GetBuffer() const override { return _buffer; };
@@ -79,21 +78,28 @@ class TransformGPUBuffer : public Graphic::Resource::AGPUBuffer {
         return context.GetDevice()->createBuffer(bufferDesc);
     }
 
+    /**
+     * @brief World matrix of the entity: its GlobalTransform once propagated, its local Transform before that.
+     */
+    glm::mat4 _GetModelMatrix() const
+    {
+        if (_entity.HasComponents<Object::Component::GlobalTransform>())
+            return _entity.GetComponents<Object::Component::GlobalTransform>().matrix;
+        return _entity.GetComponents<Object::Component::Transform>().ComputeTransformationMatrix();
+    }
+
     /**
      * @brief Update the GPU buffer with the entity's current model and normal matrices.
      *
-     * Computes the model matrix from the provided Transform component, derives the normal
-     * matrix as the transpose of the inverse of the model matrix, packs both into a
-     * TransformGPUData instance, and writes the data to the GPU buffer at offset 0 using
+     * Derives the normal matrix as the transpose of the inverse of the model matrix, packs both
+     * into a TransformGPUData instance, and writes the data to the GPU buffer at offset 0 using
      * the provided graphics context queue.
      *
-     * @param transformComponent Component used to compute the model transformation matrix.
+     * @param modelMatrix World matrix of the entity.
      * @param context Graphics context containing the queue used to write to the GPU buffer.
      */
-    void _UpdateBuffer(const Object::Component::Transform &transformComponent, const Graphic::Resource::Queue &queue)
+    void _UpdateBuffer(const glm::mat4 &modelMatrix, const Graphic::Resource::Queue &queue)
     {
-        const glm::mat4 &modelMatrix = transformComponent.ComputeTransformationMatrix();
-
         const glm::mat4 normalMatrix = glm::transpose(glm::inverse(modelMatrix));
 
         TransformGPUData gpuData;
@@ -8,8 +8,10 @@
 #include "core/Core.hpp"
 #include "entity/Entity.hpp"
 #include "resource/ASingleExecutionRenderPass.hpp"
+#include "resource/ShadowAtlas.hpp"
 #include "resource/buffer/CameraGPUBuffer.hpp"
 #include "resource/buffer/DirectionalLightsBuffer.hpp"
+#include "resource/buffer/PointLightClustersBuffer.hpp"
 #include "resource/buffer/PointLightsBuffer.hpp"
 #include "utils/DefaultMaterial.hpp"
 #include "utils/Lights.hpp"
@@ -34,7 +36,7 @@ static inline const entt::hashed_string DEFERRED_BINDGROUP_TEXTURES_ID =
     entt::hashed_string{DEFERRED_BINDGROUP_TEXTURES_NAME.data(), DEFERRED_BINDGROUP_TEXTURES_NAME.size()};
 
 static inline constexpr std::string_view DEFERRED_SHADE_CONTENT = R"(
-const MAX_POINT_LIGHTS: u32 = 64u;
+const LIGHT_CLUSTER_COUNT: u32 = 3456u;
 const MAX_DIRECTIONAL_LIGHTS: u32 = 64u;
 
 struct DeferredInput {
@@ -72,18 +74,39 @@ struct GPUPointLight {
 };
 
 struct PointLightsData {
-    lights: array<GPUPointLight, MAX_POINT_LIGHTS>,
     count: u32,
     _padding1: f32,
     _padding2: f32,
     _padding3: f32,
+    lights: array<GPUPointLight>,
+};
+
+struct LightClusters {
+    // x, y, z: number of clusters along each axis, w: number of indices
+    gridSize: vec4u,
+    // x: near plane, y: far plane, z: slice scale, w: slice bias
+    depthParams: vec4f,
+    // x: offset inside indices, y: number of lights of the cluster
+    ranges: array<vec2u, LIGHT_CLUSTER_COUNT>,
+    indices: array<u32>,
 };
 
 struct DirectionalLight {
-    viewProjection: mat4x4f,
+    // View depth of the far end of each cascade.
+    cascadeSplits: vec4f,
     color: vec4f,
     direction: vec3f,
-    shadowIndex: u32,
+    firstCascade: u32,
+    cascadeCount: u32,
+    _padding1: u32,
+    _padding2: u32,
+    _padding3: u32,
+};
+
+struct ShadowCascade {
+    viewProjection: mat4x4f,
+    // x: width of a texel in world units, y: depth range in world units
+    params: vec4f,
 };
 
 struct DirectionalLightsData {
@@ -101,10 +124,12 @@ struct DirectionalLightsData {
 @group(1) @binding(2) var gBufferDepth: texture_2d<f32>;
 
 @group(2) @binding(0) var<uniform> ambientLight : AmbientLight;
-@group(2) @binding(1) var<uniform> pointLights : PointLightsData;
+@group(2) @binding(1) var<storage, read> pointLights : PointLightsData;
 @group(2) @binding(2) var<uniform> directionalLights : DirectionalLightsData;
 @group(2) @binding(3) var lightsDirectionalTextures: texture_depth_2d_array;
 @group(2) @binding(4) var lightsDirectionalTextureSampler: sampler_comparison;
+@group(2) @binding(5) var<storage, read> lightClusters : LightClusters;
+@group(2) @binding(6) var<storage, read> shadowCascades : array<ShadowCascade>;
 
 @vertex
 fn vs_main(
@@ -127,6 +152,22 @@ fn world_from_screen_coord(coord : vec2f, depth_sample: f32) -> vec3f {
   return posWorld;
 }
 
+// Inverse of the zero-to-one perspective depth mapping, giving the view space depth.
+fn linearize_depth(depth_sample: f32) -> f32 {
+  let near = lightClusters.depthParams.x;
+  let far = lightClusters.depthParams.y;
+  return (far * near) / (far - depth_sample * (far - near));
+}
+
+// Cluster slices are exponential in depth: slice = log(z) * scale + bias.
+fn cluster_index(coord : vec2f, depth_sample: f32) -> u32 {
+  let grid = lightClusters.gridSize.xyz;
+  let viewDepth = linearize_depth(depth_sample);
+  let slice = u32(clamp(floor(log(viewDepth) * lightClusters.depthParams.z + lightClusters.depthParams.w), 0.0, f32(grid.z - 1u)));
+  let tile = min(vec2u(coord * vec2f(grid.xy)), grid.xy - vec2u(1u));
+  return tile.x + tile.y * grid.x + slice * grid.x * grid.y;
+}
+
 // Physically plausible point-light attenuation with finite radius
 // Formula inside the radius: A * (1 - s^2)^2 / (1 + F * s), where s = d / R
 // For s >= 1 (distance >= R) the attenuation is explicitly clamped to 0.0.
@@ -154,14 +195,32 @@ fn calculatePointLight(light: GPUPointLight, worldPos: vec3f, normal: vec3f) ->
     return light.color * diff * attenuation;
 }
 
-fn calculateDirectionalLight(light: DirectionalLight, N: vec3f, V: vec3f, MatKd: vec3f, MatKs: vec3f, Shiness: f32, position: vec3f, shadowBias: f32) -> vec3f
+// Visibility of a directional light, sampled from the first cascade whose split contains the view depth.
+fn directionalShadow(light: DirectionalLight, N: vec3f, position: vec3f, viewDepth: f32) -> f32
 {
-  let FragPosLightSpace = light.viewProjection * vec4f(position, 1.0);
-  let shadowCoord = FragPosLightSpace.xyz / FragPosLightSpace.w;
-  let projCoord = shadowCoord * vec3f(0.5, -0.5, 1.0) + vec3f(0.5, 0.5, 0.0);
+  var cascadeIndex = light.cascadeCount;
+  for (var i = 0u; i < light.cascadeCount; i++) {
+    if (viewDepth <= light.cascadeSplits[i]) {
+      cascadeIndex = i;
+      break;
+    }
+  }
+  // Beyond the last cascade, or no shadow map for this light.
+  if (cascadeIndex >= light.cascadeCount) {
+    return 1.0;
+  }
+
+  let layer = light.firstCascade + cascadeIndex;
+  let cascade = shadowCascades[layer];
+  // Offsetting along the normal and biasing by a texel of the cascade keeps the bias the same in world units
+  // whatever the size of the cascade.
+  let texelSize = cascade.params.x;
+  let FragPosLightSpace = cascade.viewProjection * vec4f(position + N * texelSize * 1.5, 1.0);
+  let projCoord = FragPosLightSpace.xyz * vec3f(0.5, -0.5, 1.0) + vec3f(0.5, 0.5, 0.0);
+  let shadowBias = texelSize / cascade.params.y;
 
   var visibility = 0.0;
-  let oneOverShadowDepthTextureSize = 1.0 / 2048.0;
+  let oneOverShadowDepthTextureSize = 1.0 / vec2f(textureDimensions(lightsDirectionalTextures));
   let offsets = array<vec2f, 25>(
     vec2f(-2, -2), vec2f(-1, -2), vec2f(0, -2), vec2f(1, -2), vec2f(2, -2),
     vec2f(-2, -1), vec2f(-1, -1), vec2f(0, -1), vec2f(1, -1), vec2f(2, -1),
@@ -172,14 +231,20 @@ fn calculateDirectionalLight(light: DirectionalLight, N: vec3f, V: vec3f, MatKd:
 
   const PCF_SAMPLES: u32 = 25u;
 
+  // The early returns above make this non-uniform control flow, hence the explicit level.
   for (var i = 0u; i < PCF_SAMPLES; i++) {
     let offset = offsets[i] * oneOverShadowDepthTextureSize;
-    visibility += textureSampleCompare(
+    visibility += textureSampleCompareLevel(
       lightsDirectionalTextures, lightsDirectionalTextureSampler,
-      projCoord.xy + offset, i32(light.shadowIndex), projCoord.z - shadowBias
+      projCoord.xy + offset, i32(layer), projCoord.z - shadowBias
     );
   }
-  visibility /= 25.0;
+  return visibility / 25.0;
+}
+
+fn calculateDirectionalLight(light: DirectionalLight, N: vec3f, V: vec3f, MatKd: vec3f, MatKs: vec3f, Shiness: f32, position: vec3f, viewDepth: f32) -> vec3f
+{
+  let visibility = directionalShadow(light, N, position, viewDepth);
   if (visibility < 0.01) {
     return vec3f(0.0);
   }
@@ -224,17 +289,17 @@ fn fs_main(
 
     var lighting = ambientLight.color;
 
-    for (var i = 0u; i < MAX_POINT_LIGHTS; i++) {
-        if (i >= pointLights.count) {
-            break;
-        }
-        lighting += calculatePointLight(pointLights.lights[i], position, N);
+    let cluster = lightClusters.ranges[cluster_index(coordUV, depth)];
+    for (var i = 0u; i < cluster.y; i++) {
+        let lightIndex = lightClusters.indices[cluster.x + i];
+        lighting += calculatePointLight(pointLights.lights[lightIndex], position, N);
     }
+    let viewDepth = linearize_depth(depth);
     for (var i = 0u; i < MAX_DIRECTIONAL_LIGHTS; i++) {
         if (i >= directionalLights.count) {
             break;
         }
-        lighting += calculateDirectionalLight(directionalLights.lights[i], N, V, albedo, vec3f(1.0), Shiness, position, 0.007);
+        lighting += calculateDirectionalLight(directionalLights.lights[i], N, V, albedo, vec3f(1.0), Shiness, position, viewDepth);
     }
 
     var color : vec4f = vec4f(albedo * lighting, 1.0);
@@ -243,6 +308,8 @@ fn fs_main(
 }
 )";
 
+static_assert(Utils::LIGHT_CLUSTER_COUNT == 3456, "LIGHT_CLUSTER_COUNT must match DEFERRED_SHADE_CONTENT.");
+
 class Deferred : public Graphic::Resource::ASingleExecutionRenderPass<Deferred> {
   public:
     explicit Deferred(std::string_view name = DEFERRED_PASS_NAME) : ASingleExecutionRenderPass<Deferred>(name) {}
@@ -274,6 +341,11 @@ class Deferred : public Graphic::Resource::ASingleExecutionRenderPass<Deferred>
     }
 
     static Graphic::Resource::Shader CreateShader(Graphic::Resource::DeviceContext &deviceContext)
+    {
+        return Graphic::Resource::Shader::Create(CreateShaderDescriptor(), deviceContext);
+    }
+
+    static Graphic::Resource::ShaderDescriptor CreateShaderDescriptor()
     {
         Graphic::Resource::ShaderDescriptor shaderDescriptor;
 
@@ -306,8 +378,8 @@ class Deferred : public Graphic::Resource::ASingleExecutionRenderPass<Deferred>
                                               .setVisibility(wgpu::ShaderStage::Fragment)
                                               .setBinding(0))
                                 .addEntry(Graphic::Utils::BufferBindGroupLayoutEntry("pointLights")
-                                              .setType(wgpu::BufferBindingType::Uniform)
-                                              .setMinBindingSize(Resource::PointLightsBuffer::GPUSize())
+                                              .setType(wgpu::BufferBindingType::ReadOnlyStorage)
+                                              .setMinBindingSize(Resource::PointLightsBuffer::MinBindingSize())
                                               .setVisibility(wgpu::ShaderStage::Fragment)
                                               .setBinding(1))
                                 .addEntry(Graphic::Utils::BufferBindGroupLayoutEntry("directionalLights")
@@ -323,7 +395,17 @@ class Deferred : public Graphic::Resource::ASingleExecutionRenderPass<Deferred>
                                 .addEntry(Graphic::Utils::SamplerBindGroupLayoutEntry("directionalShadowMapSampler")
                                               .setType(wgpu::SamplerBindingType::Comparison)
                                               .setVisibility(wgpu::ShaderStage::Fragment)
-                                              .setBinding(4));
+                                              .setBinding(4))
+                                .addEntry(Graphic::Utils::BufferBindGroupLayoutEntry("pointLightClusters")
+                                              .setType(wgpu::BufferBindingType::ReadOnlyStorage)
+                                              .setMinBindingSize(Resource::PointLightClustersBuffer::MinBindingSize())
+                                              .setVisibility(wgpu::ShaderStage::Fragment)
+                                              .setBinding(5))
+                                .addEntry(Graphic::Utils::BufferBindGroupLayoutEntry("shadowCascades")
+                                              .setType(wgpu::BufferBindingType::ReadOnlyStorage)
+                                              .setMinBindingSize(Resource::ShadowAtlas::CascadeTransfer::GPUSize())
+                                              .setVisibility(wgpu::ShaderStage::Fragment)
+                                              .setBinding(6));
 
         auto colorOutput =
             Graphic::Utils::ColorTargetState("DEFERRED_OUTPUT").setFormat(wgpu::TextureFormat::BGRA8UnormSrgb);
@@ -353,7 +435,7 @@ class Deferred : public Graphic::Resource::ASingleExecutionRenderPass<Deferred>
                 }
             }
         }
-        return Graphic::Resource::Shader::Create(shaderDescriptor, deviceContext);
+        return shaderDescriptor;
     }
 };
 
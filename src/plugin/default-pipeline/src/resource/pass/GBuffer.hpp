@@ -8,13 +8,16 @@
 #include "core/Core.hpp"
 #include "entity/Entity.hpp"
 #include "resource/ASingleExecutionRenderPass.hpp"
+#include "resource/GeometryArena.hpp"
 #include "resource/buffer/CameraGPUBuffer.hpp"
-#include "resource/buffer/MaterialGPUBuffer.hpp"
+#include "resource/MaterialTable.hpp"
 #include "utils/DefaultMaterial.hpp"
+#include "utils/MaterialTable.hpp"
 #include "utils/shader/BufferBindGroupLayoutEntry.hpp"
 #include "utils/shader/SamplerBindGroupLayoutEntry.hpp"
 #include "utils/shader/TextureBindGroupLayoutEntry.hpp"
 #include <entt/core/hashed_string.hpp>
+#include <optional>
 #include <string_view>
 
 namespace DefaultPipeline::Resource {
@@ -50,14 +53,20 @@ struct Material {
     specular : vec4f,
     transmittance  : vec4f,
     emission : vec4f,
-    _padding : vec3f,
-    shininess : f32
+    uvRect : vec4f,
+    shininess : f32,
+    layer : u32,
+    flags : u32,
+    maxLod : f32,
 };
 
+const MATERIAL_FLAG_STANDALONE_TEXTURE : u32 = 1u;
+
 struct VertexToFragment {
   @builtin(position) Position : vec4f,
   @location(0) fragNormal: vec3f,
   @location(1) fragUV: vec2f,
+  @location(2) @interpolate(flat) material: u32,
 }
 
 struct GBufferOutput {
@@ -69,33 +78,52 @@ struct GBufferOutput {
 
 @group(1) @binding(0) var<uniform> object: Object;
 
-@group(2) @binding(0) var<uniform> material : Material;
-@group(2) @binding(1) var texture : texture_2d<f32>;
-@group(2) @binding(2) var textureSampler : sampler;
+@group(2) @binding(0) var<storage, read> materials : array<Material>;
+@group(2) @binding(1) var atlas : texture_2d_array<f32>;
+@group(2) @binding(2) var atlasSampler : sampler;
+
+@group(3) @binding(0) var standaloneTexture : texture_2d<f32>;
+@group(3) @binding(1) var standaloneSampler : sampler;
 
 @vertex
 fn vs_main(
   @location(0) position: vec3f,
   @location(1) normal: vec3f,
   @location(2) uv: vec2f,
+  @builtin(instance_index) material: u32,
 ) -> VertexToFragment {
     var output : VertexToFragment;
     let worldPosition = (object.model * vec4(position, 1.0)).xyz;
     output.Position = camera.viewProjectionMatrix * vec4(worldPosition, 1.0);
     output.fragNormal = normalize((object.normal * vec4(normal, 0.0)).xyz);
     output.fragUV = uv;
+    // Draws pass the material slot as their first instance.
+    output.material = material;
     return output;
 }
 
 @fragment
-fn fs_main(
-  @location(0) fragNormal: vec3f,
-  @location(1) fragUV : vec2f
-) -> GBufferOutput {
+fn fs_main(input: VertexToFragment) -> GBufferOutput {
     var output : GBufferOutput;
-    var uv = vec2f(1.0 - fragUV.x, 1.0 - fragUV.y);
-    output.normal = vec4(normalize(fragNormal), 1.0);
-    var textureColor = textureSample(texture, textureSampler, uv);
+    let material = materials[input.material];
+    var uv = vec2f(1.0 - input.fragUV.x, 1.0 - input.fragUV.y);
+    output.normal = vec4(normalize(input.fragNormal), 1.0);
+
+    // Each texture is stored once in the atlas: repeat it by hand and keep the filter inside its rectangle. fract
+    // breaks the derivatives at the seams, so the LOD comes from the UVs before the repeat, clamped to the mip
+    // levels copied for the texture.
+    let atlasSize = vec2f(textureDimensions(atlas));
+    let texelUV = uv * material.uvRect.zw * atlasSize;
+    let footprint = max(dot(dpdx(texelUV), dpdx(texelUV)), dot(dpdy(texelUV), dpdy(texelUV)));
+    let lod = clamp(0.5 * log2(footprint), 0.0, material.maxLod);
+    // Trilinear filtering also reads the next level, whose texels are twice as large.
+    let halfTexel = 0.5 * exp2(ceil(lod)) / atlasSize;
+    let atlasUV = clamp(material.uvRect.xy + fract(uv) * material.uvRect.zw, material.uvRect.xy + halfTexel,
+                        material.uvRect.xy + material.uvRect.zw - halfTexel);
+    let atlasColor = textureSampleLevel(atlas, atlasSampler, atlasUV, material.layer, lod);
+    let standaloneColor = textureSample(standaloneTexture, standaloneSampler, uv);
+    let textureColor = select(atlasColor, standaloneColor,
+                              (material.flags & MATERIAL_FLAG_STANDALONE_TEXTURE) != 0u);
     if (textureColor.a < 0.05) {
         discard;
     }
@@ -117,9 +145,10 @@ class GBuffer : public Graphic::Resource::ASingleExecutionRenderPass<GBuffer> {
     /**
      * @brief Render all entities with GPUTransform and GPUMesh into the G-buffer using the active camera.
      *
-     * Binds the first available camera's bind group, then for each entity with GPUTransform and GPUMesh:
-     * binds the entity's transform and material bind groups (falls back to the default material if none),
-     * binds the vertex and index buffers, and issues an indexed draw call to populate the G-buffer outputs.
+     * Binds the first available camera's bind group and the material table bind group, then for each entity with
+     * GPUTransform and GPUMesh: binds the entity's transform bind group, the texture bind group of its material if it
+     * differs from the bound one, and issues an indexed draw call into the shared GeometryArena buffers, bound once
+     * for the whole pass. The material slot (the default material if none) is passed as the first instance.
      *
      * If no entity exposes a GPUCamera component, logs an error and returns without drawing.
      *
@@ -129,7 +158,7 @@ class GBuffer : public Graphic::Resource::ASingleExecutionRenderPass<GBuffer> {
     void UniqueRenderCallback(wgpu::RenderPassEncoder &renderPass, Engine::Core &core) override
     {
         const auto &bindGroupManager = core.GetResource<Graphic::Resource::BindGroupManager>();
-        const auto &bufferContainer = core.GetResource<Graphic::Resource::GPUBufferContainer>();
+        const auto &geometryArena = core.GetResource<Resource::GeometryArena>();
 
         auto cameraView = core.GetRegistry().view<Component::GPUCamera>();
         if (cameraView.empty())
@@ -143,8 +172,21 @@ class GBuffer : public Graphic::Resource::ASingleExecutionRenderPass<GBuffer> {
         const auto &cameraBindGroup = bindGroupManager.Get(cameraGPUComponent.bindGroup);
         renderPass.setBindGroup(0, cameraBindGroup.GetBindGroup(), 0, nullptr);
 
+        geometryArena.Bind(renderPass, core);
+
+        // Every material lives in the material table: its bind group is set once, draws select their material
+        // through their first instance.
+        if (!bindGroupManager.Contains(Utils::MATERIAL_TABLE_BIND_GROUP_ID))
+        {
+            Log::Error("GBuffer::UniqueRenderCallback: The material table bind group is not created.");
+            return;
+        }
+        const auto &materialBindGroup = bindGroupManager.Get(Utils::MATERIAL_TABLE_BIND_GROUP_ID);
+        renderPass.setBindGroup(materialBindGroup.GetLayoutIndex(), materialBindGroup.GetBindGroup(), 0, nullptr);
+
         auto view = core.GetRegistry().view<Component::GPUTransform, Component::GPUMesh>();
 
+        std::optional<entt::id_type> boundTextureBindGroup;
         for (auto &&[e, transform, gpuMesh] : view.each())
         {
             Engine::Entity entity{core, e};
@@ -152,27 +194,25 @@ class GBuffer : public Graphic::Resource::ASingleExecutionRenderPass<GBuffer> {
             const auto &transformBindGroup = bindGroupManager.Get(transform.bindGroup);
             renderPass.setBindGroup(transformBindGroup.GetLayoutIndex(), transformBindGroup.GetBindGroup(), 0, nullptr);
 
-            entt::hashed_string gpuMaterialId{};
+            Utils::MaterialSlot materialSlot = Utils::DEFAULT_MATERIAL_SLOT;
+            entt::hashed_string textureBindGroupId = Utils::DEFAULT_MATERIAL_TEXTURE_BIND_GROUP_ID;
             if (entity.HasComponents<Component::GPUMaterial>())
             {
                 const auto &materialComponent = entity.GetComponents<Component::GPUMaterial>();
-                gpuMaterialId = materialComponent.bindGroup;
+                materialSlot = materialComponent.slot;
+                textureBindGroupId = materialComponent.textureBindGroup.value_or(textureBindGroupId);
             }
-            else
+            // Only materials whose texture is not in the atlas have their own texture bind group.
+            if (boundTextureBindGroup != textureBindGroupId.value())
             {
-                gpuMaterialId = Utils::DEFAULT_MATERIAL_BIND_GROUP_ID;
+                const auto &textureBindGroup = bindGroupManager.Get(textureBindGroupId);
+                renderPass.setBindGroup(textureBindGroup.GetLayoutIndex(), textureBindGroup.GetBindGroup(), 0,
+                                        nullptr);
+                boundTextureBindGroup = textureBindGroupId.value();
             }
-            const auto &materialBindGroup = bindGroupManager.Get(gpuMaterialId);
-            renderPass.setBindGroup(materialBindGroup.GetLayoutIndex(), materialBindGroup.GetBindGroup(), 0, nullptr);
 
-            const auto &pointBuffer = bufferContainer.Get(gpuMesh.pointBufferId);
-            const auto &pointBufferSize = pointBuffer->GetBuffer().getSize();
-            renderPass.setVertexBuffer(0, pointBuffer->GetBuffer(), 0, pointBufferSize);
-            const auto &indexBuffer = bufferContainer.Get(gpuMesh.indexBufferId);
-            const auto &indexBufferSize = indexBuffer->GetBuffer().getSize();
-            renderPass.setIndexBuffer(indexBuffer->GetBuffer(), wgpu::IndexFormat::Uint32, 0, indexBufferSize);
-
-            renderPass.drawIndexed(indexBufferSize / sizeof(uint32_t), 1, 0, 0, 0);
+            const auto &geometry = geometryArena.Get(gpuMesh.GetDrawGeometry());
+            renderPass.drawIndexed(geometry.indexCount, 1, geometry.firstIndex, geometry.baseVertex, materialSlot);
         }
     }
 
@@ -180,7 +220,7 @@ class GBuffer : public Graphic::Resource::ASingleExecutionRenderPass<GBuffer> {
      * @brief Constructs and returns a shader configured for the G-buffer pass.
      *
      * The shader includes vertex and fragment entry points ("vs_main", "fs_main"),
-     * bind-group layouts for camera, model, and material, a vertex buffer layout
+     * bind-group layouts for camera, model, material table and standalone material texture, a vertex buffer layout
      * with position/normal/uv attributes, two color outputs (normal as RGBA16Float
      * and albedo as BGRA8Unorm), and a depth output (Depth32Float).
      *
@@ -188,6 +228,11 @@ class GBuffer : public Graphic::Resource::ASingleExecutionRenderPass<GBuffer> {
      * @return Graphic::Resource::Shader A shader instance configured for the G-buffer rendering pass.
      */
     static Graphic::Resource::Shader CreateShader(Graphic::Resource::DeviceContext &deviceContext)
+    {
+        return Graphic::Resource::Shader::Create(CreateShaderDescriptor(), deviceContext);
+    }
+
+    static Graphic::Resource::ShaderDescriptor CreateShaderDescriptor()
     {
         Graphic::Resource::ShaderDescriptor shaderDescriptor;
 
@@ -206,20 +251,31 @@ class GBuffer : public Graphic::Resource::ASingleExecutionRenderPass<GBuffer> {
                 .setBinding(0));
         auto materialLayout =
             Graphic::Utils::BindGroupLayout("Material")
-                .addEntry(Graphic::Utils::BufferBindGroupLayoutEntry("material")
-                              .setType(wgpu::BufferBindingType::Uniform)
-                              .setMinBindingSize(Resource::MaterialGPUBuffer::MaterialTransfer::GPUSize())
+                .addEntry(Graphic::Utils::BufferBindGroupLayoutEntry("materials")
+                              .setType(wgpu::BufferBindingType::ReadOnlyStorage)
+                              .setMinBindingSize(Resource::MaterialTable::MaterialTransfer::GPUSize())
                               .setVisibility(wgpu::ShaderStage::Fragment)
                               .setBinding(0))
+                .addEntry(Graphic::Utils::TextureBindGroupLayoutEntry("materialAtlas")
+                              .setSampleType(wgpu::TextureSampleType::Float)
+                              .setViewDimension(wgpu::TextureViewDimension::_2DArray)
+                              .setVisibility(wgpu::ShaderStage::Fragment)
+                              .setBinding(1))
+                .addEntry(Graphic::Utils::SamplerBindGroupLayoutEntry("materialAtlasSampler")
+                              .setType(wgpu::SamplerBindingType::Filtering)
+                              .setVisibility(wgpu::ShaderStage::Fragment)
+                              .setBinding(2));
+        auto materialTextureLayout =
+            Graphic::Utils::BindGroupLayout("MaterialTexture")
                 .addEntry(Graphic::Utils::TextureBindGroupLayoutEntry("materialTexture")
                               .setSampleType(wgpu::TextureSampleType::Float)
                               .setViewDimension(wgpu::TextureViewDimension::_2D)
                               .setVisibility(wgpu::ShaderStage::Fragment)
-                              .setBinding(1))
+                              .setBinding(0))
                 .addEntry(Graphic::Utils::SamplerBindGroupLayoutEntry("materialSampler")
                               .setType(wgpu::SamplerBindingType::Filtering)
                               .setVisibility(wgpu::ShaderStage::Fragment)
-                              .setBinding(2));
+                              .setBinding(1));
 
         auto vertexLayout = Graphic::Utils::VertexBufferLayout()
                                 .addVertexAttribute(wgpu::VertexFormat::Float32x3, 0, 0)
@@ -246,6 +302,7 @@ class GBuffer : public Graphic::Resource::ASingleExecutionRenderPass<GBuffer> {
             .addBindGroupLayout(cameraLayout)
             .addBindGroupLayout(modelLayout)
             .addBindGroupLayout(materialLayout)
+            .addBindGroupLayout(materialTextureLayout)
             .addVertexBufferLayout(vertexLayout)
             .addOutputColorFormat(normalOutput)
             .addOutputColorFormat(albedoOutput)
@@ -268,7 +325,7 @@ class GBuffer : public Graphic::Resource::ASingleExecutionRenderPass<GBuffer> {
                 }
             }
         }
-        return Graphic::Resource::Shader::Create(shaderDescriptor, deviceContext);
+        return shaderDescriptor;
     }
 };
 
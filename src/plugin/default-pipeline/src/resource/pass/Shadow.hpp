@@ -1,23 +1,26 @@
 #pragma once
 
 #include "Logger.hpp"
-#include "component/GPUCamera.hpp"
-#include "component/GPUMaterial.hpp"
+#include "component/GPUDirectionalLight.hpp"
 #include "component/GPUMesh.hpp"
 #include "component/GPUTransform.hpp"
+#include "component/GlobalTransform.hpp"
+#include "component/StaticShadowCaster.hpp"
+#include "component/Transform.hpp"
 #include "core/Core.hpp"
-#include "entity/Entity.hpp"
 #include "resource/AMultipleExecutionRenderPass.hpp"
-#include "resource/buffer/CameraGPUBuffer.hpp"
-#include "resource/buffer/DirectionalLightBuffer.hpp"
-#include "resource/buffer/PointLightsBuffer.hpp"
-#include "utils/DefaultMaterial.hpp"
-#include "utils/PointLights.hpp"
+#include "resource/GeometryArena.hpp"
+#include "resource/ShadowAtlas.hpp"
+#include "resource/TextureContainer.hpp"
+#include "utils/BoundingSphere.hpp"
+#include "utils/DirectionalLights.hpp"
+#include "utils/ShadowCascades.hpp"
 #include "utils/shader/BufferBindGroupLayoutEntry.hpp"
 #include "utils/shader/SamplerBindGroupLayoutEntry.hpp"
 #include "utils/shader/TextureBindGroupLayoutEntry.hpp"
 #include <entt/core/hashed_string.hpp>
 #include <string_view>
+#include <vector>
 
 namespace DefaultPipeline::Resource {
 static inline constexpr std::string_view SHADOW_PASS_OUTPUT = "SHADOW_PASS_OUTPUT";
@@ -33,8 +36,6 @@ static inline const entt::hashed_string SHADOW_BINDGROUP_TEXTURES_ID =
     entt::hashed_string{SHADOW_BINDGROUP_TEXTURES_NAME.data(), SHADOW_BINDGROUP_TEXTURES_NAME.size()};
 
 static inline constexpr std::string_view SHADOW_SHADER_CONTENT = R"(
-const MAX_POINT_LIGHTS: u32 = 64u;
-
 struct Input {
     @location(0) position: vec3f,
     @location(1) normal: vec3f,
@@ -46,99 +47,144 @@ struct Object {
   normal : mat4x4<f32>,
 }
 
-struct Light {
+struct Cascade {
   viewProjection: mat4x4f,
+  params: vec4f,
 };
 
-@group(0) @binding(0) var<uniform> light: Light;
+@group(0) @binding(0) var<storage, read> cascades: array<Cascade>;
 @group(1) @binding(0) var<uniform> object: Object;
 
+// Draws pass the atlas layer of the cascade as their first instance.
 @vertex
 fn vs_main(
-    input : Input
+    input : Input,
+    @builtin(instance_index) cascade : u32
 ) -> @builtin(position) vec4f {
-    return light.viewProjection * object.model * vec4f(input.position, 1.0);
+    return cascades[cascade].viewProjection * object.model * vec4f(input.position, 1.0);
 }
 
 @fragment
 fn fs_main() {}
 )";
 
+/**
+ * @brief Renders the cascades of the directional lights into the layers of the ShadowAtlas.
+ *
+ * Each cascade only draws the casters whose bounding sphere overlaps it. Static casters are drawn into the static
+ * cache of the cascade when it is invalid; every frame the cache is copied into the atlas and the dynamic casters are
+ * drawn on top. Cascades without dynamic casters whose atlas layer already holds the cache are skipped.
+ */
 class Shadow : public Graphic::Resource::AMultipleExecutionRenderPass<Shadow> {
   public:
     explicit Shadow(std::string_view name = SHADOW_PASS_NAME) : AMultipleExecutionRenderPass<Shadow>(name) {}
 
-    uint16_t GetNumberOfPasses(Engine::Core &core) override
+    void preMultiplePass(Engine::Core &core) override
     {
-        uint16_t count = 0;
-        core.GetRegistry().view<Component::GPUDirectionalLight>().each([&count](auto, const auto &) { count++; });
-        return std::min(count, static_cast<uint16_t>(1));
-    }
+        _jobs.clear();
+        _draws.clear();
+        _casters.clear();
 
-    void perPass(uint16_t passIndex, Engine::Core &core) override
-    {
-        auto view = core.GetRegistry().view<Component::GPUDirectionalLight>();
-        if (view.empty())
+        auto &registry = core.GetRegistry();
+        auto lights = registry.view<Component::GPUDirectionalLight>();
+        if (lights.empty() ||
+            !core.GetResource<Graphic::Resource::BindGroupManager>().Contains(Utils::SHADOW_CASCADES_BIND_GROUP_ID))
         {
             return;
         }
-        uint16_t i = 0;
-        for (auto &&[e, light] : view.each())
+
+        registry.view<Object::Component::Transform, Component::GPUTransform, Component::GPUMesh>().each(
+            [this, &registry](auto entity, const Object::Component::Transform &transform,
+                              const Component::GPUTransform &gpuTransform, const Component::GPUMesh &gpuMesh) {
+                // Static casters keep their full mesh: a level of detail change would invalidate the cache.
+                const bool isStatic = registry.all_of<Component::StaticShadowCaster>(entity);
+                const auto *globalTransform = registry.try_get<Object::Component::GlobalTransform>(entity);
+                const glm::mat4 model =
+                    globalTransform ? globalTransform->matrix : transform.ComputeTransformationMatrix();
+                _casters.push_back(Caster{
+                    .sphere = Utils::TransformBoundingSphere(model, gpuMesh.bounds),
+                    .draw = Draw{.transformBindGroup = gpuTransform.bindGroup,
+                                 .geometry = isStatic ? gpuMesh.geometry : gpuMesh.GetDrawGeometry()},
+                    .isStatic = isStatic});
+            });
+
+        auto &shadowAtlas = core.GetResource<ShadowAtlas>();
+        for (const auto &[entity, light] : lights.each())
         {
-            Engine::Entity entity{core, e};
-            if (i == passIndex)
-            {
-                auto &lightGPUComponent = entity.GetComponents<Component::GPUDirectionalLight>();
-                auto &outputs = this->GetOutputs();
-                outputs.depthBuffer->depthTextureViewId = lightGPUComponent.shadowTextureView;
-                lightGPUComponent.shadowTextureIndex = passIndex;
-                return;
-            }
-            i++;
+            if (!light.firstCascadeLayer.has_value())
+                continue;
+            const uint32_t firstLayer = light.firstCascadeLayer.value();
+            for (uint32_t layer = firstLayer; layer < firstLayer + Utils::SHADOW_CASCADE_COUNT; ++layer)
+                AddCascadeJobs(shadowAtlas, layer);
         }
-    };
+    }
+
+    uint16_t GetNumberOfPasses(Engine::Core &core) override { return static_cast<uint16_t>(_jobs.size()); }
+
+    void prePass(uint16_t passIndex, wgpu::CommandEncoder &encoder, Engine::Core &core) override
+    {
+        const auto &job = _jobs[passIndex];
+        if (!job.copyFromCache)
+            return;
+
+        const auto &textureContainer = core.GetResource<Graphic::Resource::TextureContainer>();
+        wgpu::TexelCopyTextureInfo source(wgpu::Default);
+        source.texture = textureContainer.Get(Utils::DIRECTIONAL_LIGHTS_SHADOW_CACHE_TEXTURE_ID).GetWebGPUTexture();
+        source.mipLevel = 0;
+        source.origin = {0, 0, job.layer};
+        source.aspect = wgpu::TextureAspect::All;
+        wgpu::TexelCopyTextureInfo destination = source;
+        destination.texture = textureContainer.Get(Utils::DIRECTIONAL_LIGHTS_SHADOW_TEXTURE_ID).GetWebGPUTexture();
+        encoder.copyTextureToTexture(
+            source, destination,
+            wgpu::Extent3D(Utils::SHADOW_CASCADE_RESOLUTION, Utils::SHADOW_CASCADE_RESOLUTION, 1));
+    }
+
+    void perPass(uint16_t passIndex, Engine::Core &core) override
+    {
+        const auto &job = _jobs[passIndex];
+        const auto &shadowAtlas = core.GetResource<ShadowAtlas>();
+        auto &depthBuffer = this->GetOutputs().depthBuffer;
+        depthBuffer->depthTextureViewId =
+            job.isStatic ? shadowAtlas.GetCacheLayerView(job.layer) : shadowAtlas.GetLayerView(job.layer);
+        depthBuffer->getClearDepthCallback = job.clear ? &ClearDepth : &LoadDepth;
+        _currentJob = passIndex;
+    }
 
     void UniqueRenderCallback(wgpu::RenderPassEncoder &renderPass, Engine::Core &core) override
     {
         const auto &bindGroupManager = core.GetResource<Graphic::Resource::BindGroupManager>();
-        const auto &bufferContainer = core.GetResource<Graphic::Resource::GPUBufferContainer>();
+        const auto &geometryArena = core.GetResource<Resource::GeometryArena>();
+        const auto &job = _jobs[_currentJob];
 
-        auto light = core.GetRegistry().view<Component::GPUDirectionalLight>();
-        if (light.empty())
-        {
-            return;
-        }
-        Engine::Entity lightEntity{core, light.front()};
-        const auto &lightGPUComponent = lightEntity.GetComponents<Component::GPUDirectionalLight>();
-        const auto &lightBindGroup = bindGroupManager.Get(lightGPUComponent.bindGroupData);
-        renderPass.setBindGroup(0, lightBindGroup.GetBindGroup(), 0, nullptr);
+        const auto &cascadesBindGroup = bindGroupManager.Get(Utils::SHADOW_CASCADES_BIND_GROUP_ID);
+        renderPass.setBindGroup(0, cascadesBindGroup.GetBindGroup(), 0, nullptr);
 
-        auto view = core.GetRegistry().view<Component::GPUTransform, Component::GPUMesh>();
+        geometryArena.Bind(renderPass, core);
 
-        for (auto &&[e, transform, gpuMesh] : view.each())
+        for (uint32_t i = job.firstDraw; i < job.firstDraw + job.drawCount; ++i)
         {
-            Engine::Entity entity{core, e};
-
-            const auto &transformBindGroup = bindGroupManager.Get(transform.bindGroup);
+            const auto &draw = _draws[i];
+            const auto &transformBindGroup = bindGroupManager.Get(draw.transformBindGroup);
             renderPass.setBindGroup(1, transformBindGroup.GetBindGroup(), 0, nullptr);
-            const auto &pointBuffer = bufferContainer.Get(gpuMesh.pointBufferId);
-            const auto &pointBufferSize = pointBuffer->GetBuffer().getSize();
-            renderPass.setVertexBuffer(0, pointBuffer->GetBuffer(), 0, pointBufferSize);
-            const auto &indexBuffer = bufferContainer.Get(gpuMesh.indexBufferId);
-            const auto &indexBufferSize = indexBuffer->GetBuffer().getSize();
-            renderPass.setIndexBuffer(indexBuffer->GetBuffer(), wgpu::IndexFormat::Uint32, 0, indexBufferSize);
-            renderPass.drawIndexed(indexBufferSize / sizeof(uint32_t), 1, 0, 0, 0);
+            const auto &geometry = geometryArena.Get(draw.geometry);
+            renderPass.drawIndexed(geometry.indexCount, 1, geometry.firstIndex, geometry.baseVertex, job.layer);
         }
     }
 
     static Graphic::Resource::Shader CreateShader(Graphic::Resource::DeviceContext &deviceContext)
+    {
+        return Graphic::Resource::Shader::Create(CreateShaderDescriptor(), deviceContext);
+    }
+
+    static Graphic::Resource::ShaderDescriptor CreateShaderDescriptor()
     {
         Graphic::Resource::ShaderDescriptor shaderDescriptor;
 
-        auto lightLayout = Graphic::Utils::BindGroupLayout("light").addEntry(
-            Graphic::Utils::BufferBindGroupLayoutEntry("light")
-                .setType(wgpu::BufferBindingType::Uniform)
-                .setMinBindingSize(Resource::DirectionalLightBuffer::DirectionalLightTransfer::GPUSize())
+        auto cascadesLayout = Graphic::Utils::BindGroupLayout("cascades").addEntry(
+            Graphic::Utils::BufferBindGroupLayoutEntry("cascades")
+                .setType(wgpu::BufferBindingType::ReadOnlyStorage)
+                .setMinBindingSize(Resource::ShadowAtlas::CascadeTransfer::GPUSize())
                 .setVisibility(wgpu::ShaderStage::Vertex)
                 .setBinding(0));
         auto objectLayout = Graphic::Utils::BindGroupLayout("object").addEntry(
@@ -165,7 +211,7 @@ class Shadow : public Graphic::Resource::AMultipleExecutionRenderPass<Shadow> {
             .addVertexBufferLayout(vertexLayout)
             .setVertexEntryPoint("vs_main")
             .setFragmentEntryPoint("fs_main")
-            .addBindGroupLayout(lightLayout)
+            .addBindGroupLayout(cascadesLayout)
             .addBindGroupLayout(objectLayout)
             .setOutputDepthFormat(depthOutput);
         const auto validations = shaderDescriptor.validate();
@@ -185,8 +231,81 @@ class Shadow : public Graphic::Resource::AMultipleExecutionRenderPass<Shadow> {
                 }
             }
         }
-        return Graphic::Resource::Shader::Create(shaderDescriptor, deviceContext);
+        return shaderDescriptor;
+    }
+
+  private:
+    struct Draw {
+        entt::hashed_string transformBindGroup;
+        Utils::GeometryHandle geometry = Utils::INVALID_GEOMETRY_HANDLE;
+    };
+
+    struct Caster {
+        /** @brief World space bounding sphere. */
+        glm::vec4 sphere;
+        Draw draw;
+        bool isStatic = false;
+    };
+
+    struct Job {
+        uint32_t layer = 0;
+        /** @brief Draws the static casters into the cache rather than the dynamic ones into the atlas. */
+        bool isStatic = false;
+        bool clear = false;
+        bool copyFromCache = false;
+        uint32_t firstDraw = 0;
+        uint32_t drawCount = 0;
+    };
+
+    static bool ClearDepth(Engine::Core &, float &clearDepth)
+    {
+        clearDepth = 1.0f;
+        return true;
+    }
+
+    static bool LoadDepth(Engine::Core &, float &) { return false; }
+
+    void AddCascadeJobs(ShadowAtlas &shadowAtlas, uint32_t layer)
+    {
+        const auto &cascade = shadowAtlas.GetCascade(layer);
+
+        if (!shadowAtlas.IsStaticCacheValid(layer))
+        {
+            Job job{.layer = layer, .isStatic = true, .clear = true, .firstDraw = CollectDraws(cascade, true)};
+            job.drawCount = static_cast<uint32_t>(_draws.size()) - job.firstDraw;
+            shadowAtlas.SetStaticCache(layer, job.drawCount == 0);
+            if (job.drawCount > 0)
+                _jobs.push_back(job);
+        }
+
+        Job job{.layer = layer, .firstDraw = CollectDraws(cascade, false)};
+        job.drawCount = static_cast<uint32_t>(_draws.size()) - job.firstDraw;
+        // Nothing moved in the cascade since the atlas layer was last filled from the cache.
+        if (job.drawCount == 0 && shadowAtlas.IsLayerStatic(layer))
+            return;
+        job.clear = shadowAtlas.IsStaticCacheEmpty(layer);
+        job.copyFromCache = !job.clear;
+        _jobs.push_back(job);
+        shadowAtlas.SetLayerStatic(layer, job.drawCount == 0);
     }
+
+    /** @brief Append the draws of the casters overlapping the cascade, returning the index of the first one. */
+    uint32_t CollectDraws(const Utils::ShadowCascade &cascade, bool isStatic)
+    {
+        const auto firstDraw = static_cast<uint32_t>(_draws.size());
+        for (const auto &caster : _casters)
+        {
+            if (caster.isStatic == isStatic && Utils::IsSphereInCascade(cascade, caster.sphere))
+                _draws.push_back(caster.draw);
+        }
+        return firstDraw;
+    }
+
+    /** @brief Kept between frames so building the jobs does not allocate once warmed up. */
+    std::vector<Caster> _casters;
+    std::vector<Draw> _draws;
+    std::vector<Job> _jobs;
+    uint16_t _currentJob = 0;
 };
 
 } // namespace DefaultPipeline::Resource
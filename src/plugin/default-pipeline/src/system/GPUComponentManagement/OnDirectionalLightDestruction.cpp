@@ -1,7 +1,6 @@
 #include "system/GPUComponentManagement/OnDirectionalLightDestruction.hpp"
 #include "component/GPUDirectionalLight.hpp"
-#include "resource/BindGroupManager.hpp"
-#include "resource/GPUBufferContainer.hpp"
+#include "resource/ShadowAtlas.hpp"
 
 void DefaultPipeline::System::OnDirectionalLightDestruction(Engine::Core &core, Engine::EntityId entityId)
 {
@@ -12,13 +11,8 @@ void DefaultPipeline::System::OnDirectionalLightDestruction(Engine::Core &core,
 
     const auto &directionalLightComponent = entity.GetComponents<Component::GPUDirectionalLight>();
 
-    auto &gpuBufferContainer = core.GetResource<Graphic::Resource::GPUBufferContainer>();
-    auto &bindGroupManager = core.GetResource<Graphic::Resource::BindGroupManager>();
-
-    if (gpuBufferContainer.Contains(directionalLightComponent.buffer))
-        gpuBufferContainer.Remove(directionalLightComponent.buffer);
-    if (bindGroupManager.Contains(directionalLightComponent.bindGroupData))
-        bindGroupManager.Remove(directionalLightComponent.bindGroupData);
+    if (directionalLightComponent.firstCascadeLayer.has_value())
+        core.GetResource<Resource::ShadowAtlas>().Release(directionalLightComponent.firstCascadeLayer.value());
 
     entity.RemoveComponent<Component::GPUDirectionalLight>();
 }
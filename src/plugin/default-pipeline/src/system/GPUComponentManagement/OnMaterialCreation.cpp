@@ -1,84 +1,23 @@
 #include "system/GPUComponentManagement/OnMaterialCreation.hpp"
-#include "Logger.hpp"
 #include "component/GPUMaterial.hpp"
 #include "component/Material.hpp"
-#include "resource/BindGroup.hpp"
-#include "resource/BindGroupManager.hpp"
-#include "resource/GPUBufferContainer.hpp"
-#include "resource/Sampler.hpp"
-#include "resource/SamplerContainer.hpp"
-#include "resource/Texture.hpp"
-#include "resource/TextureContainer.hpp"
-#include "resource/buffer/MaterialGPUBuffer.hpp"
-#include "resource/pass/GBuffer.hpp"
-#include <filesystem>
-#include <string>
+#include "resource/MaterialTable.hpp"
+#include "utils/MaterialTexture.hpp"
 
 void DefaultPipeline::System::OnMaterialCreation(Engine::Core &core, Engine::EntityId entityId)
 {
     Engine::Entity entity{core, entityId};
-    auto &gpuBufferContainer = core.GetResource<Graphic::Resource::GPUBufferContainer>();
     const auto &material = entity.GetComponents<Object::Component::Material>();
-    auto &textureContainer = core.GetResource<Graphic::Resource::TextureContainer>();
-    auto &samplerContainer = core.GetResource<Graphic::Resource::SamplerContainer>();
-    const auto &deviceContext = core.GetResource<Graphic::Resource::DeviceContext>();
-    const auto &queue = core.GetResource<Graphic::Resource::Queue>();
-    const auto &device = deviceContext.GetDevice();
+    auto &materialTable = core.GetResource<Resource::MaterialTable>();
 
-    if (!device.has_value())
-    {
-        Log::Error("DefaultPipeline::System::OnMaterialCreation: device is empty");
-        return;
-    }
+    if (!materialTable.IsCreated())
+        materialTable.Create(core);
 
     auto &GPUMaterial = entity.AddComponent<Component::GPUMaterial>();
 
-    entt::hashed_string textureId{material.diffuseTexName.data(), material.diffuseTexName.size()};
-    entt::hashed_string samplerId{material.diffuseTexName.data(), material.diffuseTexName.size()};
+    GPUMaterial.slot = materialTable.Allocate();
+    materialTable.SetMaterial(GPUMaterial.slot, material);
 
-    if (textureContainer.Contains(textureId))
-    {
-        GPUMaterial.texture = textureId;
-    }
-    else if (std::filesystem::exists(material.diffuseTexName))
-    {
-        Graphic::Resource::Texture texture{deviceContext, queue, material.diffuseTexName,
-                                           Graphic::Resource::Image(material.diffuseTexName)};
-        textureContainer.Add(textureId, std::move(texture));
-        GPUMaterial.texture = textureId;
-    }
-    else if (!material.diffuseTexName.empty())
-    {
-        Log::Warning(fmt::format("Texture '{}' not found as file or in texture container", material.diffuseTexName));
-    }
-
-    if (!samplerContainer.Contains(samplerId))
-    {
-        Graphic::Resource::Sampler sampler{device.value()};
-        samplerContainer.Add(samplerId, std::move(sampler));
-    }
-    GPUMaterial.sampler = samplerId;
-
-    auto materialBuffer = std::make_unique<Resource::MaterialGPUBuffer>(entity);
-    materialBuffer->Create(core);
-    uint64_t materialBufferSize = materialBuffer->GetBuffer().getSize();
-    const std::string_view materialBufferName = materialBuffer->GetDebugName();
-    entt::hashed_string materialBufferId{materialBufferName.data(), materialBufferName.size()};
-    gpuBufferContainer.Add(materialBufferId, std::move(materialBuffer));
-    GPUMaterial.buffer = materialBufferId;
-
-    auto &bindGroupManager = core.GetResource<Graphic::Resource::BindGroupManager>();
-    std::string bindGroupName = fmt::format("MATERIAL_BIND_GROUP_{}", entity);
-    entt::hashed_string bindGroupId{bindGroupName.data(), bindGroupName.size()};
-    Graphic::Resource::BindGroup bindGroup(core, bindGroupName, Resource::GBUFFER_SHADER_ID, 2,
-                                           {
-                                               {
-                                                0, Graphic::Resource::BindGroup::Asset::Type::Buffer,
-                                                materialBufferId, materialBufferSize,
-                                                },
-                                               {1, Graphic::Resource::BindGroup::Asset::Type::Texture, textureId, 0},
-                                               {2, Graphic::Resource::BindGroup::Asset::Type::Sampler, samplerId, 0},
-    });
-    bindGroupManager.Add(bindGroupId, std::move(bindGroup));
-    GPUMaterial.bindGroup = bindGroupId;
+    Utils::RequestMaterialTexture(core, GPUMaterial, material.diffuseTexName);
+    Utils::BindMaterialTexture(core, entity, GPUMaterial);
 }
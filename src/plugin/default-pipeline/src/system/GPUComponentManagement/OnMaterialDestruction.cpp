@@ -1,7 +1,7 @@
 #include "system/GPUComponentManagement/OnMaterialDestruction.hpp"
 #include "component/GPUMaterial.hpp"
-#include "resource/BindGroupManager.hpp"
-#include "resource/GPUBufferContainer.hpp"
+#include "resource/MaterialTable.hpp"
+#include "utils/MaterialTexture.hpp"
 
 void DefaultPipeline::System::OnMaterialDestruction(Engine::Core &core, Engine::EntityId entityId)
 {
@@ -10,15 +10,12 @@ void DefaultPipeline::System::OnMaterialDestruction(Engine::Core &core, Engine::
     if (!entity.HasComponents<Component::GPUMaterial>())
         return;
 
-    const auto &materialComponent = entity.GetComponents<Component::GPUMaterial>();
+    auto &materialComponent = entity.GetComponents<Component::GPUMaterial>();
 
-    auto &gpuBufferContainer = core.GetResource<Graphic::Resource::GPUBufferContainer>();
-    auto &bindGroupManager = core.GetResource<Graphic::Resource::BindGroupManager>();
-
-    if (gpuBufferContainer.Contains(materialComponent.buffer))
-        gpuBufferContainer.Remove(materialComponent.buffer);
-    if (bindGroupManager.Contains(materialComponent.bindGroup))
-        bindGroupManager.Remove(materialComponent.bindGroup);
+    // Reset what is given back: removing the GPUMaterial runs this system a second time.
+    Utils::ReleaseMaterialTexture(core, materialComponent);
+    core.GetResource<Resource::MaterialTable>().Free(materialComponent.slot);
+    materialComponent.slot = Utils::DEFAULT_MATERIAL_SLOT;
 
     entity.RemoveComponent<Component::GPUMaterial>();
 }
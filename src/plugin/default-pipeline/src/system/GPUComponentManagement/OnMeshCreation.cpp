@@ -1,27 +1,27 @@
 #include "system/GPUComponentManagement/OnMeshCreation.hpp"
 #include "component/GPUMesh.hpp"
 #include "component/Mesh.hpp"
-#include "resource/GPUBufferContainer.hpp"
-#include "resource/buffer/IndexGPUBuffer.hpp"
-#include "resource/buffer/PointGPUBuffer.hpp"
-#include <string>
+#include "component/MeshLOD.hpp"
+#include "resource/GeometryArena.hpp"
+#include "system/GPUComponentManagement/OnMeshDestruction.hpp"
+#include "system/GPUComponentManagement/OnMeshLODCreation.hpp"
+#include "utils/BoundingSphere.hpp"
 
 void DefaultPipeline::System::OnMeshCreation(Engine::Core &core, Engine::EntityId entityId)
 {
     Engine::Entity entity{core, entityId};
     const auto &mesh = entity.GetComponents<Object::Component::Mesh>();
-    auto &GPUMesh = entity.AddComponent<Component::GPUMesh>();
-    auto &gpuBufferContainer = core.GetResource<Graphic::Resource::GPUBufferContainer>();
+    auto &geometryArena = core.GetResource<Resource::GeometryArena>();
 
-    std::string pointBufferName = fmt::format("POINT_BUFFER_{}", entity);
-    entt::hashed_string pointBufferUUID{pointBufferName.data(), pointBufferName.size()};
-    gpuBufferContainer.Add(pointBufferUUID, std::make_unique<Resource::PointGPUBuffer>(entity));
-    gpuBufferContainer.Get(pointBufferUUID)->Create(core);
-    GPUMesh.pointBufferId = pointBufferUUID;
+    // A unique mesh replaces the shared asset of a MeshHandle the entity may already draw.
+    if (entity.HasComponents<Component::GPUMesh>())
+        OnMeshDestruction(core, entityId);
 
-    std::string indexBufferName = fmt::format("INDEX_BUFFER_{}", entity);
-    entt::hashed_string indexBufferUUID{indexBufferName.data(), indexBufferName.size()};
-    gpuBufferContainer.Add(indexBufferUUID, std::make_unique<Resource::IndexGPUBuffer>(entity));
-    gpuBufferContainer.Get(indexBufferUUID)->Create(core);
-    GPUMesh.indexBufferId = indexBufferUUID;
+    const auto geometry = geometryArena.Acquire(core, mesh);
+    auto &gpuMesh = entity.AddComponent<Component::GPUMesh>();
+    gpuMesh.geometry = geometry;
+    gpuMesh.bounds = Utils::ComputeBoundingSphere(mesh.GetVertices());
+
+    if (entity.HasComponents<Object::Component::MeshLOD>())
+        OnMeshLODCreation(core, entityId);
 }
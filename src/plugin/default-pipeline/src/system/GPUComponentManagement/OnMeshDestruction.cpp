@@ -1,7 +1,7 @@
 #include "system/GPUComponentManagement/OnMeshDestruction.hpp"
 #include "component/GPUMesh.hpp"
-#include "resource/BindGroupManager.hpp"
-#include "resource/GPUBufferContainer.hpp"
+#include "component/GPUMeshLOD.hpp"
+#include "resource/GeometryArena.hpp"
 
 void DefaultPipeline::System::OnMeshDestruction(Engine::Core &core, Engine::EntityId entityId)
 {
@@ -10,14 +10,14 @@ void DefaultPipeline::System::OnMeshDestruction(Engine::Core &core, Engine::Enti
     if (!entity.HasComponents<Component::GPUMesh>())
         return;
 
-    const auto &meshComponent = entity.GetComponents<Component::GPUMesh>();
+    // Levels of detail draw the vertices of the mesh, they are released first.
+    if (entity.HasComponents<Component::GPUMeshLOD>())
+        entity.RemoveComponent<Component::GPUMeshLOD>();
 
-    auto &gpuBufferContainer = core.GetResource<Graphic::Resource::GPUBufferContainer>();
+    const auto &meshComponent = entity.GetComponents<Component::GPUMesh>();
 
-    if (gpuBufferContainer.Contains(meshComponent.pointBufferId))
-        gpuBufferContainer.Remove(meshComponent.pointBufferId);
-    if (gpuBufferContainer.Contains(meshComponent.indexBufferId))
-        gpuBufferContainer.Remove(meshComponent.indexBufferId);
+    auto &geometryArena = core.GetResource<Resource::GeometryArena>();
+    geometryArena.Release(meshComponent.geometry);
 
     entity.RemoveComponent<Component::GPUMesh>();
 }
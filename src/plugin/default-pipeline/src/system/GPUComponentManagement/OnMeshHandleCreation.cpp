@@ -0,0 +1,47 @@
+#include "system/GPUComponentManagement/OnMeshHandleCreation.hpp"
+#include "Logger.hpp"
+#include "component/GPUMesh.hpp"
+#include "component/Mesh.hpp"
+#include "component/MeshHandle.hpp"
+#include "component/MeshLOD.hpp"
+#include "resource/GeometryArena.hpp"
+#include "system/GPUComponentManagement/OnMeshLODCreation.hpp"
+#include "utils/AssetReload.hpp"
+#include "utils/BoundingSphere.hpp"
+
+void DefaultPipeline::System::OnMeshHandleCreation(Engine::Core &core, Engine::EntityId entityId)
+{
+    Engine::Entity entity{core, entityId};
+
+    if (entity.HasComponents<Object::Component::Mesh>())
+    {
+        Log::Warning(fmt::format("Entity {} has both a Mesh and a MeshHandle, only its Mesh is drawn.", entityId));
+        return;
+    }
+
+    AcquireMeshHandleGeometry(core, entityId);
+}
+
+void DefaultPipeline::System::AcquireMeshHandleGeometry(Engine::Core &core, Engine::EntityId entityId)
+{
+    Engine::Entity entity{core, entityId};
+    const auto &meshHandle = entity.GetComponents<Object::Component::MeshHandle>();
+
+    if (!meshHandle.IsValid())
+    {
+        Log::Warning(fmt::format("Entity {} has a MeshHandle referencing no mesh, it is not drawn.", entityId));
+        return;
+    }
+
+    const auto &mesh = meshHandle.Get();
+    auto &geometryArena = core.GetResource<Resource::GeometryArena>();
+
+    const auto geometry = geometryArena.AcquireAsset(core, meshHandle.id, mesh);
+    auto &gpuMesh = entity.AddComponent<Component::GPUMesh>();
+    gpuMesh.geometry = geometry;
+    gpuMesh.bounds = Utils::ComputeBoundingSphere(mesh.GetVertices());
+    Utils::TrackMeshAssetGeometry(core, meshHandle.id);
+
+    if (entity.HasComponents<Object::Component::MeshLOD>())
+        OnMeshLODCreation(core, entityId);
+}
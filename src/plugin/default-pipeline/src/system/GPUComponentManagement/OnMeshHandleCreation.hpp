@@ -0,0 +1,20 @@
+#pragma once
+
+#include "core/Core.hpp"
+#include "entity/Entity.hpp"
+
+namespace DefaultPipeline::System {
+
+/**
+ * @brief Draw the mesh asset referenced by an Object::Component::MeshHandle, uploaded once for all its entities.
+ */
+void OnMeshHandleCreation(Engine::Core &core, Engine::EntityId entityId);
+
+/**
+ * @brief Give an entity the GPUMesh of its Object::Component::MeshHandle, even if it still has a Mesh.
+ *
+ * Used once the unique Mesh overriding the handle is being removed, while the registry still reports it.
+ */
+void AcquireMeshHandleGeometry(Engine::Core &core, Engine::EntityId entityId);
+
+} // namespace DefaultPipeline::System
@@ -0,0 +1,14 @@
+#include "system/GPUComponentManagement/OnMeshHandleDestruction.hpp"
+#include "component/Mesh.hpp"
+#include "system/GPUComponentManagement/OnMeshDestruction.hpp"
+
+void DefaultPipeline::System::OnMeshHandleDestruction(Engine::Core &core, Engine::EntityId entityId)
+{
+    Engine::Entity entity{core, entityId};
+
+    // The GPUMesh belongs to the unique Mesh of the entity, if any.
+    if (entity.HasComponents<Object::Component::Mesh>())
+        return;
+
+    OnMeshDestruction(core, entityId);
+}
@@ -0,0 +1,45 @@
+#include "system/GPUComponentManagement/OnMeshLODCreation.hpp"
+#include "component/GPUMesh.hpp"
+#include "component/GPUMeshLOD.hpp"
+#include "component/MeshLOD.hpp"
+#include "resource/GeometryArena.hpp"
+#include <algorithm>
+
+void DefaultPipeline::System::OnMeshLODCreation(Engine::Core &core, Engine::EntityId entityId)
+{
+    Engine::Entity entity{core, entityId};
+
+    if (!entity.HasComponents<Component::GPUMesh>())
+        return;
+
+    const auto &meshLOD = entity.GetComponents<Object::Component::MeshLOD>();
+    auto &geometryArena = core.GetResource<Resource::GeometryArena>();
+
+    if (!entity.HasComponents<Component::GPUMeshLOD>())
+        entity.AddComponent<Component::GPUMeshLOD>();
+    auto &gpuMeshLOD = entity.GetComponents<Component::GPUMeshLOD>();
+    auto &gpuMesh = entity.GetComponents<Component::GPUMesh>();
+
+    // New levels are acquired before the old ones are released, so unchanged levels keep their ranges.
+    auto previousLevels = std::move(gpuMeshLOD.levels);
+    gpuMeshLOD.levels.clear();
+    gpuMesh.lodGeometry = Utils::INVALID_GEOMETRY_HANDLE;
+    try
+    {
+        for (const auto &level : meshLOD.levels)
+            gpuMeshLOD.levels.push_back(geometryArena.AcquireIndices(core, gpuMesh.geometry, level.indices));
+    }
+    catch (...)
+    {
+        // The levels acquired so far are released with the GPUMeshLOD, the previous ones are not referenced anymore.
+        for (auto handle : previousLevels)
+            geometryArena.Release(handle);
+        throw;
+    }
+    for (auto handle : previousLevels)
+        geometryArena.Release(handle);
+
+    gpuMeshLOD.level = std::min(gpuMeshLOD.level, static_cast<uint32_t>(gpuMeshLOD.levels.size()));
+    if (gpuMeshLOD.level > 0)
+        gpuMesh.lodGeometry = gpuMeshLOD.levels[gpuMeshLOD.level - 1];
+}
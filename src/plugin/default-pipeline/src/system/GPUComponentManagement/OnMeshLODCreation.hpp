@@ -0,0 +1,16 @@
+#pragma once
+
+#include "core/Core.hpp"
+#include "entity/Entity.hpp"
+
+namespace DefaultPipeline::System {
+
+/**
+ * @brief Upload the levels of an Object::Component::MeshLOD on top of the GPUMesh of the entity.
+ *
+ * Also called when the MeshLOD is updated. Does nothing until the entity has a GPUMesh: OnMeshCreation uploads the
+ * levels then.
+ */
+void OnMeshLODCreation(Engine::Core &core, Engine::EntityId entityId);
+
+} // namespace DefaultPipeline::System
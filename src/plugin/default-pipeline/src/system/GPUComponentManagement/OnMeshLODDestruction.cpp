@@ -0,0 +1,24 @@
+#include "system/GPUComponentManagement/OnMeshLODDestruction.hpp"
+#include "component/GPUMesh.hpp"
+#include "component/GPUMeshLOD.hpp"
+#include "resource/GeometryArena.hpp"
+
+void DefaultPipeline::System::OnMeshLODDestruction(Engine::Core &core, Engine::EntityId entityId)
+{
+    Engine::Entity entity{core, entityId};
+
+    if (!entity.HasComponents<Component::GPUMeshLOD>())
+        return;
+
+    auto &gpuMeshLOD = entity.GetComponents<Component::GPUMeshLOD>();
+
+    auto &geometryArena = core.GetResource<Resource::GeometryArena>();
+    for (auto handle : gpuMeshLOD.levels)
+        geometryArena.Release(handle);
+    gpuMeshLOD.levels.clear();
+
+    if (entity.HasComponents<Component::GPUMesh>())
+        entity.GetComponents<Component::GPUMesh>().lodGeometry = Utils::INVALID_GEOMETRY_HANDLE;
+
+    entity.RemoveComponent<Component::GPUMeshLOD>();
+}
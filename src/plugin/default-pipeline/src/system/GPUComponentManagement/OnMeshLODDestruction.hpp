@@ -0,0 +1,10 @@
+#pragma once
+
+#include "core/Core.hpp"
+#include "entity/Entity.hpp"
+
+namespace DefaultPipeline::System {
+
+void OnMeshLODDestruction(Engine::Core &core, Engine::EntityId entityId);
+
+} // namespace DefaultPipeline::System
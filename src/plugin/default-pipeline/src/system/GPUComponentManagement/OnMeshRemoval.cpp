@@ -0,0 +1,15 @@
+#include "system/GPUComponentManagement/OnMeshRemoval.hpp"
+#include "component/MeshHandle.hpp"
+#include "system/GPUComponentManagement/OnMeshDestruction.hpp"
+#include "system/GPUComponentManagement/OnMeshHandleCreation.hpp"
+
+void DefaultPipeline::System::OnMeshRemoval(Engine::Core &core, Engine::EntityId entityId)
+{
+    Engine::Entity entity{core, entityId};
+
+    OnMeshDestruction(core, entityId);
+
+    // The Mesh overrode a shared asset, the entity draws it again instead of nothing.
+    if (entity.HasComponents<Object::Component::MeshHandle>())
+        AcquireMeshHandleGeometry(core, entityId);
+}
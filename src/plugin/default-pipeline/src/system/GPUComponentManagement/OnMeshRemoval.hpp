@@ -0,0 +1,13 @@
+#pragma once
+
+#include "core/Core.hpp"
+#include "entity/Entity.hpp"
+
+namespace DefaultPipeline::System {
+
+/**
+ * @brief Release the geometry of a removed Object::Component::Mesh, then draw the MeshHandle it overrode, if any.
+ */
+void OnMeshRemoval(Engine::Core &core, Engine::EntityId entityId);
+
+} // namespace DefaultPipeline::System
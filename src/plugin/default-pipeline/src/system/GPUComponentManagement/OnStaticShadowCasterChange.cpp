@@ -0,0 +1,7 @@
+#include "system/GPUComponentManagement/OnStaticShadowCasterChange.hpp"
+#include "resource/ShadowAtlas.hpp"
+
+void DefaultPipeline::System::OnStaticShadowCasterChange(Engine::Core &core, Engine::EntityId)
+{
+    core.GetResource<Resource::ShadowAtlas>().InvalidateStaticCasters();
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "core/Core.hpp"
+#include "entity/Entity.hpp"
+
+namespace DefaultPipeline::System {
+
+/**
+ * @brief Invalidate the cached static shadow depth when a Component::StaticShadowCaster is added or removed.
+ */
+void OnStaticShadowCasterChange(Engine::Core &core, Engine::EntityId entityId);
+
+} // namespace DefaultPipeline::System
@@ -2,6 +2,7 @@
 #include "event/OnResize.hpp"
 #include "resource/DeviceContext.hpp"
 #include "resource/EventManager.hpp"
+#include "resource/PipelineCache.hpp"
 #include "resource/RenderGraphContainer.hpp"
 #include "resource/ShaderContainer.hpp"
 #include "resource/TextureContainer.hpp"
@@ -10,103 +11,39 @@
 #include "resource/pass/GBuffer.hpp"
 #include "resource/pass/Shadow.hpp"
 #include "system/WindowSystem.hpp"
+#include "utils/DirectionalLights.hpp"
 #include "utils/EndRenderTexture.hpp"
 
-wgpu::TextureDescriptor CreateGBufferPassOutputNormalTextureDescriptor(glm::uvec2 size)
+static glm::uvec2 GetRenderSize(Engine::Core &core)
 {
-    wgpu::TextureDescriptor descriptor{wgpu::Default};
-    descriptor.label = wgpu::StringView(DefaultPipeline::Resource::GBUFFER_PASS_OUTPUT_NORMAL);
-    descriptor.size = {size.x, size.y, 1};
-    descriptor.dimension = wgpu::TextureDimension::_2D;
-    descriptor.format = wgpu::TextureFormat::RGBA16Float;
-    descriptor.usage = wgpu::TextureUsage::TextureBinding | wgpu::TextureUsage::RenderAttachment |
-                       wgpu::TextureUsage::CopySrc | wgpu::TextureUsage::CopyDst;
-    return descriptor;
-}
-
-wgpu::TextureDescriptor CreateGBufferPassOutputAlbedoTextureDescriptor(glm::uvec2 size)
-{
-    wgpu::TextureDescriptor descriptor{wgpu::Default};
-    descriptor.label = wgpu::StringView(DefaultPipeline::Resource::GBUFFER_PASS_OUTPUT_ALBEDO);
-    descriptor.size = {size.x, size.y, 1};
-    descriptor.dimension = wgpu::TextureDimension::_2D;
-    descriptor.format = wgpu::TextureFormat::BGRA8Unorm;
-    descriptor.usage = wgpu::TextureUsage::TextureBinding | wgpu::TextureUsage::RenderAttachment |
-                       wgpu::TextureUsage::CopySrc | wgpu::TextureUsage::CopyDst;
-    return descriptor;
-}
-
-wgpu::TextureDescriptor CreateGBufferPassOutputDepthTextureDescriptor(glm::uvec2 size)
-{
-    wgpu::TextureDescriptor descriptor{wgpu::Default};
-    descriptor.label = wgpu::StringView(DefaultPipeline::Resource::GBUFFER_PASS_OUTPUT_DEPTH);
-    descriptor.size = {size.x, size.y, 1};
-    descriptor.dimension = wgpu::TextureDimension::_2D;
-    descriptor.format = wgpu::TextureFormat::Depth32Float;
-    descriptor.usage = wgpu::TextureUsage::TextureBinding | wgpu::TextureUsage::RenderAttachment |
-                       wgpu::TextureUsage::CopySrc | wgpu::TextureUsage::CopyDst;
-    return descriptor;
+    glm::uvec2 windowSize{Window::System::DEFAULT_WIDTH, Window::System::DEFAULT_HEIGHT};
+    if (core.HasResource<Window::Resource::Window>())
+    {
+        windowSize = core.GetResource<Window::Resource::Window>().GetSize();
+    }
+    return windowSize;
 }
 
-wgpu::TextureDescriptor CreateDeferredPassOutputTextureDescriptor(glm::uvec2 size)
+static void AddGBufferTransientTextures(Graphic::Resource::RenderGraph &renderGraph)
 {
-    wgpu::TextureDescriptor descriptor{wgpu::Default};
-    descriptor.label = wgpu::StringView(DefaultPipeline::Resource::DEFERRED_PASS_OUTPUT);
-    descriptor.size = {size.x, size.y, 1};
-    descriptor.dimension = wgpu::TextureDimension::_2D;
-    descriptor.format = wgpu::TextureFormat::RGBA16Float;
-    descriptor.usage = wgpu::TextureUsage::TextureBinding | wgpu::TextureUsage::RenderAttachment |
-                       wgpu::TextureUsage::CopySrc | wgpu::TextureUsage::CopyDst;
-    return descriptor;
+    const wgpu::TextureUsage usage = wgpu::TextureUsage::TextureBinding | wgpu::TextureUsage::RenderAttachment |
+                                     wgpu::TextureUsage::CopySrc | wgpu::TextureUsage::CopyDst;
+    renderGraph.AddTransientTexture(DefaultPipeline::Resource::GBUFFER_PASS_OUTPUT_NORMAL,
+                                    {.format = wgpu::TextureFormat::RGBA16Float, .usage = usage});
+    renderGraph.AddTransientTexture(DefaultPipeline::Resource::GBUFFER_PASS_OUTPUT_ALBEDO,
+                                    {.format = wgpu::TextureFormat::BGRA8Unorm, .usage = usage});
+    renderGraph.AddTransientTexture(DefaultPipeline::Resource::GBUFFER_PASS_OUTPUT_DEPTH,
+                                    {.format = wgpu::TextureFormat::Depth32Float, .usage = usage});
 }
 
-static void CreateGBufferTextures(Engine::Core &core)
+static void RegisterTransientTexturesResize(Engine::Core &core)
 {
-    const auto &deviceContext = core.GetResource<Graphic::Resource::DeviceContext>();
-    auto &textureContainer = core.GetResource<Graphic::Resource::TextureContainer>();
     auto &eventManager = core.GetResource<Event::Resource::EventManager>();
-
-    glm::uvec2 windowSize{Window::System::DEFAULT_WIDTH, Window::System::DEFAULT_HEIGHT};
-    if (core.HasResource<Window::Resource::Window>())
-    {
-        windowSize = core.GetResource<Window::Resource::Window>().GetSize();
-    }
-    {
-        auto descriptor = CreateGBufferPassOutputNormalTextureDescriptor(windowSize);
-        Graphic::Resource::Texture defaultTexture(deviceContext, descriptor);
-        textureContainer.Add(DefaultPipeline::Resource::GBUFFER_PASS_OUTPUT_NORMAL_ID, std::move(defaultTexture));
-        eventManager.RegisterCallback<Window::Event::OnResize>([&core, &textureContainer,
-                                                                &deviceContext](const Window::Event::OnResize &event) {
-            auto descriptor = CreateGBufferPassOutputNormalTextureDescriptor({event.newSize.x, event.newSize.y});
-            Graphic::Resource::Texture resizedTexture(deviceContext, descriptor);
-            textureContainer.Remove(DefaultPipeline::Resource::GBUFFER_PASS_OUTPUT_NORMAL_ID);
-            textureContainer.Add(DefaultPipeline::Resource::GBUFFER_PASS_OUTPUT_NORMAL_ID, std::move(resizedTexture));
-        });
-    }
-    {
-        auto descriptor = CreateGBufferPassOutputAlbedoTextureDescriptor(windowSize);
-        Graphic::Resource::Texture defaultTexture(deviceContext, descriptor);
-        textureContainer.Add(DefaultPipeline::Resource::GBUFFER_PASS_OUTPUT_ALBEDO_ID, std::move(defaultTexture));
-        eventManager.RegisterCallback<Window::Event::OnResize>([&core, &textureContainer,
-                                                                &deviceContext](const Window::Event::OnResize &event) {
-            auto descriptor = CreateGBufferPassOutputAlbedoTextureDescriptor({event.newSize.x, event.newSize.y});
-            Graphic::Resource::Texture resizedTexture(deviceContext, descriptor);
-            textureContainer.Remove(DefaultPipeline::Resource::GBUFFER_PASS_OUTPUT_ALBEDO_ID);
-            textureContainer.Add(DefaultPipeline::Resource::GBUFFER_PASS_OUTPUT_ALBEDO_ID, std::move(resizedTexture));
-        });
-    }
-    {
-        auto descriptor = CreateGBufferPassOutputDepthTextureDescriptor(windowSize);
-        Graphic::Resource::Texture defaultTexture(deviceContext, descriptor);
-        textureContainer.Add(DefaultPipeline::Resource::GBUFFER_PASS_OUTPUT_DEPTH_ID, std::move(defaultTexture));
-        eventManager.RegisterCallback<Window::Event::OnResize>([&core, &textureContainer,
-                                                                &deviceContext](const Window::Event::OnResize &event) {
-            auto descriptor = CreateGBufferPassOutputDepthTextureDescriptor({event.newSize.x, event.newSize.y});
-            Graphic::Resource::Texture resizedTexture(deviceContext, descriptor);
-            textureContainer.Remove(DefaultPipeline::Resource::GBUFFER_PASS_OUTPUT_DEPTH_ID);
-            textureContainer.Add(DefaultPipeline::Resource::GBUFFER_PASS_OUTPUT_DEPTH_ID, std::move(resizedTexture));
-        });
-    }
+    // Registered before the bind group callbacks, so that they see the resized textures.
+    eventManager.RegisterCallback<Window::Event::OnResize>([&core](const Window::Event::OnResize &event) {
+        auto &renderGraph = core.GetResource<Graphic::Resource::RenderGraphContainer>().GetDefault();
+        renderGraph.ResizeTransientTextures(core, {event.newSize.x, event.newSize.y});
+    });
 }
 
 static void CreateDeferredTexturesBindingGroup(Engine::Core &core)
@@ -148,18 +85,16 @@ static void CreateDeferredTexturesBindingGroup(Engine::Core &core)
 
 static Graphic::Resource::RenderGraph CreateGraph(Engine::Core &core)
 {
+    // The three pipelines compile in parallel, they are added to the ShaderContainer by Create3DGraph.
+    auto &pipelineCache = core.GetResource<Graphic::Resource::PipelineCache>();
     Graphic::Resource::RenderGraph renderGraph{};
     {
         // GBUFFER
         DefaultPipeline::Resource::GBuffer GBufferPass{};
 
-        {
-            auto GBufferShader =
-                DefaultPipeline::Resource::GBuffer::CreateShader(core.GetResource<Graphic::Resource::DeviceContext>());
-            core.GetResource<Graphic::Resource::ShaderContainer>().Add(DefaultPipeline::Resource::GBUFFER_SHADER_ID,
-                                                                       std::move(GBufferShader));
-            GBufferPass.BindShader(DefaultPipeline::Resource::GBUFFER_SHADER_NAME);
-        }
+        pipelineCache.CreateAsync(core, DefaultPipeline::Resource::GBUFFER_SHADER_NAME,
+                                  DefaultPipeline::Resource::GBuffer::CreateShaderDescriptor());
+        GBufferPass.BindShader(DefaultPipeline::Resource::GBUFFER_SHADER_NAME);
         {
             Graphic::Resource::ColorOutput normalOutput;
             normalOutput.textureId = DefaultPipeline::Resource::GBUFFER_PASS_OUTPUT_NORMAL_ID;
@@ -192,13 +127,9 @@ static Graphic::Resource::RenderGraph CreateGraph(Engine::Core &core)
     {
         // SHADOW
         DefaultPipeline::Resource::Shadow shadowPass{};
-        {
-            auto ShadowShader =
-                DefaultPipeline::Resource::Shadow::CreateShader(core.GetResource<Graphic::Resource::DeviceContext>());
-            core.GetResource<Graphic::Resource::ShaderContainer>().Add(DefaultPipeline::Resource::SHADOW_SHADER_ID,
-                                                                       std::move(ShadowShader));
-            shadowPass.BindShader(DefaultPipeline::Resource::SHADOW_SHADER_NAME);
-        }
+        pipelineCache.CreateAsync(core, DefaultPipeline::Resource::SHADOW_SHADER_NAME,
+                                  DefaultPipeline::Resource::Shadow::CreateShaderDescriptor());
+        shadowPass.BindShader(DefaultPipeline::Resource::SHADOW_SHADER_NAME);
         {
             Graphic::Resource::DepthOutput output;
             output.getClearDepthCallback = [](Engine::Core &, float &clearDepth) {
@@ -207,18 +138,16 @@ static Graphic::Resource::RenderGraph CreateGraph(Engine::Core &core)
             };
             shadowPass.AddOutput(std::move(output));
         }
+        shadowPass.AddTextureWrite(DefaultPipeline::Utils::DIRECTIONAL_LIGHTS_SHADOW_TEXTURE_NAME);
+        shadowPass.AddTextureWrite(DefaultPipeline::Utils::DIRECTIONAL_LIGHTS_SHADOW_CACHE_TEXTURE_NAME);
         renderGraph.Add(DefaultPipeline::Resource::SHADOW_PASS_NAME, std::move(shadowPass));
     }
     {
         // DEFERRED
         DefaultPipeline::Resource::Deferred deferredPass{};
-        {
-            auto DeferredShader =
-                DefaultPipeline::Resource::Deferred::CreateShader(core.GetResource<Graphic::Resource::DeviceContext>());
-            core.GetResource<Graphic::Resource::ShaderContainer>().Add(DefaultPipeline::Resource::DEFERRED_SHADER_ID,
-                                                                       std::move(DeferredShader));
-            deferredPass.BindShader(DefaultPipeline::Resource::DEFERRED_SHADER_NAME);
-        }
+        pipelineCache.CreateAsync(core, DefaultPipeline::Resource::DEFERRED_SHADER_NAME,
+                                  DefaultPipeline::Resource::Deferred::CreateShaderDescriptor());
+        deferredPass.BindShader(DefaultPipeline::Resource::DEFERRED_SHADER_NAME);
         {
             Graphic::Resource::ColorOutput output;
             output.textureId = Graphic::Utils::END_RENDER_TEXTURE_ID;
@@ -228,13 +157,15 @@ static Graphic::Resource::RenderGraph CreateGraph(Engine::Core &core)
             };
             deferredPass.AddOutput(0, std::move(output));
         }
+        deferredPass.AddTextureRead(DefaultPipeline::Resource::GBUFFER_PASS_OUTPUT_NORMAL);
+        deferredPass.AddTextureRead(DefaultPipeline::Resource::GBUFFER_PASS_OUTPUT_ALBEDO);
+        deferredPass.AddTextureRead(DefaultPipeline::Resource::GBUFFER_PASS_OUTPUT_DEPTH);
+        deferredPass.AddTextureRead(DefaultPipeline::Utils::DIRECTIONAL_LIGHTS_SHADOW_TEXTURE_NAME);
         renderGraph.Add(DefaultPipeline::Resource::DEFERRED_PASS_NAME, std::move(deferredPass));
     }
 
-    renderGraph.SetDependency(DefaultPipeline::Resource::GBUFFER_PASS_NAME,
-                              DefaultPipeline::Resource::DEFERRED_PASS_NAME);
-    renderGraph.SetDependency(DefaultPipeline::Resource::SHADOW_PASS_NAME,
-                              DefaultPipeline::Resource::DEFERRED_PASS_NAME);
+    AddGBufferTransientTextures(renderGraph);
+    renderGraph.AddOutput(Graphic::Utils::END_RENDER_TEXTURE_NAME);
 
     return renderGraph;
 }
@@ -243,8 +174,14 @@ void DefaultPipeline::System::Create3DGraph(Engine::Core &core)
 {
     auto &renderPassContainer = core.GetResource<Graphic::Resource::RenderGraphContainer>();
 
-    CreateGBufferTextures(core);
     auto renderGraph = CreateGraph(core);
-    CreateDeferredTexturesBindingGroup(core);
     renderPassContainer.SetDefault(std::move(renderGraph));
+    // Bind groups are created from the pipeline layouts: the shaders must be ready.
+    core.GetResource<Graphic::Resource::PipelineCache>().WaitAll(core);
+
+    // The G-buffer textures belong to the graph: they must exist before the deferred bind group is created.
+    auto &defaultGraph = renderPassContainer.GetDefault();
+    defaultGraph.ResizeTransientTextures(core, GetRenderSize(core));
+    RegisterTransientTexturesResize(core);
+    CreateDeferredTexturesBindingGroup(core);
 }
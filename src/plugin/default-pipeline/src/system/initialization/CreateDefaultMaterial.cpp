@@ -1,11 +1,9 @@
 #include "system/initialization/CreateDefaultMaterial.hpp"
-#include "component/GPUMaterial.hpp"
 #include "component/Material.hpp"
 #include "resource/BindGroup.hpp"
 #include "resource/BindGroupManager.hpp"
-#include "resource/DeviceContext.hpp"
-#include "resource/GPUBufferContainer.hpp"
-#include "resource/buffer/MaterialGPUBuffer.hpp"
+#include "resource/MaterialAtlas.hpp"
+#include "resource/MaterialTable.hpp"
 #include "resource/pass/GBuffer.hpp"
 #include "utils/DefaultMaterial.hpp"
 #include "utils/DefaultSampler.hpp"
@@ -14,27 +12,28 @@
 void DefaultPipeline::System::CreateDefaultMaterial(Engine::Core &core)
 {
     auto &bindGroupManager = core.GetResource<Graphic::Resource::BindGroupManager>();
+    auto &materialAtlas = core.GetResource<Resource::MaterialAtlas>();
+    auto &materialTable = core.GetResource<Resource::MaterialTable>();
+
+    materialAtlas.Create(core);
+    materialTable.Create(core);
 
-    auto materialBuffer = std::make_unique<Resource::MaterialGPUBuffer>();
-    materialBuffer->Create(core);
     Object::Component::Material defaultMaterial;
     defaultMaterial.diffuseTexName = Graphic::Utils::DEFAULT_TEXTURE_NAME;
-    materialBuffer->SetMaterial(core, defaultMaterial);
-
-    uint64_t materialBufferSize = materialBuffer->GetBuffer().getSize();
+    materialTable.SetMaterial(Utils::DEFAULT_MATERIAL_SLOT, defaultMaterial);
 
-    auto &gpuBufferContainer = core.GetResource<Graphic::Resource::GPUBufferContainer>();
-    gpuBufferContainer.Add(Utils::DEFAULT_MATERIAL_ID, std::move(materialBuffer));
+    if (auto region = materialAtlas.Acquire(core, Graphic::Utils::DEFAULT_TEXTURE_ID); region.has_value())
+        materialTable.SetTexture(Utils::DEFAULT_MATERIAL_SLOT, region.value());
+    else
+        materialTable.SetStandaloneTexture(Utils::DEFAULT_MATERIAL_SLOT);
 
     Graphic::Resource::BindGroup bindGroup(
-        core, Utils::DEFAULT_MATERIAL_BIND_GROUP_NAME, Resource::GBUFFER_SHADER_ID, 2,
+        core, Utils::DEFAULT_MATERIAL_TEXTURE_BIND_GROUP_NAME, Resource::GBUFFER_SHADER_ID, 3,
         {
-            {
-             0, Graphic::Resource::BindGroup::Asset::Type::Buffer,
-             Utils::DEFAULT_MATERIAL_ID,
-             materialBufferSize, },
-            {1, Graphic::Resource::BindGroup::Asset::Type::Texture, Graphic::Utils::DEFAULT_TEXTURE_ID, 0},
-            {2, Graphic::Resource::BindGroup::Asset::Type::Sampler, Graphic::Utils::DEFAULT_SAMPLER_ID, 0},
+            {0, Graphic::Resource::BindGroup::Asset::Type::Texture, Graphic::Utils::DEFAULT_TEXTURE_ID, 0},
+            {1, Graphic::Resource::BindGroup::Asset::Type::Sampler, Graphic::Utils::DEFAULT_SAMPLER_ID, 0},
     });
-    bindGroupManager.Add(Utils::DEFAULT_MATERIAL_BIND_GROUP_ID, std::move(bindGroup));
+    bindGroupManager.Add(Utils::DEFAULT_MATERIAL_TEXTURE_BIND_GROUP_ID, std::move(bindGroup));
+
+    materialTable.Upload(core);
 }
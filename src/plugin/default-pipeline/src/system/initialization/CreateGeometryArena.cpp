@@ -0,0 +1,12 @@
+#include "CreateGeometryArena.hpp"
+#include "resource/GeometryArena.hpp"
+
+namespace DefaultPipeline::System {
+
+void CreateGeometryArena(Engine::Core &core)
+{
+    auto &geometryArena = core.GetResource<Resource::GeometryArena>();
+    geometryArena.Create(core);
+}
+
+} // namespace DefaultPipeline::System
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "core/Core.hpp"
+
+namespace DefaultPipeline::System {
+
+void CreateGeometryArena(Engine::Core &core);
+
+} // namespace DefaultPipeline::System
@@ -1,5 +1,6 @@
 #include "resource/BindGroupManager.hpp"
 #include "resource/GPUBufferContainer.hpp"
+#include "resource/ShadowAtlas.hpp"
 #include "resource/buffer/PointLightsBuffer.hpp"
 #include "resource/pass/Deferred.hpp"
 #include "system/initialization/CreatePointLights.hpp"
@@ -11,7 +12,6 @@ namespace DefaultPipeline::System {
 
 static void CreateDirectionalLightsShadowTextures(Engine::Core &core)
 {
-    auto &textureContainer = core.GetResource<Graphic::Resource::TextureContainer>();
     auto &samplerContainer = core.GetResource<Graphic::Resource::SamplerContainer>();
     const auto &deviceContext = core.GetResource<Graphic::Resource::DeviceContext>();
     const auto &device = deviceContext.GetDevice();
@@ -22,15 +22,7 @@ static void CreateDirectionalLightsShadowTextures(Engine::Core &core)
         return;
     }
 
-    wgpu::TextureDescriptor textureDescriptor(wgpu::Default);
-    textureDescriptor.label = wgpu::StringView("DIRECTIONAL_LIGHTS_SHADOW_TEXTURE");
-    textureDescriptor.size = {2048, 2048, Utils::MAX_DIRECTIONAL_LIGHTS};
-    textureDescriptor.dimension = wgpu::TextureDimension::_2D;
-    textureDescriptor.format = wgpu::TextureFormat::Depth32Float;
-    textureDescriptor.usage = wgpu::TextureUsage::TextureBinding | wgpu::TextureUsage::RenderAttachment |
-                              wgpu::TextureUsage::CopySrc | wgpu::TextureUsage::CopyDst;
-    Graphic::Resource::Texture shadowTexture(deviceContext, textureDescriptor);
-    textureContainer.Add(Utils::DIRECTIONAL_LIGHTS_SHADOW_TEXTURE_ID, std::move(shadowTexture));
+    core.GetResource<Resource::ShadowAtlas>().Create(core);
 
     wgpu::SamplerDescriptor samplerDescriptor(wgpu::Default);
     samplerDescriptor.label = wgpu::StringView("DIRECTIONAL_LIGHTS_SHADOW_SAMPLER");
@@ -55,23 +47,33 @@ void CreateLights(Engine::Core &core)
     auto &pointLightsBuffer = bufferManager.Get(Utils::POINT_LIGHTS_BUFFER_ID);
     auto pointLightsBufferSize = pointLightsBuffer->GetBuffer().getSize();
 
+    auto &pointLightClustersBuffer = bufferManager.Get(Utils::POINT_LIGHT_CLUSTERS_BUFFER_ID);
+    auto pointLightClustersBufferSize = pointLightClustersBuffer->GetBuffer().getSize();
+
     auto &directionalLightsBuffer = bufferManager.Get(Utils::DIRECTIONAL_LIGHTS_BUFFER_ID);
     auto directionalLightsBufferSize = directionalLightsBuffer->GetBuffer().getSize();
 
     CreateDirectionalLightsShadowTextures(core);
 
+    auto &shadowCascadesBuffer = bufferManager.Get(Utils::SHADOW_CASCADES_BUFFER_ID);
+    auto shadowCascadesBufferSize = shadowCascadesBuffer->GetBuffer().getSize();
+
     auto &bindGroupManager = core.GetResource<Graphic::Resource::BindGroupManager>();
     Graphic::Resource::BindGroup lightsBindGroup(
         core, Utils::LIGHTS_BIND_GROUP_NAME, Resource::DEFERRED_SHADER_ID, 2,
         {
-            {0, Graphic::Resource::BindGroup::Asset::Type::Buffer,  Utils::AMBIENT_LIGHT_BUFFER_ID,
-             ambientLightBufferSize                                                                               },
-            {1, Graphic::Resource::BindGroup::Asset::Type::Buffer,  Utils::POINT_LIGHTS_BUFFER_ID,
-             pointLightsBufferSize                                                                                },
-            {2, Graphic::Resource::BindGroup::Asset::Type::Buffer,  Utils::DIRECTIONAL_LIGHTS_BUFFER_ID,
-             directionalLightsBufferSize                                                                          },
-            {3, Graphic::Resource::BindGroup::Asset::Type::Texture, Utils::DIRECTIONAL_LIGHTS_SHADOW_TEXTURE_ID, 0},
-            {4, Graphic::Resource::BindGroup::Asset::Type::Sampler, Utils::DIRECTIONAL_LIGHTS_SHADOW_SAMPLER_ID, 0}
+            {0, Graphic::Resource::BindGroup::Asset::Type::Buffer, Utils::AMBIENT_LIGHT_BUFFER_ID,
+             ambientLightBufferSize},
+            {1, Graphic::Resource::BindGroup::Asset::Type::Buffer, Utils::POINT_LIGHTS_BUFFER_ID,
+             pointLightsBufferSize},
+            {2, Graphic::Resource::BindGroup::Asset::Type::Buffer, Utils::DIRECTIONAL_LIGHTS_BUFFER_ID,
+             directionalLightsBufferSize},
+            {3, Graphic::Resource::BindGroup::Asset::Type::TextureView, Utils::DIRECTIONAL_LIGHTS_SHADOW_VIEW_ID, 0},
+            {4, Graphic::Resource::BindGroup::Asset::Type::Sampler, Utils::DIRECTIONAL_LIGHTS_SHADOW_SAMPLER_ID, 0},
+            {5, Graphic::Resource::BindGroup::Asset::Type::Buffer, Utils::POINT_LIGHT_CLUSTERS_BUFFER_ID,
+             pointLightClustersBufferSize},
+            {6, Graphic::Resource::BindGroup::Asset::Type::Buffer, Utils::SHADOW_CASCADES_BUFFER_ID,
+             shadowCascadesBufferSize},
     });
     bindGroupManager.Add(Utils::LIGHTS_BIND_GROUP_ID, std::move(lightsBindGroup));
 }
@@ -1,6 +1,7 @@
 #include "system/initialization/CreatePointLights.hpp"
 #include "resource/BindGroupManager.hpp"
 #include "resource/GPUBufferContainer.hpp"
+#include "resource/buffer/PointLightClustersBuffer.hpp"
 #include "resource/buffer/PointLightsBuffer.hpp"
 
 namespace DefaultPipeline::System {
@@ -11,7 +12,10 @@ void CreatePointLights(Engine::Core &core)
 
     auto pointLightsBuffer = std::make_unique<Resource::PointLightsBuffer>();
     pointLightsBuffer->Create(core);
-    auto pointLightsBufferSize = pointLightsBuffer->GetBuffer().getSize();
     bufferManager.Add(Utils::POINT_LIGHTS_BUFFER_ID, std::move(pointLightsBuffer));
+
+    auto pointLightClustersBuffer = std::make_unique<Resource::PointLightClustersBuffer>();
+    pointLightClustersBuffer->Create(core);
+    bufferManager.Add(Utils::POINT_LIGHT_CLUSTERS_BUFFER_ID, std::move(pointLightClustersBuffer));
 }
 } // namespace DefaultPipeline::System
@@ -0,0 +1,53 @@
+#include "system/preparation/SelectMeshLODs.hpp"
+#include "component/Camera.hpp"
+#include "component/GPUCamera.hpp"
+#include "component/GPUMesh.hpp"
+#include "component/GPUMeshLOD.hpp"
+#include "component/GlobalTransform.hpp"
+#include "component/MeshLOD.hpp"
+#include "component/Transform.hpp"
+#include "utils/BoundingSphere.hpp"
+#include "utils/MeshLOD.hpp"
+#include <algorithm>
+#include <vector>
+
+void DefaultPipeline::System::SelectMeshLODs(Engine::Core &core)
+{
+    auto &registry = core.GetRegistry();
+
+    // Same camera selection as the Deferred pass.
+    const auto cameraEntity = registry.view<Component::GPUCamera>().front();
+    if (cameraEntity == entt::null ||
+        !registry.all_of<Object::Component::Transform, Object::Component::Camera>(cameraEntity))
+    {
+        return;
+    }
+
+    const auto &camera = registry.get<Object::Component::Camera>(cameraEntity);
+    const auto *cameraGlobalTransform = registry.try_get<Object::Component::GlobalTransform>(cameraEntity);
+    const glm::vec3 cameraPosition = cameraGlobalTransform
+                                         ? cameraGlobalTransform->GetPosition()
+                                         : registry.get<Object::Component::Transform>(cameraEntity).GetPosition();
+    std::vector<float> screenSizes;
+
+    registry
+        .view<Object::Component::Transform, Object::Component::MeshLOD, Component::GPUMesh, Component::GPUMeshLOD>()
+        .each([&registry, &camera, &cameraPosition, &screenSizes](
+                  auto entity, const Object::Component::Transform &transform, const Object::Component::MeshLOD &meshLOD,
+                  Component::GPUMesh &gpuMesh, Component::GPUMeshLOD &gpuMeshLOD) {
+            const auto *globalTransform = registry.try_get<Object::Component::GlobalTransform>(entity);
+            const glm::mat4 model = globalTransform ? globalTransform->matrix : transform.ComputeTransformationMatrix();
+            const glm::vec4 sphere = Utils::TransformBoundingSphere(model, gpuMesh.bounds);
+            const float screenSize =
+                Utils::ComputeScreenSize(camera.projection, sphere.w, glm::distance(glm::vec3(sphere), cameraPosition));
+
+            const size_t levelCount = std::min(meshLOD.levels.size(), gpuMeshLOD.levels.size());
+            screenSizes.resize(levelCount);
+            for (size_t i = 0; i < levelCount; ++i)
+                screenSizes[i] = meshLOD.levels[i].screenSize;
+
+            gpuMeshLOD.level = Utils::SelectLODLevel(gpuMeshLOD.level, screenSize, screenSizes, meshLOD.hysteresis);
+            gpuMesh.lodGeometry =
+                gpuMeshLOD.level > 0 ? gpuMeshLOD.levels[gpuMeshLOD.level - 1] : Utils::INVALID_GEOMETRY_HANDLE;
+        });
+}
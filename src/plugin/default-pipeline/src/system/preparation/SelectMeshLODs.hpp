@@ -0,0 +1,13 @@
+#pragma once
+
+#include "core/Core.hpp"
+
+namespace DefaultPipeline::System {
+
+/**
+ * @brief Select the level of detail drawn for each mesh with an Object::Component::MeshLOD, from the projected size of
+ * its bounding sphere in the main camera.
+ */
+void SelectMeshLODs(Engine::Core &core);
+
+} // namespace DefaultPipeline::System
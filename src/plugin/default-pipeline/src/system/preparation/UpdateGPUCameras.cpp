@@ -1,6 +1,7 @@
 #include "system/preparation/UpdateGPUCameras.hpp"
 #include "component/Camera.hpp"
 #include "component/GPUCamera.hpp"
+#include "component/GlobalTransform.hpp"
 #include "component/Transform.hpp"
 #include "entity/Entity.hpp"
 #include "resource/BindGroupManager.hpp"
@@ -9,19 +10,22 @@
 
 void DefaultPipeline::System::UpdateGPUCameras(Engine::Core &core)
 {
+    auto &registry = core.GetRegistry();
     auto &gpuBufferContainer = core.GetResource<Graphic::Resource::GPUBufferContainer>();
     const auto &textureContainer = core.GetResource<Graphic::Resource::TextureContainer>();
 
-    core.GetRegistry().view<Object::Component::Transform, Object::Component::Camera, Component::GPUCamera>().each(
-        [&core, &gpuBufferContainer, &textureContainer](Object::Component::Transform &transform,
-                                                        Object::Component::Camera &camera,
-                                                        Component::GPUCamera &gpuCamera) {
+    registry.view<Object::Component::Transform, Object::Component::Camera, Component::GPUCamera>().each(
+        [&core, &registry, &gpuBufferContainer, &textureContainer](
+            auto entity, Object::Component::Transform &transform, Object::Component::Camera &camera,
+            Component::GPUCamera &gpuCamera) {
             if (gpuCamera.targetTexture.value() != 0 && textureContainer.Contains(gpuCamera.targetTexture))
             {
                 const auto &texture = textureContainer.Get(gpuCamera.targetTexture);
                 camera.UpdateAspectRatio(texture.GetSize());
             }
-            camera.Update(transform);
+            // Cameras attached to a parent follow it.
+            const auto *globalTransform = registry.try_get<Object::Component::GlobalTransform>(entity);
+            camera.Update(globalTransform ? globalTransform->ToTransform() : transform);
             auto &gpuBuffer = gpuBufferContainer.Get(gpuCamera.buffer);
             gpuBuffer->Update(core);
         });
@@ -1,24 +1,32 @@
 #include "system/preparation/UpdateGPUDirectionalLight.hpp"
-#include "component/DirectionalLight.hpp"
+#include "component/Camera.hpp"
+#include "component/GPUCamera.hpp"
 #include "component/GPUDirectionalLight.hpp"
+#include "component/GlobalTransform.hpp"
 #include "component/Transform.hpp"
-#include "entity/Entity.hpp"
-#include "resource/BindGroupManager.hpp"
-#include "resource/GPUBufferContainer.hpp"
-#include "resource/TextureContainer.hpp"
+#include "resource/ShadowAtlas.hpp"
 
 void DefaultPipeline::System::UpdateGPUDirectionalLight(Engine::Core &core)
 {
-    auto &gpuBufferContainer = core.GetResource<Graphic::Resource::GPUBufferContainer>();
-    const auto &textureContainer = core.GetResource<Graphic::Resource::TextureContainer>();
+    auto &registry = core.GetRegistry();
+    auto &shadowAtlas = core.GetResource<Resource::ShadowAtlas>();
 
-    core.GetRegistry()
-        .view<Object::Component::Transform, Object::Component::DirectionalLight, Component::GPUDirectionalLight>()
-        .each([&core, &gpuBufferContainer, &textureContainer](Object::Component::Transform &transform,
-                                                              Object::Component::DirectionalLight &directionalLight,
-                                                              Component::GPUDirectionalLight &gpuDirectionalLight) {
-            gpuDirectionalLight.Update(directionalLight, transform);
-            auto &gpuBuffer = gpuBufferContainer.Get(gpuDirectionalLight.buffer);
-            gpuBuffer->Update(core);
-        });
+    // Same camera selection as the Deferred pass: the cascades split the shaded view.
+    const auto cameraEntity = registry.view<Component::GPUCamera>().front();
+    if (cameraEntity != entt::null)
+    {
+        const auto &camera = registry.get<Object::Component::Camera>(cameraEntity);
+        registry.view<Object::Component::Transform, Component::GPUDirectionalLight>().each(
+            [&registry, &camera, &shadowAtlas](auto entity, const Object::Component::Transform &transform,
+                                               Component::GPUDirectionalLight &gpuDirectionalLight) {
+                const auto *globalTransform = registry.try_get<Object::Component::GlobalTransform>(entity);
+                gpuDirectionalLight.Update(globalTransform ? globalTransform->ToTransform() : transform, camera);
+                if (!gpuDirectionalLight.firstCascadeLayer.has_value())
+                    return;
+                for (uint32_t i = 0; i < Utils::SHADOW_CASCADE_COUNT; ++i)
+                    shadowAtlas.SetCascade(gpuDirectionalLight.firstCascadeLayer.value() + i,
+                                           gpuDirectionalLight.cascades[i]);
+            });
+    }
+    shadowAtlas.Upload(core);
 }
@@ -1,13 +1,15 @@
 #include "system/preparation/UpdateGPUMaterials.hpp"
 #include "component/GPUMaterial.hpp"
-#include "resource/GPUBufferContainer.hpp"
+#include "component/Material.hpp"
+#include "resource/MaterialTable.hpp"
 
 void DefaultPipeline::System::UpdateGPUMaterials(Engine::Core &core)
 {
-    auto &gpuBufferContainer = core.GetResource<Graphic::Resource::GPUBufferContainer>();
-    core.GetRegistry().view<Component::GPUMaterial>().each(
-        [&core, &gpuBufferContainer](Component::GPUMaterial &gpuMaterial) {
-            auto &gpuBuffer = gpuBufferContainer.Get(gpuMaterial.buffer);
-            gpuBuffer->Update(core);
+    auto &materialTable = core.GetResource<Resource::MaterialTable>();
+    // Only the materials whose parameters changed are uploaded, in a single write.
+    core.GetRegistry().view<Object::Component::Material, Component::GPUMaterial>().each(
+        [&materialTable](const Object::Component::Material &material, const Component::GPUMaterial &gpuMaterial) {
+            materialTable.SetMaterial(gpuMaterial.slot, material);
         });
+    materialTable.Upload(core);
 }
@@ -1,17 +1,22 @@
 #include "UpdateGPUMeshes.hpp"
 
 #include "component/GPUMesh.hpp"
+#include "component/GPUMeshLOD.hpp"
 #include "component/Mesh.hpp"
-#include "resource/DeviceContext.hpp"
-#include "resource/GPUBufferContainer.hpp"
-#include "resource/buffer/PointGPUBuffer.hpp"
+#include "component/MeshLOD.hpp"
+#include "component/StaticShadowCaster.hpp"
+#include "exception/UpdateBufferError.hpp"
+#include "resource/GeometryArena.hpp"
+#include "resource/ShadowAtlas.hpp"
+#include "system/GPUComponentManagement/OnMeshLODCreation.hpp"
+#include "utils/BoundingSphere.hpp"
 
 namespace DefaultPipeline::System {
 
 void UpdateGPUMeshes(Engine::Core &core)
 {
     auto &registry = core.GetRegistry();
-    auto &gpuBufferContainer = core.GetResource<Graphic::Resource::GPUBufferContainer>();
+    auto &geometryArena = core.GetResource<Resource::GeometryArena>();
 
     auto view = registry.view<Object::Component::Mesh, Component::GPUMesh>();
 
@@ -24,15 +29,30 @@ void UpdateGPUMeshes(Engine::Core &core)
 
         auto &gpuMesh = view.get<Component::GPUMesh>(entity);
 
-        if (gpuBufferContainer.Contains(gpuMesh.pointBufferId))
+        // Levels of detail are released before their parent ranges may move, then acquired on the new ones.
+        if (registry.all_of<Component::GPUMeshLOD>(entity))
+            registry.remove<Component::GPUMeshLOD>(entity);
+
+        gpuMesh.geometry = geometryArena.Update(core, gpuMesh.geometry, mesh);
+        gpuMesh.bounds = Utils::ComputeBoundingSphere(mesh.GetVertices());
+        mesh.ClearDirty();
+
+        if (registry.all_of<Object::Component::MeshLOD>(entity))
         {
-            auto &buffer = gpuBufferContainer.Get(gpuMesh.pointBufferId);
-            if (buffer && buffer->IsCreated(core))
+            try
             {
-                buffer->Update(core);
-                mesh.ClearDirty();
+                OnMeshLODCreation(core, entity);
+            }
+            catch (const Graphic::Exception::UpdateBufferError &error)
+            {
+                Log::Warning(fmt::format("UpdateGPUMeshes: Levels of detail of entity {} no longer match its mesh: {}",
+                                         Engine::EntityId(entity), error.what()));
+                registry.remove<Component::GPUMeshLOD>(entity);
             }
         }
+
+        if (registry.all_of<Component::StaticShadowCaster>(entity))
+            core.GetResource<Resource::ShadowAtlas>().InvalidateStaticCasters();
     }
 }
 
@@ -1,12 +1,18 @@
 #include "system/preparation/UpdateGPUTransforms.hpp"
 #include "component/GPUTransform.hpp"
+#include "component/GlobalTransform.hpp"
 #include "resource/GPUBufferContainer.hpp"
 
 void DefaultPipeline::System::UpdateGPUTransforms(Engine::Core &core)
 {
+    auto &registry = core.GetRegistry();
     auto &gpuBufferContainer = core.GetResource<Graphic::Resource::GPUBufferContainer>();
-    core.GetRegistry().view<Component::GPUTransform>().each(
-        [&core, &gpuBufferContainer](Component::GPUTransform &gpuTransform) {
+    registry.view<Component::GPUTransform>().each(
+        [&core, &registry, &gpuBufferContainer](auto entity, Component::GPUTransform &gpuTransform) {
+            // Entities whose world transform did not move since the last frame keep their uploaded matrices.
+            const auto *globalTransform = registry.try_get<Object::Component::GlobalTransform>(entity);
+            if (globalTransform != nullptr && !globalTransform->changed)
+                return;
             auto &gpuBuffer = gpuBufferContainer.Get(gpuTransform.modelMatrixBuffer);
             gpuBuffer->Update(core);
         });
@@ -0,0 +1,30 @@
+#include "system/preparation/UpdatePendingMaterialTextures.hpp"
+#include "component/GPUMaterial.hpp"
+#include "resource/AsyncTextureLoader.hpp"
+#include "resource/TextureContainer.hpp"
+#include "utils/MaterialTexture.hpp"
+
+void DefaultPipeline::System::UpdatePendingMaterialTextures(Engine::Core &core)
+{
+    const auto &textureContainer = core.GetResource<Graphic::Resource::TextureContainer>();
+    const auto &textureLoader = core.GetResource<Graphic::Resource::AsyncTextureLoader>();
+
+    core.GetRegistry().view<Component::GPUMaterial>().each(
+        [&core, &textureContainer, &textureLoader](auto entity, Component::GPUMaterial &gpuMaterial) {
+            if (gpuMaterial.pendingTexture.empty())
+                return;
+
+            entt::hashed_string textureId{gpuMaterial.pendingTexture.data(), gpuMaterial.pendingTexture.size()};
+            if (textureContainer.Contains(textureId))
+            {
+                gpuMaterial.texture = textureId;
+                gpuMaterial.pendingTexture.clear();
+                Utils::BindMaterialTexture(core, Engine::Entity{core, entity}, gpuMaterial);
+            }
+            else if (textureLoader.HasFailed(gpuMaterial.pendingTexture))
+            {
+                // The loader already reported the error, the material keeps the default texture.
+                gpuMaterial.pendingTexture.clear();
+            }
+        });
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include "core/Core.hpp"
+
+namespace DefaultPipeline::System {
+
+/**
+ * @brief Bind the textures loaded in the background in place of the default texture of their materials.
+ */
+void UpdatePendingMaterialTextures(Engine::Core &core);
+
+} // namespace DefaultPipeline::System
@@ -8,6 +8,7 @@ void UpdatePointLights(Engine::Core &core)
 {
     auto &bufferManager = core.GetResource<Graphic::Resource::GPUBufferContainer>();
     bufferManager.Get(Utils::POINT_LIGHTS_BUFFER_ID)->Update(core);
+    bufferManager.Get(Utils::POINT_LIGHT_CLUSTERS_BUFFER_ID)->Update(core);
 }
 
 } // namespace DefaultPipeline::System
@@ -0,0 +1,114 @@
+#include "utils/AssetReload.hpp"
+#include "Logger.hpp"
+#include "component/GPUMaterial.hpp"
+#include "component/GPUMesh.hpp"
+#include "component/GPUMeshLOD.hpp"
+#include "component/Mesh.hpp"
+#include "component/MeshHandle.hpp"
+#include "component/StaticShadowCaster.hpp"
+#include "entity/Entity.hpp"
+#include "resource/AssetDatabase.hpp"
+#include "resource/AsyncTextureLoader.hpp"
+#include "resource/GeometryArena.hpp"
+#include "resource/ShadowAtlas.hpp"
+#include "resource/TextureContainer.hpp"
+#include "utils/BoundingSphere.hpp"
+#include "utils/MaterialTexture.hpp"
+#include "utils/MeshAsset.hpp"
+#include <string>
+#include <vector>
+
+static void ReuploadMeshAsset(Engine::Core &core, const std::string &assetName)
+{
+    const auto meshHandle = Object::Utils::GetMeshAsset(core, assetName);
+    const auto &mesh = meshHandle.Get();
+    auto &geometryArena = core.GetResource<DefaultPipeline::Resource::GeometryArena>();
+    // No entity draws the asset anymore: it is uploaded again by the next one.
+    if (!geometryArena.UpdateAsset(core, meshHandle.id, mesh))
+        return;
+
+    const auto bounds = DefaultPipeline::Utils::ComputeBoundingSphere(mesh.GetVertices());
+    auto &registry = core.GetRegistry();
+    std::vector<Engine::EntityId> staleLevels;
+    bool castsStaticShadows = false;
+    registry.view<Object::Component::MeshHandle, DefaultPipeline::Component::GPUMesh>().each(
+        [&registry, &meshHandle, &bounds, &staleLevels, &castsStaticShadows](
+            auto entity, const Object::Component::MeshHandle &handle, DefaultPipeline::Component::GPUMesh &gpuMesh) {
+            // The GPUMesh of an entity with its own Mesh draws that mesh.
+            if (handle.id != meshHandle.id || registry.all_of<Object::Component::Mesh>(entity))
+                return;
+            gpuMesh.bounds = bounds;
+            if (registry.all_of<DefaultPipeline::Component::GPUMeshLOD>(entity))
+                staleLevels.push_back(entity);
+            if (registry.all_of<DefaultPipeline::Component::StaticShadowCaster>(entity))
+                castsStaticShadows = true;
+        });
+
+    // The cached static shadows were rendered with the previous vertices.
+    if (castsStaticShadows)
+        core.GetResource<DefaultPipeline::Resource::ShadowAtlas>().InvalidateStaticCasters();
+
+    // Levels of detail index the previous vertices, they are drawn again once the MeshLOD is replaced.
+    for (auto entity : staleLevels)
+    {
+        Engine::Entity{core, entity}.RemoveComponent<DefaultPipeline::Component::GPUMeshLOD>();
+        Log::Warning(fmt::format("Entity {} draws '{}' without levels of detail until its MeshLOD is rebuilt.", entity,
+                                 assetName));
+    }
+}
+
+static void ReloadTexture(Engine::Core &core, const std::string &path)
+{
+    core.GetResource<Graphic::Resource::AsyncTextureLoader>().Forget(path);
+    auto &textureContainer = core.GetResource<Graphic::Resource::TextureContainer>();
+    const entt::hashed_string textureId{path.data(), path.size()};
+    if (textureContainer.Contains(textureId))
+        textureContainer.Remove(textureId);
+}
+
+static void RebindMaterials(Engine::Core &core, const std::string &path)
+{
+    const entt::hashed_string textureId{path.data(), path.size()};
+    core.GetRegistry().view<DefaultPipeline::Component::GPUMaterial>().each(
+        [&core, &path, &textureId](auto entity, DefaultPipeline::Component::GPUMaterial &gpuMaterial) {
+            if (gpuMaterial.texture.value() != textureId.value() && gpuMaterial.pendingTexture != path)
+                return;
+            // The default texture is bound until the new file is resident, see UpdatePendingMaterialTextures.
+            DefaultPipeline::Utils::RequestMaterialTexture(core, gpuMaterial, path);
+            DefaultPipeline::Utils::BindMaterialTexture(core, Engine::Entity{core, entity}, gpuMaterial);
+        });
+}
+
+void DefaultPipeline::Utils::TrackMeshAssetGeometry(Engine::Core &core, entt::id_type asset)
+{
+    if (!core.HasResource<Object::Resource::AssetDatabase>())
+        return;
+
+    auto &assetDatabase = core.GetResource<Object::Resource::AssetDatabase>();
+    if (!assetDatabase.Contains(asset))
+        return;
+
+    const std::string assetName = assetDatabase.Get(asset).name;
+    const std::string geometryName = assetName + ":geometry";
+    if (assetDatabase.Contains(Object::Resource::AssetDatabase::GetId(geometryName)))
+        return;
+    assetDatabase.Register(geometryName, {asset},
+                           [assetName](Engine::Core &importCore) { ReuploadMeshAsset(importCore, assetName); });
+}
+
+void DefaultPipeline::Utils::TrackMaterialTexture(Engine::Core &core, std::string_view path)
+{
+    if (!core.HasResource<Object::Resource::AssetDatabase>())
+        return;
+
+    auto &assetDatabase = core.GetResource<Object::Resource::AssetDatabase>();
+    const std::string texturePath(path);
+    if (assetDatabase.Contains(Object::Resource::AssetDatabase::GetId(texturePath)))
+        return;
+
+    const auto texture = assetDatabase.Register(
+        texturePath, texturePath, [texturePath](Engine::Core &importCore) { ReloadTexture(importCore, texturePath); });
+    assetDatabase.Register(texturePath + ":materials", {texture}, [texturePath](Engine::Core &importCore) {
+        RebindMaterials(importCore, texturePath);
+    });
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "core/Core.hpp"
+#include <entt/core/fwd.hpp>
+#include <string_view>
+
+namespace DefaultPipeline::Utils {
+
+/**
+ * @brief Re-upload the GPU geometry of a mesh asset each time the Object::Resource::AssetDatabase re-imports it.
+ *
+ * The geometry is registered as a dependent of the asset, so it is uploaded once for all the entities drawing it.
+ * Nothing is done if the core has no database or the asset is not registered in it.
+ */
+void TrackMeshAssetGeometry(Engine::Core &core, entt::id_type asset);
+
+/**
+ * @brief Reload a material texture file each time it is edited, then rebind the materials using it.
+ *
+ * The texture is registered in the Object::Resource::AssetDatabase with its file, and the bind groups of its
+ * materials as a dependent of it. Nothing is done if the core has no database.
+ */
+void TrackMaterialTexture(Engine::Core &core, std::string_view path);
+
+} // namespace DefaultPipeline::Utils
@@ -0,0 +1,38 @@
+#include "utils/BoundingSphere.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace DefaultPipeline::Utils {
+
+glm::vec4 ComputeBoundingSphere(std::span<const glm::vec3> points)
+{
+    if (points.empty())
+        return glm::vec4(0.0f);
+
+    glm::vec3 min = points.front();
+    glm::vec3 max = points.front();
+    for (const auto &point : points)
+    {
+        min = glm::min(min, point);
+        max = glm::max(max, point);
+    }
+
+    const glm::vec3 center = (min + max) * 0.5f;
+    float radiusSquared = 0.0f;
+    for (const auto &point : points)
+    {
+        const glm::vec3 offset = point - center;
+        radiusSquared = std::max(radiusSquared, glm::dot(offset, offset));
+    }
+    return glm::vec4(center, std::sqrt(radiusSquared));
+}
+
+glm::vec4 TransformBoundingSphere(const glm::mat4 &model, const glm::vec4 &sphere)
+{
+    const glm::vec3 center = glm::vec3(model * glm::vec4(glm::vec3(sphere), 1.0f));
+    const float scale = std::max({glm::length(glm::vec3(model[0])), glm::length(glm::vec3(model[1])),
+                                  glm::length(glm::vec3(model[2]))});
+    return glm::vec4(center, sphere.w * scale);
+}
+
+} // namespace DefaultPipeline::Utils
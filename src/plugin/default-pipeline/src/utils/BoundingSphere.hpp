@@ -0,0 +1,19 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <span>
+
+namespace DefaultPipeline::Utils {
+
+/**
+ * @brief Bounding sphere of a set of points: xyz is the center of their bounding box, w the distance to the furthest
+ * point. A radius of zero is returned for an empty set.
+ */
+[[nodiscard]] glm::vec4 ComputeBoundingSphere(std::span<const glm::vec3> points);
+
+/**
+ * @brief Bounding sphere of a local space sphere once transformed by a model matrix, scaled by its largest axis.
+ */
+[[nodiscard]] glm::vec4 TransformBoundingSphere(const glm::mat4 &model, const glm::vec4 &sphere);
+
+} // namespace DefaultPipeline::Utils
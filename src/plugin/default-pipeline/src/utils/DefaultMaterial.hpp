@@ -4,9 +4,11 @@
 #include <string_view>
 
 namespace DefaultPipeline::Utils {
-static inline constexpr std::string_view DEFAULT_MATERIAL_NAME = "DEFAULT_MATERIAL";
-static inline const entt::hashed_string DEFAULT_MATERIAL_ID{DEFAULT_MATERIAL_NAME.data(), DEFAULT_MATERIAL_NAME.size()};
-static inline constexpr std::string_view DEFAULT_MATERIAL_BIND_GROUP_NAME = "DEFAULT_MATERIAL_BIND_GROUP";
-static inline const entt::hashed_string DEFAULT_MATERIAL_BIND_GROUP_ID{DEFAULT_MATERIAL_BIND_GROUP_NAME.data(),
-                                                                       DEFAULT_MATERIAL_BIND_GROUP_NAME.size()};
+/**
+ * Standalone texture bind group of the materials sampling the atlas: it binds the default texture, never sampled.
+ */
+static inline constexpr std::string_view DEFAULT_MATERIAL_TEXTURE_BIND_GROUP_NAME =
+    "DEFAULT_MATERIAL_TEXTURE_BIND_GROUP";
+static inline const entt::hashed_string DEFAULT_MATERIAL_TEXTURE_BIND_GROUP_ID{
+    DEFAULT_MATERIAL_TEXTURE_BIND_GROUP_NAME.data(), DEFAULT_MATERIAL_TEXTURE_BIND_GROUP_NAME.size()};
 } // namespace DefaultPipeline::Utils
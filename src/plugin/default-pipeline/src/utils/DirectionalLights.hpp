@@ -15,6 +15,29 @@ static inline constexpr std::string_view DIRECTIONAL_LIGHTS_SHADOW_TEXTURE_NAME
 static inline const entt::hashed_string DIRECTIONAL_LIGHTS_SHADOW_TEXTURE_ID{
     DIRECTIONAL_LIGHTS_SHADOW_TEXTURE_NAME.data(), DIRECTIONAL_LIGHTS_SHADOW_TEXTURE_NAME.size()};
 
+/**
+ * Array view over every layer of the shadow atlas, sampled by the deferred pass.
+ */
+static inline constexpr std::string_view DIRECTIONAL_LIGHTS_SHADOW_VIEW_NAME = "DIRECTIONAL_LIGHTS_SHADOW_VIEW";
+static inline const entt::hashed_string DIRECTIONAL_LIGHTS_SHADOW_VIEW_ID{DIRECTIONAL_LIGHTS_SHADOW_VIEW_NAME.data(),
+                                                                          DIRECTIONAL_LIGHTS_SHADOW_VIEW_NAME.size()};
+
+/**
+ * Depth of the static casters of each cascade, copied into the shadow atlas before the dynamic casters are drawn.
+ */
+static inline constexpr std::string_view DIRECTIONAL_LIGHTS_SHADOW_CACHE_TEXTURE_NAME =
+    "DIRECTIONAL_LIGHTS_SHADOW_CACHE_TEXTURE";
+static inline const entt::hashed_string DIRECTIONAL_LIGHTS_SHADOW_CACHE_TEXTURE_ID{
+    DIRECTIONAL_LIGHTS_SHADOW_CACHE_TEXTURE_NAME.data(), DIRECTIONAL_LIGHTS_SHADOW_CACHE_TEXTURE_NAME.size()};
+
+static inline constexpr std::string_view SHADOW_CASCADES_BUFFER_NAME = "SHADOW_CASCADES_BUFFER";
+static inline const entt::hashed_string SHADOW_CASCADES_BUFFER_ID{SHADOW_CASCADES_BUFFER_NAME.data(),
+                                                                  SHADOW_CASCADES_BUFFER_NAME.size()};
+
+static inline constexpr std::string_view SHADOW_CASCADES_BIND_GROUP_NAME = "SHADOW_CASCADES_BIND_GROUP";
+static inline const entt::hashed_string SHADOW_CASCADES_BIND_GROUP_ID{SHADOW_CASCADES_BIND_GROUP_NAME.data(),
+                                                                      SHADOW_CASCADES_BIND_GROUP_NAME.size()};
+
 static inline constexpr std::string_view DIRECTIONAL_LIGHTS_SHADOW_SAMPLER_NAME = "DIRECTIONAL_LIGHTS_SHADOW_SAMPLER";
 static inline const entt::hashed_string DIRECTIONAL_LIGHTS_SHADOW_SAMPLER_ID{
     DIRECTIONAL_LIGHTS_SHADOW_SAMPLER_NAME.data(), DIRECTIONAL_LIGHTS_SHADOW_SAMPLER_NAME.size()};
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <entt/core/hashed_string.hpp>
+#include <limits>
+#include <string_view>
+
+namespace DefaultPipeline::Utils {
+
+using GeometryHandle = uint32_t;
+static inline constexpr GeometryHandle INVALID_GEOMETRY_HANDLE = std::numeric_limits<GeometryHandle>::max();
+
+/**
+ * Interleaved vertex layout stored in the geometry arena: position (3), normal (3), uv (2).
+ */
+static inline constexpr uint32_t GEOMETRY_VERTEX_FLOATS = 8;
+static inline constexpr uint64_t GEOMETRY_VERTEX_STRIDE = GEOMETRY_VERTEX_FLOATS * sizeof(float);
+
+static inline constexpr uint64_t GEOMETRY_ARENA_INITIAL_VERTEX_CAPACITY = 1 << 18;
+static inline constexpr uint64_t GEOMETRY_ARENA_INITIAL_INDEX_CAPACITY = 1 << 20;
+
+static inline constexpr std::string_view GEOMETRY_ARENA_VERTEX_BUFFER_NAME = "GEOMETRY_ARENA_VERTEX_BUFFER";
+static inline const entt::hashed_string GEOMETRY_ARENA_VERTEX_BUFFER_ID{GEOMETRY_ARENA_VERTEX_BUFFER_NAME.data(),
+                                                                        GEOMETRY_ARENA_VERTEX_BUFFER_NAME.size()};
+
+static inline constexpr std::string_view GEOMETRY_ARENA_INDEX_BUFFER_NAME = "GEOMETRY_ARENA_INDEX_BUFFER";
+static inline const entt::hashed_string GEOMETRY_ARENA_INDEX_BUFFER_ID{GEOMETRY_ARENA_INDEX_BUFFER_NAME.data(),
+                                                                       GEOMETRY_ARENA_INDEX_BUFFER_NAME.size()};
+} // namespace DefaultPipeline::Utils
@@ -0,0 +1,50 @@
+#include "utils/InterleaveVertices.hpp"
+#include "utils/GeometryArena.hpp"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#    include <xmmintrin.h>
+#    define DEFAULT_PIPELINE_INTERLEAVE_SSE
+#endif
+
+namespace DefaultPipeline::Utils {
+
+static_assert(sizeof(glm::vec3) == 3 * sizeof(float), "glm::vec3 must be tightly packed.");
+static_assert(sizeof(glm::vec2) == 2 * sizeof(float), "glm::vec2 must be tightly packed.");
+static_assert(GEOMETRY_VERTEX_FLOATS == 8, "InterleaveVertices writes 8 floats per vertex.");
+
+void InterleaveVertices(float *out, const glm::vec3 *positions, const glm::vec3 *normals, const glm::vec2 *texCoords,
+                        size_t count)
+{
+    size_t i = 0;
+
+#ifdef DEFAULT_PIPELINE_INTERLEAVE_SSE
+    // 4-wide loads of a vec3 read one float of the next vertex, so the last vertex goes through the scalar path.
+    for (; i + 1 < count; ++i, out += GEOMETRY_VERTEX_FLOATS)
+    {
+        const __m128 position = _mm_loadu_ps(&positions[i].x); // px py pz _
+        const __m128 normal = _mm_loadu_ps(&normals[i].x);     // nx ny nz _
+        const __m128 texCoord = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64 *>(&texCoords[i].x));
+
+        const __m128 zx = _mm_shuffle_ps(position, normal, _MM_SHUFFLE(0, 0, 2, 2));     // pz pz nx nx
+        const __m128 first = _mm_shuffle_ps(position, zx, _MM_SHUFFLE(2, 0, 1, 0));      // px py pz nx
+        const __m128 second = _mm_shuffle_ps(normal, texCoord, _MM_SHUFFLE(1, 0, 2, 1)); // ny nz u v
+
+        _mm_storeu_ps(out, first);
+        _mm_storeu_ps(out + 4, second);
+    }
+#endif
+
+    for (; i < count; ++i, out += GEOMETRY_VERTEX_FLOATS)
+    {
+        out[0] = positions[i].x;
+        out[1] = positions[i].y;
+        out[2] = positions[i].z;
+        out[3] = normals[i].x;
+        out[4] = normals[i].y;
+        out[5] = normals[i].z;
+        out[6] = texCoords[i].x;
+        out[7] = texCoords[i].y;
+    }
+}
+
+} // namespace DefaultPipeline::Utils
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+#include <glm/glm.hpp>
+
+namespace DefaultPipeline::Utils {
+
+/**
+ * @brief Pack SoA mesh attributes into the interleaved layout of the geometry arena (position, normal, uv).
+ *
+ * Writes count * GEOMETRY_VERTEX_FLOATS floats to out. Uses SSE when available, two 16-byte stores per vertex.
+ */
+void InterleaveVertices(float *out, const glm::vec3 *positions, const glm::vec3 *normals, const glm::vec2 *texCoords,
+                        size_t count);
+
+} // namespace DefaultPipeline::Utils
@@ -0,0 +1,114 @@
+#include "utils/LightClusterGrid.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace DefaultPipeline::Utils {
+
+static uint32_t NdcToTile(float ndc, uint32_t tileCount)
+{
+    const float tile = std::floor((ndc * 0.5f + 0.5f) * static_cast<float>(tileCount));
+    return static_cast<uint32_t>(std::clamp(tile, 0.0f, static_cast<float>(tileCount - 1)));
+}
+
+void LightClusterGrid::Build(const glm::mat4 &view, const glm::mat4 &projection, float nearPlane, float farPlane,
+                             std::span<const glm::vec4> lightSpheres)
+{
+    _nearPlane = nearPlane;
+    _farPlane = farPlane;
+    const float logDepthRange = std::log(farPlane / nearPlane);
+    _sliceScale = static_cast<float>(LIGHT_CLUSTER_GRID_Z) / logDepthRange;
+    _sliceBias = -static_cast<float>(LIGHT_CLUSTER_GRID_Z) * std::log(nearPlane) / logDepthRange;
+    _droppedIndexCount = 0;
+
+    _ranges.assign(LIGHT_CLUSTER_COUNT, Range{});
+    _fill.assign(LIGHT_CLUSTER_COUNT, 0);
+    _bounds.clear();
+
+    for (uint32_t i = 0; i < lightSpheres.size(); ++i)
+    {
+        LightBounds bounds{};
+        if (!_ComputeBounds(view, projection, lightSpheres[i], bounds))
+            continue;
+        bounds.light = i;
+        _bounds.push_back(bounds);
+
+        for (uint32_t z = bounds.min.z; z <= bounds.max.z; ++z)
+            for (uint32_t y = bounds.min.y; y <= bounds.max.y; ++y)
+                for (uint32_t x = bounds.min.x; x <= bounds.max.x; ++x)
+                    _ranges[GetClusterIndex(x, y, z)].count++;
+    }
+
+    uint32_t offset = 0;
+    for (auto &range : _ranges)
+    {
+        range.offset = offset;
+        if (offset + range.count > MAX_LIGHT_CLUSTER_INDICES)
+        {
+            _droppedIndexCount += offset + range.count - static_cast<uint32_t>(MAX_LIGHT_CLUSTER_INDICES);
+            range.count = static_cast<uint32_t>(MAX_LIGHT_CLUSTER_INDICES) - offset;
+        }
+        offset += range.count;
+    }
+    _indices.resize(offset);
+
+    for (const auto &bounds : _bounds)
+    {
+        for (uint32_t z = bounds.min.z; z <= bounds.max.z; ++z)
+            for (uint32_t y = bounds.min.y; y <= bounds.max.y; ++y)
+                for (uint32_t x = bounds.min.x; x <= bounds.max.x; ++x)
+                {
+                    const uint32_t cluster = GetClusterIndex(x, y, z);
+                    if (_fill[cluster] < _ranges[cluster].count)
+                        _indices[_ranges[cluster].offset + _fill[cluster]++] = bounds.light;
+                }
+    }
+}
+
+uint32_t LightClusterGrid::GetSlice(float viewDepth) const
+{
+    const float slice = std::floor(std::log(std::max(viewDepth, _nearPlane)) * _sliceScale + _sliceBias);
+    return static_cast<uint32_t>(std::clamp(slice, 0.0f, static_cast<float>(LIGHT_CLUSTER_GRID_Z - 1)));
+}
+
+bool LightClusterGrid::_ComputeBounds(const glm::mat4 &view, const glm::mat4 &projection, const glm::vec4 &sphere,
+                                      LightBounds &bounds) const
+{
+    const float radius = sphere.w;
+    if (radius <= 0.0f)
+        return false;
+
+    const glm::vec3 center = glm::vec3(view * glm::vec4(glm::vec3(sphere), 1.0f));
+    float zMin = center.z - radius;
+    float zMax = center.z + radius;
+    if (zMax < _nearPlane || zMin > _farPlane)
+        return false;
+    zMin = std::max(zMin, _nearPlane);
+    zMax = std::min(zMax, _farPlane);
+
+    // Projecting the corners of the view space box clamped to the visible depth range gives a conservative
+    // screen rectangle, since x / z and y / z reach their extremes on those corners.
+    glm::vec2 ndcMin(std::numeric_limits<float>::max());
+    glm::vec2 ndcMax(std::numeric_limits<float>::lowest());
+    for (float x : {center.x - radius, center.x + radius})
+        for (float y : {center.y - radius, center.y + radius})
+            for (float z : {zMin, zMax})
+            {
+                const glm::vec4 clip = projection * glm::vec4(x, y, z, 1.0f);
+                const glm::vec2 ndc = glm::vec2(clip) / clip.w;
+                ndcMin = glm::min(ndcMin, ndc);
+                ndcMax = glm::max(ndcMax, ndc);
+            }
+
+    if (ndcMax.x < -1.0f || ndcMin.x > 1.0f || ndcMax.y < -1.0f || ndcMin.y > 1.0f)
+        return false;
+
+    // Screen tiles go top to bottom while NDC y goes bottom to top.
+    bounds.min = glm::uvec3(NdcToTile(ndcMin.x, LIGHT_CLUSTER_GRID_X), NdcToTile(-ndcMax.y, LIGHT_CLUSTER_GRID_Y),
+                            GetSlice(zMin));
+    bounds.max = glm::uvec3(NdcToTile(ndcMax.x, LIGHT_CLUSTER_GRID_X), NdcToTile(-ndcMin.y, LIGHT_CLUSTER_GRID_Y),
+                            GetSlice(zMax));
+    return true;
+}
+
+} // namespace DefaultPipeline::Utils
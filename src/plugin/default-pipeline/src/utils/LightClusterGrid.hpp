@@ -0,0 +1,82 @@
+#pragma once
+
+#include "utils/PointLights.hpp"
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <span>
+#include <vector>
+
+namespace DefaultPipeline::Utils {
+
+/**
+ * CPU light binning into a froxel grid of LIGHT_CLUSTER_GRID_X * LIGHT_CLUSTER_GRID_Y * LIGHT_CLUSTER_GRID_Z
+ * clusters. Each cluster ends up with a range inside a shared index list, so the deferred shader only iterates the
+ * lights that can actually reach its pixels.
+ *
+ * Internal vectors keep their capacity between builds so rebinning every frame does not allocate once warmed up.
+ */
+class LightClusterGrid {
+  public:
+    struct Range {
+        uint32_t offset = 0;
+        uint32_t count = 0;
+    };
+
+    static_assert(sizeof(Range) == 8, "Range must match a WGSL vec2u.");
+
+    LightClusterGrid() = default;
+    ~LightClusterGrid() = default;
+
+    /**
+     * @brief Bin light spheres into the cluster grid.
+     *
+     * @param view          view matrix of the camera (left handed, +Z forward)
+     * @param projection    projection matrix of the camera (zero to one depth)
+     * @param nearPlane     near plane distance of the camera
+     * @param farPlane      far plane distance of the camera
+     * @param lightSpheres  world space light spheres: xyz is the position, w the radius
+     */
+    void Build(const glm::mat4 &view, const glm::mat4 &projection, float nearPlane, float farPlane,
+               std::span<const glm::vec4> lightSpheres);
+
+    /**
+     * @brief Get the depth slice containing a view space depth, using the parameters of the last build.
+     */
+    [[nodiscard]] uint32_t GetSlice(float viewDepth) const;
+
+    [[nodiscard]] static constexpr uint32_t GetClusterIndex(uint32_t x, uint32_t y, uint32_t z)
+    {
+        return x + y * LIGHT_CLUSTER_GRID_X + z * LIGHT_CLUSTER_GRID_X * LIGHT_CLUSTER_GRID_Y;
+    }
+
+    [[nodiscard]] const std::vector<Range> &GetRanges() const { return _ranges; }
+    [[nodiscard]] const std::vector<uint32_t> &GetIndices() const { return _indices; }
+    [[nodiscard]] uint32_t GetDroppedIndexCount() const { return _droppedIndexCount; }
+    [[nodiscard]] float GetNearPlane() const { return _nearPlane; }
+    [[nodiscard]] float GetFarPlane() const { return _farPlane; }
+    [[nodiscard]] float GetSliceScale() const { return _sliceScale; }
+    [[nodiscard]] float GetSliceBias() const { return _sliceBias; }
+
+  private:
+    struct LightBounds {
+        uint32_t light;
+        glm::uvec3 min;
+        glm::uvec3 max;
+    };
+
+    bool _ComputeBounds(const glm::mat4 &view, const glm::mat4 &projection, const glm::vec4 &sphere,
+                        LightBounds &bounds) const;
+
+    float _nearPlane = 0.1f;
+    float _farPlane = 100.0f;
+    float _sliceScale = 0.0f;
+    float _sliceBias = 0.0f;
+    uint32_t _droppedIndexCount = 0;
+
+    std::vector<LightBounds> _bounds;
+    std::vector<Range> _ranges;
+    std::vector<uint32_t> _fill;
+    std::vector<uint32_t> _indices;
+};
+
+} // namespace DefaultPipeline::Utils
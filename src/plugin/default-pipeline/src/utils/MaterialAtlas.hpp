@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <entt/core/hashed_string.hpp>
+#include <string_view>
+
+namespace DefaultPipeline::Utils {
+
+/**
+ * Size in texels of a page of the material atlas, each page being a layer of one 2D texture array.
+ */
+static inline constexpr uint32_t MATERIAL_ATLAS_PAGE_SIZE = 2048;
+static inline constexpr uint32_t MATERIAL_ATLAS_MAX_PAGES = 16;
+/**
+ * Mip levels of the atlas. Textures are placed on multiples of 2^(MATERIAL_ATLAS_MIP_LEVELS - 1) texels, so their
+ * rectangle stays aligned on texels in every level.
+ */
+static inline constexpr uint32_t MATERIAL_ATLAS_MIP_LEVELS = 6;
+static inline constexpr uint32_t MATERIAL_ATLAS_TILE_ALIGNMENT = 1u << (MATERIAL_ATLAS_MIP_LEVELS - 1);
+
+static inline constexpr std::string_view MATERIAL_ATLAS_TEXTURE_NAME = "MATERIAL_ATLAS_TEXTURE";
+static inline const entt::hashed_string MATERIAL_ATLAS_TEXTURE_ID{MATERIAL_ATLAS_TEXTURE_NAME.data(),
+                                                                  MATERIAL_ATLAS_TEXTURE_NAME.size()};
+
+static inline constexpr std::string_view MATERIAL_ATLAS_VIEW_NAME = "MATERIAL_ATLAS_VIEW";
+static inline const entt::hashed_string MATERIAL_ATLAS_VIEW_ID{MATERIAL_ATLAS_VIEW_NAME.data(),
+                                                               MATERIAL_ATLAS_VIEW_NAME.size()};
+} // namespace DefaultPipeline::Utils
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <entt/core/hashed_string.hpp>
+#include <string_view>
+
+namespace DefaultPipeline::Utils {
+
+using MaterialSlot = uint32_t;
+
+/**
+ * Slot of the default material, bound by entities without a Material component.
+ */
+static inline constexpr MaterialSlot DEFAULT_MATERIAL_SLOT = 0;
+static inline constexpr uint32_t MATERIAL_TABLE_INITIAL_CAPACITY = 256;
+
+/**
+ * Set in the flags of a material whose texture could not be packed in the atlas: it is sampled from the standalone
+ * texture bind group instead.
+ */
+static inline constexpr uint32_t MATERIAL_FLAG_STANDALONE_TEXTURE = 1u << 0;
+
+static inline constexpr std::string_view MATERIAL_TABLE_BUFFER_NAME = "MATERIAL_TABLE_BUFFER";
+static inline const entt::hashed_string MATERIAL_TABLE_BUFFER_ID{MATERIAL_TABLE_BUFFER_NAME.data(),
+                                                                 MATERIAL_TABLE_BUFFER_NAME.size()};
+
+static inline constexpr std::string_view MATERIAL_TABLE_BIND_GROUP_NAME = "MATERIAL_TABLE_BIND_GROUP";
+static inline const entt::hashed_string MATERIAL_TABLE_BIND_GROUP_ID{MATERIAL_TABLE_BIND_GROUP_NAME.data(),
+                                                                     MATERIAL_TABLE_BIND_GROUP_NAME.size()};
+} // namespace DefaultPipeline::Utils
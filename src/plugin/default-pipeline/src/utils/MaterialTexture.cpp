@@ -0,0 +1,100 @@
+#include "utils/MaterialTexture.hpp"
+#include "Logger.hpp"
+#include "resource/AsyncTextureLoader.hpp"
+#include "resource/BindGroup.hpp"
+#include "resource/BindGroupManager.hpp"
+#include "resource/MaterialAtlas.hpp"
+#include "resource/MaterialTable.hpp"
+#include "resource/TextureContainer.hpp"
+#include "resource/pass/GBuffer.hpp"
+#include "utils/AssetReload.hpp"
+#include "utils/DefaultTexture.hpp"
+#include "utils/SharedSampler.hpp"
+#include <filesystem>
+#include <string>
+
+static wgpu::SamplerDescriptor CreateMaterialSamplerDescriptor()
+{
+    wgpu::SamplerDescriptor samplerDesc(wgpu::Default);
+    samplerDesc.maxAnisotropy = 1;
+    samplerDesc.addressModeU = wgpu::AddressMode::Repeat;
+    samplerDesc.addressModeV = wgpu::AddressMode::Repeat;
+    samplerDesc.addressModeW = wgpu::AddressMode::Repeat;
+    return samplerDesc;
+}
+
+void DefaultPipeline::Utils::RequestMaterialTexture(Engine::Core &core, Component::GPUMaterial &gpuMaterial,
+                                                    std::string_view textureName)
+{
+    auto &textureContainer = core.GetResource<Graphic::Resource::TextureContainer>();
+    auto &textureLoader = core.GetResource<Graphic::Resource::AsyncTextureLoader>();
+    entt::hashed_string textureId{textureName.data(), textureName.size()};
+
+    gpuMaterial.pendingTexture.clear();
+    if (textureContainer.Contains(textureId))
+    {
+        gpuMaterial.texture = textureId;
+    }
+    else if (!textureName.empty() && std::filesystem::exists(textureName) && !textureLoader.HasFailed(textureName))
+    {
+        textureLoader.Load(textureName);
+        TrackMaterialTexture(core, textureName);
+        gpuMaterial.texture = Graphic::Utils::DEFAULT_TEXTURE_ID;
+        gpuMaterial.pendingTexture = std::string(textureName);
+    }
+    else
+    {
+        // Bind groups fall back to the empty texture for unknown ids.
+        gpuMaterial.texture = textureId;
+        if (!textureName.empty())
+            Log::Warning(fmt::format("Texture '{}' not found as file or in texture container", textureName));
+    }
+}
+
+void DefaultPipeline::Utils::BindMaterialTexture(Engine::Core &core, Engine::Entity entity,
+                                                 Component::GPUMaterial &gpuMaterial)
+{
+    auto &materialAtlas = core.GetResource<Resource::MaterialAtlas>();
+    auto &materialTable = core.GetResource<Resource::MaterialTable>();
+
+    // Acquired before releasing the previous texture: rebinding the same texture keeps its region.
+    const auto region = materialAtlas.Acquire(core, gpuMaterial.texture);
+    ReleaseMaterialTexture(core, gpuMaterial);
+
+    if (region.has_value())
+    {
+        materialTable.SetTexture(gpuMaterial.slot, region.value());
+        gpuMaterial.atlasTexture = region->texture;
+        return;
+    }
+
+    std::string bindGroupName = fmt::format("MATERIAL_TEXTURE_BIND_GROUP_{}", entity);
+    entt::hashed_string bindGroupId{bindGroupName.data(), bindGroupName.size()};
+
+    Graphic::Resource::BindGroup bindGroup(
+        core, bindGroupName, Resource::GBUFFER_SHADER_ID, 3,
+        {
+            {0, Graphic::Resource::BindGroup::Asset::Type::Texture, gpuMaterial.texture, 0},
+            {1, Graphic::Resource::BindGroup::Asset::Type::Sampler,
+             Graphic::Utils::GetSharedSampler(core, CreateMaterialSamplerDescriptor()), 0},
+    });
+    core.GetResource<Graphic::Resource::BindGroupManager>().Add(bindGroupId, std::move(bindGroup));
+    gpuMaterial.textureBindGroup = bindGroupId;
+    materialTable.SetStandaloneTexture(gpuMaterial.slot);
+}
+
+void DefaultPipeline::Utils::ReleaseMaterialTexture(Engine::Core &core, Component::GPUMaterial &gpuMaterial)
+{
+    if (gpuMaterial.atlasTexture.has_value())
+    {
+        core.GetResource<Resource::MaterialAtlas>().Release(gpuMaterial.atlasTexture.value());
+        gpuMaterial.atlasTexture.reset();
+    }
+    if (gpuMaterial.textureBindGroup.has_value())
+    {
+        auto &bindGroupManager = core.GetResource<Graphic::Resource::BindGroupManager>();
+        if (bindGroupManager.Contains(gpuMaterial.textureBindGroup.value()))
+            bindGroupManager.Remove(gpuMaterial.textureBindGroup.value());
+        gpuMaterial.textureBindGroup.reset();
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "component/GPUMaterial.hpp"
+#include "core/Core.hpp"
+#include "entity/Entity.hpp"
+#include <string_view>
+
+namespace DefaultPipeline::Utils {
+
+/**
+ * @brief Choose the texture bound by a material.
+ *
+ * A texture already in the texture container is bound directly. A texture file is queued in the
+ * AsyncTextureLoader and the default texture is bound until it is resident, see UpdatePendingMaterialTextures. The
+ * file is reloaded when edited if the core has an Object::Resource::AssetDatabase, see TrackMaterialTexture.
+ */
+void RequestMaterialTexture(Engine::Core &core, Component::GPUMaterial &gpuMaterial, std::string_view textureName);
+
+/**
+ * @brief Point the slot of the material at its texture.
+ *
+ * The texture is packed in the MaterialAtlas when possible. Otherwise (e.g. block-compressed textures) the material
+ * gets its own texture bind group, which the GBuffer pass binds next to the shared material bind group.
+ */
+void BindMaterialTexture(Engine::Core &core, Engine::Entity entity, Component::GPUMaterial &gpuMaterial);
+
+/**
+ * @brief Give back the atlas region or the texture bind group of the material.
+ */
+void ReleaseMaterialTexture(Engine::Core &core, Component::GPUMaterial &gpuMaterial);
+
+} // namespace DefaultPipeline::Utils
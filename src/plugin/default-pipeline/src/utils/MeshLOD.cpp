@@ -0,0 +1,28 @@
+#include "utils/MeshLOD.hpp"
+#include <algorithm>
+#include <limits>
+
+namespace DefaultPipeline::Utils {
+
+float ComputeScreenSize(const glm::mat4 &projection, float radius, float distance)
+{
+    // Inside the sphere, the mesh covers the whole screen.
+    if (distance <= radius)
+        return std::numeric_limits<float>::max();
+    // The screen is 2 * distance / projection[1][1] high at that distance, and the sphere 2 * radius.
+    return radius * projection[1][1] / distance;
+}
+
+uint32_t SelectLODLevel(uint32_t currentLevel, float screenSize, std::span<const float> screenSizes, float hysteresis)
+{
+    const auto levelCount = static_cast<uint32_t>(screenSizes.size());
+    uint32_t level = std::min(currentLevel, levelCount);
+
+    while (level < levelCount && screenSize < screenSizes[level] * (1.0f - hysteresis))
+        ++level;
+    while (level > 0 && screenSize > screenSizes[level - 1] * (1.0f + hysteresis))
+        --level;
+    return level;
+}
+
+} // namespace DefaultPipeline::Utils
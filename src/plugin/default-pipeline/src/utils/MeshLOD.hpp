@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <span>
+
+namespace DefaultPipeline::Utils {
+
+/**
+ * @brief Projected diameter of a bounding sphere, as a fraction of the full screen height: 1 when the sphere spans
+ * the screen from bottom to top.
+ *
+ * @param projection perspective projection of the camera
+ * @param distance   distance from the camera to the center of the sphere
+ */
+[[nodiscard]] float ComputeScreenSize(const glm::mat4 &projection, float radius, float distance);
+
+/**
+ * @brief Level of detail to draw at a given screen size, starting from the level drawn last frame.
+ *
+ * Level i + 1 is drawn under screenSizes[i]. A level is only left once the screen size is past its thresholds by the
+ * relative hysteresis margin, so a mesh hovering around a threshold keeps its level.
+ *
+ * @param screenSizes decreasing screen sizes of the levels, level 0 (the mesh itself) excluded
+ */
+[[nodiscard]] uint32_t SelectLODLevel(uint32_t currentLevel, float screenSize, std::span<const float> screenSizes,
+                                      float hysteresis);
+
+} // namespace DefaultPipeline::Utils
@@ -1,13 +1,33 @@
 #pragma once
 
+#include <cstdint>
 #include <entt/core/hashed_string.hpp>
 #include <string_view>
 
 namespace DefaultPipeline::Utils {
 
-static inline constexpr size_t MAX_POINT_LIGHTS = 64;
+static inline constexpr size_t MAX_POINT_LIGHTS = 4096;
+
+/**
+ * Dimensions of the froxel grid used to bin point lights per camera.
+ * X and Y split the screen into tiles, Z splits [near, far] exponentially.
+ */
+static inline constexpr uint32_t LIGHT_CLUSTER_GRID_X = 16;
+static inline constexpr uint32_t LIGHT_CLUSTER_GRID_Y = 9;
+static inline constexpr uint32_t LIGHT_CLUSTER_GRID_Z = 24;
+static inline constexpr size_t LIGHT_CLUSTER_COUNT = LIGHT_CLUSTER_GRID_X * LIGHT_CLUSTER_GRID_Y * LIGHT_CLUSTER_GRID_Z;
+
+/**
+ * Maximum number of light indices stored across all clusters. A light touching several clusters uses one index per
+ * cluster. Indices past this budget are dropped with a warning.
+ */
+static inline constexpr size_t MAX_LIGHT_CLUSTER_INDICES = LIGHT_CLUSTER_COUNT * 64;
 
 static inline constexpr std::string_view POINT_LIGHTS_BUFFER_NAME = "POINT_LIGHTS_BUFFER";
 static inline const entt::hashed_string POINT_LIGHTS_BUFFER_ID{POINT_LIGHTS_BUFFER_NAME.data(),
                                                                POINT_LIGHTS_BUFFER_NAME.size()};
+
+static inline constexpr std::string_view POINT_LIGHT_CLUSTERS_BUFFER_NAME = "POINT_LIGHT_CLUSTERS_BUFFER";
+static inline const entt::hashed_string POINT_LIGHT_CLUSTERS_BUFFER_ID{POINT_LIGHT_CLUSTERS_BUFFER_NAME.data(),
+                                                                       POINT_LIGHT_CLUSTERS_BUFFER_NAME.size()};
 } // namespace DefaultPipeline::Utils
@@ -0,0 +1,88 @@
+#include "utils/ShadowCascades.hpp"
+#include <algorithm>
+#include <cmath>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace DefaultPipeline::Utils {
+
+std::array<float, SHADOW_CASCADE_COUNT> ComputeCascadeSplits(float nearPlane, float farPlane, float lambda)
+{
+    std::array<float, SHADOW_CASCADE_COUNT> splits{};
+    for (uint32_t i = 0; i < SHADOW_CASCADE_COUNT; ++i)
+    {
+        const float ratio = static_cast<float>(i + 1) / static_cast<float>(SHADOW_CASCADE_COUNT);
+        const float logarithmic = nearPlane * std::pow(farPlane / nearPlane, ratio);
+        const float uniform = nearPlane + (farPlane - nearPlane) * ratio;
+        splits[i] = lambda * logarithmic + (1.0f - lambda) * uniform;
+    }
+    return splits;
+}
+
+ShadowCascade ComputeShadowCascade(const glm::mat4 &inverseViewProjection, float nearPlane, float farPlane,
+                                   float splitNear, float splitFar, const glm::vec3 &lightDirection)
+{
+    // Positions along a frustum edge are linear in view depth, the slice corners are interpolated between the
+    // corners of the near and far planes.
+    const float depthRange = farPlane - nearPlane;
+    const float sliceStart = (splitNear - nearPlane) / depthRange;
+    const float sliceEnd = (splitFar - nearPlane) / depthRange;
+    std::array<glm::vec3, 8> corners{};
+    glm::vec3 center(0.0f);
+    uint32_t corner = 0;
+    for (float x : {-1.0f, 1.0f})
+    {
+        for (float y : {-1.0f, 1.0f})
+        {
+            const glm::vec4 nearCorner = inverseViewProjection * glm::vec4(x, y, 0.0f, 1.0f);
+            const glm::vec4 farCorner = inverseViewProjection * glm::vec4(x, y, 1.0f, 1.0f);
+            const glm::vec3 nearPosition = glm::vec3(nearCorner) / nearCorner.w;
+            const glm::vec3 farPosition = glm::vec3(farCorner) / farCorner.w;
+            corners[corner++] = glm::mix(nearPosition, farPosition, sliceStart);
+            corners[corner++] = glm::mix(nearPosition, farPosition, sliceEnd);
+        }
+    }
+    for (const auto &position : corners)
+        center += position / static_cast<float>(corners.size());
+
+    float radius = 0.0f;
+    for (const auto &position : corners)
+        radius = std::max(radius, glm::length(position - center));
+    // Rounded so that floating point noise does not resize the cascade from one frame to the next.
+    radius = std::ceil(radius * 16.0f) / 16.0f;
+
+    ShadowCascade cascade;
+    constexpr float resolution = static_cast<float>(SHADOW_CASCADE_RESOLUTION);
+    constexpr float snapTexels = static_cast<float>(SHADOW_CASCADE_SNAP_TEXELS);
+    // The extent is padded by one snap step: halfExtent = radius + snapTexels * texelSize.
+    cascade.halfExtent = radius / (1.0f - 2.0f * snapTexels / resolution);
+    cascade.texelSize = 2.0f * cascade.halfExtent / resolution;
+    cascade.depthRange = 2.0f * cascade.halfExtent + SHADOW_CASTER_DEPTH_MARGIN;
+
+    const glm::vec3 direction = glm::normalize(lightDirection);
+    const glm::vec3 up = std::abs(glm::dot(direction, glm::vec3(0.0f, 1.0f, 0.0f))) > 0.99f ?
+                             glm::vec3(1.0f, 0.0f, 0.0f) :
+                             glm::vec3(0.0f, 1.0f, 0.0f);
+    const glm::mat4 lightRotation = glm::lookAtLH(glm::vec3(0.0f), direction, up);
+
+    const float snapStep = snapTexels * cascade.texelSize;
+    const glm::vec3 lightCenter = glm::floor(glm::vec3(lightRotation * glm::vec4(center, 1.0f)) / snapStep) * snapStep;
+
+    const glm::mat4 view = glm::translate(glm::mat4(1.0f), -lightCenter) * lightRotation;
+    const glm::mat4 projection =
+        glm::orthoLH_ZO(-cascade.halfExtent, cascade.halfExtent, -cascade.halfExtent, cascade.halfExtent,
+                        -cascade.halfExtent - SHADOW_CASTER_DEPTH_MARGIN, cascade.halfExtent);
+    cascade.viewProjection = projection * view;
+    return cascade;
+}
+
+bool IsSphereInCascade(const ShadowCascade &cascade, const glm::vec4 &sphere)
+{
+    // The projection is orthographic: no perspective divide, and the radius scales the same everywhere.
+    const glm::vec4 position = cascade.viewProjection * glm::vec4(glm::vec3(sphere), 1.0f);
+    const float radiusXY = sphere.w / cascade.halfExtent;
+    const float radiusZ = sphere.w / cascade.depthRange;
+    return std::abs(position.x) <= 1.0f + radiusXY && std::abs(position.y) <= 1.0f + radiusXY &&
+           position.z >= -radiusZ && position.z <= 1.0f + radiusZ;
+}
+
+} // namespace DefaultPipeline::Utils
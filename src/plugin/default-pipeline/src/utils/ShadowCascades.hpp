@@ -0,0 +1,78 @@
+#pragma once
+
+#include "utils/DirectionalLights.hpp"
+#include <array>
+#include <cstdint>
+#include <glm/glm.hpp>
+
+namespace DefaultPipeline::Utils {
+
+/**
+ * Number of cascades of each directional light, the deferred shader stores their splits in a vec4.
+ */
+static inline constexpr uint32_t SHADOW_CASCADE_COUNT = 4;
+/**
+ * Size in texels of a cascade, each cascade being a layer of the shadow atlas.
+ */
+static inline constexpr uint32_t SHADOW_CASCADE_RESOLUTION = 2048;
+static inline constexpr uint32_t MAX_SHADOW_CASCADE_LAYERS = MAX_DIRECTIONAL_LIGHTS * SHADOW_CASCADE_COUNT;
+/**
+ * Cascades move by steps of this many texels, so the cached static depth stays valid while the camera moves inside a
+ * step. Their extent is padded accordingly.
+ */
+static inline constexpr uint32_t SHADOW_CASCADE_SNAP_TEXELS = 32;
+/**
+ * Blend between uniform (0) and logarithmic (1) cascade splits.
+ */
+static inline constexpr float SHADOW_CASCADE_SPLIT_LAMBDA = 0.8f;
+/**
+ * Cascades do not go further than this view depth, even if the camera far plane does.
+ */
+static inline constexpr float SHADOW_MAX_DISTANCE = 100.0f;
+/**
+ * Depth added towards the light in front of each cascade, for casters outside the view to still cast shadows in it.
+ */
+static inline constexpr float SHADOW_CASTER_DEPTH_MARGIN = 50.0f;
+
+static_assert(SHADOW_CASCADE_COUNT == 4, "SHADOW_CASCADE_COUNT must match the vec4 splits of DEFERRED_SHADE_CONTENT.");
+
+struct ShadowCascade {
+    glm::mat4 viewProjection{1.0f};
+    /** @brief Half of the width of the cascade, in world units. */
+    float halfExtent = 0.0f;
+    /** @brief Distance between the near and far planes of the cascade, in world units. */
+    float depthRange = 0.0f;
+    /** @brief Width of a texel of the cascade, in world units. */
+    float texelSize = 0.0f;
+};
+
+/**
+ * @brief Compute the far view depth of each cascade with the practical split scheme, blending uniform and
+ * logarithmic splits of [nearPlane, farPlane].
+ */
+[[nodiscard]] std::array<float, SHADOW_CASCADE_COUNT> ComputeCascadeSplits(float nearPlane, float farPlane,
+                                                                           float lambda = SHADOW_CASCADE_SPLIT_LAMBDA);
+
+/**
+ * @brief Fit an orthographic cascade around the slice [splitNear, splitFar] of the view frustum of a camera.
+ *
+ * The cascade is fitted around the bounding sphere of the slice, so its size does not change when the camera
+ * rotates, and its position is snapped to steps of SHADOW_CASCADE_SNAP_TEXELS texels in light space.
+ *
+ * @param inverseViewProjection inverse of the view projection of the camera (zero to one depth)
+ * @param nearPlane             near plane distance of the camera
+ * @param farPlane              far plane distance of the camera
+ * @param splitNear             view depth of the start of the slice
+ * @param splitFar              view depth of the end of the slice
+ * @param lightDirection        direction the light travels in
+ */
+[[nodiscard]] ShadowCascade ComputeShadowCascade(const glm::mat4 &inverseViewProjection, float nearPlane,
+                                                 float farPlane, float splitNear, float splitFar,
+                                                 const glm::vec3 &lightDirection);
+
+/**
+ * @brief Whether a world space sphere (xyz center, w radius) overlaps the volume of a cascade.
+ */
+[[nodiscard]] bool IsSphereInCascade(const ShadowCascade &cascade, const glm::vec4 &sphere);
+
+} // namespace DefaultPipeline::Utils
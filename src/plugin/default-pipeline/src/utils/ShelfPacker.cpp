@@ -0,0 +1,80 @@
+#include "utils/ShelfPacker.hpp"
+#include <algorithm>
+
+namespace DefaultPipeline::Utils {
+
+std::optional<AtlasRect> ShelfPacker::Allocate(uint32_t width, uint32_t height)
+{
+    if (width == 0 || height == 0 || width > _size || height > _size)
+        return std::nullopt;
+
+    const uint32_t shelfHeight =
+        std::min(_size, (height + SHELF_HEIGHT_GRANULARITY - 1) / SHELF_HEIGHT_GRANULARITY * SHELF_HEIGHT_GRANULARITY);
+
+    // Prefer the lowest shelf that fits without wasting more than half of its height.
+    Shelf *best = nullptr;
+    for (auto &shelf : _shelves)
+    {
+        if (shelf.height < shelfHeight || shelf.height > shelfHeight * 2 ||
+            shelf.allocator.GetLargestFreeBlock() < width)
+            continue;
+        if (best == nullptr || shelf.height < best->height)
+            best = &shelf;
+    }
+    if (best != nullptr)
+        return AllocateInShelf(*best, width, height);
+
+    if (_top + shelfHeight <= _size)
+    {
+        auto &shelf = _shelves.emplace_back();
+        shelf.y = _top;
+        shelf.height = shelfHeight;
+        shelf.allocator.Reset(_size);
+        _top += shelfHeight;
+        return AllocateInShelf(shelf, width, height);
+    }
+
+    // The page is full: accept any shelf tall enough, even if most of its height is lost.
+    for (auto &shelf : _shelves)
+    {
+        if (shelf.height >= height && shelf.allocator.GetLargestFreeBlock() >= width)
+            return AllocateInShelf(shelf, width, height);
+    }
+    return std::nullopt;
+}
+
+void ShelfPacker::Free(const AtlasRect &rect)
+{
+    auto shelf = std::ranges::find_if(_shelves, [&rect](const Shelf &candidate) { return candidate.y == rect.y; });
+    if (shelf == _shelves.end())
+        return;
+
+    shelf->allocator.Free(rect.x, rect.width);
+    _usedArea -= static_cast<uint64_t>(rect.width) * rect.height;
+
+    while (!_shelves.empty() && _shelves.back().allocator.GetUsedSize() == 0)
+    {
+        _top -= _shelves.back().height;
+        _shelves.pop_back();
+    }
+}
+
+void ShelfPacker::Reset(uint32_t size)
+{
+    _shelves.clear();
+    _size = size;
+    _top = 0;
+    _usedArea = 0;
+}
+
+std::optional<AtlasRect> ShelfPacker::AllocateInShelf(Shelf &shelf, uint32_t width, uint32_t height)
+{
+    const auto x = shelf.allocator.Allocate(width);
+    if (!x.has_value())
+        return std::nullopt;
+
+    _usedArea += static_cast<uint64_t>(width) * height;
+    return AtlasRect{.x = static_cast<uint32_t>(x.value()), .y = shelf.y, .width = width, .height = height};
+}
+
+} // namespace DefaultPipeline::Utils
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "utils/RangeAllocator.hpp"
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace DefaultPipeline::Utils {
+
+/**
+ * @brief Texel rectangle of an atlas page.
+ */
+struct AtlasRect {
+    uint32_t x = 0;
+    uint32_t y = 0;
+    uint32_t width = 0;
+    uint32_t height = 0;
+};
+
+/**
+ * @brief Packs rectangles into a square page, row by row.
+ *
+ * The page is cut into horizontal shelves whose height is the rounded height of the first rectangle placed in them;
+ * each shelf hands out horizontal ranges through a RangeAllocator, so freed rectangles are merged and reused by the
+ * next ones of a similar height. Shelves left empty at the bottom of the page are given back.
+ */
+class ShelfPacker {
+  public:
+    explicit ShelfPacker(uint32_t size = 0) { Reset(size); }
+    ~ShelfPacker() = default;
+
+    /**
+     * @brief Place a rectangle of the given size.
+     *
+     * @return the placed rectangle, or std::nullopt if the page has no room left for it.
+     */
+    [[nodiscard]] std::optional<AtlasRect> Allocate(uint32_t width, uint32_t height);
+
+    /**
+     * @brief Give back a rectangle previously returned by Allocate.
+     */
+    void Free(const AtlasRect &rect);
+
+    /**
+     * @brief Drop every rectangle and set a new page size.
+     */
+    void Reset(uint32_t size);
+
+    [[nodiscard]] uint32_t GetSize() const { return _size; }
+    [[nodiscard]] size_t GetShelfCount() const { return _shelves.size(); }
+    [[nodiscard]] uint64_t GetUsedArea() const { return _usedArea; }
+
+  private:
+    struct Shelf {
+        uint32_t y = 0;
+        uint32_t height = 0;
+        Graphic::Utils::RangeAllocator allocator;
+    };
+
+    /** @brief Shelf heights are rounded so that rectangles of close heights share shelves. */
+    static inline constexpr uint32_t SHELF_HEIGHT_GRANULARITY = 8;
+
+    std::optional<AtlasRect> AllocateInShelf(Shelf &shelf, uint32_t width, uint32_t height);
+
+    std::vector<Shelf> _shelves;
+    uint32_t _size = 0;
+    uint32_t _top = 0;
+    uint64_t _usedArea = 0;
+};
+
+} // namespace DefaultPipeline::Utils
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include "Graphic.hpp"
+#include "RenderingPipeline.hpp"
+#include "component/Mesh.hpp"
+#include "core/Core.hpp"
+#include "exception/UpdateBufferError.hpp"
+#include "resource/GeometryArena.hpp"
+#include "utils/ConfigureHeadlessGraphics.hpp"
+#include "utils/ThrowErrorIfGraphicalErrorHappened.hpp"
+#include <vector>
+
+using DefaultPipeline::Resource::GeometryArena;
+
+namespace {
+Object::Component::Mesh CreateTriangle(float z)
+{
+    Object::Component::Mesh mesh;
+    mesh.SetVertices({{0.0f, 0.0f, z}, {1.0f, 0.0f, z}, {0.0f, 1.0f, z}});
+    mesh.SetNormals({{0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}});
+    mesh.SetTexCoords({{0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}});
+    mesh.SetIndices({0, 1, 2});
+    return mesh;
+}
+
+void RunWithGraphics(void (*test)(Engine::Core &))
+{
+    Engine::Core core;
+    core.AddPlugins<Graphic::Plugin>();
+    core.RegisterSystem<RenderingPipeline::Init>(Graphic::Tests::Utils::ConfigureHeadlessGraphics,
+                                                 Graphic::Tests::Utils::ThrowErrorIfGraphicalErrorHappened);
+    core.RegisterSystem(test);
+    EXPECT_NO_THROW(core.RunSystems());
+}
+
+void SameContentIsSharedTest(Engine::Core &core)
+{
+    GeometryArena arena;
+    const auto first = arena.Acquire(core, CreateTriangle(0.0f));
+    const auto same = arena.Acquire(core, CreateTriangle(0.0f));
+    const auto other = arena.Acquire(core, CreateTriangle(1.0f));
+    auto reversed = CreateTriangle(0.0f);
+    reversed.SetIndices({2, 1, 0});
+    const auto sameVertices = arena.Acquire(core, reversed);
+
+    EXPECT_EQ(first, same);
+    EXPECT_EQ(arena.GetRefCount(first), 2u);
+    EXPECT_NE(first, other);
+    EXPECT_NE(arena.Get(first).baseVertex, arena.Get(other).baseVertex);
+    // Same vertices but other indices: nothing is shared.
+    EXPECT_NE(first, sameVertices);
+    EXPECT_NE(arena.Get(first).firstIndex, arena.Get(sameVertices).firstIndex);
+}
+
+void ReleaseFreesTheLastOwnerTest(Engine::Core &core)
+{
+    GeometryArena arena;
+    const auto first = arena.Acquire(core, CreateTriangle(0.0f));
+    const auto same = arena.Acquire(core, CreateTriangle(0.0f));
+
+    arena.Release(first);
+    EXPECT_TRUE(arena.Contains(same));
+    EXPECT_EQ(arena.GetRefCount(same), 1u);
+
+    arena.Release(same);
+    EXPECT_FALSE(arena.Contains(same));
+
+    // The released content is not found anymore, it is uploaded again.
+    const auto again = arena.Acquire(core, CreateTriangle(0.0f));
+    EXPECT_TRUE(arena.Contains(again));
+    EXPECT_EQ(arena.GetRefCount(again), 1u);
+}
+
+void UpdatingASharedMeshCopiesItTest(Engine::Core &core)
+{
+    GeometryArena arena;
+    const auto first = arena.Acquire(core, CreateTriangle(0.0f));
+    const auto same = arena.Acquire(core, CreateTriangle(0.0f));
+
+    const auto updated = arena.Update(core, same, CreateTriangle(2.0f));
+    EXPECT_NE(updated, first);
+    EXPECT_EQ(arena.GetRefCount(first), 1u);
+    EXPECT_EQ(arena.GetRefCount(updated), 1u);
+
+    // Back to the content of the first mesh: the ranges are shared again.
+    const auto shared = arena.Update(core, updated, CreateTriangle(0.0f));
+    EXPECT_EQ(shared, first);
+    EXPECT_EQ(arena.GetRefCount(first), 2u);
+}
+
+void IndexSetsAreSharedPerParentTest(Engine::Core &core)
+{
+    GeometryArena arena;
+    const auto parent = arena.Acquire(core, CreateTriangle(0.0f));
+    const auto otherParent = arena.Acquire(core, CreateTriangle(1.0f));
+    const std::vector<uint32_t> indices = {0, 1, 2, 2, 1, 0};
+    const std::vector<uint32_t> reversed = {2, 1, 0, 0, 1, 2};
+
+    const auto lod = arena.AcquireIndices(core, parent, indices);
+    const auto same = arena.AcquireIndices(core, parent, indices);
+    const auto otherIndices = arena.AcquireIndices(core, parent, reversed);
+    const auto otherVertices = arena.AcquireIndices(core, otherParent, indices);
+
+    EXPECT_EQ(lod, same);
+    EXPECT_EQ(arena.GetRefCount(lod), 2u);
+    EXPECT_NE(lod, otherIndices);
+    EXPECT_NE(arena.Get(lod).firstIndex, arena.Get(otherIndices).firstIndex);
+    // Same indices over other vertices: nothing is shared.
+    EXPECT_NE(lod, otherVertices);
+    EXPECT_EQ(arena.Get(lod).baseVertex, arena.Get(parent).baseVertex);
+    EXPECT_EQ(arena.Get(otherVertices).baseVertex, arena.Get(otherParent).baseVertex);
+    EXPECT_EQ(arena.Get(lod).indexCount, indices.size());
+}
+
+void ReleasingIndexSetsKeepsTheParentTest(Engine::Core &core)
+{
+    GeometryArena arena;
+    const auto parent = arena.Acquire(core, CreateTriangle(0.0f));
+    const std::vector<uint32_t> indices = {0, 2, 1};
+
+    const auto lod = arena.AcquireIndices(core, parent, indices);
+    const auto same = arena.AcquireIndices(core, parent, indices);
+    arena.Release(lod);
+    EXPECT_TRUE(arena.Contains(same));
+    arena.Release(same);
+    EXPECT_FALSE(arena.Contains(same));
+    EXPECT_TRUE(arena.Contains(parent));
+    EXPECT_EQ(arena.GetRefCount(parent), 1u);
+
+    // The released set is not found anymore, it is uploaded again.
+    const auto again = arena.AcquireIndices(core, parent, indices);
+    EXPECT_TRUE(arena.Contains(again));
+    EXPECT_EQ(arena.GetRefCount(again), 1u);
+
+    const std::vector<uint32_t> outOfRange = {0, 1, 3};
+    EXPECT_THROW((void) arena.AcquireIndices(core, parent, outOfRange), Graphic::Exception::UpdateBufferError);
+    EXPECT_THROW((void) arena.AcquireIndices(core, again, indices), Graphic::Exception::UpdateBufferError);
+}
+
+void FailedDefragmentKeepsTheRangesTest(Engine::Core &core)
+{
+    GeometryArena arena;
+    const auto first = arena.Acquire(core, CreateTriangle(0.0f));
+    const auto second = arena.Acquire(core, CreateTriangle(1.0f));
+    const auto lod = arena.AcquireIndices(core, second, std::vector<uint32_t>{0, 2, 1});
+    arena.Release(first);
+    const auto before = arena.Get(second);
+    const auto lodBefore = arena.Get(lod);
+
+    EXPECT_THROW(arena.Defragment(core, 1, 1), Graphic::Exception::UpdateBufferError);
+    EXPECT_EQ(arena.Get(second).baseVertex, before.baseVertex);
+    EXPECT_EQ(arena.Get(second).firstIndex, before.firstIndex);
+    EXPECT_EQ(arena.Get(lod).baseVertex, lodBefore.baseVertex);
+    EXPECT_EQ(arena.Get(lod).firstIndex, lodBefore.firstIndex);
+
+    // Packing into enough room moves the ranges, and index sets follow their parent.
+    arena.Defragment(core);
+    EXPECT_EQ(arena.Get(second).baseVertex, 0u);
+    EXPECT_EQ(arena.Get(lod).baseVertex, 0u);
+}
+} // namespace
+
+TEST(GeometryArena, SameContentIsShared) { RunWithGraphics(SameContentIsSharedTest); }
+
+TEST(GeometryArena, ReleaseFreesTheLastOwner) { RunWithGraphics(ReleaseFreesTheLastOwnerTest); }
+
+TEST(GeometryArena, UpdatingASharedMeshCopiesIt) { RunWithGraphics(UpdatingASharedMeshCopiesItTest); }
+
+TEST(GeometryArena, IndexSetsAreSharedPerParent) { RunWithGraphics(IndexSetsAreSharedPerParentTest); }
+
+TEST(GeometryArena, ReleasingIndexSetsKeepsTheParent) { RunWithGraphics(ReleasingIndexSetsKeepsTheParentTest); }
+
+TEST(GeometryArena, FailedDefragmentKeepsTheRanges) { RunWithGraphics(FailedDefragmentKeepsTheRangesTest); }
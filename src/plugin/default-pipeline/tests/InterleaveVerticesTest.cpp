@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include "utils/GeometryArena.hpp"
+#include "utils/InterleaveVertices.hpp"
+#include <vector>
+
+TEST(InterleaveVertices, MatchesScalarLayout)
+{
+    constexpr size_t count = 5;
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> normals;
+    std::vector<glm::vec2> texCoords;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const float base = static_cast<float>(i) * 10.0f;
+        positions.emplace_back(base + 1.0f, base + 2.0f, base + 3.0f);
+        normals.emplace_back(base + 4.0f, base + 5.0f, base + 6.0f);
+        texCoords.emplace_back(base + 7.0f, base + 8.0f);
+    }
+
+    std::vector<float> out(count * DefaultPipeline::Utils::GEOMETRY_VERTEX_FLOATS, -1.0f);
+    DefaultPipeline::Utils::InterleaveVertices(out.data(), positions.data(), normals.data(), texCoords.data(), count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const float base = static_cast<float>(i) * 10.0f;
+        for (size_t component = 0; component < DefaultPipeline::Utils::GEOMETRY_VERTEX_FLOATS; ++component)
+        {
+            EXPECT_FLOAT_EQ(out[i * DefaultPipeline::Utils::GEOMETRY_VERTEX_FLOATS + component],
+                            base + static_cast<float>(component + 1))
+                << "vertex " << i << " component " << component;
+        }
+    }
+}
+
+TEST(InterleaveVertices, SubRangeDoesNotTouchOtherVertices)
+{
+    std::vector<glm::vec3> positions(4, glm::vec3(1.0f));
+    std::vector<glm::vec3> normals(4, glm::vec3(2.0f));
+    std::vector<glm::vec2> texCoords(4, glm::vec2(3.0f));
+
+    std::vector<float> out(4 * DefaultPipeline::Utils::GEOMETRY_VERTEX_FLOATS, 0.0f);
+    DefaultPipeline::Utils::InterleaveVertices(out.data() + DefaultPipeline::Utils::GEOMETRY_VERTEX_FLOATS,
+                                               positions.data() + 1, normals.data() + 1, texCoords.data() + 1, 2);
+
+    for (size_t component = 0; component < DefaultPipeline::Utils::GEOMETRY_VERTEX_FLOATS; ++component)
+    {
+        EXPECT_EQ(out[component], 0.0f);
+        EXPECT_EQ(out[3 * DefaultPipeline::Utils::GEOMETRY_VERTEX_FLOATS + component], 0.0f);
+    }
+    EXPECT_EQ(out[DefaultPipeline::Utils::GEOMETRY_VERTEX_FLOATS], 1.0f);
+    EXPECT_EQ(out[2 * DefaultPipeline::Utils::GEOMETRY_VERTEX_FLOATS + 7], 3.0f);
+}
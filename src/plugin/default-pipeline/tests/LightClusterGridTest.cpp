@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include "utils/LightClusterGrid.hpp"
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace {
+constexpr float NEAR_PLANE = 0.1f;
+constexpr float FAR_PLANE = 100.0f;
+
+glm::mat4 CreateView()
+{
+    return glm::lookAtLH(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+}
+
+glm::mat4 CreateProjection()
+{
+    return glm::perspectiveLH_ZO(glm::radians(70.0f), 16.0f / 9.0f, NEAR_PLANE, FAR_PLANE);
+}
+
+bool ClusterContains(const DefaultPipeline::Utils::LightClusterGrid &grid, uint32_t cluster, uint32_t light)
+{
+    const auto &range = grid.GetRanges()[cluster];
+    for (uint32_t i = 0; i < range.count; ++i)
+    {
+        if (grid.GetIndices()[range.offset + i] == light)
+            return true;
+    }
+    return false;
+}
+} // namespace
+
+TEST(LightClusterGrid, LightInFrontOfCameraIsBinnedAroundScreenCenter)
+{
+    DefaultPipeline::Utils::LightClusterGrid grid;
+    std::vector<glm::vec4> lights = {glm::vec4(0.0f, 0.0f, 10.0f, 0.5f)};
+
+    grid.Build(CreateView(), CreateProjection(), NEAR_PLANE, FAR_PLANE, lights);
+
+    const uint32_t slice = grid.GetSlice(10.0f);
+    const uint32_t centerCluster = DefaultPipeline::Utils::LightClusterGrid::GetClusterIndex(
+        DefaultPipeline::Utils::LIGHT_CLUSTER_GRID_X / 2, DefaultPipeline::Utils::LIGHT_CLUSTER_GRID_Y / 2, slice);
+    const uint32_t cornerCluster = DefaultPipeline::Utils::LightClusterGrid::GetClusterIndex(0, 0, slice);
+
+    EXPECT_TRUE(ClusterContains(grid, centerCluster, 0));
+    EXPECT_FALSE(ClusterContains(grid, cornerCluster, 0));
+    EXPECT_EQ(grid.GetDroppedIndexCount(), 0u);
+}
+
+TEST(LightClusterGrid, LightsOutsideTheFrustumAreCulled)
+{
+    DefaultPipeline::Utils::LightClusterGrid grid;
+    std::vector<glm::vec4> lights = {
+        glm::vec4(0.0f, 0.0f, -10.0f, 1.0f),  // behind the camera
+        glm::vec4(0.0f, 0.0f, 500.0f, 1.0f),  // past the far plane
+        glm::vec4(200.0f, 0.0f, 10.0f, 1.0f), // far on the right
+        glm::vec4(0.0f, 0.0f, 10.0f, 0.0f),   // no radius
+    };
+
+    grid.Build(CreateView(), CreateProjection(), NEAR_PLANE, FAR_PLANE, lights);
+
+    EXPECT_TRUE(grid.GetIndices().empty());
+}
+
+TEST(LightClusterGrid, EveryIndexReferencesAnExistingLight)
+{
+    DefaultPipeline::Utils::LightClusterGrid grid;
+    std::vector<glm::vec4> lights;
+    for (int x = -10; x <= 10; ++x)
+    {
+        for (int z = 1; z <= 50; ++z)
+        {
+            lights.emplace_back(static_cast<float>(x) * 2.0f, 0.0f, static_cast<float>(z) * 2.0f, 3.0f);
+        }
+    }
+
+    grid.Build(CreateView(), CreateProjection(), NEAR_PLANE, FAR_PLANE, lights);
+
+    ASSERT_EQ(grid.GetRanges().size(), DefaultPipeline::Utils::LIGHT_CLUSTER_COUNT);
+    EXPECT_FALSE(grid.GetIndices().empty());
+    for (const auto &range : grid.GetRanges())
+    {
+        ASSERT_LE(range.offset + range.count, grid.GetIndices().size());
+    }
+    for (uint32_t index : grid.GetIndices())
+    {
+        EXPECT_LT(index, lights.size());
+    }
+}
+
+TEST(LightClusterGrid, SlicesCoverTheDepthRange)
+{
+    DefaultPipeline::Utils::LightClusterGrid grid;
+    grid.Build(CreateView(), CreateProjection(), NEAR_PLANE, FAR_PLANE, {});
+
+    EXPECT_EQ(grid.GetSlice(NEAR_PLANE), 0u);
+    EXPECT_EQ(grid.GetSlice(FAR_PLANE * 2.0f), DefaultPipeline::Utils::LIGHT_CLUSTER_GRID_Z - 1);
+    EXPECT_LE(grid.GetSlice(1.0f), grid.GetSlice(10.0f));
+}
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include "Graphic.hpp"
+#include "RenderingPipeline.hpp"
+#include "core/Core.hpp"
+#include "resource/MaterialAtlas.hpp"
+#include "resource/MaterialTable.hpp"
+#include "utils/ConfigureHeadlessGraphics.hpp"
+#include "utils/MaterialAtlas.hpp"
+#include "utils/ThrowErrorIfGraphicalErrorHappened.hpp"
+#include <cmath>
+
+using namespace entt::literals;
+using DefaultPipeline::Resource::MaterialAtlas;
+using DefaultPipeline::Resource::MaterialTable;
+
+namespace {
+void AddImageTexture(Engine::Core &core, std::string_view name, glm::uvec2 size)
+{
+    Graphic::Resource::Image image(size, [](glm::uvec2 pos) {
+        return glm::u8vec4(static_cast<uint8_t>(pos.x), static_cast<uint8_t>(pos.y), 0, 255);
+    });
+    core.GetResource<Graphic::Resource::TextureContainer>().Add(
+        entt::hashed_string{name.data(), name.size()},
+        Graphic::Resource::Texture(core.GetResource<Graphic::Resource::DeviceContext>(),
+                                   core.GetResource<Graphic::Resource::Queue>(), name, image));
+}
+
+void AddTextureWithoutMipChain(Engine::Core &core, std::string_view name, glm::uvec2 size)
+{
+    wgpu::TextureDescriptor textureDesc(wgpu::Default);
+    textureDesc.label = wgpu::StringView(name);
+    textureDesc.size = {size.x, size.y, 1};
+    textureDesc.dimension = wgpu::TextureDimension::_2D;
+    textureDesc.mipLevelCount = 1;
+    textureDesc.sampleCount = 1;
+    textureDesc.format = MaterialAtlas::FORMAT;
+    textureDesc.usage = wgpu::TextureUsage::TextureBinding | wgpu::TextureUsage::CopySrc;
+    core.GetResource<Graphic::Resource::TextureContainer>().Add(
+        entt::hashed_string{name.data(), name.size()},
+        Graphic::Resource::Texture(core.GetResource<Graphic::Resource::DeviceContext>(), textureDesc));
+}
+
+void RunWithGraphics(void (*test)(Engine::Core &))
+{
+    Engine::Core core;
+    core.AddPlugins<Graphic::Plugin>();
+    core.RegisterSystem<RenderingPipeline::Init>(Graphic::Tests::Utils::ConfigureHeadlessGraphics,
+                                                 Graphic::Tests::Utils::ThrowErrorIfGraphicalErrorHappened);
+    core.RegisterSystem(test);
+    EXPECT_NO_THROW(core.RunSystems());
+}
+
+void PacksMipLevelsTest(Engine::Core &core)
+{
+    constexpr float pageSize = static_cast<float>(DefaultPipeline::Utils::MATERIAL_ATLAS_PAGE_SIZE);
+    constexpr float alignment = static_cast<float>(DefaultPipeline::Utils::MATERIAL_ATLAS_TILE_ALIGNMENT);
+    constexpr float lastLevel = static_cast<float>(DefaultPipeline::Utils::MATERIAL_ATLAS_MIP_LEVELS - 1);
+    AddImageTexture(core, "square", {64, 64});
+    AddImageTexture(core, "odd", {100, 60});
+    AddTextureWithoutMipChain(core, "flat", {64, 64});
+
+    MaterialAtlas atlas;
+    const auto square = atlas.Acquire(core, "square"_hs);
+    const auto odd = atlas.Acquire(core, "odd"_hs);
+    const auto flat = atlas.Acquire(core, "flat"_hs);
+    ASSERT_TRUE(square.has_value());
+    ASSERT_TRUE(odd.has_value());
+    ASSERT_TRUE(flat.has_value());
+
+    const auto &atlasTexture = core.GetResource<Graphic::Resource::TextureContainer>()
+                                   .Get(DefaultPipeline::Utils::MATERIAL_ATLAS_TEXTURE_ID)
+                                   .GetWebGPUTexture();
+    EXPECT_EQ(atlasTexture.getMipLevelCount(), DefaultPipeline::Utils::MATERIAL_ATLAS_MIP_LEVELS);
+
+    // Textures with a mip chain are sampled down to the last level of the atlas, the others only at level 0.
+    EXPECT_EQ(square->maxLod, lastLevel);
+    EXPECT_EQ(odd->maxLod, lastLevel);
+    EXPECT_EQ(flat->maxLod, 0.0f);
+
+    // The region covers the texture, but rectangles start on aligned texels.
+    EXPECT_EQ(odd->uvRect.z * pageSize, 100.0f);
+    EXPECT_EQ(odd->uvRect.w * pageSize, 60.0f);
+    for (const auto &region : {square.value(), odd.value(), flat.value()})
+    {
+        EXPECT_EQ(std::fmod(region.uvRect.x * pageSize, alignment), 0.0f);
+        EXPECT_EQ(std::fmod(region.uvRect.y * pageSize, alignment), 0.0f);
+    }
+    EXPECT_FALSE(odd->uvRect.x == square->uvRect.x && odd->uvRect.y == square->uvRect.y);
+}
+
+void SharesRegionsTest(Engine::Core &core)
+{
+    AddImageTexture(core, "shared", {32, 32});
+
+    MaterialAtlas atlas;
+    const auto first = atlas.Acquire(core, "shared"_hs);
+    const auto second = atlas.Acquire(core, "shared"_hs);
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(first->uvRect, second->uvRect);
+    EXPECT_EQ(first->layer, second->layer);
+    EXPECT_EQ(atlas.GetRefCount(first->texture), 2u);
+
+    atlas.Release(first->texture);
+    EXPECT_TRUE(atlas.Contains(first->texture));
+    atlas.Release(second->texture);
+    EXPECT_FALSE(atlas.Contains(first->texture));
+}
+} // namespace
+
+TEST(MaterialAtlas, PacksTexturesWithTheirMipLevels) { RunWithGraphics(PacksMipLevelsTest); }
+
+TEST(MaterialAtlas, SharesRegionsOfTheSameTexture) { RunWithGraphics(SharesRegionsTest); }
+
+TEST(MaterialTable, SetTextureWritesTheAtlasRegion)
+{
+    MaterialTable table;
+    const auto slot = table.Allocate();
+    EXPECT_NE(slot, DefaultPipeline::Utils::DEFAULT_MATERIAL_SLOT);
+
+    table.SetStandaloneTexture(slot);
+    EXPECT_NE(table.Get(slot).flags & DefaultPipeline::Utils::MATERIAL_FLAG_STANDALONE_TEXTURE, 0u);
+
+    table.SetTexture(slot,
+                     MaterialAtlas::Region{.uvRect = {0.25f, 0.5f, 0.125f, 0.0625f}, .layer = 2, .maxLod = 3.0f});
+    const auto &material = table.Get(slot);
+    EXPECT_EQ(material.uvRect, glm::vec4(0.25f, 0.5f, 0.125f, 0.0625f));
+    EXPECT_EQ(material.layer, 2u);
+    EXPECT_EQ(material.maxLod, 3.0f);
+    EXPECT_EQ(material.flags & DefaultPipeline::Utils::MATERIAL_FLAG_STANDALONE_TEXTURE, 0u);
+}
+
+TEST(MaterialTable, FreedSlotsAreReused)
+{
+    MaterialTable table;
+    const auto first = table.Allocate();
+    const auto second = table.Allocate();
+    EXPECT_EQ(table.GetMaterialCount(), 3u);
+
+    table.SetTexture(first, MaterialAtlas::Region{.layer = 1, .maxLod = 2.0f});
+    table.Free(first);
+    EXPECT_FALSE(table.Contains(first));
+    EXPECT_TRUE(table.Contains(second));
+
+    // A reused slot starts from the default parameters.
+    const auto reused = table.Allocate();
+    EXPECT_EQ(reused, first);
+    EXPECT_EQ(table.Get(reused).layer, 0u);
+    EXPECT_EQ(table.Get(reused).maxLod, 0.0f);
+
+    table.Free(DefaultPipeline::Utils::DEFAULT_MATERIAL_SLOT);
+    EXPECT_TRUE(table.Contains(DefaultPipeline::Utils::DEFAULT_MATERIAL_SLOT));
+}
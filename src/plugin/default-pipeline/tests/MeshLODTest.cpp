@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+
+#include "utils/MeshLOD.hpp"
+#include <array>
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace {
+constexpr std::array<float, 3> SCREEN_SIZES = {0.4f, 0.2f, 0.1f};
+constexpr float HYSTERESIS = 0.1f;
+
+uint32_t Select(uint32_t currentLevel, float screenSize)
+{
+    return DefaultPipeline::Utils::SelectLODLevel(currentLevel, screenSize, SCREEN_SIZES, HYSTERESIS);
+}
+} // namespace
+
+TEST(MeshLOD, LevelFollowsTheScreenSize)
+{
+    EXPECT_EQ(Select(0, 1.0f), 0u);
+    EXPECT_EQ(Select(0, 0.3f), 1u);
+    EXPECT_EQ(Select(0, 0.15f), 2u);
+    EXPECT_EQ(Select(0, 0.01f), 3u);
+    EXPECT_EQ(Select(3, 1.0f), 0u);
+}
+
+TEST(MeshLOD, HysteresisKeepsTheCurrentLevelAroundAThreshold)
+{
+    // Just under the first threshold, but inside the margin: the mesh keeps its full detail.
+    EXPECT_EQ(Select(0, 0.39f), 0u);
+    // Just over it, inside the margin: the first level is kept as well.
+    EXPECT_EQ(Select(1, 0.41f), 1u);
+    // Out of the margin, the level changes.
+    EXPECT_EQ(Select(0, 0.35f), 1u);
+    EXPECT_EQ(Select(1, 0.45f), 0u);
+}
+
+TEST(MeshLOD, CurrentLevelIsClampedToTheLevelCount)
+{
+    EXPECT_EQ(Select(10, 0.01f), 3u);
+    EXPECT_EQ(DefaultPipeline::Utils::SelectLODLevel(2, 0.01f, {}, HYSTERESIS), 0u);
+}
+
+TEST(MeshLOD, ScreenSizeShrinksWithDistance)
+{
+    const glm::mat4 projection = glm::perspectiveLH_ZO(glm::radians(90.0f), 1.0f, 0.1f, 100.0f);
+
+    // With a 90 degrees vertical field of view, the screen is 2d high at distance d: a sphere of diameter 2 at
+    // distance 10 covers a tenth of it.
+    EXPECT_NEAR(DefaultPipeline::Utils::ComputeScreenSize(projection, 1.0f, 10.0f), 0.1f, 1e-5f);
+    EXPECT_NEAR(DefaultPipeline::Utils::ComputeScreenSize(projection, 1.0f, 20.0f), 0.05f, 1e-5f);
+    EXPECT_GT(DefaultPipeline::Utils::ComputeScreenSize(projection, 1.0f, 0.5f), 1.0f);
+}
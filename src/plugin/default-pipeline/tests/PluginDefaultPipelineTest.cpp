@@ -2,8 +2,13 @@
 
 #include "Graphic.hpp"
 #include "RenderingPipeline.hpp"
+#include "component/GPUMesh.hpp"
+#include "component/Mesh.hpp"
+#include "component/MeshHandle.hpp"
 #include "core/Core.hpp"
 #include "plugin/PluginDefaultPipeline.hpp"
+#include "utils/MeshAsset.hpp"
+#include <utility>
 
 TEST(DefaultPipeline, SmokeTest)
 {
@@ -18,3 +23,41 @@ TEST(DefaultPipeline, SmokeTest)
     core.RunSystems();
     SUCCEED();
 }
+
+TEST(DefaultPipeline, RemovingAMeshDrawsItsMeshHandleAgain)
+{
+    Engine::Core core;
+
+    core.AddPlugins<DefaultPipeline::Plugin>();
+
+    core.RegisterSystem<RenderingPipeline::Init>([](Engine::Core &c) {
+        c.GetResource<Graphic::Resource::GraphicSettings>().SetWindowSystem(Graphic::Resource::WindowSystem::None);
+    });
+    core.RegisterSystem([](Engine::Core &c) {
+        Object::Component::Mesh triangle;
+        triangle.SetVertices({{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}});
+        triangle.SetNormals({{0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}});
+        triangle.SetTexCoords({{0.0f, 0.0f}, {1.0f, 0.0f}, {0.0f, 1.0f}});
+        triangle.SetIndices({0, 1, 2});
+        const auto handle = Object::Utils::GetOrCreateMeshAsset(c, "triangle", [&triangle] { return triangle; });
+        // Another entity keeps the asset uploaded while the first one overrides it.
+        auto other = c.CreateEntity();
+        other.AddComponent<Object::Component::MeshHandle>(handle);
+        auto entity = c.CreateEntity();
+        entity.AddComponent<Object::Component::MeshHandle>(handle);
+        const auto shared = other.GetComponents<DefaultPipeline::Component::GPUMesh>().geometry;
+        EXPECT_EQ(entity.GetComponents<DefaultPipeline::Component::GPUMesh>().geometry, shared);
+
+        // The unique mesh differs from the asset, so it is drawn from other ranges.
+        triangle.SetVertices({{0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 1.0f}, {0.0f, 1.0f, 1.0f}});
+        entity.AddComponent<Object::Component::Mesh>(std::move(triangle));
+        EXPECT_NE(entity.GetComponents<DefaultPipeline::Component::GPUMesh>().geometry, shared);
+
+        entity.RemoveComponent<Object::Component::Mesh>();
+
+        ASSERT_TRUE(entity.HasComponents<DefaultPipeline::Component::GPUMesh>());
+        EXPECT_EQ(entity.GetComponents<DefaultPipeline::Component::GPUMesh>().geometry, shared);
+    });
+
+    EXPECT_NO_THROW(core.RunSystems());
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include "utils/BoundingSphere.hpp"
+#include "utils/ShadowCascades.hpp"
+#include <cmath>
+#include <glm/gtc/matrix_transform.hpp>
+#include <vector>
+
+namespace {
+constexpr float NEAR_PLANE = 0.1f;
+constexpr float FAR_PLANE = 100.0f;
+const glm::vec3 LIGHT_DIRECTION = glm::normalize(glm::vec3(0.3f, -1.0f, 0.2f));
+
+glm::mat4 CreateInverseViewProjection(const glm::vec3 &position)
+{
+    const glm::mat4 view = glm::lookAtLH(position, position + glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    const glm::mat4 projection = glm::perspectiveLH_ZO(glm::radians(70.0f), 16.0f / 9.0f, NEAR_PLANE, FAR_PLANE);
+    return glm::inverse(projection * view);
+}
+
+DefaultPipeline::Utils::ShadowCascade ComputeCascade(const glm::vec3 &cameraPosition, float splitNear, float splitFar)
+{
+    return DefaultPipeline::Utils::ComputeShadowCascade(CreateInverseViewProjection(cameraPosition), NEAR_PLANE,
+                                                        FAR_PLANE, splitNear, splitFar, LIGHT_DIRECTION);
+}
+} // namespace
+
+TEST(ShadowCascades, SplitsIncreaseUpToTheFarPlane)
+{
+    const auto splits = DefaultPipeline::Utils::ComputeCascadeSplits(NEAR_PLANE, FAR_PLANE);
+
+    EXPECT_GT(splits[0], NEAR_PLANE);
+    for (size_t i = 1; i < splits.size(); ++i)
+        EXPECT_GT(splits[i], splits[i - 1]);
+    EXPECT_NEAR(splits.back(), FAR_PLANE, 1e-3f);
+}
+
+TEST(ShadowCascades, CascadeContainsItsSlice)
+{
+    const auto cascade = ComputeCascade(glm::vec3(0.0f), NEAR_PLANE, 10.0f);
+
+    EXPECT_TRUE(DefaultPipeline::Utils::IsSphereInCascade(cascade, glm::vec4(0.0f, 0.0f, 5.0f, 0.0f)));
+    EXPECT_TRUE(DefaultPipeline::Utils::IsSphereInCascade(cascade, glm::vec4(2.0f, -1.0f, 9.0f, 0.0f)));
+    EXPECT_FALSE(DefaultPipeline::Utils::IsSphereInCascade(cascade, glm::vec4(0.0f, 0.0f, 60.0f, 1.0f)));
+    // Outside of the slice, but large enough to reach it.
+    EXPECT_TRUE(DefaultPipeline::Utils::IsSphereInCascade(cascade, glm::vec4(0.0f, 0.0f, 60.0f, 55.0f)));
+}
+
+TEST(ShadowCascades, CasterBetweenTheLightAndTheSliceIsKept)
+{
+    const auto cascade = ComputeCascade(glm::vec3(0.0f), NEAR_PLANE, 10.0f);
+    const glm::vec3 caster = glm::vec3(0.0f, 0.0f, 5.0f) - LIGHT_DIRECTION * 20.0f;
+
+    EXPECT_TRUE(DefaultPipeline::Utils::IsSphereInCascade(cascade, glm::vec4(caster, 0.5f)));
+}
+
+TEST(ShadowCascades, SmallCameraMovesKeepTheCascade)
+{
+    const auto cascade = ComputeCascade(glm::vec3(0.0f), 10.0f, 30.0f);
+    const float snapStep = cascade.texelSize * DefaultPipeline::Utils::SHADOW_CASCADE_SNAP_TEXELS;
+
+    uint32_t unchanged = 0;
+    for (uint32_t i = 1; i <= 10; ++i)
+    {
+        const float offset = snapStep * 0.01f * static_cast<float>(i);
+        const auto moved = ComputeCascade(glm::vec3(offset, 0.0f, 0.0f), 10.0f, 30.0f);
+        EXPECT_FLOAT_EQ(moved.halfExtent, cascade.halfExtent);
+        if (moved.viewProjection == cascade.viewProjection)
+            ++unchanged;
+    }
+    // The camera may cross at most one snap boundary over a tenth of a step.
+    EXPECT_GE(unchanged, 1u);
+}
+
+TEST(ShadowCascades, BoundingSphereFollowsTheTransform)
+{
+    const std::vector<glm::vec3> positions = {glm::vec3(-1.0f, -1.0f, -1.0f), glm::vec3(1.0f, 1.0f, 1.0f)};
+    const glm::vec4 local = DefaultPipeline::Utils::ComputeBoundingSphere(positions);
+    EXPECT_EQ(glm::vec3(local), glm::vec3(0.0f));
+    EXPECT_NEAR(local.w, std::sqrt(3.0f), 1e-5f);
+
+    const glm::mat4 transform =
+        glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(5.0f, 0.0f, 0.0f)), glm::vec3(1.0f, 3.0f, 1.0f));
+    const glm::vec4 world = DefaultPipeline::Utils::TransformBoundingSphere(transform, local);
+    EXPECT_NEAR(world.x, 5.0f, 1e-5f);
+    EXPECT_NEAR(world.w, 3.0f * std::sqrt(3.0f), 1e-4f);
+}
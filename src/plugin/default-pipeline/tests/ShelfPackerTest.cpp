@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include "utils/ShelfPacker.hpp"
+
+using DefaultPipeline::Utils::AtlasRect;
+using DefaultPipeline::Utils::ShelfPacker;
+
+namespace {
+bool Overlap(const AtlasRect &a, const AtlasRect &b)
+{
+    return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height && b.y < a.y + a.height;
+}
+} // namespace
+
+TEST(ShelfPacker, PacksRectanglesWithoutOverlap)
+{
+    ShelfPacker packer(256);
+    std::vector<AtlasRect> rects;
+
+    for (uint32_t i = 0; i < 24; ++i)
+    {
+        auto rect = packer.Allocate(16 + (i % 4) * 8, 16 + (i % 3) * 12);
+        ASSERT_TRUE(rect.has_value());
+        EXPECT_LE(rect->x + rect->width, 256u);
+        EXPECT_LE(rect->y + rect->height, 256u);
+        rects.push_back(rect.value());
+    }
+
+    for (size_t i = 0; i < rects.size(); ++i)
+    {
+        for (size_t j = i + 1; j < rects.size(); ++j)
+            EXPECT_FALSE(Overlap(rects[i], rects[j])) << i << " overlaps " << j;
+    }
+}
+
+TEST(ShelfPacker, RectanglesOfCloseHeightsShareAShelf)
+{
+    ShelfPacker packer(256);
+
+    auto first = packer.Allocate(32, 30);
+    auto second = packer.Allocate(32, 27);
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(first->y, second->y);
+    EXPECT_EQ(packer.GetShelfCount(), 1u);
+
+    // Far smaller rectangles open their own shelf instead of wasting the height of the first one.
+    auto small = packer.Allocate(8, 4);
+    ASSERT_TRUE(small.has_value());
+    EXPECT_EQ(packer.GetShelfCount(), 2u);
+}
+
+TEST(ShelfPacker, RejectsRectanglesThatDoNotFit)
+{
+    ShelfPacker packer(64);
+
+    EXPECT_FALSE(packer.Allocate(65, 8).has_value());
+    EXPECT_FALSE(packer.Allocate(8, 65).has_value());
+    EXPECT_FALSE(packer.Allocate(0, 8).has_value());
+
+    ASSERT_TRUE(packer.Allocate(64, 64).has_value());
+    EXPECT_FALSE(packer.Allocate(1, 1).has_value());
+}
+
+TEST(ShelfPacker, FreedRectanglesAreReused)
+{
+    ShelfPacker packer(64);
+
+    auto top = packer.Allocate(64, 32);
+    auto bottom = packer.Allocate(64, 32);
+    ASSERT_TRUE(top.has_value());
+    ASSERT_TRUE(bottom.has_value());
+    EXPECT_FALSE(packer.Allocate(32, 32).has_value());
+
+    packer.Free(top.value());
+    auto reused = packer.Allocate(32, 32);
+    ASSERT_TRUE(reused.has_value());
+    EXPECT_EQ(reused->y, top->y);
+
+    // Empty shelves at the bottom of the page are given back, the space can then take any height.
+    packer.Free(bottom.value());
+    EXPECT_EQ(packer.GetShelfCount(), 1u);
+    packer.Free(reused.value());
+    EXPECT_EQ(packer.GetShelfCount(), 0u);
+    EXPECT_EQ(packer.GetUsedArea(), 0u);
+    EXPECT_TRUE(packer.Allocate(64, 64).has_value());
+}
@@ -6,14 +6,20 @@
 #include "resource/ARenderPass.hpp"
 #include "resource/ASingleExecutionRenderPass.hpp"
 #include "resource/Adapter.hpp"
+#include "resource/AsyncTextureLoader.hpp"
 #include "resource/BindGroup.hpp"
 #include "resource/BindGroupManager.hpp"
+#include "resource/CompressedImage.hpp"
 #include "resource/DeviceContext.hpp"
+#include "resource/FrameCapture.hpp"
+#include "resource/FrameCommandEncoder.hpp"
 #include "resource/GPUBufferContainer.hpp"
+#include "resource/GPUPassTimer.hpp"
 #include "resource/GraphicSettings.hpp"
 #include "resource/Image.hpp"
 #include "resource/Instance.hpp"
 #include "resource/Limits.hpp"
+#include "resource/PipelineCache.hpp"
 #include "resource/Queue.hpp"
 #include "resource/RenderGraph.hpp"
 #include "resource/RenderGraphContainer.hpp"
@@ -25,16 +31,23 @@
 #include "resource/Surface.hpp"
 #include "resource/Texture.hpp"
 #include "resource/TextureContainer.hpp"
+#include "resource/TextureReadback.hpp"
 #include "resource/TextureView.hpp"
 #include "resource/TextureViewContainer.hpp"
 
 // Utils
 #include "utils/DefaultSampler.hpp"
 #include "utils/DefaultTexture.hpp"
+#include "utils/ConvertTexelsToRGBA8.hpp"
 #include "utils/EmptyTexture.hpp"
 #include "utils/EndRenderTexture.hpp"
+#include "utils/GenerateMipChain.hpp"
+#include "utils/FrameWriter.hpp"
 #include "utils/GetBytesPerPixel.hpp"
 #include "utils/IValidable.hpp"
+#include "utils/MappedFileWriter.hpp"
+#include "utils/RangeAllocator.hpp"
+#include "utils/SharedSampler.hpp"
 #include "utils/shader/ABindGroupLayoutEntry.hpp"
 #include "utils/shader/BindGroupLayout.hpp"
 #include "utils/shader/BufferBindGroupLayoutEntry.hpp"
@@ -82,19 +95,30 @@
 #include "system/initialization/ReleaseAdapter.hpp"
 #include "system/initialization/ReleaseInstance.hpp"
 #include "system/initialization/RequestCapabilities.hpp"
+#include "system/initialization/SetupAsyncTextureLoader.hpp"
 #include "system/initialization/SetupQueue.hpp"
 #include "system/initialization/SetupResizableRenderTexture.hpp"
 
 #include "system/preparation/PrepareEndRenderTexture.hpp"
+#include "system/preparation/UploadLoadedTextures.hpp"
+
+#include "system/renderPipeline/CreatePendingPipelines.hpp"
 
 #include "system/commandCreation/ExecuteRenderPass.hpp"
+#include "system/commandSubmission/CaptureFrame.hpp"
+#include "system/commandSubmission/SubmitRenderPass.hpp"
+#include "system/commandSubmission/UpdateTextureReadback.hpp"
 
 #include "system/presentation/Present.hpp"
 
+#include "system/shutdown/ReleaseAsyncTextureLoader.hpp"
 #include "system/shutdown/ReleaseBindingGroup.hpp"
 #include "system/shutdown/ReleaseContext.hpp"
+#include "system/shutdown/ReleaseFrameCapture.hpp"
 #include "system/shutdown/ReleaseGPUBuffer.hpp"
+#include "system/shutdown/ReleasePipelineCache.hpp"
 #include "system/shutdown/ReleaseSampler.hpp"
 #include "system/shutdown/ReleaseShader.hpp"
 #include "system/shutdown/ReleaseTexture.hpp"
+#include "system/shutdown/ReleaseTextureReadback.hpp"
 #include "system/shutdown/ReleaseTextureView.hpp"
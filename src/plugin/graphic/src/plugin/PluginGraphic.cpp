@@ -15,26 +15,36 @@ void Graphic::Plugin::Bind()
     RegisterResource(Graphic::Resource::DeviceContext());
     RegisterResource(Graphic::Resource::GraphicSettings());
     RegisterResource(Graphic::Resource::ShaderContainer());
+    RegisterResource(Graphic::Resource::PipelineCache());
     RegisterResource(Graphic::Resource::TextureContainer());
     RegisterResource(Graphic::Resource::TextureViewContainer());
     RegisterResource(Graphic::Resource::GPUBufferContainer());
     RegisterResource(Graphic::Resource::SamplerContainer());
     RegisterResource(Graphic::Resource::BindGroupManager());
     RegisterResource(Graphic::Resource::RenderGraphContainer());
+    RegisterResource(Graphic::Resource::TextureReadback());
+    RegisterResource(Graphic::Resource::FrameCapture());
+    RegisterResource(Graphic::Resource::AsyncTextureLoader());
 
     RegisterSystems<RenderingPipeline::Setup>(
         System::CreateInstance, System::CreateSurface, System::CreateAdapter, System::ReleaseInstance,
         System::RequestCapabilities, System::CreateDevice, System::CreateQueue, System::SetupQueue,
         System::ConfigureSurface, System::ReleaseAdapter, System::CreateEmptyTexture, System::CreateDefaultTexture,
-        System::CreateDefaultSampler, System::SetupResizableRenderTexture);
+        System::CreateDefaultSampler, System::SetupAsyncTextureLoader, System::SetupResizableRenderTexture);
 
-    RegisterSystems<RenderingPipeline::Preparation>(System::PrepareEndRenderTexture);
+    RegisterSystems<RenderingPipeline::Preparation>(System::PrepareEndRenderTexture, System::UploadLoadedTextures);
+
+    RegisterSystems<RenderingPipeline::PipelineCreation>(System::CreatePendingPipelines);
 
     RegisterSystems<RenderingPipeline::CommandCreation>(System::ExecuteRenderPass);
 
+    RegisterSystems<RenderingPipeline::Submission>(System::SubmitRenderPass, System::CaptureFrame,
+                                                   System::UpdateTextureReadback);
+
     RegisterSystems<RenderingPipeline::Presentation>(System::Present);
 
     RegisterSystems<Engine::Scheduler::Shutdown>(
-        System::ReleaseGPUBuffer, System::ReleaseBindingGroup, System::ReleaseShader, System::ReleaseTextureView,
-        System::ReleaseTexture, System::ReleaseSampler, System::ReleaseContext);
+        System::ReleaseFrameCapture, System::ReleaseTextureReadback, System::ReleaseAsyncTextureLoader,
+        System::ReleaseGPUBuffer, System::ReleaseBindingGroup, System::ReleaseShader, System::ReleasePipelineCache,
+        System::ReleaseTextureView, System::ReleaseTexture, System::ReleaseSampler, System::ReleaseContext);
 }
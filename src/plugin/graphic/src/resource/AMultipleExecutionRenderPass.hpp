@@ -1,6 +1,5 @@
 #pragma once
 
-#include "exception/FailToCreateCommandEncoderError.hpp"
 #include "exception/MissingOutputRenderPassError.hpp"
 #include "resource/ARenderPass.hpp"
 #include "resource/TextureViewContainer.hpp"
@@ -19,6 +18,12 @@ template <typename TDerived> class AMultipleExecutionRenderPass : public ARender
     virtual void postMultiplePass(Engine::Core &core) {
         // Default implementation does nothing
     };
+    /**
+     * @brief Record commands that must run before the render pass of passIndex begins, such as texture copies.
+     */
+    virtual void prePass(uint16_t passIndex, wgpu::CommandEncoder &encoder, Engine::Core &core) {
+        // Default implementation does nothing
+    };
     virtual void perPass(uint16_t passIndex, Engine::Core &core) {
         // Default implementation does nothing
     };
@@ -26,24 +31,30 @@ template <typename TDerived> class AMultipleExecutionRenderPass : public ARender
         // Default implementation does nothing
     };
 
-    void Execute(Engine::Core &core) override
+    void Execute(Engine::Core &core) override { this->_RecordAndSubmit(core); }
+
+    bool SupportsRecording() const override { return true; }
+
+    void Record(wgpu::CommandEncoder &encoder, Engine::Core &core) override
     {
         preMultiplePass(core);
         const uint16_t numberOfPasses = GetNumberOfPasses(core);
         for (uint16_t passIndex = 0; passIndex < numberOfPasses; passIndex++)
         {
+            prePass(passIndex, encoder, core);
             perPass(passIndex, core);
-            ExecuteSinglePass(core);
+            _isFirstPass = passIndex == 0;
+            _isLastPass = passIndex + 1 == numberOfPasses;
+            RecordSinglePass(encoder, core);
             postPass(passIndex, core);
         }
+        _isFirstPass = true;
+        _isLastPass = true;
         postMultiplePass(core);
     }
 
-    void ExecuteSinglePass(Engine::Core &core)
+    void RecordSinglePass(wgpu::CommandEncoder &encoder, Engine::Core &core)
     {
-        auto &deviceContext = core.GetResource<Resource::DeviceContext>();
-        auto &queue = core.GetResource<Resource::Queue>();
-
         if (this->GetOutputs().colorBuffers.empty() && !this->GetOutputs().depthBuffer.has_value())
         {
             Log::Error(
@@ -51,7 +62,7 @@ template <typename TDerived> class AMultipleExecutionRenderPass : public ARender
             return;
         }
 
-        wgpu::RenderPassEncoder renderPass = this->_CreateRenderPass(deviceContext, core);
+        wgpu::RenderPassEncoder renderPass = this->_CreateRenderPass(encoder, core);
 
         auto &shader = core.GetResource<Graphic::Resource::ShaderContainer>().Get(this->GetBoundShader().value());
         renderPass.setPipeline(shader.GetPipeline());
@@ -67,36 +78,20 @@ template <typename TDerived> class AMultipleExecutionRenderPass : public ARender
 
         renderPass.end();
         renderPass.release();
-
-        wgpu::CommandBufferDescriptor cmdBufferDescriptor(wgpu::Default);
-        std::string cmdBufferDescriptorLabel = fmt::format("CreateRenderPass::{}::CommandBuffer", this->GetName());
-        cmdBufferDescriptor.label = wgpu::StringView(cmdBufferDescriptorLabel);
-        auto commandBuffer = _commandEncoder.finish(cmdBufferDescriptor);
-        _commandEncoder.release();
-
-        queue->submit(1, &commandBuffer);
-        commandBuffer.release();
     }
 
     virtual void UniqueRenderCallback(wgpu::RenderPassEncoder &renderPass, Engine::Core &core) = 0;
 
   private:
-    wgpu::RenderPassEncoder _CreateRenderPass(Resource::DeviceContext &context, Engine::Core &core)
+    wgpu::RenderPassEncoder _CreateRenderPass(wgpu::CommandEncoder &encoder, Engine::Core &core)
     {
-        auto &device = context.GetDevice().value();
-
-        wgpu::CommandEncoderDescriptor encoderDesc(wgpu::Default);
-        std::string encoderDescLabel = fmt::format("CreateRenderPass::{}::CommandEncoder", this->GetName());
-        encoderDesc.label = wgpu::StringView(encoderDescLabel);
-        _commandEncoder = device.createCommandEncoder(encoderDesc);
-        if (_commandEncoder == nullptr)
-            throw Exception::FailToCreateCommandEncoderError(fmt::format(
-                "CreateRenderPass::{}::Command encoder is not created, cannot draw sprite.", this->GetName()));
-
         wgpu::RenderPassDescriptor renderPassDesc(wgpu::Default);
         std::string renderPassDescLabel = fmt::format("CreateRenderPass::{}::RenderPass", this->GetName());
         renderPassDesc.label = wgpu::StringView(renderPassDescLabel);
 
+        wgpu::RenderPassTimestampWrites timestampWrites;
+        this->_SetTimestampWrites(renderPassDesc, timestampWrites, _isFirstPass, _isLastPass);
+
         std::vector<wgpu::RenderPassColorAttachment> colorAttachments;
         colorAttachments.reserve(this->GetOutputs().colorBuffers.size());
 
@@ -170,9 +165,11 @@ template <typename TDerived> class AMultipleExecutionRenderPass : public ARender
             renderPassDesc.depthStencilAttachment = &depthAttachment;
         }
 
-        return _commandEncoder.beginRenderPass(renderPassDesc);
+        return encoder.beginRenderPass(renderPassDesc);
     }
 
-    wgpu::CommandEncoder _commandEncoder;
+    /** @brief Position of the render pass being recorded, the pass timestamps are written by the first and last. */
+    bool _isFirstPass = true;
+    bool _isLastPass = true;
 };
 } // namespace Graphic::Resource
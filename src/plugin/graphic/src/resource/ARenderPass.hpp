@@ -1,7 +1,11 @@
 #pragma once
 
 #include "core/Core.hpp"
+#include "exception/FailToCreateCommandEncoderError.hpp"
 #include "resource/BindGroupManager.hpp"
+#include "resource/DeviceContext.hpp"
+#include "resource/GPUPassTimer.hpp"
+#include "resource/Queue.hpp"
 #include "resource/Shader.hpp"
 #include "resource/ShaderContainer.hpp"
 #include "utils/IValidable.hpp"
@@ -57,6 +61,33 @@ class ARenderPass {
 
     virtual void Execute(Engine::Core &core) = 0;
 
+    /**
+     * @brief Whether the pass implements Record.
+     *
+     * RenderGraph records such passes into the frame command encoder. Other passes are executed on their own, after
+     * what was recorded before them has been submitted.
+     */
+    virtual bool SupportsRecording() const { return false; }
+
+    /**
+     * @brief Record the pass into an encoder shared with other passes, without submitting it.
+     */
+    virtual void Record(wgpu::CommandEncoder &encoder, Engine::Core &core) {}
+
+    /**
+     * @brief Set the timestamp queries written by the next recording of the pass, std::nullopt to stop timing it.
+     */
+    void SetTimestampQuery(std::optional<GPUPassTimer::Query> query)
+    {
+        _timestampQuery = query;
+        _timestampsWritten = false;
+    }
+
+    /**
+     * @brief Whether the last recording wrote both timestamps of its query.
+     */
+    bool HasWrittenTimestamps(void) const { return _timestampsWritten; }
+
     void BindShader(std::string_view shaderName)
     {
         _boundShader = entt::hashed_string(shaderName.data(), shaderName.size());
@@ -89,6 +120,44 @@ class ARenderPass {
         _outputs.depthBuffer = output;
     }
 
+    /**
+     * @brief Declare a texture the pass reads, usually through one of its input bind groups.
+     *
+     * RenderGraph schedules the pass after every pass writing that texture.
+     */
+    void AddTextureRead(std::string_view textureName)
+    {
+        _textureReads.emplace_back(textureName.data(), textureName.size());
+    }
+
+    /**
+     * @brief Declare a texture the pass writes without it being one of its outputs, e.g. through a texture view.
+     */
+    void AddTextureWrite(std::string_view textureName)
+    {
+        _textureWrites.emplace_back(textureName.data(), textureName.size());
+    }
+
+    /**
+     * @brief Every texture written by the pass: color outputs, depth output and declared writes.
+     */
+    std::vector<entt::hashed_string> GetWrittenTextures(void) const
+    {
+        std::vector<entt::hashed_string> written(_textureWrites);
+        for (const auto &[index, colorOutput] : _outputs.colorBuffers)
+        {
+            if (colorOutput.textureId.value() != 0)
+            {
+                written.push_back(colorOutput.textureId);
+            }
+        }
+        if (_outputs.depthBuffer.has_value() && _outputs.depthBuffer->textureId.value() != 0)
+        {
+            written.push_back(_outputs.depthBuffer->textureId);
+        }
+        return written;
+    }
+
     std::vector<Utils::ValidationError> validate(Engine::Core &core) const
     {
         std::vector<Utils::ValidationError> errors;
@@ -147,11 +216,72 @@ class ARenderPass {
     const auto &GetName(void) const { return _name; }
     const auto &GetOutputs(void) const { return _outputs; }
     auto &GetOutputs(void) { return _outputs; }
+    const auto &GetTextureReads(void) const { return _textureReads; }
+
+  protected:
+    /**
+     * @brief Make a render pass of this pass write the timestamps of its query, if it has one.
+     *
+     * The first render pass writes the beginning timestamp and the last one the end timestamp, so a pass made of
+     * several render passes is timed as a whole. The writes must outlive the beginRenderPass call.
+     */
+    void _SetTimestampWrites(wgpu::RenderPassDescriptor &descriptor, wgpu::RenderPassTimestampWrites &writes,
+                             bool isFirst, bool isLast)
+    {
+        if (!_timestampQuery.has_value() || (!isFirst && !isLast))
+            return;
+
+        writes.querySet = _timestampQuery->querySet;
+        writes.beginningOfPassWriteIndex = isFirst ? _timestampQuery->beginIndex : WGPU_QUERY_SET_INDEX_UNDEFINED;
+        writes.endOfPassWriteIndex = isLast ? _timestampQuery->endIndex : WGPU_QUERY_SET_INDEX_UNDEFINED;
+        descriptor.timestampWrites = &writes;
+        if (isLast)
+            _timestampsWritten = true;
+    }
+
+    /**
+     * @brief Record the pass in a dedicated encoder and submit it immediately.
+     */
+    void _RecordAndSubmit(Engine::Core &core)
+    {
+        auto &device = core.GetResource<Resource::DeviceContext>().GetDevice().value();
+
+        wgpu::CommandEncoderDescriptor encoderDesc(wgpu::Default);
+        std::string encoderDescLabel = fmt::format("CreateRenderPass::{}::CommandEncoder", _name);
+        encoderDesc.label = wgpu::StringView(encoderDescLabel);
+        wgpu::CommandEncoder commandEncoder = device.createCommandEncoder(encoderDesc);
+        if (commandEncoder == nullptr)
+            throw Exception::FailToCreateCommandEncoderError(
+                fmt::format("CreateRenderPass::{}::Command encoder is not created, cannot draw sprite.", _name));
+
+        try
+        {
+            Record(commandEncoder, core);
+        }
+        catch (...)
+        {
+            commandEncoder.release();
+            throw;
+        }
+
+        wgpu::CommandBufferDescriptor cmdBufferDescriptor(wgpu::Default);
+        std::string cmdBufferDescriptorLabel = fmt::format("CreateRenderPass::{}::CommandBuffer", _name);
+        cmdBufferDescriptor.label = wgpu::StringView(cmdBufferDescriptorLabel);
+        auto commandBuffer = commandEncoder.finish(cmdBufferDescriptor);
+        commandEncoder.release();
+
+        core.GetResource<Resource::Queue>()->submit(1, &commandBuffer);
+        commandBuffer.release();
+    }
 
   private:
     std::optional<entt::hashed_string> _boundShader = std::nullopt;
     InputContainer _inputs;
     std::string _name;
     OutputContainer _outputs;
+    std::vector<entt::hashed_string> _textureReads;
+    std::vector<entt::hashed_string> _textureWrites;
+    std::optional<GPUPassTimer::Query> _timestampQuery = std::nullopt;
+    bool _timestampsWritten = false;
 };
 } // namespace Graphic::Resource
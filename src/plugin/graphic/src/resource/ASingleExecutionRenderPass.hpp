@@ -1,6 +1,5 @@
 #pragma once
 
-#include "exception/FailToCreateCommandEncoderError.hpp"
 #include "exception/MissingOutputRenderPassError.hpp"
 #include "resource/ARenderPass.hpp"
 #include "resource/TextureViewContainer.hpp"
@@ -11,18 +10,27 @@ template <typename TDerived> class ASingleExecutionRenderPass : public ARenderPa
   public:
     explicit ASingleExecutionRenderPass(std::string_view name) : ARenderPass(name) {}
 
-    void Execute(Engine::Core &core) override
-    {
-        auto &deviceContext = core.GetResource<Resource::DeviceContext>();
-        auto &queue = core.GetResource<Resource::Queue>();
+    void Execute(Engine::Core &core) override { this->_RecordAndSubmit(core); }
+
+    bool SupportsRecording() const override { return true; }
 
+    void Record(wgpu::CommandEncoder &encoder, Engine::Core &core) override
+    {
         if (this->GetOutputs().colorBuffers.empty() && !this->GetOutputs().depthBuffer.has_value())
         {
             throw Exception::MissingOutputRenderPassError(
                 fmt::format("RenderPass {}: No outputs defined for render pass, cannot execute.", this->GetName()));
         }
 
-        wgpu::RenderPassEncoder renderPass = this->_CreateRenderPass(deviceContext, core);
+        RecordSinglePass(encoder, core);
+    }
+
+    virtual void UniqueRenderCallback(wgpu::RenderPassEncoder &renderPass, Engine::Core &core) = 0;
+
+  private:
+    void RecordSinglePass(wgpu::CommandEncoder &encoder, Engine::Core &core)
+    {
+        wgpu::RenderPassEncoder renderPass = this->_CreateRenderPass(encoder, core);
 
         auto &shader = core.GetResource<Graphic::Resource::ShaderContainer>().Get(this->GetBoundShader().value());
         renderPass.setPipeline(shader.GetPipeline());
@@ -38,36 +46,17 @@ template <typename TDerived> class ASingleExecutionRenderPass : public ARenderPa
 
         renderPass.end();
         renderPass.release();
-
-        wgpu::CommandBufferDescriptor cmdBufferDescriptor(wgpu::Default);
-        std::string cmdBufferDescriptorLabel = fmt::format("CreateRenderPass::{}::CommandBuffer", this->GetName());
-        cmdBufferDescriptor.label = wgpu::StringView(cmdBufferDescriptorLabel);
-        auto commandBuffer = _commandEncoder.finish(cmdBufferDescriptor);
-        _commandEncoder.release();
-
-        queue->submit(1, &commandBuffer);
-        commandBuffer.release();
     }
 
-    virtual void UniqueRenderCallback(wgpu::RenderPassEncoder &renderPass, Engine::Core &core) = 0;
-
-  private:
-    wgpu::RenderPassEncoder _CreateRenderPass(Resource::DeviceContext &context, Engine::Core &core)
+    wgpu::RenderPassEncoder _CreateRenderPass(wgpu::CommandEncoder &encoder, Engine::Core &core)
     {
-        auto &device = context.GetDevice().value();
-
-        wgpu::CommandEncoderDescriptor encoderDesc(wgpu::Default);
-        std::string encoderDescLabel = fmt::format("CreateRenderPass::{}::CommandEncoder", this->GetName());
-        encoderDesc.label = wgpu::StringView(encoderDescLabel);
-        _commandEncoder = device.createCommandEncoder(encoderDesc);
-        if (_commandEncoder == nullptr)
-            throw Exception::FailToCreateCommandEncoderError(fmt::format(
-                "CreateRenderPass::{}::Command encoder is not created, cannot draw sprite.", this->GetName()));
-
         wgpu::RenderPassDescriptor renderPassDesc(wgpu::Default);
         std::string renderPassDescLabel = fmt::format("CreateRenderPass::{}::RenderPass", this->GetName());
         renderPassDesc.label = wgpu::StringView(renderPassDescLabel);
 
+        wgpu::RenderPassTimestampWrites timestampWrites;
+        this->_SetTimestampWrites(renderPassDesc, timestampWrites, true, true);
+
         std::vector<wgpu::RenderPassColorAttachment> colorAttachments;
         colorAttachments.reserve(this->GetOutputs().colorBuffers.size());
 
@@ -140,9 +129,7 @@ template <typename TDerived> class ASingleExecutionRenderPass : public ARenderPa
             renderPassDesc.depthStencilAttachment = &depthAttachment;
         }
 
-        return _commandEncoder.beginRenderPass(renderPassDesc);
+        return encoder.beginRenderPass(renderPassDesc);
     }
-
-    wgpu::CommandEncoder _commandEncoder;
 };
 } // namespace Graphic::Resource
@@ -0,0 +1,265 @@
+#include "resource/AsyncTextureLoader.hpp"
+#include "Logger.hpp"
+#include "exception/UnsupportedTextureFormatError.hpp"
+#include "resource/DeviceContext.hpp"
+#include "resource/Queue.hpp"
+#include "resource/Texture.hpp"
+#include "resource/TextureContainer.hpp"
+#include "utils/GenerateMipChain.hpp"
+#include <algorithm>
+#include <iterator>
+#include <span>
+
+namespace Graphic::Resource {
+
+AsyncTextureLoader::AsyncTextureLoader(uint32_t threadCount) : _threadCount(threadCount)
+{
+    if (_threadCount == 0)
+        _threadCount = std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+}
+
+AsyncTextureLoader &AsyncTextureLoader::operator=(AsyncTextureLoader &&other) noexcept
+{
+    if (this != &other)
+    {
+        Stop();
+        _state = std::move(other._state);
+        _threads = std::move(other._threads);
+        _threadCount = other._threadCount;
+        _uploadBudget = other._uploadBudget;
+    }
+    return *this;
+}
+
+void AsyncTextureLoader::Load(std::string_view path)
+{
+    {
+        std::scoped_lock lock(_state->mutex);
+        std::string key(path);
+        if (_state->stopping || _state->pending.contains(key) || _state->resident.contains(key) ||
+            _state->failed.contains(key))
+            return;
+        _state->pending.insert(key);
+        _state->jobs.push_back(std::move(key));
+    }
+    // Workers are started on the first load, so a loader that is never used costs no thread.
+    while (_threads.size() < _threadCount)
+    {
+        _threads.emplace_back(&AsyncTextureLoader::_Run, _state);
+    }
+    _state->hasJobs.notify_one();
+}
+
+void AsyncTextureLoader::Forget(std::string_view path)
+{
+    std::scoped_lock lock(_state->mutex);
+    std::string key(path);
+    _state->resident.erase(key);
+    _state->failed.erase(key);
+}
+
+void AsyncTextureLoader::Update(Engine::Core &core)
+{
+    // At least one image is uploaded per frame, even if it is bigger than the budget.
+    uint64_t uploadedBytes = 0;
+    for (bool first = true; first || uploadedBytes < _uploadBudget; first = false)
+    {
+        std::optional<DecodedImage> decoded = _PopDecoded();
+        if (!decoded.has_value())
+            return;
+        uploadedBytes += decoded->GetByteSize();
+        _Upload(core, *decoded);
+    }
+}
+
+void AsyncTextureLoader::Flush(Engine::Core &core)
+{
+    {
+        std::unique_lock lock(_state->mutex);
+        _state->hasDecoded.wait(
+            lock, [this]() { return (_state->jobs.empty() && _state->decoding == 0) || _state->stopping; });
+    }
+    while (true)
+    {
+        std::optional<DecodedImage> decoded = _PopDecoded();
+        if (!decoded.has_value())
+            return;
+        _Upload(core, *decoded);
+    }
+}
+
+void AsyncTextureLoader::Stop()
+{
+    if (_state == nullptr)
+        return;
+    {
+        std::scoped_lock lock(_state->mutex);
+        _state->stopping = true;
+        for (const auto &path : _state->jobs)
+            _state->pending.erase(path);
+        _state->jobs.clear();
+    }
+    _state->hasJobs.notify_all();
+    _state->hasDecoded.notify_all();
+    for (auto &thread : _threads)
+    {
+        if (thread.joinable())
+            thread.join();
+    }
+    _threads.clear();
+
+    // Images decoded but not uploaded yet can no longer be, they would stay pending forever.
+    std::scoped_lock lock(_state->mutex);
+    _state->decoded.clear();
+    _state->pending.clear();
+}
+
+bool AsyncTextureLoader::IsPending(std::string_view path) const
+{
+    std::scoped_lock lock(_state->mutex);
+    return _state->pending.contains(std::string(path));
+}
+
+bool AsyncTextureLoader::IsResident(std::string_view path) const
+{
+    std::scoped_lock lock(_state->mutex);
+    return _state->resident.contains(std::string(path));
+}
+
+bool AsyncTextureLoader::HasFailed(std::string_view path) const
+{
+    std::scoped_lock lock(_state->mutex);
+    return _state->failed.contains(std::string(path));
+}
+
+size_t AsyncTextureLoader::GetPendingCount() const
+{
+    std::scoped_lock lock(_state->mutex);
+    return _state->pending.size();
+}
+
+size_t AsyncTextureLoader::GetReadyCount() const
+{
+    std::scoped_lock lock(_state->mutex);
+    return _state->decoded.size();
+}
+
+void AsyncTextureLoader::_Run(std::shared_ptr<State> sharedState)
+{
+    State &state = *sharedState;
+    while (true)
+    {
+        std::string path;
+        bool compressedTexturesSupported = false;
+        {
+            std::unique_lock lock(state.mutex);
+            state.hasJobs.wait(lock, [&state]() { return !state.jobs.empty() || state.stopping; });
+            if (state.stopping)
+                return;
+            path = std::move(state.jobs.front());
+            state.jobs.pop_front();
+            compressedTexturesSupported = state.compressedTexturesSupported;
+            ++state.decoding;
+        }
+
+        DecodedImage decoded{.path = path};
+        try
+        {
+            _Decode(decoded, compressedTexturesSupported);
+        }
+        catch (const std::exception &e)
+        {
+            Log::Error(fmt::format("AsyncTextureLoader: Failed to decode '{}': {}", path, e.what()));
+            decoded.levels.clear();
+            decoded.compressed.reset();
+        }
+
+        {
+            std::scoped_lock lock(state.mutex);
+            state.decoded.push_back(std::move(decoded));
+            --state.decoding;
+        }
+        state.hasDecoded.notify_all();
+    }
+}
+
+std::optional<AsyncTextureLoader::DecodedImage> AsyncTextureLoader::_PopDecoded()
+{
+    std::scoped_lock lock(_state->mutex);
+    if (_state->decoded.empty())
+        return std::nullopt;
+    DecodedImage decoded = std::move(_state->decoded.front());
+    _state->decoded.pop_front();
+    return decoded;
+}
+
+void AsyncTextureLoader::_Decode(DecodedImage &decoded, bool compressedTexturesSupported)
+{
+    const std::filesystem::path path(decoded.path);
+    if (CompressedImage::IsCompressedImageFile(path))
+    {
+        if (!compressedTexturesSupported)
+            throw Exception::UnsupportedTextureFormatError("The device does not support compressed textures");
+        decoded.compressed.emplace(path);
+        return;
+    }
+
+    if (compressedTexturesSupported)
+    {
+        // A compressed version of the texture next to its source is used instead, smaller to upload and in VRAM.
+        for (const char *extension : {".ktx2", ".dds"})
+        {
+            const auto compressedPath = std::filesystem::path(path).replace_extension(extension);
+            if (!std::filesystem::exists(compressedPath))
+                continue;
+            try
+            {
+                decoded.compressed.emplace(compressedPath);
+                return;
+            }
+            catch (const std::exception &e)
+            {
+                Log::Warning(fmt::format("AsyncTextureLoader: Ignoring '{}': {}", compressedPath.string(), e.what()));
+            }
+        }
+    }
+
+    decoded.levels.emplace_back(path);
+    auto mips = Utils::GenerateMipChain(decoded.levels.front());
+    std::ranges::move(mips, std::back_inserter(decoded.levels));
+}
+
+void AsyncTextureLoader::_Upload(Engine::Core &core, DecodedImage &decoded)
+{
+    const bool succeeded = decoded.compressed.has_value() || !decoded.levels.empty();
+    if (succeeded)
+    {
+        const auto &deviceContext = core.GetResource<DeviceContext>();
+        const auto &queue = core.GetResource<Queue>();
+        auto &textureContainer = core.GetResource<TextureContainer>();
+        entt::hashed_string textureId{decoded.path.data(), decoded.path.size()};
+        if (!textureContainer.Contains(textureId))
+        {
+            if (decoded.compressed.has_value())
+                textureContainer.Add(textureId, Texture(deviceContext, queue, decoded.path, *decoded.compressed));
+            else
+                textureContainer.Add(textureId, Texture(deviceContext, queue, decoded.path,
+                                                        std::span<const Image>(decoded.levels)));
+        }
+    }
+
+    std::scoped_lock lock(_state->mutex);
+    _state->pending.erase(decoded.path);
+    if (succeeded)
+        _state->resident.insert(std::move(decoded.path));
+    else
+        _state->failed.insert(std::move(decoded.path));
+}
+
+void AsyncTextureLoader::SetCompressedTexturesSupported(bool supported)
+{
+    std::scoped_lock lock(_state->mutex);
+    _state->compressedTexturesSupported = supported;
+}
+
+} // namespace Graphic::Resource
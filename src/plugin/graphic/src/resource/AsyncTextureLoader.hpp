@@ -0,0 +1,130 @@
+#pragma once
+
+#include "core/Core.hpp"
+#include "resource/CompressedImage.hpp"
+#include "resource/Image.hpp"
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+namespace Graphic::Resource {
+
+/**
+ * @brief Decodes image files on worker threads and uploads them as textures a few per frame.
+ *
+ * A loaded texture is added to the TextureContainer under its path, like a texture created synchronously from an
+ * Image. Uploads are limited to a number of bytes per frame (at least one texture per frame is uploaded), so loading
+ * hundreds of textures spreads over several frames instead of freezing one. Until IsResident returns true, users
+ * should bind a placeholder such as Utils::DEFAULT_TEXTURE_ID.
+ */
+class AsyncTextureLoader {
+  public:
+    static inline constexpr uint64_t DEFAULT_UPLOAD_BUDGET = 16ull << 20;
+
+    explicit AsyncTextureLoader(uint32_t threadCount = 0);
+    ~AsyncTextureLoader() { Stop(); }
+
+    AsyncTextureLoader(const AsyncTextureLoader &) = delete;
+    AsyncTextureLoader &operator=(const AsyncTextureLoader &) = delete;
+    AsyncTextureLoader(AsyncTextureLoader &&) noexcept = default;
+    AsyncTextureLoader &operator=(AsyncTextureLoader &&other) noexcept;
+
+    /**
+     * @brief Queue the decoding of an image file, unless it is already queued, loaded or failed to load.
+     */
+    void Load(std::string_view path);
+
+    /**
+     * @brief Forget that an image was loaded or failed to load, so that the next Load decodes the file again (e.g.
+     * once it was edited). The texture stays in the TextureContainer until the caller removes it.
+     */
+    void Forget(std::string_view path);
+
+    /**
+     * @brief Upload decoded images to the GPU, up to the upload budget. Called once per frame.
+     */
+    void Update(Engine::Core &core);
+
+    /**
+     * @brief Wait for every queued image to be decoded and upload all of them, ignoring the budget.
+     */
+    void Flush(Engine::Core &core);
+
+    /**
+     * @brief Stop the worker threads. Queued images that are not uploaded yet are discarded and no longer pending,
+     * and no image can be loaded afterwards.
+     */
+    void Stop();
+
+    [[nodiscard]] bool IsPending(std::string_view path) const;
+    [[nodiscard]] bool IsResident(std::string_view path) const;
+    [[nodiscard]] bool HasFailed(std::string_view path) const;
+    [[nodiscard]] size_t GetPendingCount() const;
+    /** @brief Number of decoded images waiting for their upload. */
+    [[nodiscard]] size_t GetReadyCount() const;
+
+    /**
+     * @brief Let the loader use KTX2 / DDS files, see CompressedImage. Set by the plugin once the device exists.
+     *
+     * When enabled, a compressed file next to the requested image (same name, .ktx2 or .dds extension) is loaded
+     * instead of it. Otherwise images are decoded to RGBA8 and their mip chain is generated on the worker threads.
+     */
+    void SetCompressedTexturesSupported(bool supported);
+
+    void SetUploadBudget(uint64_t bytesPerFrame) { _uploadBudget = bytesPerFrame; }
+    [[nodiscard]] uint64_t GetUploadBudget() const { return _uploadBudget; }
+
+  private:
+    /** @brief Either the mip chain of an RGBA8 image or a compressed image, both empty if decoding failed. */
+    struct DecodedImage {
+        std::string path;
+        std::vector<Image> levels;
+        std::optional<CompressedImage> compressed;
+
+        [[nodiscard]] uint64_t GetByteSize() const
+        {
+            if (compressed.has_value())
+                return compressed->data.size();
+            uint64_t size = 0;
+            for (const auto &level : levels)
+                size += level.pixels.size() * sizeof(glm::u8vec4);
+            return size;
+        }
+    };
+
+    /** @brief Shared with the worker threads, so that the loader itself can be moved. */
+    struct State {
+        mutable std::mutex mutex;
+        std::condition_variable hasJobs;
+        std::condition_variable hasDecoded;
+        std::deque<std::string> jobs;
+        std::deque<DecodedImage> decoded;
+        std::unordered_set<std::string> pending;
+        std::unordered_set<std::string> resident;
+        std::unordered_set<std::string> failed;
+        bool compressedTexturesSupported = false;
+        /** @brief Number of images being decoded by the worker threads. */
+        size_t decoding = 0;
+        bool stopping = false;
+    };
+
+    static void _Run(std::shared_ptr<State> sharedState);
+    static void _Decode(DecodedImage &decoded, bool compressedTexturesSupported);
+    std::optional<DecodedImage> _PopDecoded();
+    void _Upload(Engine::Core &core, DecodedImage &decoded);
+
+    std::shared_ptr<State> _state = std::make_shared<State>();
+    std::vector<std::thread> _threads;
+    uint32_t _threadCount = 0;
+    uint64_t _uploadBudget = DEFAULT_UPLOAD_BUDGET;
+};
+
+} // namespace Graphic::Resource
@@ -10,6 +10,7 @@
 #include "resource/SamplerContainer.hpp"
 #include "resource/ShaderContainer.hpp"
 #include "resource/TextureContainer.hpp"
+#include "resource/TextureViewContainer.hpp"
 #include "utils/webgpu.hpp"
 
 namespace Graphic::Resource {
@@ -21,6 +22,8 @@ class BindGroup {
             Buffer,
             Sampler,
             Texture,
+            /** @brief A view of the TextureViewContainer, for views other than the default one (e.g. arrays). */
+            TextureView,
         };
 
         uint32_t binding;
@@ -141,6 +144,11 @@ class BindGroup {
             entry.textureView = texture.GetDefaultView().GetWebGPUView();
             break;
         }
+        case Asset::Type::TextureView: {
+            auto &textureViewContainer = core.GetResource<Graphic::Resource::TextureViewContainer>();
+            entry.textureView = textureViewContainer.Get(asset.name).GetWebGPUView();
+            break;
+        }
         default: throw Exception::BindGroupCreationError("Unexpected Asset::Type value in _CreateBindGroupEntry");
         }
 
@@ -0,0 +1,239 @@
+#include "resource/CompressedImage.hpp"
+#include "exception/FileReadingError.hpp"
+#include "exception/UnknownFileError.hpp"
+#include "exception/UnsupportedTextureFormatError.hpp"
+#include "utils/GenerateMipChain.hpp"
+#include <fmt/format.h>
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+namespace Graphic::Resource {
+
+namespace {
+
+constexpr uint32_t DDS_MAGIC = 0x20534444; // "DDS "
+constexpr size_t DDS_HEADER_SIZE = 124;
+constexpr size_t DDS_DX10_HEADER_SIZE = 20;
+constexpr uint32_t DDSD_MIPMAPCOUNT = 0x20000;
+constexpr uint32_t DDPF_FOURCC = 0x4;
+
+constexpr std::array<uint8_t, 12> KTX2_IDENTIFIER = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32,
+                                                     0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+constexpr size_t KTX2_LEVEL_INDEX_OFFSET = 80;
+constexpr size_t KTX2_LEVEL_INDEX_ENTRY_SIZE = 24;
+
+constexpr uint32_t MakeFourCC(char a, char b, char c, char d)
+{
+    return uint32_t(uint8_t(a)) | uint32_t(uint8_t(b)) << 8 | uint32_t(uint8_t(c)) << 16 | uint32_t(uint8_t(d)) << 24;
+}
+
+template <typename T> T ReadLittleEndian(const std::vector<uint8_t> &data, size_t offset)
+{
+    T value = 0;
+    for (size_t i = 0; i < sizeof(T); ++i)
+        value |= static_cast<T>(data[offset + i]) << (8 * i);
+    return value;
+}
+
+wgpu::TextureFormat GetFormatFromFourCC(uint32_t fourCC)
+{
+    switch (fourCC)
+    {
+    case MakeFourCC('D', 'X', 'T', '1'): return wgpu::TextureFormat::BC1RGBAUnormSrgb;
+    case MakeFourCC('D', 'X', 'T', '5'): return wgpu::TextureFormat::BC3RGBAUnormSrgb;
+    case MakeFourCC('A', 'T', 'I', '2'):
+    case MakeFourCC('B', 'C', '5', 'U'): return wgpu::TextureFormat::BC5RGUnorm;
+    case MakeFourCC('B', 'C', '5', 'S'): return wgpu::TextureFormat::BC5RGSnorm;
+    default: return wgpu::TextureFormat::Undefined;
+    }
+}
+
+wgpu::TextureFormat GetFormatFromDXGI(uint32_t dxgiFormat)
+{
+    switch (dxgiFormat)
+    {
+    case 71: return wgpu::TextureFormat::BC1RGBAUnorm;
+    case 72: return wgpu::TextureFormat::BC1RGBAUnormSrgb;
+    case 77: return wgpu::TextureFormat::BC3RGBAUnorm;
+    case 78: return wgpu::TextureFormat::BC3RGBAUnormSrgb;
+    case 83: return wgpu::TextureFormat::BC5RGUnorm;
+    case 84: return wgpu::TextureFormat::BC5RGSnorm;
+    case 98: return wgpu::TextureFormat::BC7RGBAUnorm;
+    case 99: return wgpu::TextureFormat::BC7RGBAUnormSrgb;
+    default: return wgpu::TextureFormat::Undefined;
+    }
+}
+
+wgpu::TextureFormat GetFormatFromVkFormat(uint32_t vkFormat)
+{
+    switch (vkFormat)
+    {
+    case 131: // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+    case 133: return wgpu::TextureFormat::BC1RGBAUnorm;
+    case 132: // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+    case 134: return wgpu::TextureFormat::BC1RGBAUnormSrgb;
+    case 137: return wgpu::TextureFormat::BC3RGBAUnorm;
+    case 138: return wgpu::TextureFormat::BC3RGBAUnormSrgb;
+    case 141: return wgpu::TextureFormat::BC5RGUnorm;
+    case 142: return wgpu::TextureFormat::BC5RGSnorm;
+    case 145: return wgpu::TextureFormat::BC7RGBAUnorm;
+    case 146: return wgpu::TextureFormat::BC7RGBAUnormSrgb;
+    default: return wgpu::TextureFormat::Undefined;
+    }
+}
+
+/** @brief Reject level counts beyond the full mip chain, whose levels would have no size left. */
+void ValidateLevelCount(uint32_t levelCount, uint32_t width, uint32_t height, const std::filesystem::path &filepath)
+{
+    const uint32_t maxLevelCount = Utils::GetMipLevelCount(width, height);
+    if (levelCount > maxLevelCount)
+        throw Exception::FileReadingError(fmt::format("{} mip levels for a {}x{} texture, at most {} are possible: {}",
+                                                      levelCount, width, height, maxLevelCount, filepath.string()));
+}
+
+} // namespace
+
+CompressedImage::CompressedImage(const std::filesystem::path &filepath)
+{
+    if (std::filesystem::exists(filepath) == false)
+        throw Exception::UnknownFileError("File not found at: " + filepath.string());
+
+    std::ifstream file(filepath, std::ios::binary | std::ios::ate);
+    if (!file)
+        throw Exception::FileReadingError("Failed to open compressed image: " + filepath.string());
+    data.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size())))
+        throw Exception::FileReadingError("Failed to read compressed image: " + filepath.string());
+
+    if (data.size() >= KTX2_IDENTIFIER.size() && std::equal(KTX2_IDENTIFIER.begin(), KTX2_IDENTIFIER.end(),
+                                                            data.begin()))
+        _ParseKTX2(filepath);
+    else if (data.size() >= 4 && ReadLittleEndian<uint32_t>(data, 0) == DDS_MAGIC)
+        _ParseDDS(filepath);
+    else
+        throw Exception::FileReadingError("Unknown compressed image container: " + filepath.string());
+}
+
+bool CompressedImage::IsCompressedImageFile(const std::filesystem::path &filepath)
+{
+    std::string extension = filepath.extension().string();
+    std::ranges::transform(extension, extension.begin(), [](unsigned char c) { return std::tolower(c); });
+    return extension == ".ktx2" || extension == ".dds";
+}
+
+uint32_t CompressedImage::GetBlockSize(wgpu::TextureFormat format)
+{
+    switch (format)
+    {
+    case wgpu::TextureFormat::BC1RGBAUnorm:
+    case wgpu::TextureFormat::BC1RGBAUnormSrgb: return 8;
+    case wgpu::TextureFormat::BC3RGBAUnorm:
+    case wgpu::TextureFormat::BC3RGBAUnormSrgb:
+    case wgpu::TextureFormat::BC5RGUnorm:
+    case wgpu::TextureFormat::BC5RGSnorm:
+    case wgpu::TextureFormat::BC7RGBAUnorm:
+    case wgpu::TextureFormat::BC7RGBAUnormSrgb: return 16;
+    default: return 0;
+    }
+}
+
+void CompressedImage::_ParseDDS(const std::filesystem::path &filepath)
+{
+    if (data.size() < 4 + DDS_HEADER_SIZE || ReadLittleEndian<uint32_t>(data, 4) != DDS_HEADER_SIZE)
+        throw Exception::FileReadingError("Invalid DDS header: " + filepath.string());
+
+    const auto flags = ReadLittleEndian<uint32_t>(data, 8);
+    height = ReadLittleEndian<uint32_t>(data, 12);
+    width = ReadLittleEndian<uint32_t>(data, 16);
+    const auto mipMapCount = ReadLittleEndian<uint32_t>(data, 28);
+    const auto pixelFormatFlags = ReadLittleEndian<uint32_t>(data, 80);
+    const auto fourCC = ReadLittleEndian<uint32_t>(data, 84);
+
+    size_t offset = 4 + DDS_HEADER_SIZE;
+    if ((pixelFormatFlags & DDPF_FOURCC) == 0)
+        throw Exception::UnsupportedTextureFormatError("Uncompressed DDS textures are not supported: " +
+                                                       filepath.string());
+    if (fourCC == MakeFourCC('D', 'X', '1', '0'))
+    {
+        if (data.size() < offset + DDS_DX10_HEADER_SIZE)
+            throw Exception::FileReadingError("Invalid DDS DX10 header: " + filepath.string());
+        const auto resourceDimension = ReadLittleEndian<uint32_t>(data, offset + 4);
+        const auto arraySize = ReadLittleEndian<uint32_t>(data, offset + 12);
+        if (resourceDimension != 3 /* D3D10_RESOURCE_DIMENSION_TEXTURE2D */ || arraySize > 1)
+            throw Exception::UnsupportedTextureFormatError("Only single 2D DDS textures are supported: " +
+                                                           filepath.string());
+        format = GetFormatFromDXGI(ReadLittleEndian<uint32_t>(data, offset));
+        offset += DDS_DX10_HEADER_SIZE;
+    }
+    else
+    {
+        format = GetFormatFromFourCC(fourCC);
+    }
+    if (format == wgpu::TextureFormat::Undefined)
+        throw Exception::UnsupportedTextureFormatError("Unsupported DDS texture format: " + filepath.string());
+
+    const uint32_t levelCount = (flags & DDSD_MIPMAPCOUNT) != 0 ? std::max(mipMapCount, 1u) : 1u;
+    ValidateLevelCount(levelCount, width, height, filepath);
+    for (uint32_t level = 0; level < levelCount; ++level)
+    {
+        _AddLevel(offset, filepath);
+        offset += levels.back().size;
+    }
+}
+
+void CompressedImage::_ParseKTX2(const std::filesystem::path &filepath)
+{
+    if (data.size() < KTX2_LEVEL_INDEX_OFFSET)
+        throw Exception::FileReadingError("Invalid KTX2 header: " + filepath.string());
+
+    const auto vkFormat = ReadLittleEndian<uint32_t>(data, 12);
+    width = ReadLittleEndian<uint32_t>(data, 20);
+    height = ReadLittleEndian<uint32_t>(data, 24);
+    const auto depth = ReadLittleEndian<uint32_t>(data, 28);
+    const auto layerCount = ReadLittleEndian<uint32_t>(data, 32);
+    const auto faceCount = ReadLittleEndian<uint32_t>(data, 36);
+    const auto levelCount = std::max(ReadLittleEndian<uint32_t>(data, 40), 1u);
+    const auto supercompressionScheme = ReadLittleEndian<uint32_t>(data, 44);
+
+    if (depth > 1 || layerCount > 1 || faceCount != 1 || supercompressionScheme != 0)
+        throw Exception::UnsupportedTextureFormatError(
+            "Only single 2D KTX2 textures without supercompression are supported: " + filepath.string());
+    format = GetFormatFromVkFormat(vkFormat);
+    if (format == wgpu::TextureFormat::Undefined)
+        throw Exception::UnsupportedTextureFormatError(
+            fmt::format("Unsupported KTX2 texture format {}: {}", vkFormat, filepath.string()));
+    ValidateLevelCount(levelCount, width, height, filepath);
+    if (data.size() < KTX2_LEVEL_INDEX_OFFSET + size_t{levelCount} * KTX2_LEVEL_INDEX_ENTRY_SIZE)
+        throw Exception::FileReadingError("Invalid KTX2 level index: " + filepath.string());
+
+    for (uint32_t level = 0; level < levelCount; ++level)
+    {
+        const size_t entry = KTX2_LEVEL_INDEX_OFFSET + size_t{level} * KTX2_LEVEL_INDEX_ENTRY_SIZE;
+        _AddLevel(static_cast<size_t>(ReadLittleEndian<uint64_t>(data, entry)), filepath);
+        if (ReadLittleEndian<uint64_t>(data, entry + 8) < levels.back().size)
+            throw Exception::FileReadingError("Truncated KTX2 level: " + filepath.string());
+    }
+}
+
+void CompressedImage::_AddLevel(size_t offset, const std::filesystem::path &filepath)
+{
+    const auto mip = static_cast<uint32_t>(levels.size());
+    if (mip == 0 && (width % 4 != 0 || height % 4 != 0))
+        throw Exception::UnsupportedTextureFormatError(
+            fmt::format("Compressed texture size {}x{} is not a multiple of 4: {}", width, height, filepath.string()));
+    Level level;
+    level.width = std::max(width >> mip, 1u);
+    level.height = std::max(height >> mip, 1u);
+    level.offset = offset;
+    level.size = size_t{(level.width + 3) / 4} * ((level.height + 3) / 4) * GetBlockSize(format);
+    if (width == 0 || height == 0 || level.offset > data.size() || data.size() - level.offset < level.size)
+        throw Exception::FileReadingError(fmt::format("Truncated mip level {} in: {}", mip, filepath.string()));
+    levels.push_back(level);
+}
+
+} // namespace Graphic::Resource
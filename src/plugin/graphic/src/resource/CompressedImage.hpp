@@ -0,0 +1,58 @@
+#pragma once
+
+#include "utils/webgpu.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace Graphic::Resource {
+
+/**
+ * @brief Block-compressed image with its mip levels, as stored in a KTX2 or DDS file.
+ *
+ * Supports BC1, BC3, BC5 and BC7 2D textures without supercompression. DDS files using the legacy DXT1 / DXT5 codes
+ * are read as sRGB, like the RGBA8 textures loaded from an Image. Using such a texture requires the
+ * TextureCompressionBC feature, see DeviceContext::HasFeature.
+ */
+struct CompressedImage {
+    struct Level {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        /** @brief Byte offset of the level in data. */
+        size_t offset = 0;
+        size_t size = 0;
+    };
+
+    wgpu::TextureFormat format = wgpu::TextureFormat::Undefined;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    std::vector<Level> levels;
+    std::vector<uint8_t> data;
+
+    CompressedImage() = default;
+
+    /**
+     * @throws Exception::UnknownFileError If the file does not exist.
+     * @throws Exception::FileReadingError If the file is not a valid KTX2 or DDS file.
+     * @throws Exception::UnsupportedTextureFormatError If the texture is not a 2D BC1/3/5/7 texture.
+     */
+    explicit CompressedImage(const std::filesystem::path &filepath);
+
+    /**
+     * @brief Whether the path has the extension of a supported container (.ktx2 or .dds).
+     */
+    static bool IsCompressedImageFile(const std::filesystem::path &filepath);
+
+    /**
+     * @brief Size in bytes of a 4x4 block, or 0 if the format is not a supported block format.
+     */
+    static uint32_t GetBlockSize(wgpu::TextureFormat format);
+
+  private:
+    void _ParseDDS(const std::filesystem::path &filepath);
+    void _ParseKTX2(const std::filesystem::path &filepath);
+    void _AddLevel(size_t offset, const std::filesystem::path &filepath);
+};
+
+} // namespace Graphic::Resource
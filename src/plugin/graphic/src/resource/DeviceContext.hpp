@@ -1,7 +1,9 @@
 #pragma once
 
 #include "utils/webgpu.hpp"
+#include <algorithm>
 #include <optional>
+#include <vector>
 
 namespace Graphic::Resource {
 struct DeviceContext {
@@ -19,6 +21,14 @@ struct DeviceContext {
     auto &GetDevice() { return _device; }
     const auto &GetDevice() const { return _device; }
 
+    /** @brief Features the device was created with: the required ones and the supported optional ones. */
+    auto &GetFeatures() { return _features; }
+    const auto &GetFeatures() const { return _features; }
+    bool HasFeature(wgpu::FeatureName feature) const
+    {
+        return std::ranges::find(_features, static_cast<WGPUFeatureName>(feature)) != _features.end();
+    }
+
     void Release() noexcept
     {
         if (_device.has_value())
@@ -31,5 +41,6 @@ struct DeviceContext {
   private:
     wgpu::DeviceDescriptor _descriptor = wgpu::DeviceDescriptor(wgpu::Default);
     std::optional<wgpu::Device> _device = std::nullopt;
+    std::vector<WGPUFeatureName> _features;
 };
 } // namespace Graphic::Resource
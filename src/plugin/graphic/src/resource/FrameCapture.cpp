@@ -0,0 +1,83 @@
+#include "resource/FrameCapture.hpp"
+#include "resource/TextureContainer.hpp"
+#include "utils/EndRenderTexture.hpp"
+#include <algorithm>
+#include <thread>
+
+namespace Graphic::Resource {
+
+void FrameCapture::StartPngSequence(const std::filesystem::path &directory, std::string_view prefix)
+{
+    std::filesystem::create_directories(directory);
+    auto state = std::make_unique<State>();
+    // PNG encoding is the bottleneck, frames are independent so they are encoded in parallel.
+    const uint32_t threadCount = std::clamp(std::thread::hardware_concurrency() / 2, 1u, 4u);
+    state->writer = std::make_unique<Utils::FrameWriter>(
+        [directory, prefix = std::string(prefix)](const Image &image, uint64_t frameIndex) {
+            auto path = directory / fmt::format("{}_{:06}.png", prefix, frameIndex);
+            image.ToPng(path.string());
+        },
+        _maxQueuedFrames, threadCount);
+    _Start(std::move(state));
+}
+
+void FrameCapture::StartRawFile(const std::filesystem::path &path)
+{
+    if (path.has_parent_path())
+        std::filesystem::create_directories(path.parent_path());
+    auto state = std::make_unique<State>();
+    state->rawFile = std::make_unique<Utils::MappedFileWriter>(path);
+    // A single thread keeps the frames in order in the file.
+    state->writer = std::make_unique<Utils::FrameWriter>(
+        [rawFile = state->rawFile.get()](const Image &image, uint64_t) {
+            rawFile->Write(image.pixels.data(), image.pixels.size() * sizeof(glm::u8vec4));
+        },
+        _maxQueuedFrames, 1);
+    _Start(std::move(state));
+}
+
+void FrameCapture::_Start(std::unique_ptr<State> state)
+{
+    if (IsCapturing())
+    {
+        Log::Warning("FrameCapture: Already capturing, stop the current capture first.");
+        return;
+    }
+    state->dropFramesWhenBusy = _dropFramesWhenBusy;
+    _state = std::move(state);
+    _capturedFrames = 0;
+}
+
+void FrameCapture::Stop(Engine::Core &core)
+{
+    if (!IsCapturing())
+        return;
+    _readback.WaitAll(core);
+    _state->writer->Stop();
+    if (_state->rawFile)
+        _state->rawFile->Close();
+    Log::Info(fmt::format("FrameCapture: {} frame(s) captured, {} written, {} dropped.", _capturedFrames,
+                          _state->writer->GetWrittenFrameCount(), _state->droppedFrames.load()));
+    _state.reset();
+}
+
+void FrameCapture::Capture(Engine::Core &core)
+{
+    if (!IsCapturing())
+        return;
+
+    const auto &textures = core.GetResource<TextureContainer>();
+    if (textures.Contains(Utils::END_RENDER_TEXTURE_ID))
+    {
+        _readback.Request(core, textures.Get(Utils::END_RENDER_TEXTURE_ID), [state = _state](Image &&image) {
+            if (image.pixels.empty())
+                return;
+            if (!state->writer->Push(std::move(image), !state->dropFramesWhenBusy))
+                ++state->droppedFrames;
+        });
+        ++_capturedFrames;
+    }
+    _readback.Update(core);
+}
+
+} // namespace Graphic::Resource
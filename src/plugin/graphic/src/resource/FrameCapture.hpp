@@ -0,0 +1,86 @@
+#pragma once
+
+#include "core/Core.hpp"
+#include "resource/TextureReadback.hpp"
+#include "utils/FrameWriter.hpp"
+#include "utils/MappedFileWriter.hpp"
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+namespace Graphic::Resource {
+
+/**
+ * @brief Copies the end render texture of every frame to disk, meant for headless (WindowSystem::None) runs.
+ *
+ * Frames are read back asynchronously (see TextureReadback, latency frames of delay) and written by background
+ * threads, either as a PNG sequence or appended as raw RGBA8 frames to a memory-mapped file. The render loop never
+ * waits for the disk: when the writers fall behind, frames are dropped unless SetDropFramesWhenBusy(false) is used.
+ */
+class FrameCapture {
+  public:
+    static inline constexpr uint32_t DEFAULT_LATENCY = 3;
+    static inline constexpr size_t DEFAULT_MAX_QUEUED_FRAMES = 8;
+
+    explicit FrameCapture(uint32_t latency = DEFAULT_LATENCY) : _readback(latency) {}
+    ~FrameCapture() = default;
+
+    FrameCapture(const FrameCapture &) = delete;
+    FrameCapture &operator=(const FrameCapture &) = delete;
+    FrameCapture(FrameCapture &&) noexcept = default;
+    FrameCapture &operator=(FrameCapture &&) noexcept = default;
+
+    /**
+     * @brief Write each frame to directory/prefix_NNNNNN.png, encoded by several threads.
+     */
+    void StartPngSequence(const std::filesystem::path &directory, std::string_view prefix = "frame");
+
+    /**
+     * @brief Append each frame, as width * height RGBA8 pixels without header, to a memory-mapped file.
+     */
+    void StartRawFile(const std::filesystem::path &path);
+
+    /**
+     * @brief Wait for the frames in flight, write them and stop the writer threads.
+     */
+    void Stop(Engine::Core &core);
+
+    [[nodiscard]] bool IsCapturing() const { return _state != nullptr; }
+
+    /**
+     * @brief Request the readback of the end render texture and hand the finished frames to the writers.
+     *
+     * Called once per frame, after the frame is submitted.
+     */
+    void Capture(Engine::Core &core);
+
+    void SetDropFramesWhenBusy(bool drop) { _dropFramesWhenBusy = drop; }
+    void SetMaxQueuedFrames(size_t maxQueuedFrames) { _maxQueuedFrames = maxQueuedFrames; }
+
+    [[nodiscard]] uint64_t GetCapturedFrameCount() const { return _capturedFrames; }
+    [[nodiscard]] uint64_t GetDroppedFrameCount() const { return _state ? _state->droppedFrames.load() : 0; }
+    [[nodiscard]] uint64_t GetWrittenFrameCount() const
+    {
+        return _state ? _state->writer->GetWrittenFrameCount() : 0;
+    }
+
+  private:
+    /** @brief Shared with the readback callbacks, which may outlive a move of the resource. */
+    struct State {
+        std::unique_ptr<Utils::MappedFileWriter> rawFile;
+        std::unique_ptr<Utils::FrameWriter> writer;
+        std::atomic<uint64_t> droppedFrames{0};
+        bool dropFramesWhenBusy = true;
+    };
+
+    void _Start(std::unique_ptr<State> state);
+
+    TextureReadback _readback;
+    std::shared_ptr<State> _state;
+    size_t _maxQueuedFrames = DEFAULT_MAX_QUEUED_FRAMES;
+    bool _dropFramesWhenBusy = true;
+    uint64_t _capturedFrames = 0;
+};
+
+} // namespace Graphic::Resource
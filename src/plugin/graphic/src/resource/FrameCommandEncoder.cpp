@@ -0,0 +1,110 @@
+#include "resource/FrameCommandEncoder.hpp"
+#include "exception/FailToCreateCommandEncoderError.hpp"
+#include "resource/DeviceContext.hpp"
+#include "resource/Queue.hpp"
+
+namespace Graphic::Resource {
+
+FrameCommandEncoder::FrameCommandEncoder(FrameCommandEncoder &&other) noexcept
+    : _label(std::move(other._label)), _encoder(other._encoder), _commandBuffers(std::move(other._commandBuffers)),
+      _passesPerSubmit(other._passesPerSubmit), _passesInBatch(other._passesInBatch), _statistics(other._statistics),
+      _lastFrameStatistics(other._lastFrameStatistics)
+{
+    other._encoder = nullptr;
+    other._commandBuffers.clear();
+}
+
+FrameCommandEncoder &FrameCommandEncoder::operator=(FrameCommandEncoder &&other) noexcept
+{
+    if (this != &other)
+    {
+        Release();
+        _label = std::move(other._label);
+        _encoder = other._encoder;
+        _commandBuffers = std::move(other._commandBuffers);
+        _passesPerSubmit = other._passesPerSubmit;
+        _passesInBatch = other._passesInBatch;
+        _statistics = other._statistics;
+        _lastFrameStatistics = other._lastFrameStatistics;
+        other._encoder = nullptr;
+        other._commandBuffers.clear();
+    }
+    return *this;
+}
+
+wgpu::CommandEncoder &FrameCommandEncoder::Get(Engine::Core &core)
+{
+    if (_encoder == nullptr)
+    {
+        const auto &device = core.GetResource<Resource::DeviceContext>().GetDevice().value();
+
+        wgpu::CommandEncoderDescriptor encoderDesc(wgpu::Default);
+        std::string encoderDescLabel = fmt::format("{}::CommandEncoder", _label);
+        encoderDesc.label = wgpu::StringView(encoderDescLabel);
+        _encoder = device.createCommandEncoder(encoderDesc);
+        if (_encoder == nullptr)
+            throw Exception::FailToCreateCommandEncoderError(
+                fmt::format("{}::Command encoder is not created, cannot record render passes.", _label));
+    }
+    return _encoder;
+}
+
+void FrameCommandEncoder::OnPassRecorded(Engine::Core &core)
+{
+    _statistics.recordedPasses++;
+    _passesInBatch++;
+    if (_passesPerSubmit != 0 && _passesInBatch >= _passesPerSubmit)
+        Submit(core);
+}
+
+void FrameCommandEncoder::Submit(Engine::Core &core)
+{
+    _passesInBatch = 0;
+    Finish();
+    if (_commandBuffers.empty())
+        return;
+
+    const auto start = std::chrono::steady_clock::now();
+    auto &queue = core.GetResource<Resource::Queue>();
+    queue->submit(_commandBuffers.size(), _commandBuffers.data());
+    for (auto &commandBuffer : _commandBuffers)
+        commandBuffer.release();
+    _commandBuffers.clear();
+    _statistics.submits++;
+    _statistics.submitTime += std::chrono::steady_clock::now() - start;
+}
+
+void FrameCommandEncoder::EndFrame(Engine::Core &core)
+{
+    Submit(core);
+    _lastFrameStatistics = _statistics;
+    _statistics = Statistics{};
+}
+
+void FrameCommandEncoder::Finish()
+{
+    if (_encoder == nullptr)
+        return;
+
+    wgpu::CommandBufferDescriptor cmdBufferDescriptor(wgpu::Default);
+    std::string cmdBufferDescriptorLabel = fmt::format("{}::CommandBuffer", _label);
+    cmdBufferDescriptor.label = wgpu::StringView(cmdBufferDescriptorLabel);
+    _commandBuffers.push_back(_encoder.finish(cmdBufferDescriptor));
+    _encoder.release();
+    _encoder = nullptr;
+    _statistics.commandBuffers++;
+}
+
+void FrameCommandEncoder::Release()
+{
+    if (_encoder != nullptr)
+    {
+        _encoder.release();
+        _encoder = nullptr;
+    }
+    for (auto &commandBuffer : _commandBuffers)
+        commandBuffer.release();
+    _commandBuffers.clear();
+}
+
+} // namespace Graphic::Resource
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "core/Core.hpp"
+#include "utils/webgpu.hpp"
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace Graphic::Resource {
+
+/**
+ * @brief Command encoder shared by every render pass of a frame.
+ *
+ * Passes record into the same encoder and the resulting command buffers are handed to the queue in a single submit
+ * (or in batches of passesPerSubmit passes when configured), instead of one encoder and one submit per pass.
+ */
+class FrameCommandEncoder {
+  public:
+    struct Statistics {
+        uint32_t recordedPasses = 0;
+        uint32_t commandBuffers = 0;
+        uint32_t submits = 0;
+        std::chrono::nanoseconds recordTime{0};
+        std::chrono::nanoseconds submitTime{0};
+    };
+
+    explicit FrameCommandEncoder(std::string_view label = "Frame") : _label(label) {}
+    ~FrameCommandEncoder() { Release(); }
+
+    FrameCommandEncoder(const FrameCommandEncoder &) = delete;
+    FrameCommandEncoder &operator=(const FrameCommandEncoder &) = delete;
+
+    FrameCommandEncoder(FrameCommandEncoder &&other) noexcept;
+    FrameCommandEncoder &operator=(FrameCommandEncoder &&other) noexcept;
+
+    /**
+     * @brief Get the encoder of the current batch, creating it if needed.
+     */
+    wgpu::CommandEncoder &Get(Engine::Core &core);
+
+    /**
+     * @brief Notify that a pass has been recorded, submitting the batch early if passesPerSubmit is reached.
+     */
+    void OnPassRecorded(Engine::Core &core);
+
+    /**
+     * @brief Finish the current encoder and submit every pending command buffer in a single call.
+     */
+    void Submit(Engine::Core &core);
+
+    /**
+     * @brief Close the frame: pending work is submitted and statistics are moved to GetLastFrameStatistics.
+     */
+    void EndFrame(Engine::Core &core);
+
+    void AddRecordTime(std::chrono::nanoseconds duration) { _statistics.recordTime += duration; }
+
+    /**
+     * @brief Set how many passes are recorded before submitting a batch, 0 to submit once per frame.
+     */
+    void SetPassesPerSubmit(uint32_t passesPerSubmit) { _passesPerSubmit = passesPerSubmit; }
+    [[nodiscard]] uint32_t GetPassesPerSubmit() const { return _passesPerSubmit; }
+
+    [[nodiscard]] bool HasPendingCommands() const { return _encoder != nullptr || !_commandBuffers.empty(); }
+    [[nodiscard]] const Statistics &GetStatistics() const { return _statistics; }
+    [[nodiscard]] const Statistics &GetLastFrameStatistics() const { return _lastFrameStatistics; }
+
+  private:
+    void Finish();
+    void Release();
+
+    std::string _label;
+    wgpu::CommandEncoder _encoder = nullptr;
+    std::vector<wgpu::CommandBuffer> _commandBuffers;
+    uint32_t _passesPerSubmit = 0;
+    uint32_t _passesInBatch = 0;
+    Statistics _statistics;
+    Statistics _lastFrameStatistics;
+};
+
+} // namespace Graphic::Resource
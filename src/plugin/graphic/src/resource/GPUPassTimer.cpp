@@ -0,0 +1,238 @@
+#include "resource/GPUPassTimer.hpp"
+#include "resource/DeviceContext.hpp"
+#include <algorithm>
+
+namespace Graphic::Resource {
+
+/** @brief Each pass writes two timestamps of 8 bytes. */
+static inline constexpr uint64_t TIMESTAMP_PAIR_SIZE = 2 * sizeof(uint64_t);
+
+GPUPassTimer::GPUPassTimer(uint32_t framesInFlight)
+{
+    _frames.reserve(std::max(framesInFlight, 1u));
+    for (uint32_t i = 0; i < std::max(framesInFlight, 1u); ++i)
+    {
+        _frames.push_back(std::make_unique<Frame>());
+    }
+}
+
+GPUPassTimer::GPUPassTimer(GPUPassTimer &&other) noexcept
+    : _frames(std::move(other._frames)), _current(other._current), _frameCounter(other._frameCounter),
+      _lastTimings(std::move(other._lastTimings)), _supported(other._supported),
+      _checkedSupport(other._checkedSupport)
+{
+    other._current = nullptr;
+}
+
+GPUPassTimer &GPUPassTimer::operator=(GPUPassTimer &&other) noexcept
+{
+    if (this != &other)
+    {
+        Release();
+        _frames = std::move(other._frames);
+        _current = other._current;
+        _frameCounter = other._frameCounter;
+        _lastTimings = std::move(other._lastTimings);
+        _supported = other._supported;
+        _checkedSupport = other._checkedSupport;
+        other._current = nullptr;
+    }
+    return *this;
+}
+
+void GPUPassTimer::BeginFrame(Engine::Core &core)
+{
+    _current = nullptr;
+    if (!_checkedSupport)
+    {
+        _supported = core.GetResource<DeviceContext>().HasFeature(wgpu::FeatureName::TimestampQuery);
+        _checkedSupport = true;
+        if (!_supported)
+            Log::Debug("GPUPassTimer: Timestamp queries are not supported by the device, passes are not timed.");
+    }
+    if (!_supported)
+        return;
+
+    CollectMappedFrames();
+    auto it = std::ranges::find_if(_frames, [](const auto &frame) { return frame->state == FrameState::Free; });
+    if (it == _frames.end())
+        return;
+
+    Frame &frame = **it;
+    if (frame.querySet == nullptr)
+        CreateFrame(core, frame);
+    frame.state = FrameState::Recording;
+    frame.passes.clear();
+    frame.written.clear();
+    frame.frameIndex = _frameCounter++;
+    _current = &frame;
+}
+
+std::optional<GPUPassTimer::Query> GPUPassTimer::BeginPass(std::string_view name)
+{
+    if (_current == nullptr || _current->passes.size() >= MAX_TIMED_PASSES)
+        return std::nullopt;
+
+    const auto index = static_cast<uint32_t>(_current->passes.size());
+    _current->passes.push_back(PassTiming{.name = std::string(name)});
+    _current->written.push_back(false);
+    return Query{.querySet = _current->querySet, .beginIndex = index * 2, .endIndex = index * 2 + 1};
+}
+
+void GPUPassTimer::EndPass(bool written)
+{
+    if (_current == nullptr || _current->written.empty())
+        return;
+    _current->written.back() = written;
+}
+
+void GPUPassTimer::Resolve(wgpu::CommandEncoder &encoder)
+{
+    if (_current == nullptr)
+        return;
+    if (_current->passes.empty())
+    {
+        _current->state = FrameState::Free;
+        _current = nullptr;
+        return;
+    }
+
+    const auto queryCount = static_cast<uint32_t>(_current->passes.size() * 2);
+    encoder.resolveQuerySet(_current->querySet, 0, queryCount, _current->resolveBuffer, 0);
+    encoder.copyBufferToBuffer(_current->resolveBuffer, 0, _current->readbackBuffer, 0,
+                               _current->passes.size() * TIMESTAMP_PAIR_SIZE);
+    _current->state = FrameState::Resolved;
+}
+
+void GPUPassTimer::EndFrame(Engine::Core &core)
+{
+    if (_current != nullptr && _current->state == FrameState::Resolved)
+    {
+        wgpu::BufferMapCallbackInfo cbInfo(wgpu::Default);
+        cbInfo.mode = wgpu::CallbackMode::AllowSpontaneous;
+        cbInfo.callback = MapCallback;
+        cbInfo.userdata1 = _current;
+        cbInfo.userdata2 = nullptr;
+        _current->mapped = false;
+        _current->mapFailed = false;
+        _current->state = FrameState::Mapping;
+        _current->readbackBuffer.mapAsync(wgpu::MapMode::Read, 0, _current->passes.size() * TIMESTAMP_PAIR_SIZE,
+                                          cbInfo);
+    }
+    else if (_current != nullptr)
+    {
+        // Resolve was never reached, e.g. the frame was not submitted.
+        _current->state = FrameState::Free;
+    }
+    _current = nullptr;
+
+    if (!_supported)
+        return;
+    core.GetResource<DeviceContext>().GetDevice()->poll(false, nullptr);
+    CollectMappedFrames();
+}
+
+std::optional<double> GPUPassTimer::GetPassMilliseconds(std::string_view name) const
+{
+    auto it = std::ranges::find_if(_lastTimings, [name](const PassTiming &timing) { return timing.name == name; });
+    if (it == _lastTimings.end())
+        return std::nullopt;
+    return it->milliseconds;
+}
+
+void GPUPassTimer::Release()
+{
+    for (auto &frame : _frames)
+    {
+        if (frame == nullptr)
+            continue;
+        if (frame->querySet != nullptr)
+        {
+            frame->querySet.release();
+            frame->querySet = nullptr;
+        }
+        if (frame->resolveBuffer != nullptr)
+        {
+            frame->resolveBuffer.release();
+            frame->resolveBuffer = nullptr;
+        }
+        if (frame->readbackBuffer != nullptr)
+        {
+            frame->readbackBuffer.release();
+            frame->readbackBuffer = nullptr;
+        }
+        frame->state = FrameState::Free;
+    }
+    _current = nullptr;
+}
+
+void GPUPassTimer::MapCallback(WGPUMapAsyncStatus status, WGPUStringView message, void *userdata1, void *)
+{
+    auto frame = static_cast<Frame *>(userdata1);
+    if (status != wgpu::MapAsyncStatus::Success)
+    {
+        Log::Warning(fmt::format("GPUPassTimer: Failed to map timestamps: {}",
+                                 std::string_view(message.data, message.length)));
+        frame->mapFailed = true;
+    }
+    frame->mapped = true;
+}
+
+void GPUPassTimer::CreateFrame(Engine::Core &core, Frame &frame) const
+{
+    const auto &device = core.GetResource<DeviceContext>().GetDevice().value();
+
+    wgpu::QuerySetDescriptor querySetDesc(wgpu::Default);
+    querySetDesc.label = wgpu::StringView("GPUPassTimer::QuerySet");
+    querySetDesc.type = wgpu::QueryType::Timestamp;
+    querySetDesc.count = MAX_TIMED_PASSES * 2;
+    frame.querySet = device.createQuerySet(querySetDesc);
+
+    wgpu::BufferDescriptor bufDesc(wgpu::Default);
+    bufDesc.size = MAX_TIMED_PASSES * TIMESTAMP_PAIR_SIZE;
+    bufDesc.usage = wgpu::BufferUsage::QueryResolve | wgpu::BufferUsage::CopySrc;
+    bufDesc.label = wgpu::StringView("GPUPassTimer::ResolveBuffer");
+    frame.resolveBuffer = device.createBuffer(bufDesc);
+
+    bufDesc.usage = wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::MapRead;
+    bufDesc.label = wgpu::StringView("GPUPassTimer::ReadbackBuffer");
+    frame.readbackBuffer = device.createBuffer(bufDesc);
+}
+
+void GPUPassTimer::CollectMappedFrames(void)
+{
+    Frame *latest = nullptr;
+    for (auto &frame : _frames)
+    {
+        if (frame->state != FrameState::Mapping || !frame->mapped)
+            continue;
+
+        if (!frame->mapFailed)
+        {
+            const auto size = frame->passes.size() * TIMESTAMP_PAIR_SIZE;
+            const auto *timestamps = static_cast<const uint64_t *>(frame->readbackBuffer.getConstMappedRange(0, size));
+            for (size_t i = 0; i < frame->passes.size(); ++i)
+            {
+                const uint64_t begin = timestamps[i * 2];
+                const uint64_t end = timestamps[i * 2 + 1];
+                // Timestamps are in nanoseconds. Some backends may reset them between submits, giving end < begin.
+                frame->passes[i].milliseconds = end > begin ? static_cast<double>(end - begin) / 1e6 : 0.0;
+            }
+            frame->readbackBuffer.unmap();
+            if (latest == nullptr || frame->frameIndex > latest->frameIndex)
+                latest = frame.get();
+        }
+        frame->state = FrameState::Free;
+    }
+    if (latest == nullptr)
+        return;
+
+    _lastTimings.clear();
+    for (size_t i = 0; i < latest->passes.size(); ++i)
+    {
+        if (latest->written[i])
+            _lastTimings.push_back(latest->passes[i]);
+    }
+}
+
+} // namespace Graphic::Resource
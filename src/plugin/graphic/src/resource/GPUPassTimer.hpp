@@ -0,0 +1,125 @@
+#pragma once
+
+#include "core/Core.hpp"
+#include "utils/webgpu.hpp"
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Graphic::Resource {
+
+/**
+ * @brief Measures the GPU time of render passes with timestamp queries.
+ *
+ * Each frame in flight owns a query set and a map-read buffer. A frame writes a timestamp at the beginning and at the
+ * end of every timed pass, resolves them after the last pass, and its buffer is mapped once submitted. Results are
+ * collected without ever waiting for the GPU, so GetLastTimings describes a frame a few frames old. When every frame
+ * is still in flight the current one is simply not timed.
+ *
+ * Timing is disabled when the device lacks wgpu::FeatureName::TimestampQuery, an optional feature of GraphicSettings:
+ * passes then get no timestamp query and GetLastTimings stays empty.
+ */
+class GPUPassTimer {
+  public:
+    struct PassTiming {
+        std::string name;
+        double milliseconds = 0.0;
+    };
+
+    /** @brief Query indices reserved for a pass in the query set of the current frame. */
+    struct Query {
+        wgpu::QuerySet querySet = nullptr;
+        uint32_t beginIndex = 0;
+        uint32_t endIndex = 0;
+    };
+
+    static inline constexpr uint32_t DEFAULT_FRAMES_IN_FLIGHT = 3;
+    static inline constexpr uint32_t MAX_TIMED_PASSES = 64;
+
+    explicit GPUPassTimer(uint32_t framesInFlight = DEFAULT_FRAMES_IN_FLIGHT);
+    ~GPUPassTimer() { Release(); }
+
+    GPUPassTimer(const GPUPassTimer &) = delete;
+    GPUPassTimer &operator=(const GPUPassTimer &) = delete;
+
+    GPUPassTimer(GPUPassTimer &&other) noexcept;
+    GPUPassTimer &operator=(GPUPassTimer &&other) noexcept;
+
+    /**
+     * @brief Start timing a frame if the device supports timestamps and a frame slot is free.
+     */
+    void BeginFrame(Engine::Core &core);
+
+    /**
+     * @brief Reserve the queries of a pass of the current frame.
+     *
+     * @return std::nullopt when the frame is not timed or MAX_TIMED_PASSES passes were already timed.
+     */
+    [[nodiscard]] std::optional<Query> BeginPass(std::string_view name);
+
+    /**
+     * @brief Tell whether the pass whose queries were reserved last actually wrote them.
+     *
+     * A pass may record no GPU pass at all (e.g. a multiple execution pass with no execution), its timing is dropped.
+     */
+    void EndPass(bool written);
+
+    /** @brief Whether the current frame timed at least one pass, whose queries must be resolved. */
+    [[nodiscard]] bool IsTimingFrame() const { return _current != nullptr && !_current->passes.empty(); }
+
+    /**
+     * @brief Record the resolution of the queries of the current frame into the encoder submitted last in the frame.
+     */
+    void Resolve(wgpu::CommandEncoder &encoder);
+
+    /**
+     * @brief Map the buffer of the frame that was just submitted and collect the frames whose buffer is mapped.
+     */
+    void EndFrame(Engine::Core &core);
+
+    [[nodiscard]] bool IsSupported() const { return _supported; }
+    /** @brief Timings of the last frame collected, in pass recording order. */
+    [[nodiscard]] const std::vector<PassTiming> &GetLastTimings() const { return _lastTimings; }
+    [[nodiscard]] std::optional<double> GetPassMilliseconds(std::string_view name) const;
+
+    void Release();
+
+  private:
+    enum class FrameState {
+        Free,
+        Recording,
+        Resolved,
+        Mapping
+    };
+
+    struct Frame {
+        FrameState state = FrameState::Free;
+        wgpu::QuerySet querySet = nullptr;
+        wgpu::Buffer resolveBuffer = nullptr;
+        wgpu::Buffer readbackBuffer = nullptr;
+        std::vector<PassTiming> passes;
+        /** @brief Whether the queries of each pass were written, timings of the others are dropped. */
+        std::vector<bool> written;
+        uint64_t frameIndex = 0;
+        /** @brief Set from the map callback. */
+        bool mapped = false;
+        bool mapFailed = false;
+    };
+
+    static void MapCallback(WGPUMapAsyncStatus status, WGPUStringView message, void *userdata1, void *userdata2);
+
+    void CreateFrame(Engine::Core &core, Frame &frame) const;
+    void CollectMappedFrames(void);
+
+    // Frames are heap allocated: they are handed to mapAsync and must not move.
+    std::vector<std::unique_ptr<Frame>> _frames;
+    Frame *_current = nullptr;
+    uint64_t _frameCounter = 0;
+    std::vector<PassTiming> _lastTimings;
+    bool _supported = false;
+    bool _checkedSupport = false;
+};
+
+} // namespace Graphic::Resource
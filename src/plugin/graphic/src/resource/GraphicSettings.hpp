@@ -61,6 +61,23 @@ class GraphicSettings {
         return it != requiredFeatures.end();
     }
 
+    const RequiredFeatureContainer &GetOptionalFeatures() const { return optionalFeatures; }
+
+    /**
+     * @brief Request a feature only if the adapter supports it, see DeviceContext::HasFeature.
+     */
+    GraphicSettings &AddOptionalFeature(wgpu::FeatureName feature)
+    {
+        optionalFeatures.push_back(feature);
+        return *this;
+    }
+
+    GraphicSettings &RemoveOptionalFeature(wgpu::FeatureName feature)
+    {
+        std::erase(optionalFeatures, static_cast<WGPUFeatureName>(feature));
+        return *this;
+    }
+
     GraphicSettings &SetOnErrorCallback(WGPUUncapturedErrorCallback callback)
     {
         onErrorCallback = callback;
@@ -90,5 +107,10 @@ class GraphicSettings {
     PowerPreference powerPreference = PowerPreference::HighPerformance;
     Limits wantedLimits = Limits(wgpu::Default);
     RequiredFeatureContainer requiredFeatures;
+    /**
+     * @brief Block-compressed textures are used when available, RGBA8 textures otherwise. Render graph passes are
+     * timed on the GPU when timestamp queries are available.
+     */
+    RequiredFeatureContainer optionalFeatures = {WGPUFeatureName_TextureCompressionBC, WGPUFeatureName_TimestampQuery};
 };
 } // namespace Graphic::Resource
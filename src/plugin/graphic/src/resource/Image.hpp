@@ -5,6 +5,7 @@
 #include "exception/UnknownFileError.hpp"
 #include "lodepng.h"
 #include "stb_image.h"
+#include <cstring>
 #include <filesystem>
 #include <functional>
 #include <glm/vec2.hpp>
@@ -55,21 +56,15 @@ struct Image {
         this->height = static_cast<uint32_t>(height_);
         this->channels = 4;
 
-        this->pixels.resize(width_ * height_);
-        for (uint32_t y = 0; y < this->height; ++y)
-        {
-            for (uint32_t x = 0; x < this->width; ++x)
-            {
-                size_t index = y * this->width + x;
-                this->pixels[index] =
-                    glm::u8vec4(data[index * 4 + 0], data[index * 4 + 1], data[index * 4 + 2], data[index * 4 + 3]);
-            }
-        }
+        // stb returns tightly packed RGBA8 texels, the same layout as glm::u8vec4.
+        static_assert(sizeof(glm::u8vec4) == 4, "glm::u8vec4 must be tightly packed.");
+        this->pixels.resize(static_cast<size_t>(width_) * height_);
+        std::memcpy(this->pixels.data(), data, this->pixels.size() * sizeof(glm::u8vec4));
 
         stbi_image_free(data);
     }
 
-    void ToPng(std::string_view filename)
+    void ToPng(std::string_view filename) const
     {
         unsigned int error =
             lodepng::encode(filename.data(), reinterpret_cast<const unsigned char *>(pixels.data()), width, height);
@@ -0,0 +1,243 @@
+#include "resource/PipelineCache.hpp"
+#include "Logger.hpp"
+#include "resource/ShaderContainer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <functional>
+
+namespace Graphic::Resource {
+
+PipelineCache &PipelineCache::operator=(PipelineCache &&other) noexcept
+{
+    if (this != &other)
+    {
+        Release();
+        _pipelines = std::move(other._pipelines);
+        _modules = std::move(other._modules);
+        _jobs = std::move(other._jobs);
+        _requests = std::move(other._requests);
+        _hits = other._hits;
+        _misses = other._misses;
+    }
+    return *this;
+}
+
+Shader PipelineCache::CreateShader(DeviceContext &deviceContext, const ShaderDescriptor &descriptor)
+{
+    const uint64_t hash = descriptor.computeHash();
+    std::string key = descriptor.computeKey();
+    if (_IsCollision(hash, key))
+    {
+        ++_misses;
+        return Shader::Create(descriptor, _CompileUncached(descriptor, deviceContext.GetDevice().value()));
+    }
+    if (auto job = _jobs.find(hash); job != _jobs.end())
+    {
+        // Already compiling on a worker: waiting for it is cheaper than compiling it twice.
+        ++_hits;
+        _FinishJob(job);
+    }
+    else if (_pipelines.contains(hash))
+    {
+        ++_hits;
+    }
+    else
+    {
+        ++_misses;
+        const std::string_view source = _GetSource(descriptor);
+        const uint64_t sourceHash = _HashSource(source);
+        _Store(hash, std::move(key), sourceHash, source,
+               _Compile(descriptor, deviceContext.GetDevice().value(), _FindModule(sourceHash, source)));
+    }
+    return Shader::Create(descriptor, _Acquire(hash));
+}
+
+void PipelineCache::CreateAsync(Engine::Core &core, std::string_view id, const ShaderDescriptor &descriptor)
+{
+    const uint64_t hash = descriptor.computeHash();
+    std::string key = descriptor.computeKey();
+    wgpu::Device device = core.GetResource<DeviceContext>().GetDevice().value();
+    if (_IsCollision(hash, key))
+    {
+        // Requests are resolved by hash, so the colliding shader is compiled and added right away.
+        ++_misses;
+        core.GetResource<ShaderContainer>().Add(std::string(id),
+                                                Shader::Create(descriptor, _CompileUncached(descriptor, device)));
+        return;
+    }
+    if (_pipelines.contains(hash) || _jobs.contains(hash))
+    {
+        ++_hits;
+    }
+    else
+    {
+        ++_misses;
+        const std::string_view source = _GetSource(descriptor);
+        const uint64_t sourceHash = _HashSource(source);
+        // The cached module is only released by Release, which waits for the jobs first.
+        wgpu::ShaderModule module = _FindModule(sourceHash, source);
+        Job job;
+        job.key = std::move(key);
+        job.sourceHash = sourceHash;
+        job.source = source;
+        job.result = std::async(std::launch::async,
+                                [descriptor, device, module]() { return _Compile(descriptor, device, module); });
+        _jobs.emplace(hash, std::move(job));
+    }
+    _requests.push_back({std::string(id), descriptor, hash});
+}
+
+void PipelineCache::Update(Engine::Core &core)
+{
+    if (_requests.empty())
+        return;
+    _CollectJobs(false);
+    _AddFinishedShaders(core);
+}
+
+void PipelineCache::WaitAll(Engine::Core &core)
+{
+    _CollectJobs(true);
+    _AddFinishedShaders(core);
+}
+
+bool PipelineCache::IsPending(std::string_view id) const
+{
+    return std::ranges::any_of(_requests, [id](const Request &request) { return request.id == id; });
+}
+
+void PipelineCache::Release()
+{
+    _CollectJobs(true);
+    _requests.clear();
+    for (auto &[hash, cached] : _pipelines)
+    {
+        cached.pipeline.release();
+    }
+    _pipelines.clear();
+    for (auto &[hash, cached] : _modules)
+    {
+        cached.module.release();
+    }
+    _modules.clear();
+}
+
+std::string_view PipelineCache::_GetSource(const ShaderDescriptor &descriptor)
+{
+    const auto &source = descriptor.getShaderSource();
+    return source.has_value() ? std::string_view(*source) : std::string_view();
+}
+
+uint64_t PipelineCache::_HashSource(std::string_view source) { return std::hash<std::string_view>{}(source); }
+
+PipelineCache::Compiled PipelineCache::_Compile(const ShaderDescriptor &descriptor, const wgpu::Device &device,
+                                                const wgpu::ShaderModule &module)
+{
+    Compiled compiled;
+    if (module == nullptr)
+        compiled.module = Shader::CreateShaderModule(descriptor, device);
+    compiled.pipeline = Shader::CreatePipeline(descriptor, device, module != nullptr ? module : compiled.module);
+    return compiled;
+}
+
+bool PipelineCache::_IsCollision(uint64_t hash, std::string_view key) const
+{
+    if (auto job = _jobs.find(hash); job != _jobs.end())
+        return job->second.key != key;
+    if (auto cached = _pipelines.find(hash); cached != _pipelines.end())
+        return cached->second.key != key;
+    return false;
+}
+
+wgpu::RenderPipeline PipelineCache::_CompileUncached(const ShaderDescriptor &descriptor, const wgpu::Device &device)
+{
+    Log::Warning(fmt::format("PipelineCache: Shader '{}' collides with a cached pipeline, it is not cached.",
+                             descriptor.getName()));
+    const std::string_view source = _GetSource(descriptor);
+    Compiled compiled = _Compile(descriptor, device, _FindModule(_HashSource(source), source));
+    // The pipeline keeps its own reference to the module.
+    if (compiled.module != nullptr)
+        compiled.module.release();
+    return compiled.pipeline;
+}
+
+wgpu::ShaderModule PipelineCache::_FindModule(uint64_t sourceHash, std::string_view source) const
+{
+    auto it = _modules.find(sourceHash);
+    return it != _modules.end() && it->second.source == source ? it->second.module : wgpu::ShaderModule(nullptr);
+}
+
+void PipelineCache::_Store(uint64_t hash, std::string key, uint64_t sourceHash, std::string_view source,
+                           Compiled compiled)
+{
+    if (compiled.module != nullptr)
+    {
+        // Two jobs started before either finished may have compiled the same source, or another source may have the
+        // same hash: the module is then only referenced by the pipeline.
+        if (_modules.contains(sourceHash))
+            compiled.module.release();
+        else
+            _modules.emplace(sourceHash, CachedModule{std::string(source), compiled.module});
+    }
+    if (compiled.pipeline != nullptr)
+        _pipelines.emplace(hash, CachedPipeline{std::move(key), compiled.pipeline});
+}
+
+void PipelineCache::_FinishJob(std::unordered_map<uint64_t, Job>::iterator job)
+{
+    const uint64_t hash = job->first;
+    std::string key = std::move(job->second.key);
+    const uint64_t sourceHash = job->second.sourceHash;
+    const std::string source = std::move(job->second.source);
+    Compiled compiled;
+    try
+    {
+        compiled = job->second.result.get();
+    }
+    catch (const std::exception &e)
+    {
+        Log::Error(fmt::format("PipelineCache: Failed to compile pipeline {:#x}: {}", hash, e.what()));
+    }
+    _jobs.erase(job);
+    _Store(hash, std::move(key), sourceHash, source, compiled);
+}
+
+void PipelineCache::_CollectJobs(bool wait)
+{
+    for (auto it = _jobs.begin(); it != _jobs.end();)
+    {
+        auto next = std::next(it);
+        if (wait || it->second.result.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+            _FinishJob(it);
+        it = next;
+    }
+}
+
+void PipelineCache::_AddFinishedShaders(Engine::Core &core)
+{
+    auto &shaderContainer = core.GetResource<ShaderContainer>();
+    for (auto it = _requests.begin(); it != _requests.end();)
+    {
+        if (_jobs.contains(it->hash))
+        {
+            ++it;
+            continue;
+        }
+        if (_pipelines.contains(it->hash))
+            shaderContainer.Add(it->id, Shader::Create(it->descriptor, _Acquire(it->hash)));
+        else
+            Log::Error(fmt::format("PipelineCache: Failed to create shader '{}'.", it->id));
+        it = _requests.erase(it);
+    }
+}
+
+wgpu::RenderPipeline PipelineCache::_Acquire(uint64_t hash)
+{
+    auto it = _pipelines.find(hash);
+    if (it == _pipelines.end())
+        return nullptr;
+    it->second.pipeline.addRef();
+    return it->second.pipeline;
+}
+
+} // namespace Graphic::Resource
@@ -0,0 +1,134 @@
+#pragma once
+
+#include "core/Core.hpp"
+#include "resource/DeviceContext.hpp"
+#include "resource/Shader.hpp"
+#include "resource/ShaderDescriptor.hpp"
+#include "utils/webgpu.hpp"
+#include <future>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Graphic::Resource {
+
+/**
+ * @brief De-duplicates render pipelines by the hash of their ShaderDescriptor and compiles them off the main thread.
+ *
+ * Shaders created through the cache share one pipeline per descriptor hash (see ShaderDescriptor::computeHash) and
+ * one shader module per WGSL source, so adding the same shader twice, or under another name, compiles nothing. The
+ * key of the descriptor and the source are kept next to the cached pipeline and module, and compared on a hash hit:
+ * a descriptor colliding with a cached one gets its own pipeline, which is not cached.
+ *
+ * CreateAsync compiles the module and the pipeline on a worker thread. Update, run once per frame during the
+ * PipelineCreation stage, adds the finished shaders to the ShaderContainer without blocking; WaitAll blocks until
+ * every requested shader is added, which lets several pipelines of a same startup compile in parallel.
+ *
+ * @note The pipelines are only kept in memory: the WebGPU implementation has no pipeline cache API, so warm starts
+ * rely on the shader caches of the drivers.
+ */
+class PipelineCache {
+  public:
+    PipelineCache() = default;
+    ~PipelineCache() { Release(); }
+
+    PipelineCache(const PipelineCache &) = delete;
+    PipelineCache &operator=(const PipelineCache &) = delete;
+
+    PipelineCache(PipelineCache &&) noexcept = default;
+    PipelineCache &operator=(PipelineCache &&other) noexcept;
+
+    /**
+     * @brief Get the shader of the descriptor, compiling its pipeline only if no identical descriptor was seen yet.
+     */
+    [[nodiscard]] Shader CreateShader(DeviceContext &deviceContext, const ShaderDescriptor &descriptor);
+
+    /**
+     * @brief Start compiling the shader on a worker thread. It is added to the ShaderContainer under the given id by
+     * the Update or WaitAll call that follows its completion.
+     */
+    void CreateAsync(Engine::Core &core, std::string_view id, const ShaderDescriptor &descriptor);
+
+    /**
+     * @brief Add the shaders whose pipeline is compiled to the ShaderContainer, without waiting for the others.
+     */
+    void Update(Engine::Core &core);
+
+    /**
+     * @brief Block until every shader requested by CreateAsync is added to the ShaderContainer.
+     */
+    void WaitAll(Engine::Core &core);
+
+    [[nodiscard]] bool IsPending(std::string_view id) const;
+    [[nodiscard]] size_t GetPendingCount() const { return _requests.size(); }
+    [[nodiscard]] size_t GetPipelineCount() const { return _pipelines.size(); }
+    [[nodiscard]] size_t GetShaderModuleCount() const { return _modules.size(); }
+    [[nodiscard]] uint64_t GetHitCount() const { return _hits; }
+    [[nodiscard]] uint64_t GetMissCount() const { return _misses; }
+
+    /**
+     * @brief Wait for the running compilations, then release every cached pipeline and shader module.
+     *
+     * Shaders created from the cache hold their own reference and stay valid.
+     */
+    void Release();
+
+  private:
+    struct Compiled {
+        /** @brief Module compiled by the job, null when it reused a cached one. */
+        wgpu::ShaderModule module = nullptr;
+        wgpu::RenderPipeline pipeline = nullptr;
+    };
+
+    struct Job {
+        std::future<Compiled> result;
+        /** @brief See ShaderDescriptor::computeKey. */
+        std::string key;
+        uint64_t sourceHash = 0;
+        std::string source;
+    };
+
+    struct CachedPipeline {
+        std::string key;
+        wgpu::RenderPipeline pipeline = nullptr;
+    };
+
+    struct CachedModule {
+        std::string source;
+        wgpu::ShaderModule module = nullptr;
+    };
+
+    struct Request {
+        std::string id;
+        ShaderDescriptor descriptor;
+        uint64_t hash = 0;
+    };
+
+    static std::string_view _GetSource(const ShaderDescriptor &descriptor);
+    static uint64_t _HashSource(std::string_view source);
+    static Compiled _Compile(const ShaderDescriptor &descriptor, const wgpu::Device &device,
+                             const wgpu::ShaderModule &module);
+
+    /** @brief Whether a pipeline with this hash is cached or compiling for a descriptor with another key. */
+    [[nodiscard]] bool _IsCollision(uint64_t hash, std::string_view key) const;
+    /** @brief Compile a pipeline that is not cached, for a descriptor colliding with a cached one. */
+    wgpu::RenderPipeline _CompileUncached(const ShaderDescriptor &descriptor, const wgpu::Device &device);
+    /** @brief Get the cached module compiled from this source, null if there is none. */
+    wgpu::ShaderModule _FindModule(uint64_t sourceHash, std::string_view source) const;
+    void _Store(uint64_t hash, std::string key, uint64_t sourceHash, std::string_view source, Compiled compiled);
+    void _FinishJob(std::unordered_map<uint64_t, Job>::iterator job);
+    void _CollectJobs(bool wait);
+    void _AddFinishedShaders(Engine::Core &core);
+    /** @brief Get a new reference to the cached pipeline, null if its compilation failed. */
+    wgpu::RenderPipeline _Acquire(uint64_t hash);
+
+    std::unordered_map<uint64_t, CachedPipeline> _pipelines;
+    std::unordered_map<uint64_t, CachedModule> _modules;
+    std::unordered_map<uint64_t, Job> _jobs;
+    std::vector<Request> _requests;
+    uint64_t _hits = 0;
+    uint64_t _misses = 0;
+};
+
+} // namespace Graphic::Resource
@@ -1,5 +1,8 @@
 #include "resource/RenderGraph.hpp"
 #include "exception/RenderPassSortError.hpp"
+#include "resource/TextureContainer.hpp"
+#include <algorithm>
+#include <chrono>
 #include <map>
 #include <queue>
 
@@ -15,6 +18,7 @@ void RenderGraph::Remove(std::string_view name)
     Log::Debug(fmt::format("RenderGraph: Removed render pass '{}'.", name));
     _renderPasses.erase(id);
     _orderedIDs.remove(id);
+    std::erase(_insertionOrder, id);
     _dependencies.erase(id);
     for (auto &dep : _dependencies)
     {
@@ -24,19 +28,49 @@ void RenderGraph::Remove(std::string_view name)
 }
 void RenderGraph::Execute(Engine::Core &core)
 {
-    Update();
+    Record(core);
+    Submit(core);
+}
+void RenderGraph::Record(Engine::Core &core)
+{
+    Compile(core);
+    _gpuTimer.BeginFrame(core);
+    const auto start = std::chrono::steady_clock::now();
+    const auto submitTimeBefore = _frameEncoder.GetStatistics().submitTime;
     for (const auto &id : _orderedIDs)
     {
-        if (auto it = _renderPasses.find(id); it != _renderPasses.end())
+        auto it = _renderPasses.find(id);
+        if (it == _renderPasses.end())
+        {
+            throw Exception::RenderPassSortError(
+                fmt::format("RenderGraph: Render pass with ID '{}' not found during execution.", id.value()));
+        }
+
+        auto &renderPass = it->second;
+        renderPass->SetTimestampQuery(_gpuTimer.BeginPass(renderPass->GetName()));
+        if (renderPass->SupportsRecording())
         {
-            it->second->Execute(core);
+            renderPass->Record(_frameEncoder.Get(core), core);
+            _frameEncoder.OnPassRecorded(core);
         }
         else
         {
-            throw Exception::RenderPassSortError(
-                fmt::format("RenderGraph: Render pass with ID '{}' not found during execution.", id.value()));
+            // The pass submits on its own: everything recorded before it must reach the queue first.
+            _frameEncoder.Submit(core);
+            renderPass->Execute(core);
         }
+        _gpuTimer.EndPass(renderPass->HasWrittenTimestamps());
+        renderPass->SetTimestampQuery(std::nullopt);
     }
+    const auto submitTimeDuringRecord = _frameEncoder.GetStatistics().submitTime - submitTimeBefore;
+    _frameEncoder.AddRecordTime(std::chrono::steady_clock::now() - start - submitTimeDuringRecord);
+}
+void RenderGraph::Submit(Engine::Core &core)
+{
+    if (_gpuTimer.IsTimingFrame())
+        _gpuTimer.Resolve(_frameEncoder.Get(core));
+    _frameEncoder.EndFrame(core);
+    _gpuTimer.EndFrame(core);
 }
 bool RenderGraph::Contains(std::string_view name) const { return this->_renderPasses.contains(GetID(name)); }
 void RenderGraph::SetDependency(std::string_view nameBefore, std::string_view nameAfter)
@@ -67,12 +101,94 @@ void RenderGraph::SetDependency(std::string_view nameBefore, std::string_view na
     _dependencies[idAfter].insert(idBefore);
 }
 
-void RenderGraph::Update(void)
+void RenderGraph::AddOutput(std::string_view textureName)
+{
+    _outputs.insert(GetID(textureName));
+    _dirty = true;
+}
+void RenderGraph::AddTransientTexture(std::string_view textureName, const TransientTextureDescriptor &descriptor)
 {
-    if (!_dirty)
+    ID id = GetID(textureName);
+    if (_transientTextures.contains(id))
+    {
+        Log::Warning(
+            fmt::format("RenderGraph: Transient texture '{}' already exists. Skipping addition.", textureName));
         return;
-    TopologicalSort();
-    _dirty = false;
+    }
+    _transientTextures[id] = TransientTexture{.name = std::string(textureName), .descriptor = descriptor};
+    _transientOrder.push_back(id);
+    _dirty = true;
+}
+void RenderGraph::ResizeTransientTextures(Engine::Core &core, const glm::uvec2 &size)
+{
+    if (size == _transientSize)
+        return;
+    _transientSize = size;
+    _transientTexturesDirty = true;
+    Compile(core);
+}
+void RenderGraph::Compile(Engine::Core &core)
+{
+    if (_dirty)
+    {
+        ResolveDependencies();
+        TopologicalSort();
+        CullPasses();
+        ComputeTransientLifetimes();
+        AssignTransientSlots();
+        _transientTexturesDirty = true;
+        _dirty = false;
+    }
+    if (_transientTexturesDirty)
+    {
+        CreateTransientTextures(core);
+        _transientTexturesDirty = false;
+    }
+}
+bool RenderGraph::IsCulled(std::string_view name) const { return _culledIDs.contains(GetID(name)); }
+std::optional<size_t> RenderGraph::GetTransientTextureSlot(std::string_view textureName) const
+{
+    auto it = _transientTextures.find(GetID(textureName));
+    if (it == _transientTextures.end())
+        return std::nullopt;
+    return it->second.slot;
+}
+
+void RenderGraph::ResolveDependencies(void)
+{
+    _resolvedDependencies = _dependencies;
+
+    std::unordered_map<ID, std::vector<ID>, IDHash> writers;
+    for (const auto &id : _insertionOrder)
+    {
+        for (const auto &texture : _renderPasses.at(id)->GetWrittenTextures())
+        {
+            auto &textureWriters = writers[texture];
+            // Passes writing the same texture keep the order they were added in.
+            if (!textureWriters.empty() && textureWriters.back() != id)
+            {
+                _resolvedDependencies[id].insert(textureWriters.back());
+            }
+            textureWriters.push_back(id);
+        }
+    }
+
+    for (const auto &id : _insertionOrder)
+    {
+        for (const auto &texture : _renderPasses.at(id)->GetTextureReads())
+        {
+            auto it = writers.find(texture);
+            if (it == writers.end())
+                continue;
+            for (const auto &writer : it->second)
+            {
+                if (writer != id)
+                {
+                    _resolvedDependencies[id].insert(writer);
+                }
+            }
+        }
+    }
 }
 void RenderGraph::TopologicalSort(void)
 {
@@ -84,7 +200,7 @@ void RenderGraph::TopologicalSort(void)
         inDegree[id] = 0;
     }
 
-    for (const auto &[after, befores] : _dependencies)
+    for (const auto &[after, befores] : _resolvedDependencies)
     {
         if (_renderPasses.find(after) != _renderPasses.end())
         {
@@ -98,9 +214,9 @@ void RenderGraph::TopologicalSort(void)
     }
 
     std::queue<ID> queue;
-    for (const auto &[id, degree] : inDegree)
+    for (const auto &id : _insertionOrder)
     {
-        if (degree == 0)
+        if (inDegree[id] == 0)
         {
             queue.push(id);
         }
@@ -127,9 +243,11 @@ void RenderGraph::TopologicalSort(void)
 void RenderGraph::ProcessDependencies(ID current, std::queue<ID> &queue,
                                       std::unordered_map<ID, size_t, IDHash> &inDegree) const
 {
-    for (const auto &[after, befores] : _dependencies)
+    // Insertion order keeps the result deterministic when several passes become ready at once.
+    for (const auto &after : _insertionOrder)
     {
-        if (befores.contains(current))
+        auto it = _resolvedDependencies.find(after);
+        if (it != _resolvedDependencies.end() && it->second.contains(current))
         {
             --inDegree[after];
             if (inDegree[after] == 0)
@@ -139,4 +257,163 @@ void RenderGraph::ProcessDependencies(ID current, std::queue<ID> &queue,
         }
     }
 }
+void RenderGraph::CullPasses(void)
+{
+    _culledIDs.clear();
+    if (_outputs.empty())
+        return;
+
+    std::unordered_set<ID, IDHash> kept;
+    std::vector<ID> toVisit;
+    for (const auto &id : _orderedIDs)
+    {
+        const auto written = _renderPasses.at(id)->GetWrittenTextures();
+        if (std::ranges::any_of(written, [this](const ID &texture) { return _outputs.contains(texture); }))
+        {
+            kept.insert(id);
+            toVisit.push_back(id);
+        }
+    }
+    while (!toVisit.empty())
+    {
+        ID current = toVisit.back();
+        toVisit.pop_back();
+        auto it = _resolvedDependencies.find(current);
+        if (it == _resolvedDependencies.end())
+            continue;
+        for (const auto &before : it->second)
+        {
+            if (_renderPasses.contains(before) && kept.insert(before).second)
+            {
+                toVisit.push_back(before);
+            }
+        }
+    }
+
+    for (auto it = _orderedIDs.begin(); it != _orderedIDs.end();)
+    {
+        if (kept.contains(*it))
+        {
+            ++it;
+            continue;
+        }
+        const auto &name = _renderPasses.at(*it)->GetName();
+        Log::Debug(fmt::format("RenderGraph: Culled render pass '{}', none of its outputs are used.", name));
+        _culledIDs.insert(*it);
+        it = _orderedIDs.erase(it);
+    }
+}
+void RenderGraph::ComputeTransientLifetimes(void)
+{
+    for (auto &[id, transient] : _transientTextures)
+    {
+        transient.used = false;
+    }
+
+    size_t passIndex = 0;
+    for (const auto &id : _orderedIDs)
+    {
+        const auto &renderPass = _renderPasses.at(id);
+        auto markUse = [this, passIndex](const ID &texture) {
+            auto it = _transientTextures.find(texture);
+            if (it == _transientTextures.end())
+                return;
+            auto &transient = it->second;
+            if (!transient.used)
+            {
+                transient.firstUse = passIndex;
+                transient.used = true;
+            }
+            transient.lastUse = passIndex;
+        };
+        for (const auto &texture : renderPass->GetWrittenTextures())
+            markUse(texture);
+        for (const auto &texture : renderPass->GetTextureReads())
+            markUse(texture);
+        ++passIndex;
+    }
+}
+void RenderGraph::AssignTransientSlots(void)
+{
+    struct Slot {
+        TransientTextureDescriptor descriptor;
+        std::optional<size_t> lastUse;
+    };
+    std::vector<Slot> slots;
+
+    std::vector<ID> byFirstUse = _transientOrder;
+    std::ranges::stable_sort(byFirstUse, [this](const ID &lhs, const ID &rhs) {
+        const auto &a = _transientTextures.at(lhs);
+        const auto &b = _transientTextures.at(rhs);
+        // Unused transients come last: they can share any compatible texture.
+        if (a.used != b.used)
+            return a.used;
+        return a.firstUse < b.firstUse;
+    });
+
+    for (const auto &id : byFirstUse)
+    {
+        auto &transient = _transientTextures.at(id);
+        auto compatible = [&transient](const Slot &slot) {
+            return slot.descriptor.format == transient.descriptor.format &&
+                   slot.descriptor.usage == transient.descriptor.usage;
+        };
+        auto it = std::ranges::find_if(slots, [&](const Slot &slot) {
+            if (!compatible(slot))
+                return false;
+            return !transient.used || !slot.lastUse.has_value() || slot.lastUse.value() < transient.firstUse;
+        });
+        if (it == slots.end())
+        {
+            slots.push_back(Slot{.descriptor = transient.descriptor, .lastUse = std::nullopt});
+            it = std::prev(slots.end());
+        }
+        if (transient.used)
+        {
+            it->lastUse = transient.lastUse;
+        }
+        transient.slot = static_cast<size_t>(std::distance(slots.begin(), it));
+    }
+    _transientSlotCount = slots.size();
+}
+void RenderGraph::CreateTransientTextures(Engine::Core &core)
+{
+    if (_transientTextures.empty())
+        return;
+    if (_transientSize.x == 0 || _transientSize.y == 0)
+    {
+        Log::Warning("RenderGraph: Transient textures have no size yet, call ResizeTransientTextures first.");
+        return;
+    }
+
+    const auto &deviceContext = core.GetResource<DeviceContext>();
+    auto &textures = core.GetResource<TextureContainer>();
+
+    std::vector<wgpu::Texture> slotTextures(_transientSlotCount, nullptr);
+    for (const auto &id : _transientOrder)
+    {
+        const auto &transient = _transientTextures.at(id);
+        auto &slotTexture = slotTextures[transient.slot];
+        if (slotTexture == nullptr)
+        {
+            wgpu::TextureDescriptor descriptor(wgpu::Default);
+            std::string label = fmt::format("RenderGraph::Transient{}", transient.slot);
+            descriptor.label = wgpu::StringView(label);
+            descriptor.size = {_transientSize.x, _transientSize.y, 1};
+            descriptor.format = transient.descriptor.format;
+            descriptor.usage = transient.descriptor.usage;
+            slotTexture = deviceContext.GetDevice()->createTexture(descriptor);
+        }
+        else
+        {
+            // Each aliasing Texture releases its own reference.
+            slotTexture.addRef();
+        }
+        ID textureId{transient.name.data(), transient.name.size()};
+        textures.Remove(textureId);
+        textures.Add(textureId, Texture(transient.name, slotTexture));
+    }
+    Log::Debug(fmt::format("RenderGraph: Created {} texture(s) for {} transient texture(s).", _transientSlotCount,
+                           _transientTextures.size()));
+}
 } // namespace Graphic::Resource
@@ -1,8 +1,12 @@
 #pragma once
 
 #include "resource/ARenderPass.hpp"
+#include "resource/FrameCommandEncoder.hpp"
+#include "resource/GPUPassTimer.hpp"
+#include <glm/vec2.hpp>
 #include <list>
 #include <memory>
+#include <optional>
 #include <queue>
 #include <string>
 #include <unordered_map>
@@ -13,6 +17,31 @@ concept CRenderPass = std::is_base_of_v<Graphic::Resource::ARenderPass, TRenderP
 
 namespace Graphic::Resource {
 
+/**
+ * @brief Description of a texture owned by the render graph, only alive between its first and last use in a frame.
+ *
+ * Every transient texture has the size given to RenderGraph::ResizeTransientTextures.
+ */
+struct TransientTextureDescriptor {
+    wgpu::TextureFormat format = wgpu::TextureFormat::RGBA8Unorm;
+    wgpu::TextureUsage usage = wgpu::TextureUsage::RenderAttachment | wgpu::TextureUsage::TextureBinding;
+};
+
+/**
+ * @brief Ordered set of render passes.
+ *
+ * Passes are ordered by explicit dependencies (SetDependency) and by the textures they declare: a pass reading a
+ * texture (ARenderPass::AddTextureRead) runs after every pass writing it, and passes writing the same texture run in
+ * the order they were added.
+ *
+ * When graph outputs are declared (AddOutput), passes that do not contribute to any of them are culled.
+ *
+ * Transient textures (AddTransientTexture) are created by the graph. Transients with the same format and usage whose
+ * lifetimes (from the first to the last pass using them) do not overlap share the same GPU texture.
+ *
+ * When the device supports timestamp queries, the GPU time of every pass is measured (see GPUPassTimer) and exposed
+ * next to the CPU frame statistics by GetLastGPUTimings.
+ */
 class RenderGraph {
   private:
     using ID = entt::hashed_string;
@@ -42,25 +71,124 @@ class RenderGraph {
         }
         Log::Debug(fmt::format("RenderGraph: Added render pass '{}'.", name));
         _renderPasses[id] = std::make_shared<TRenderPass>(std::forward<TRenderPass>(renderPass));
+        _insertionOrder.push_back(id);
         _orderedIDs.push_back(id);
+        _dirty = true;
     }
 
     void Remove(std::string_view name);
+
+    /**
+     * @brief Record every pass then submit the frame, equivalent to Record followed by Submit.
+     */
     void Execute(Engine::Core &core);
+
+    /**
+     * @brief Record every pass, in dependency order, into the frame command encoder.
+     *
+     * Nothing is submitted unless passes per submit is configured (see SetPassesPerSubmit) or a pass does not
+     * support recording (see ARenderPass::SupportsRecording).
+     */
+    void Record(Engine::Core &core);
+
+    /**
+     * @brief Submit what Record produced and close the frame statistics.
+     */
+    void Submit(Engine::Core &core);
+
     bool Contains(std::string_view name) const;
     void SetDependency(std::string_view nameBefore, std::string_view nameAfter);
 
+    /**
+     * @brief Declare a texture the graph produces for the rest of the frame (e.g. the texture presented).
+     */
+    void AddOutput(std::string_view textureName);
+
+    /**
+     * @brief Declare a texture created and owned by the graph, registered in the TextureContainer under its name.
+     */
+    void AddTransientTexture(std::string_view textureName, const TransientTextureDescriptor &descriptor);
+
+    /**
+     * @brief Set the size of every transient texture, recreating them right away if the graph is already compiled.
+     */
+    void ResizeTransientTextures(Engine::Core &core, const glm::uvec2 &size);
+
+    /**
+     * @brief Resolve pass order, cull unused passes and create transient textures, if anything changed.
+     *
+     * Called by Record, it only needs to be called directly when transient textures must exist before the first
+     * frame (e.g. to create bind groups using them).
+     */
+    void Compile(Engine::Core &core);
+
+    /**
+     * @brief Whether the pass was culled by the last compilation.
+     */
+    [[nodiscard]] bool IsCulled(std::string_view name) const;
+
+    /**
+     * @brief Index of the GPU texture backing the given transient texture, shared with the transients it aliases.
+     */
+    [[nodiscard]] std::optional<size_t> GetTransientTextureSlot(std::string_view textureName) const;
+
+    /**
+     * @brief Number of GPU textures created for the transient textures.
+     */
+    [[nodiscard]] size_t GetTransientTextureSlotCount(void) const { return _transientSlotCount; }
+
+    void SetPassesPerSubmit(uint32_t passesPerSubmit) { _frameEncoder.SetPassesPerSubmit(passesPerSubmit); }
+    const FrameCommandEncoder::Statistics &GetLastFrameStatistics() const
+    {
+        return _frameEncoder.GetLastFrameStatistics();
+    }
+
+    /**
+     * @brief GPU time of each pass of a recent frame, empty if the device does not support timestamp queries.
+     */
+    const std::vector<GPUPassTimer::PassTiming> &GetLastGPUTimings() const { return _gpuTimer.GetLastTimings(); }
+    std::optional<double> GetPassGPUMilliseconds(std::string_view name) const
+    {
+        return _gpuTimer.GetPassMilliseconds(name);
+    }
+    [[nodiscard]] bool IsGPUTimingSupported() const { return _gpuTimer.IsSupported(); }
+
   private:
     static ID GetID(std::string_view name) { return entt::hashed_string(name.data(), name.size()); }
 
-    void Update(void);
+    struct TransientTexture {
+        std::string name;
+        TransientTextureDescriptor descriptor;
+        size_t firstUse = 0;
+        size_t lastUse = 0;
+        bool used = false;
+        size_t slot = 0;
+    };
+
+    void ResolveDependencies(void);
     void TopologicalSort(void);
     void ProcessDependencies(ID current, std::queue<ID> &queue, std::unordered_map<ID, size_t, IDHash> &inDegree) const;
+    void CullPasses(void);
+    void ComputeTransientLifetimes(void);
+    void AssignTransientSlots(void);
+    void CreateTransientTextures(Engine::Core &core);
 
     bool _dirty = false;
+    bool _transientTexturesDirty = false;
     std::unordered_map<ID, std::shared_ptr<ARenderPass>, IDHash> _renderPasses;
     std::unordered_map<ID, std::unordered_set<ID, IDHash>, IDHash> _dependencies;
+    /** @brief Explicit dependencies merged with the ones inferred from declared texture reads and writes. */
+    std::unordered_map<ID, std::unordered_set<ID, IDHash>, IDHash> _resolvedDependencies;
+    std::vector<ID> _insertionOrder;
     std::list<ID> _orderedIDs;
+    std::unordered_set<ID, IDHash> _culledIDs;
+    std::unordered_set<ID, IDHash> _outputs;
+    std::unordered_map<ID, TransientTexture, IDHash> _transientTextures;
+    std::vector<ID> _transientOrder;
+    glm::uvec2 _transientSize{0};
+    size_t _transientSlotCount = 0;
+    FrameCommandEncoder _frameEncoder{"RenderGraph"};
+    GPUPassTimer _gpuTimer;
 };
 
 } // namespace Graphic::Resource
@@ -45,12 +45,37 @@ class Shader {
     static Shader Create(const ShaderDescriptor &descriptor, DeviceContext &deviceContext)
     {
         wgpu::Device device = deviceContext.GetDevice().value();
+        wgpu::ShaderModule shaderModule = CreateShaderModule(descriptor, device);
+        wgpu::RenderPipeline pipeline = CreatePipeline(descriptor, device, shaderModule);
+        shaderModule.release();
+        return Create(descriptor, pipeline);
+    }
+
+    /**
+     * @brief Wrap an already created pipeline, the shader takes ownership of one reference.
+     */
+    static Shader Create(const ShaderDescriptor &descriptor, wgpu::RenderPipeline pipeline)
+    {
         Shader shader;
         shader.descriptor = descriptor;
+        shader.pipeline = pipeline;
+        return shader;
+    }
 
-        const std::string &name = descriptor.getName();
+    static wgpu::ShaderModule CreateShaderModule(const ShaderDescriptor &descriptor, const wgpu::Device &device)
+    {
+        return _createShaderModule(descriptor.getName(), descriptor.getShaderSource().value(), device);
+    }
 
-        wgpu::ShaderModule shaderModule = _createShaderModule(name, descriptor.getShaderSource().value(), device);
+    /**
+     * @brief Create the render pipeline of the descriptor from its compiled shader module.
+     *
+     * @note Only reads the descriptor and the device, so it can run on a worker thread.
+     */
+    static wgpu::RenderPipeline CreatePipeline(const ShaderDescriptor &descriptor, const wgpu::Device &device,
+                                               const wgpu::ShaderModule &shaderModule)
+    {
+        const std::string &name = descriptor.getName();
 
         wgpu::RenderPipelineDescriptor pipelineDescriptor(wgpu::Default);
         const std::string pipelineLabel = fmt::format("{} Render Pipeline", name);
@@ -110,16 +135,15 @@ class Shader {
         pipelineDescriptor.primitive.cullMode = descriptor.getCullMode();
         pipelineDescriptor.primitive.frontFace = wgpu::FrontFace::CW;
 
-        shader.pipeline = device.createRenderPipeline(pipelineDescriptor);
+        wgpu::RenderPipeline pipeline = device.createRenderPipeline(pipelineDescriptor);
 
-        shaderModule.release();
         wgpu::PipelineLayout(pipelineDescriptor.layout).release();
         for (auto layout : bindGroupLayouts)
         {
             wgpu::BindGroupLayout(layout).release();
         }
 
-        return shader;
+        return pipeline;
     }
 
     inline const ShaderDescriptor &GetDescriptor() const { return descriptor; }
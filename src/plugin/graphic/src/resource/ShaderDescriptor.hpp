@@ -12,10 +12,15 @@
 #include "utils/shader/DepthStencilState.hpp"
 #include "utils/shader/VertexBufferLayout.hpp"
 
+#include <bit>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <list>
 #include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
 
 namespace Graphic::Resource {
 class ShaderDescriptor : public Utils::IValidable {
@@ -192,6 +197,48 @@ class ShaderDescriptor : public Utils::IValidable {
         return errors;
     }
 
+    /**
+     * @brief Hash everything the render pipeline is built from: source, entry points, vertex and bind group layouts,
+     * color targets, depth-stencil state and primitive state.
+     *
+     * Names are not hashed, so two descriptors that only differ by their names produce the same pipeline.
+     */
+    uint64_t computeHash(void) const
+    {
+        uint64_t hash = 0;
+        auto combine = [&hash](uint64_t part) { hash ^= part + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2); };
+        this->_visitPipelineState([&combine](auto value) {
+            if constexpr (std::is_same_v<decltype(value), std::string_view>)
+                combine(std::hash<std::string_view>{}(value));
+            else
+                combine(value);
+        });
+        return hash;
+    }
+
+    /**
+     * @brief Serialize the state hashed by computeHash, so that two descriptors with the same hash can be told apart.
+     *
+     * Two descriptors produce the same pipeline if and only if their keys are equal.
+     */
+    std::string computeKey(void) const
+    {
+        std::string key;
+        auto append = [&key](uint64_t value) { key.append(reinterpret_cast<const char *>(&value), sizeof(value)); };
+        this->_visitPipelineState([&key, &append](auto value) {
+            if constexpr (std::is_same_v<decltype(value), std::string_view>)
+            {
+                append(value.size());
+                key.append(value);
+            }
+            else
+            {
+                append(value);
+            }
+        });
+        return key;
+    }
+
     const std::string &getName() const { return this->_name.has_value() ? this->_name.value() : _DEFAULT_NAME; }
     const std::list<Utils::BindGroupLayout> &getBindGroupLayouts() const { return this->_bindGroupLayouts; }
     const std::list<Utils::VertexBufferLayout> &getVertexBufferLayouts() const { return this->_vertexBufferLayouts; }
@@ -211,6 +258,85 @@ class ShaderDescriptor : public Utils::IValidable {
     wgpu::CullMode getCullMode() const { return this->_cullMode; }
 
   private:
+    /**
+     * @brief Call the visitor with every field the render pipeline is built from, as uint64_t or std::string_view.
+     */
+    template <typename Visitor> void _visitPipelineState(Visitor &&visit) const
+    {
+        auto integer = [&visit](uint64_t value) { visit(value); };
+        auto floating = [&integer](float value) { integer(std::bit_cast<uint32_t>(value)); };
+        auto string = [&visit](std::string_view value) { visit(value); };
+
+        string(this->_shaderSource.value_or(""));
+        string(this->getVertexEntryPoint());
+        string(this->getFragmentEntryPoint());
+        for (const auto &layout : this->_vertexBufferLayouts)
+        {
+            integer(layout.getArrayStride());
+            integer(static_cast<WGPUVertexStepMode>(layout.getStepMode()));
+            integer(layout.getVertexAttributes().size());
+            for (const WGPUVertexAttribute &attribute : layout.getVertexAttributes())
+            {
+                integer(attribute.format);
+                integer(attribute.offset);
+                integer(attribute.shaderLocation);
+            }
+        }
+        for (const auto &layout : this->_bindGroupLayouts)
+        {
+            integer(layout.getEntries().size());
+            for (const auto &layoutEntry : layout.getEntries())
+            {
+                const WGPUBindGroupLayoutEntry &entry = layoutEntry->getEntry();
+                integer(entry.binding);
+                integer(entry.visibility);
+                integer(entry.buffer.type);
+                integer(entry.buffer.hasDynamicOffset);
+                integer(entry.buffer.minBindingSize);
+                integer(entry.sampler.type);
+                integer(entry.texture.sampleType);
+                integer(entry.texture.viewDimension);
+                integer(entry.texture.multisampled);
+                integer(entry.storageTexture.access);
+                integer(entry.storageTexture.format);
+                integer(entry.storageTexture.viewDimension);
+            }
+        }
+        for (const auto &target : this->_outputColorFormats)
+        {
+            const WGPUBlendState &blend = target.getBlendState();
+            integer(static_cast<WGPUTextureFormat>(target.getFormat()));
+            for (const WGPUBlendComponent &component : {blend.color, blend.alpha})
+            {
+                integer(component.operation);
+                integer(component.srcFactor);
+                integer(component.dstFactor);
+            }
+        }
+        integer(this->_outputDepthFormat.has_value());
+        if (this->_outputDepthFormat.has_value())
+        {
+            const WGPUDepthStencilState &depth = this->_outputDepthFormat->getValue();
+            integer(depth.format);
+            integer(depth.depthWriteEnabled);
+            integer(depth.depthCompare);
+            for (const WGPUStencilFaceState &face : {depth.stencilFront, depth.stencilBack})
+            {
+                integer(face.compare);
+                integer(face.failOp);
+                integer(face.depthFailOp);
+                integer(face.passOp);
+            }
+            integer(depth.stencilReadMask);
+            integer(depth.stencilWriteMask);
+            integer(static_cast<uint32_t>(depth.depthBias));
+            floating(depth.depthBiasSlopeScale);
+            floating(depth.depthBiasClamp);
+        }
+        integer(static_cast<WGPUPrimitiveTopology>(this->_primitiveTopology));
+        integer(static_cast<WGPUCullMode>(this->_cullMode));
+    }
+
     inline const static std::string _DEFAULT_FRAGMENT_ENTRY_POINT = "fs_main";
     inline const static std::string _DEFAULT_VERTEX_ENTRY_POINT = "vs_main";
     inline const static std::string _DEFAULT_NAME = "Unnamed";
@@ -1,21 +1,26 @@
 #pragma once
 
 #include "exception/UnsupportedTextureFormatError.hpp"
+#include "resource/CompressedImage.hpp"
 #include "resource/DeviceContext.hpp"
 #include "resource/Image.hpp"
 #include "resource/Queue.hpp"
 #include "resource/TextureView.hpp"
+#include "utils/ConvertTexelsToRGBA8.hpp"
+#include "utils/GenerateMipChain.hpp"
 #include "utils/GetBytesPerPixel.hpp"
 #include "utils/webgpu.hpp"
+#include <glm/gtc/packing.hpp>
+#include <glm/vec2.hpp>
+#include <glm/vec4.hpp>
+#include <algorithm>
 #include <array>
 #include <bit>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <functional>
-#include <glm/gtc/packing.hpp>
-#include <glm/vec2.hpp>
-#include <glm/vec4.hpp>
+#include <span>
 #include <vector>
 
 namespace Graphic::Resource {
@@ -26,6 +31,7 @@ struct CallbackData {
     uint32_t bytesPerRow;
     wgpu::TextureFormat format;
     bool done = false;
+    bool failed = false;
 };
 
 /**
@@ -35,15 +41,13 @@ struct CallbackData {
  * @param status Result of the mapAsync operation.
  * @param message Optional message produced by the mapping operation.
  * @param userdata1 Pointer to a CallbackData instance that will receive the resulting Image pixels and control flags
- * (must be a valid CallbackData*).
+ * (must be a valid CallbackData*). CallbackData::data width and height must be set.
  * @param userdata2 Unused.
  *
- * If @p status is not success the function logs the failure, sets CallbackData::done to true and returns. If mapping
- * succeeded the function reads the mapped buffer, iterates over texels while skipping per-row padding, converts each
- * texel to a 4-channel 8-bit RGBA pixel according to CallbackData::format, appends pixels to CallbackData::data.pixels,
- * unmaps the buffer, and marks CallbackData::done true. Supported source formats: RGBA8UnormSrgb, RGBA8Unorm,
- * BGRA8Unorm, RGBA16Float (per-channel half floats unpacked, clamped to [0,1], and scaled to 0–255), and Depth32Float
- * (depth mapped to a grayscale RGBA with alpha=255).
+ * If @p status is not success the function logs the failure, sets CallbackData::failed and CallbackData::done to true
+ * and returns. If mapping succeeded the function converts the mapped rows, skipping per-row padding, to 4-channel
+ * 8-bit RGBA pixels (see Utils::ConvertTexelsToRGBA8) stored in CallbackData::data.pixels, unmaps the buffer, and
+ * marks CallbackData::done true.
  *
  * @throws Exception::UnsupportedTextureFormatError If the texture format in CallbackData is not supported for
  * retrieval.
@@ -54,57 +58,28 @@ static void TextureRetrieveCallback(WGPUMapAsyncStatus status, WGPUStringView me
     if (status != wgpu::MapAsyncStatus::Success)
     {
         Log::Error(fmt::format("Failed to map buffer: {}", std::string_view(message.data, message.length)));
+        data->failed = true;
         data->done = true;
         return;
     }
     auto &buf = data->buffer;
-    auto mapped = static_cast<uint8_t *>(buf.getMappedRange(0, buf.getSize()));
-    uint32_t size = (data->bytesPerRow / Graphic::Utils::GetBytesPerPixel(data->format)) * data->data.height;
-    for (size_t i = 0; i < size; i++)
+    const auto &image = data->data;
+    auto mapped = static_cast<const uint8_t *>(buf.getMappedRange(0, size_t{data->bytesPerRow} * image.height));
+    data->data.pixels.resize(size_t{image.width} * image.height);
+    try
     {
-        if (i % (data->bytesPerRow / Graphic::Utils::GetBytesPerPixel(data->format)) >= data->data.width)
-        {
-            continue; // Skip padding bytes
-        }
-        glm::u8vec4 pixel;
-        // Here we assume the texture format is RGBA8Unorm (4 bytes per pixel)
-        switch (data->format)
+        for (uint32_t row = 0; row < image.height; ++row)
         {
-        case wgpu::TextureFormat::RGBA8UnormSrgb:
-        case wgpu::TextureFormat::RGBA8Unorm:
-            pixel.r = mapped[i * 4 + 0];
-            pixel.g = mapped[i * 4 + 1];
-            pixel.b = mapped[i * 4 + 2];
-            pixel.a = mapped[i * 4 + 3];
-            break;
-        case wgpu::TextureFormat::BGRA8UnormSrgb:
-        case wgpu::TextureFormat::BGRA8Unorm:
-            pixel.b = mapped[i * 4 + 0];
-            pixel.g = mapped[i * 4 + 1];
-            pixel.r = mapped[i * 4 + 2];
-            pixel.a = mapped[i * 4 + 3];
-            break;
-        case wgpu::TextureFormat::RGBA16Float: {
-            auto r = std::bit_cast<uint16_t>(std::array<uint8_t, 2>{mapped[i * 8 + 0], mapped[i * 8 + 1]});
-            auto g = std::bit_cast<uint16_t>(std::array<uint8_t, 2>{mapped[i * 8 + 2], mapped[i * 8 + 3]});
-            auto b = std::bit_cast<uint16_t>(std::array<uint8_t, 2>{mapped[i * 8 + 4], mapped[i * 8 + 5]});
-            auto a = std::bit_cast<uint16_t>(std::array<uint8_t, 2>{mapped[i * 8 + 6], mapped[i * 8 + 7]});
-            pixel.r = static_cast<uint8_t>(std::clamp(glm::unpackHalf1x16(r), 0.0f, 1.0f) * 255.0f);
-            pixel.g = static_cast<uint8_t>(std::clamp(glm::unpackHalf1x16(g), 0.0f, 1.0f) * 255.0f);
-            pixel.b = static_cast<uint8_t>(std::clamp(glm::unpackHalf1x16(b), 0.0f, 1.0f) * 255.0f);
-            pixel.a = static_cast<uint8_t>(std::clamp(glm::unpackHalf1x16(a), 0.0f, 1.0f) * 255.0f);
-            break;
+            Graphic::Utils::ConvertTexelsToRGBA8(data->format, mapped + size_t{row} * data->bytesPerRow,
+                                                 data->data.pixels.data() + size_t{row} * image.width, image.width);
         }
-        case wgpu::TextureFormat::Depth32Float: {
-            auto depth = std::bit_cast<float>(
-                std::array<uint8_t, 4>{mapped[i * 4 + 0], mapped[i * 4 + 1], mapped[i * 4 + 2], mapped[i * 4 + 3]});
-            auto depthByte = static_cast<uint8_t>(std::clamp(depth, 0.0f, 1.0f) * 255.0f);
-            pixel = glm::u8vec4(depthByte, depthByte, depthByte, 255);
-            break;
-        }
-        default: throw Exception::UnsupportedTextureFormatError("Texture format not supported for retrieval.");
-        }
-        data->data.pixels.push_back(pixel);
+    }
+    catch (...)
+    {
+        buf.unmap();
+        data->failed = true;
+        data->done = true;
+        throw;
     }
     buf.unmap();
     data->done = true;
@@ -123,12 +98,64 @@ class Texture {
     {
     }
 
+    /**
+     * @brief Create an sRGB texture with a full mip chain, generated from the image (see Utils::GenerateMipChain).
+     */
     Texture(const DeviceContext &deviceContext, const Queue &queue, std::string_view name, const Image &image)
-        : Texture(deviceContext, _BuildDescriptor(name, image))
+        : Texture(deviceContext, _BuildDescriptor(name, {image.width, image.height},
+                                                  Utils::GetMipLevelCount(image.width, image.height),
+                                                  wgpu::TextureFormat::RGBA8UnormSrgb, IMAGE_TEXTURE_USAGE))
     {
         Write(deviceContext, image, queue);
     }
 
+    /**
+     * @brief Create an sRGB texture from already generated mip levels, levels[0] being the full size image.
+     */
+    Texture(const DeviceContext &deviceContext, const Queue &queue, std::string_view name,
+            std::span<const Image> levels)
+        : Texture(deviceContext, _BuildDescriptor(name, {levels.front().width, levels.front().height},
+                                                  static_cast<uint32_t>(levels.size()),
+                                                  wgpu::TextureFormat::RGBA8UnormSrgb, IMAGE_TEXTURE_USAGE))
+    {
+        for (uint32_t level = 0; level < levels.size(); ++level)
+        {
+            _WriteLevel(queue, levels[level], level);
+        }
+    }
+
+    /**
+     * @brief Create a block-compressed texture with the mip levels stored in the image.
+     *
+     * The device must have been created with the TextureCompressionBC feature.
+     */
+    Texture(const DeviceContext &deviceContext, const Queue &queue, std::string_view name,
+            const CompressedImage &image)
+        : Texture(deviceContext, _BuildDescriptor(name, {image.width, image.height},
+                                                  static_cast<uint32_t>(image.levels.size()), image.format,
+                                                  wgpu::TextureUsage::TextureBinding | wgpu::TextureUsage::CopyDst))
+    {
+        const uint32_t blockSize = CompressedImage::GetBlockSize(image.format);
+        for (uint32_t level = 0; level < image.levels.size(); ++level)
+        {
+            const auto &mip = image.levels[level];
+            wgpu::TexelCopyTextureInfo destination;
+            destination.texture = _webgpuTexture;
+            destination.mipLevel = level;
+            destination.origin = {0, 0, 0};
+            destination.aspect = wgpu::TextureAspect::All;
+
+            wgpu::TexelCopyBufferLayout source;
+            source.offset = 0;
+            source.bytesPerRow = (mip.width + 3) / 4 * blockSize;
+            source.rowsPerImage = (mip.height + 3) / 4;
+
+            // Copies of compressed textures cover whole blocks, even for the mip levels smaller than a block.
+            wgpu::Extent3D levelSize = {(mip.width + 3) & ~3u, (mip.height + 3) & ~3u, 1};
+            queue->writeTexture(destination, image.data.data() + mip.offset, mip.size, source, levelSize);
+        }
+    }
+
     Texture(const DeviceContext &deviceContext, const Queue &queue, std::string_view name, const glm::uvec2 &size,
             const std::function<glm::u8vec4(glm::uvec2 pos)> &callback)
         : Texture(deviceContext, queue, name, Image(size, callback))
@@ -178,6 +205,9 @@ class Texture {
 
     inline glm::uvec2 GetSize() const { return glm::uvec2{_webgpuTexture.getWidth(), _webgpuTexture.getHeight()}; }
 
+    /**
+     * @brief Write the image to the first mip level, then regenerate the other levels from it.
+     */
     // We assume the image is correctly formatted (width * height = pixels.size())
     void Write(const DeviceContext &deviceContext, const Image &image, const Queue &queue)
     {
@@ -186,59 +216,33 @@ class Texture {
             Log::Warning("Image data size does not match texture size.");
         }
 
-        wgpu::Extent3D textureSize = {this->_webgpuTexture.getWidth(), this->_webgpuTexture.getHeight(), 1};
-        wgpu::TexelCopyTextureInfo destination;
-        destination.texture = this->_webgpuTexture;
-        destination.mipLevel = 0;
-        destination.origin = {0, 0, 0};
-        destination.aspect = wgpu::TextureAspect::All;
-
-        wgpu::TexelCopyBufferLayout source;
-        source.offset = 0;
-        source.bytesPerRow = image.channels * textureSize.width;
-        source.rowsPerImage = textureSize.height;
+        _WriteLevel(queue, image, 0);
 
-        const uint32_t rowBytes = source.bytesPerRow;
-        const uint32_t alignedRowBytes = (rowBytes + 255u) & ~255u;
-        if (alignedRowBytes == rowBytes)
-        {
-            queue->writeTexture(destination, image.pixels.data(), rowBytes * source.rowsPerImage, source, textureSize);
+        const uint32_t mipLevelCount = _webgpuTexture.getMipLevelCount();
+        if (mipLevelCount <= 1)
             return;
-        }
-
-        std::vector<uint8_t> padded(alignedRowBytes * textureSize.height, 0u);
-        const auto *const src = reinterpret_cast<const std::byte *>(image.pixels.data());
-        for (uint32_t row = 0; row < textureSize.height; ++row)
+        const auto mips = Utils::GenerateMipChain(image);
+        for (uint32_t level = 1; level < mipLevelCount && level <= mips.size(); ++level)
         {
-            std::memcpy(padded.data() + row * alignedRowBytes, src + row * rowBytes, rowBytes);
+            _WriteLevel(queue, mips[level - 1], level);
         }
+    }
 
-        source.bytesPerRow = alignedRowBytes;
-        queue->writeTexture(destination, padded.data(), alignedRowBytes * source.rowsPerImage, source, textureSize);
+    /**
+     * @brief Row pitch of the texture once copied into a buffer, aligned as required by copyTextureToBuffer.
+     */
+    uint32_t GetReadbackBytesPerRow() const
+    {
+        return (_webgpuTexture.getWidth() * _GetBytesPerPixel() + 255) / 256 * 256;
     }
 
     /**
-     * @brief Reads back the GPU texture and returns it as an Image.
-     *
-     * Copies the texture to a CPU-readable buffer, converts the source texel format into 4-channel
-     * RGBA byte pixels, and returns an Image populated with those pixels. Depth formats are
-     * mapped to grayscale RGBA (depth -> luminance, alpha = 255).
-     *
-     * @return Image The retrieved image with width and height matching the texture and 4 channels (RGBA).
+     * @brief Record a copy of the first mip level into a buffer, rows padded to GetReadbackBytesPerRow.
      */
-    Image RetrieveImage(const DeviceContext &deviceContext, const Queue &queue) const
+    void RecordCopyToBuffer(wgpu::CommandEncoder &encoder, const wgpu::Buffer &buffer) const
     {
         wgpu::Extent3D copySize(_webgpuTexture.getWidth(), _webgpuTexture.getHeight(), 1);
 
-        wgpu::CommandEncoder encoder = deviceContext.GetDevice()->createCommandEncoder();
-
-        const uint32_t bytesPerRow = (copySize.width * _GetBytesPerPixel() + 255) / 256 * 256;
-        wgpu::BufferDescriptor bufDesc(wgpu::Default);
-        bufDesc.size = copySize.height * bytesPerRow;
-        bufDesc.usage = wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::MapRead;
-        bufDesc.label = wgpu::StringView("Depth Readback Buffer");
-        wgpu::Buffer readbackBuffer = deviceContext.GetDevice()->createBuffer(bufDesc);
-
         wgpu::TexelCopyTextureInfo srcView(wgpu::Default);
         srcView.texture = _webgpuTexture;
         srcView.mipLevel = 0;
@@ -254,21 +258,45 @@ class Texture {
             srcView.aspect = wgpu::TextureAspect::All;
 
         wgpu::TexelCopyBufferInfo dstView(wgpu::Default);
-        dstView.buffer = readbackBuffer;
+        dstView.buffer = buffer;
         dstView.layout.offset = 0;
-        dstView.layout.bytesPerRow = bytesPerRow;
+        dstView.layout.bytesPerRow = GetReadbackBytesPerRow();
         dstView.layout.rowsPerImage = copySize.height;
 
         encoder.copyTextureToBuffer(srcView, dstView, copySize);
+    }
+
+    /**
+     * @brief Reads back the GPU texture and returns it as an Image.
+     *
+     * Copies the texture to a CPU-readable buffer, converts the source texel format into 4-channel
+     * RGBA byte pixels, and returns an Image populated with those pixels. Depth formats are
+     * mapped to grayscale RGBA (depth -> luminance, alpha = 255).
+     *
+     * This blocks until the GPU is done, prefer TextureReadback to read textures every frame.
+     *
+     * @return Image The retrieved image with width and height matching the texture and 4 channels (RGBA).
+     */
+    Image RetrieveImage(const DeviceContext &deviceContext, const Queue &queue) const
+    {
+        wgpu::CommandEncoder encoder = deviceContext.GetDevice()->createCommandEncoder();
+
+        const uint32_t bytesPerRow = GetReadbackBytesPerRow();
+        wgpu::BufferDescriptor bufDesc(wgpu::Default);
+        bufDesc.size = uint64_t{_webgpuTexture.getHeight()} * bytesPerRow;
+        bufDesc.usage = wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::MapRead;
+        bufDesc.label = wgpu::StringView("Depth Readback Buffer");
+        wgpu::Buffer readbackBuffer = deviceContext.GetDevice()->createBuffer(bufDesc);
+
+        RecordCopyToBuffer(encoder, readbackBuffer);
         auto cmd = encoder.finish();
         encoder.release();
-        auto cmdName = fmt::format("{} Readback Command", _name);
         queue->submit(1, &cmd);
         cmd.release();
 
         CallbackData cbData = {readbackBuffer, {}, bytesPerRow, _webgpuTexture.getFormat(), false};
-        cbData.data.width = copySize.width;
-        cbData.data.height = copySize.height;
+        cbData.data.width = _webgpuTexture.getWidth();
+        cbData.data.height = _webgpuTexture.getHeight();
         cbData.data.channels = 4;
 
         wgpu::BufferMapCallbackInfo cbInfo(wgpu::Default);
@@ -277,10 +305,10 @@ class Texture {
         cbInfo.userdata1 = &cbData;
         cbInfo.userdata2 = nullptr;
         readbackBuffer.mapAsync(wgpu::MapMode::Read, 0, readbackBuffer.getSize(), cbInfo);
+        // Blocking poll: returns as soon as the copy is done instead of sleeping between polls.
         while (!cbData.done)
         {
-            deviceContext.GetDevice()->poll(false, nullptr);
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            deviceContext.GetDevice()->poll(true, nullptr);
         }
         readbackBuffer.release();
         return cbData.data;
@@ -288,6 +316,8 @@ class Texture {
 
     const Resource::TextureView &GetDefaultView() const { return _defaultView; }
 
+    const wgpu::Texture &GetWebGPUTexture() const { return _webgpuTexture; }
+
     inline Resource::TextureView CreateView(const wgpu::TextureViewDescriptor &descriptor) const
     {
         return Resource::TextureView(_webgpuTexture.createView(descriptor));
@@ -302,22 +332,62 @@ class Texture {
   private:
     Texture(void) = default;
 
-    static wgpu::TextureDescriptor _BuildDescriptor(std::string_view name, const Image &image)
+    static inline const wgpu::TextureUsage IMAGE_TEXTURE_USAGE =
+        wgpu::TextureUsage::TextureBinding | wgpu::TextureUsage::RenderAttachment | wgpu::TextureUsage::CopySrc |
+        wgpu::TextureUsage::CopyDst;
+
+    static wgpu::TextureDescriptor _BuildDescriptor(std::string_view name, const glm::uvec2 &size,
+                                                    uint32_t mipLevelCount, wgpu::TextureFormat format,
+                                                    wgpu::TextureUsage usage)
     {
         wgpu::TextureDescriptor textureDesc(wgpu::Default);
         textureDesc.label = wgpu::StringView(name);
-        textureDesc.size = {image.width, image.height, 1};
+        textureDesc.size = {size.x, size.y, 1};
         textureDesc.dimension = wgpu::TextureDimension::_2D;
-        textureDesc.mipLevelCount = 1;
+        textureDesc.mipLevelCount = mipLevelCount;
         textureDesc.sampleCount = 1;
-        textureDesc.format = wgpu::TextureFormat::RGBA8UnormSrgb;
-        textureDesc.usage = wgpu::TextureUsage::TextureBinding | wgpu::TextureUsage::RenderAttachment |
-                            wgpu::TextureUsage::CopySrc | wgpu::TextureUsage::CopyDst;
+        textureDesc.format = format;
+        textureDesc.usage = usage;
         textureDesc.viewFormats = nullptr;
         textureDesc.viewFormatCount = 0;
         return textureDesc;
     }
 
+    void _WriteLevel(const Queue &queue, const Image &image, uint32_t mipLevel)
+    {
+        const uint32_t width = std::max(_webgpuTexture.getWidth() >> mipLevel, 1u);
+        const uint32_t height = std::max(_webgpuTexture.getHeight() >> mipLevel, 1u);
+        wgpu::Extent3D textureSize = {width, height, 1};
+        wgpu::TexelCopyTextureInfo destination;
+        destination.texture = this->_webgpuTexture;
+        destination.mipLevel = mipLevel;
+        destination.origin = {0, 0, 0};
+        destination.aspect = wgpu::TextureAspect::All;
+
+        wgpu::TexelCopyBufferLayout source;
+        source.offset = 0;
+        source.bytesPerRow = image.channels * textureSize.width;
+        source.rowsPerImage = textureSize.height;
+
+        const uint32_t rowBytes = source.bytesPerRow;
+        const uint32_t alignedRowBytes = (rowBytes + 255u) & ~255u;
+        if (alignedRowBytes == rowBytes)
+        {
+            queue->writeTexture(destination, image.pixels.data(), rowBytes * source.rowsPerImage, source, textureSize);
+            return;
+        }
+
+        std::vector<uint8_t> padded(alignedRowBytes * textureSize.height, 0u);
+        const auto *const src = reinterpret_cast<const std::byte *>(image.pixels.data());
+        for (uint32_t row = 0; row < textureSize.height; ++row)
+        {
+            std::memcpy(padded.data() + row * alignedRowBytes, src + row * rowBytes, rowBytes);
+        }
+
+        source.bytesPerRow = alignedRowBytes;
+        queue->writeTexture(destination, padded.data(), alignedRowBytes * source.rowsPerImage, source, textureSize);
+    }
+
     uint32_t _GetBytesPerPixel() const { return Utils::GetBytesPerPixel(_webgpuTexture.getFormat()); }
 
     wgpu::Texture _webgpuTexture;
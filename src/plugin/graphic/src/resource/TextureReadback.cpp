@@ -0,0 +1,230 @@
+#include "resource/TextureReadback.hpp"
+#include "exception/FailToCreateCommandEncoderError.hpp"
+#include "resource/DeviceContext.hpp"
+#include "resource/Queue.hpp"
+#include <algorithm>
+
+namespace Graphic::Resource {
+
+TextureReadback::TextureReadback(uint32_t ringSize)
+{
+    _slots.reserve(std::max(ringSize, 1u));
+    for (uint32_t i = 0; i < std::max(ringSize, 1u); ++i)
+    {
+        _slots.push_back(std::make_unique<Slot>());
+    }
+}
+
+TextureReadback::TextureReadback(TextureReadback &&other) noexcept
+    : _slots(std::move(other._slots)), _pending(std::move(other._pending)), _encoder(other._encoder)
+{
+    other._encoder = nullptr;
+}
+
+TextureReadback &TextureReadback::operator=(TextureReadback &&other) noexcept
+{
+    if (this != &other)
+    {
+        Release();
+        _slots = std::move(other._slots);
+        _pending = std::move(other._pending);
+        _encoder = other._encoder;
+        other._encoder = nullptr;
+    }
+    return *this;
+}
+
+std::future<Image> TextureReadback::Request(Engine::Core &core, const Texture &texture)
+{
+    return Request(core, texture, _GetEncoder(core));
+}
+
+void TextureReadback::Request(Engine::Core &core, const Texture &texture, Callback callback)
+{
+    Request(core, texture, _GetEncoder(core), std::move(callback));
+}
+
+std::future<Image> TextureReadback::Request(Engine::Core &core, const Texture &texture, wgpu::CommandEncoder &encoder)
+{
+    Slot &slot = _AcquireSlot(core, texture);
+    slot.promise = std::promise<Image>();
+    slot.callback = nullptr;
+    auto future = slot.promise.get_future();
+    _Record(core, slot, texture, encoder);
+    return future;
+}
+
+void TextureReadback::Request(Engine::Core &core, const Texture &texture, wgpu::CommandEncoder &encoder,
+                              Callback callback)
+{
+    Slot &slot = _AcquireSlot(core, texture);
+    slot.promise = std::promise<Image>();
+    slot.callback = std::move(callback);
+    _Record(core, slot, texture, encoder);
+}
+
+void TextureReadback::Flush(Engine::Core &core)
+{
+    if (_encoder != nullptr)
+    {
+        wgpu::CommandBufferDescriptor cmdBufferDescriptor(wgpu::Default);
+        cmdBufferDescriptor.label = wgpu::StringView("TextureReadback::CommandBuffer");
+        auto commandBuffer = _encoder.finish(cmdBufferDescriptor);
+        _encoder.release();
+        _encoder = nullptr;
+        core.GetResource<Queue>()->submit(1, &commandBuffer);
+        commandBuffer.release();
+    }
+
+    for (Slot *slot : _pending)
+    {
+        if (slot->state != SlotState::Recorded)
+            continue;
+
+        wgpu::BufferMapCallbackInfo cbInfo(wgpu::Default);
+        cbInfo.mode = wgpu::CallbackMode::AllowSpontaneous;
+        cbInfo.callback = TextureRetrieveCallback;
+        cbInfo.userdata1 = &slot->data;
+        cbInfo.userdata2 = nullptr;
+        slot->state = SlotState::Mapping;
+        const uint64_t size = uint64_t{slot->data.bytesPerRow} * slot->data.data.height;
+        slot->buffer.mapAsync(wgpu::MapMode::Read, 0, size, cbInfo);
+    }
+}
+
+void TextureReadback::Update(Engine::Core &core)
+{
+    Flush(core);
+    if (_pending.empty())
+        return;
+    core.GetResource<DeviceContext>().GetDevice()->poll(false, nullptr);
+    _DeliverFinished();
+}
+
+void TextureReadback::WaitAll(Engine::Core &core)
+{
+    Flush(core);
+    auto &device = core.GetResource<DeviceContext>().GetDevice().value();
+    while (!_pending.empty())
+    {
+        device.poll(true, nullptr);
+        _DeliverFinished();
+    }
+}
+
+void TextureReadback::Release()
+{
+    if (_encoder != nullptr)
+    {
+        _encoder.release();
+        _encoder = nullptr;
+    }
+    for (auto &slot : _slots)
+    {
+        if (slot != nullptr && slot->buffer != nullptr)
+        {
+            slot->buffer.release();
+            slot->buffer = nullptr;
+            slot->capacity = 0;
+        }
+    }
+}
+
+TextureReadback::Slot &TextureReadback::_AcquireSlot(Engine::Core &core, const Texture &texture)
+{
+    auto it = std::ranges::find_if(_slots, [](const auto &slot) { return slot->state == SlotState::Free; });
+    if (it == _slots.end())
+    {
+        // Every buffer is in flight: wait for the oldest one, which frees its slot.
+        Slot *oldest = _pending.empty() ? nullptr : _pending.front();
+        if (oldest == nullptr || oldest->state != SlotState::Mapping)
+        {
+            // Copies recorded this frame are not submitted yet, waiting is impossible.
+            Log::Warning(fmt::format("TextureReadback: More than {} readbacks requested in a frame, growing the ring.",
+                                     _slots.size()));
+            _slots.push_back(std::make_unique<Slot>());
+            return *_slots.back();
+        }
+        auto &device = core.GetResource<DeviceContext>().GetDevice().value();
+        while (oldest->state != SlotState::Free)
+        {
+            device.poll(true, nullptr);
+            _DeliverFinished();
+        }
+        return *oldest;
+    }
+    return **it;
+}
+
+void TextureReadback::_Record(Engine::Core &core, Slot &slot, const Texture &texture, wgpu::CommandEncoder &encoder)
+{
+    const glm::uvec2 size = texture.GetSize();
+    const uint32_t bytesPerRow = texture.GetReadbackBytesPerRow();
+    const uint64_t requiredSize = uint64_t{bytesPerRow} * size.y;
+
+    if (slot.capacity < requiredSize)
+    {
+        if (slot.buffer != nullptr)
+            slot.buffer.release();
+        wgpu::BufferDescriptor bufDesc(wgpu::Default);
+        bufDesc.size = requiredSize;
+        bufDesc.usage = wgpu::BufferUsage::CopyDst | wgpu::BufferUsage::MapRead;
+        bufDesc.label = wgpu::StringView("TextureReadback::Buffer");
+        slot.buffer = core.GetResource<DeviceContext>().GetDevice()->createBuffer(bufDesc);
+        slot.capacity = requiredSize;
+    }
+
+    texture.RecordCopyToBuffer(encoder, slot.buffer);
+
+    slot.data.buffer = slot.buffer;
+    slot.data.bytesPerRow = bytesPerRow;
+    slot.data.format = texture.GetWebGPUTexture().getFormat();
+    slot.data.done = false;
+    slot.data.failed = false;
+    slot.data.data = Image{};
+    slot.data.data.width = size.x;
+    slot.data.data.height = size.y;
+    slot.data.data.channels = 4;
+    slot.state = SlotState::Recorded;
+    _pending.push_back(&slot);
+}
+
+wgpu::CommandEncoder &TextureReadback::_GetEncoder(Engine::Core &core)
+{
+    if (_encoder == nullptr)
+    {
+        wgpu::CommandEncoderDescriptor encoderDesc(wgpu::Default);
+        encoderDesc.label = wgpu::StringView("TextureReadback::CommandEncoder");
+        _encoder = core.GetResource<DeviceContext>().GetDevice()->createCommandEncoder(encoderDesc);
+        if (_encoder == nullptr)
+            throw Exception::FailToCreateCommandEncoderError("TextureReadback: Command encoder is not created.");
+    }
+    return _encoder;
+}
+
+void TextureReadback::_Deliver(Slot &slot)
+{
+    // The slot is free before the callback runs, so that it can request the next readback.
+    slot.state = SlotState::Free;
+    Image image = std::move(slot.data.data);
+    auto callback = std::move(slot.callback);
+    slot.callback = nullptr;
+    if (callback)
+    {
+        callback(std::move(image));
+        return;
+    }
+    slot.promise.set_value(std::move(image));
+}
+
+void TextureReadback::_DeliverFinished(void)
+{
+    while (!_pending.empty() && _pending.front()->state == SlotState::Mapping && _pending.front()->data.done)
+    {
+        Slot *slot = _pending.front();
+        _pending.pop_front();
+        _Deliver(*slot);
+    }
+}
+
+} // namespace Graphic::Resource
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "core/Core.hpp"
+#include "resource/Texture.hpp"
+#include "utils/webgpu.hpp"
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace Graphic::Resource {
+
+/**
+ * @brief Asynchronous texture readback backed by a ring of persistent map-read buffers.
+ *
+ * A request records the texture copy now and returns a future (or calls a callback) once the copy reached the CPU,
+ * usually a few frames later. Copies requested without an encoder are submitted together by Flush, after the frame
+ * passes. Update, called once per frame, maps the submitted buffers and delivers the finished readbacks in request
+ * order, without ever blocking.
+ *
+ * When every buffer of the ring is in flight, a new request waits for the oldest one. A readback whose mapping failed
+ * delivers an empty image.
+ */
+class TextureReadback {
+  public:
+    using Callback = std::function<void(Image &&)>;
+
+    static inline constexpr uint32_t DEFAULT_RING_SIZE = 3;
+
+    explicit TextureReadback(uint32_t ringSize = DEFAULT_RING_SIZE);
+    ~TextureReadback() { Release(); }
+
+    TextureReadback(const TextureReadback &) = delete;
+    TextureReadback &operator=(const TextureReadback &) = delete;
+
+    TextureReadback(TextureReadback &&other) noexcept;
+    TextureReadback &operator=(TextureReadback &&other) noexcept;
+
+    /**
+     * @brief Record the copy in the readback encoder, submitted by the next Flush.
+     */
+    std::future<Image> Request(Engine::Core &core, const Texture &texture);
+    void Request(Engine::Core &core, const Texture &texture, Callback callback);
+
+    /**
+     * @brief Record the copy in the given encoder. It must be submitted before the next Flush.
+     */
+    std::future<Image> Request(Engine::Core &core, const Texture &texture, wgpu::CommandEncoder &encoder);
+    void Request(Engine::Core &core, const Texture &texture, wgpu::CommandEncoder &encoder, Callback callback);
+
+    /**
+     * @brief Submit the recorded copies and start mapping their buffers.
+     */
+    void Flush(Engine::Core &core);
+
+    /**
+     * @brief Flush, then deliver every readback whose buffer is mapped, without waiting for the GPU.
+     */
+    void Update(Engine::Core &core);
+
+    /**
+     * @brief Flush, then block until every pending readback is delivered.
+     */
+    void WaitAll(Engine::Core &core);
+
+    [[nodiscard]] size_t GetPendingCount() const { return _pending.size(); }
+    [[nodiscard]] size_t GetRingSize() const { return _slots.size(); }
+
+    /**
+     * @brief Release the buffers. Pending readbacks must have been delivered (see WaitAll).
+     */
+    void Release();
+
+  private:
+    enum class SlotState {
+        Free,
+        Recorded,
+        Mapping
+    };
+
+    struct Slot {
+        SlotState state = SlotState::Free;
+        wgpu::Buffer buffer = nullptr;
+        uint64_t capacity = 0;
+        CallbackData data{nullptr, {}, 0, wgpu::TextureFormat::Undefined, false};
+        std::promise<Image> promise;
+        Callback callback;
+    };
+
+    Slot &_AcquireSlot(Engine::Core &core, const Texture &texture);
+    void _Record(Engine::Core &core, Slot &slot, const Texture &texture, wgpu::CommandEncoder &encoder);
+    wgpu::CommandEncoder &_GetEncoder(Engine::Core &core);
+    void _Deliver(Slot &slot);
+    void _DeliverFinished(void);
+
+    // Slots are heap allocated: their CallbackData is handed to mapAsync and must not move.
+    std::vector<std::unique_ptr<Slot>> _slots;
+    /** @brief Slots in flight, oldest request first. */
+    std::deque<Slot *> _pending;
+    wgpu::CommandEncoder _encoder = nullptr;
+};
+
+} // namespace Graphic::Resource
@@ -6,5 +6,5 @@ void Graphic::System::ExecuteRenderPass(Engine::Core &core)
     auto &renderPassContainer = core.GetResource<Graphic::Resource::RenderGraphContainer>();
 
     if (renderPassContainer.HasDefault())
-        renderPassContainer.GetDefault().Execute(core);
+        renderPassContainer.GetDefault().Record(core);
 }
@@ -0,0 +1,10 @@
+#include "system/commandSubmission/CaptureFrame.hpp"
+#include "resource/FrameCapture.hpp"
+
+void Graphic::System::CaptureFrame(Engine::Core &core)
+{
+    auto &frameCapture = core.GetResource<Graphic::Resource::FrameCapture>();
+
+    if (frameCapture.IsCapturing())
+        frameCapture.Capture(core);
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "core/Core.hpp"
+
+namespace Graphic::System {
+
+void CaptureFrame(Engine::Core &core);
+
+}
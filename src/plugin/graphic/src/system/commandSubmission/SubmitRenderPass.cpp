@@ -0,0 +1,10 @@
+#include "system/commandSubmission/SubmitRenderPass.hpp"
+#include "resource/RenderGraphContainer.hpp"
+
+void Graphic::System::SubmitRenderPass(Engine::Core &core)
+{
+    auto &renderPassContainer = core.GetResource<Graphic::Resource::RenderGraphContainer>();
+
+    if (renderPassContainer.HasDefault())
+        renderPassContainer.GetDefault().Submit(core);
+}
@@ -0,0 +1,7 @@
+#include "system/commandSubmission/UpdateTextureReadback.hpp"
+#include "resource/TextureReadback.hpp"
+
+void Graphic::System::UpdateTextureReadback(Engine::Core &core)
+{
+    core.GetResource<Graphic::Resource::TextureReadback>().Update(core);
+}
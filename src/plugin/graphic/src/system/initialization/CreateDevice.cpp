@@ -3,13 +3,31 @@
 #include "resource/Adapter.hpp"
 #include "resource/DeviceContext.hpp"
 #include "resource/GraphicSettings.hpp"
+#include <algorithm>
+#include <vector>
 
 namespace Graphic::System {
-static void SetupDeviceDescriptor(wgpu::DeviceDescriptor &deviceDesc, Graphic::Resource::GraphicSettings &settings)
+static void SetupDeviceFeatures(std::vector<WGPUFeatureName> &features, Graphic::Resource::Adapter &adapter,
+                                Graphic::Resource::GraphicSettings &settings)
+{
+    features = settings.GetRequiredFeatures();
+    for (WGPUFeatureName feature : settings.GetOptionalFeatures())
+    {
+        if (std::ranges::find(features, feature) != features.end())
+            continue;
+        if (adapter->hasFeature(static_cast<wgpu::FeatureName>(feature)))
+            features.push_back(feature);
+        else
+            Log::Info(fmt::format("Optional device feature {:x} is not supported", static_cast<uint32_t>(feature)));
+    }
+}
+
+static void SetupDeviceDescriptor(wgpu::DeviceDescriptor &deviceDesc, Graphic::Resource::GraphicSettings &settings,
+                                  const std::vector<WGPUFeatureName> &features)
 {
     deviceDesc.label = wgpu::StringView("Core Device");
-    deviceDesc.requiredFeatureCount = settings.GetRequiredFeatures().size();
-    deviceDesc.requiredFeatures = settings.GetRequiredFeatures().data();
+    deviceDesc.requiredFeatureCount = features.size();
+    deviceDesc.requiredFeatures = features.data();
     deviceDesc.requiredLimits = dynamic_cast<wgpu::Limits *>(&settings.GetWantedLimits());
     deviceDesc.defaultQueue.nextInChain = nullptr;
     deviceDesc.defaultQueue.label = wgpu::StringView("The default queue");
@@ -31,7 +49,8 @@ void CreateDevice(Engine::Core &core)
     auto &adapter = core.GetResource<Resource::Adapter>();
     auto &settings = core.GetResource<Resource::GraphicSettings>();
 
-    SetupDeviceDescriptor(deviceContext.GetDescriptor(), settings);
+    SetupDeviceFeatures(deviceContext.GetFeatures(), adapter, settings);
+    SetupDeviceDescriptor(deviceContext.GetDescriptor(), settings, deviceContext.GetFeatures());
 
     deviceContext.GetDevice() = adapter->requestDevice(deviceContext.GetDescriptor());
 
@@ -0,0 +1,12 @@
+#include "system/initialization/SetupAsyncTextureLoader.hpp"
+#include "resource/AsyncTextureLoader.hpp"
+#include "resource/DeviceContext.hpp"
+
+namespace Graphic::System {
+void SetupAsyncTextureLoader(Engine::Core &core)
+{
+    const auto &deviceContext = core.GetResource<Resource::DeviceContext>();
+    core.GetResource<Resource::AsyncTextureLoader>().SetCompressedTexturesSupported(
+        deviceContext.HasFeature(wgpu::FeatureName::TextureCompressionBC));
+}
+} // namespace Graphic::System
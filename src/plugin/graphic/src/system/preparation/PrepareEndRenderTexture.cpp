@@ -11,6 +11,13 @@
 static void EnsurePlaceholderEndRenderTexture(Graphic::Resource::DeviceContext &deviceContext,
                                               Graphic::Resource::TextureContainer &textureContainer)
 {
+    // Textures taken from the surface are not owned, an owned end render texture is already the placeholder.
+    if (textureContainer.Contains(Graphic::Utils::END_RENDER_TEXTURE_ID) &&
+        textureContainer.Get(Graphic::Utils::END_RENDER_TEXTURE_ID).OwnsResources())
+    {
+        return;
+    }
+
     wgpu::TextureDescriptor textureDesc(wgpu::Default);
     std::string_view name(Graphic::Utils::END_RENDER_TEXTURE_ID.data(), Graphic::Utils::END_RENDER_TEXTURE_ID.size());
     textureDesc.label = wgpu::StringView(name);
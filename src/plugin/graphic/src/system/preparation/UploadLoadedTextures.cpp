@@ -0,0 +1,7 @@
+#include "system/preparation/UploadLoadedTextures.hpp"
+#include "resource/AsyncTextureLoader.hpp"
+
+void Graphic::System::UploadLoadedTextures(Engine::Core &core)
+{
+    core.GetResource<Graphic::Resource::AsyncTextureLoader>().Update(core);
+}
@@ -0,0 +1,7 @@
+#include "system/renderPipeline/CreatePendingPipelines.hpp"
+#include "resource/PipelineCache.hpp"
+
+void Graphic::System::CreatePendingPipelines(Engine::Core &core)
+{
+    core.GetResource<Graphic::Resource::PipelineCache>().Update(core);
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+#include "core/Core.hpp"
+
+namespace Graphic::System {
+void CreatePendingPipelines(Engine::Core &core);
+} // namespace Graphic::System
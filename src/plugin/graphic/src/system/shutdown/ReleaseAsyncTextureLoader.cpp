@@ -0,0 +1,9 @@
+#include "system/shutdown/ReleaseAsyncTextureLoader.hpp"
+#include "resource/AsyncTextureLoader.hpp"
+
+void Graphic::System::ReleaseAsyncTextureLoader(Engine::Core &core)
+{
+    // Worker threads are joined before the textures they would upload are released.
+    core.GetResource<Resource::AsyncTextureLoader>().Stop();
+    core.DeleteResource<Resource::AsyncTextureLoader>();
+}
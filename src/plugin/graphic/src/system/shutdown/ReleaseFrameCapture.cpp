@@ -0,0 +1,8 @@
+#include "system/shutdown/ReleaseFrameCapture.hpp"
+#include "resource/FrameCapture.hpp"
+
+void Graphic::System::ReleaseFrameCapture(Engine::Core &core)
+{
+    core.GetResource<Resource::FrameCapture>().Stop(core);
+    core.DeleteResource<Resource::FrameCapture>();
+}
@@ -0,0 +1,9 @@
+#include "system/shutdown/ReleasePipelineCache.hpp"
+#include "resource/PipelineCache.hpp"
+
+void Graphic::System::ReleasePipelineCache(Engine::Core &core)
+{
+    // Running compilations use the device, they are waited for before the context is released.
+    core.GetResource<Resource::PipelineCache>().Release();
+    core.DeleteResource<Resource::PipelineCache>();
+}
@@ -0,0 +1,9 @@
+#include "system/shutdown/ReleaseTextureReadback.hpp"
+#include "resource/TextureReadback.hpp"
+
+void Graphic::System::ReleaseTextureReadback(Engine::Core &core)
+{
+    // Pending mappings write into the readback slots, they must complete before the slots are destroyed.
+    core.GetResource<Resource::TextureReadback>().WaitAll(core);
+    core.DeleteResource<Resource::TextureReadback>();
+}
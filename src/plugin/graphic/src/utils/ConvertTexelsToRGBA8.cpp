@@ -0,0 +1,100 @@
+#include "utils/ConvertTexelsToRGBA8.hpp"
+#include "exception/UnsupportedTextureFormatError.hpp"
+#include <algorithm>
+#include <cstring>
+#include <glm/gtc/packing.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define GRAPHIC_CONVERT_TEXELS_SSE2
+#endif
+
+namespace Graphic::Utils {
+
+static_assert(sizeof(glm::u8vec4) == 4, "glm::u8vec4 must be tightly packed.");
+
+static uint8_t UnitToByte(float value) { return static_cast<uint8_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f); }
+
+static void ConvertBGRA8(const uint8_t *source, glm::u8vec4 *destination, uint32_t count)
+{
+    uint32_t i = 0;
+#ifdef GRAPHIC_CONVERT_TEXELS_SSE2
+    const __m128i greenAlphaMask = _mm_set1_epi32(static_cast<int>(0xFF00FF00u));
+    const __m128i blueRedMask = _mm_set1_epi32(0x00FF00FF);
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i texels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i * 4));
+        const __m128i greenAlpha = _mm_and_si128(texels, greenAlphaMask);
+        const __m128i blueRed = _mm_and_si128(texels, blueRedMask);
+        const __m128i redBlue = _mm_or_si128(_mm_slli_epi32(blueRed, 16), _mm_srli_epi32(blueRed, 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i), _mm_or_si128(greenAlpha, redBlue));
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        destination[i] = glm::u8vec4(source[i * 4 + 2], source[i * 4 + 1], source[i * 4 + 0], source[i * 4 + 3]);
+    }
+}
+
+static void ConvertRGBA16Float(const uint8_t *source, glm::u8vec4 *destination, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        uint64_t packed;
+        std::memcpy(&packed, source + i * 8, sizeof(packed));
+        const glm::vec4 color = glm::unpackHalf4x16(packed);
+#ifdef GRAPHIC_CONVERT_TEXELS_SSE2
+        __m128 channels = _mm_loadu_ps(&color.x);
+        channels = _mm_min_ps(_mm_max_ps(channels, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+        const __m128i bytes = _mm_cvttps_epi32(_mm_mul_ps(channels, _mm_set1_ps(255.0f)));
+        const __m128i packedBytes = _mm_packus_epi16(_mm_packs_epi32(bytes, bytes), _mm_setzero_si128());
+        const int32_t pixel = _mm_cvtsi128_si32(packedBytes);
+        std::memcpy(&destination[i], &pixel, sizeof(pixel));
+#else
+        destination[i] =
+            glm::u8vec4(UnitToByte(color.r), UnitToByte(color.g), UnitToByte(color.b), UnitToByte(color.a));
+#endif
+    }
+}
+
+static void ConvertDepth32Float(const uint8_t *source, glm::u8vec4 *destination, uint32_t count)
+{
+    uint32_t i = 0;
+#ifdef GRAPHIC_CONVERT_TEXELS_SSE2
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 depth = _mm_loadu_ps(reinterpret_cast<const float *>(source + i * 4));
+        const __m128i gray = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(depth, zero), one), scale));
+        const __m128i pixels =
+            _mm_or_si128(_mm_or_si128(gray, _mm_slli_epi32(gray, 8)), _mm_or_si128(_mm_slli_epi32(gray, 16), alpha));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i), pixels);
+    }
+#endif
+    for (; i < count; ++i)
+    {
+        float depth;
+        std::memcpy(&depth, source + i * 4, sizeof(depth));
+        const uint8_t gray = UnitToByte(depth);
+        destination[i] = glm::u8vec4(gray, gray, gray, 255);
+    }
+}
+
+void ConvertTexelsToRGBA8(wgpu::TextureFormat format, const uint8_t *source, glm::u8vec4 *destination, uint32_t count)
+{
+    switch (format)
+    {
+    case wgpu::TextureFormat::RGBA8UnormSrgb:
+    case wgpu::TextureFormat::RGBA8Unorm: std::memcpy(destination, source, count * sizeof(glm::u8vec4)); break;
+    case wgpu::TextureFormat::BGRA8UnormSrgb:
+    case wgpu::TextureFormat::BGRA8Unorm: ConvertBGRA8(source, destination, count); break;
+    case wgpu::TextureFormat::RGBA16Float: ConvertRGBA16Float(source, destination, count); break;
+    case wgpu::TextureFormat::Depth32Float: ConvertDepth32Float(source, destination, count); break;
+    default: throw Exception::UnsupportedTextureFormatError("Texture format not supported for retrieval.");
+    }
+}
+
+} // namespace Graphic::Utils
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "utils/webgpu.hpp"
+#include <cstdint>
+#include <glm/vec4.hpp>
+
+namespace Graphic::Utils {
+
+/**
+ * @brief Convert one row of texels of the given format to RGBA8 pixels.
+ *
+ * RGBA8 rows are copied as is, BGRA8 rows are swizzled, RGBA16Float channels are clamped to [0,1] and scaled to
+ * 0-255, Depth32Float is mapped to a grayscale pixel with alpha=255. Uses SSE2 when available.
+ *
+ * @throws Exception::UnsupportedTextureFormatError If the format cannot be converted.
+ */
+void ConvertTexelsToRGBA8(wgpu::TextureFormat format, const uint8_t *source, glm::u8vec4 *destination, uint32_t count);
+
+} // namespace Graphic::Utils
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <entt/core/hashed_string.hpp>
+#include <string_view>
 
 namespace Graphic::Utils {
-constexpr entt::hashed_string END_RENDER_TEXTURE_ID{"end_render_texture"};
+constexpr std::string_view END_RENDER_TEXTURE_NAME = "end_render_texture";
+constexpr entt::hashed_string END_RENDER_TEXTURE_ID{END_RENDER_TEXTURE_NAME.data(), END_RENDER_TEXTURE_NAME.size()};
 } // namespace Graphic::Utils
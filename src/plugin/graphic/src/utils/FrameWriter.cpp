@@ -0,0 +1,78 @@
+#include "utils/FrameWriter.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+
+namespace Graphic::Utils {
+
+FrameWriter::FrameWriter(WriteFunction write, size_t maxQueuedFrames, uint32_t threadCount)
+    : _write(std::move(write)), _maxQueuedFrames(std::max<size_t>(maxQueuedFrames, 1))
+{
+    for (uint32_t i = 0; i < std::max(threadCount, 1u); ++i)
+    {
+        _threads.emplace_back(&FrameWriter::_Run, this);
+    }
+}
+
+bool FrameWriter::Push(Resource::Image &&image, bool waitWhenFull)
+{
+    std::unique_lock lock(_mutex);
+    if (_stopping)
+        return false;
+    if (_queue.size() >= _maxQueuedFrames)
+    {
+        if (!waitWhenFull)
+            return false;
+        _hasRoom.wait(lock, [this]() { return _queue.size() < _maxQueuedFrames || _stopping; });
+        if (_stopping)
+            return false;
+    }
+    _queue.push_back(QueuedFrame{_nextFrameIndex++, std::move(image)});
+    lock.unlock();
+    _hasFrames.notify_one();
+    return true;
+}
+
+void FrameWriter::Stop()
+{
+    {
+        std::scoped_lock lock(_mutex);
+        _stopping = true;
+    }
+    _hasFrames.notify_all();
+    _hasRoom.notify_all();
+    for (auto &thread : _threads)
+    {
+        if (thread.joinable())
+            thread.join();
+    }
+    _threads.clear();
+}
+
+void FrameWriter::_Run(void)
+{
+    while (true)
+    {
+        std::unique_lock lock(_mutex);
+        // Queued frames are still written once stopping, only an empty queue ends the thread.
+        _hasFrames.wait(lock, [this]() { return !_queue.empty() || _stopping; });
+        if (_queue.empty())
+            return;
+        QueuedFrame frame = std::move(_queue.front());
+        _queue.pop_front();
+        lock.unlock();
+        _hasRoom.notify_one();
+
+        try
+        {
+            _write(frame.image, frame.index);
+            ++_writtenFrames;
+        }
+        catch (const std::exception &e)
+        {
+            ++_failedFrames;
+            Log::Error(fmt::format("FrameWriter: Failed to write frame {}: {}", frame.index, e.what()));
+        }
+    }
+}
+
+} // namespace Graphic::Utils
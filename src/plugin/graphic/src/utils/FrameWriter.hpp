@@ -0,0 +1,70 @@
+#pragma once
+
+#include "resource/Image.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Graphic::Utils {
+
+/**
+ * @brief Hands captured frames to background threads that write them (PNG encoding, raw file, ...).
+ *
+ * Frames are numbered in the order they are pushed. The queue is bounded: when it is full, Push either drops the
+ * frame or waits for room, so a slow writer never makes memory grow without limit.
+ */
+class FrameWriter {
+  public:
+    using WriteFunction = std::function<void(const Resource::Image &image, uint64_t frameIndex)>;
+
+    FrameWriter(WriteFunction write, size_t maxQueuedFrames, uint32_t threadCount = 1);
+    ~FrameWriter() { Stop(); }
+
+    FrameWriter(const FrameWriter &) = delete;
+    FrameWriter &operator=(const FrameWriter &) = delete;
+    FrameWriter(FrameWriter &&) = delete;
+    FrameWriter &operator=(FrameWriter &&) = delete;
+
+    /**
+     * @brief Queue a frame for writing.
+     *
+     * @param waitWhenFull whether to wait for room when the queue is full instead of dropping the frame.
+     * @return false if the frame was dropped.
+     */
+    bool Push(Resource::Image &&image, bool waitWhenFull);
+
+    /**
+     * @brief Write every queued frame, then join the threads.
+     */
+    void Stop();
+
+    [[nodiscard]] uint64_t GetWrittenFrameCount() const { return _writtenFrames.load(); }
+    [[nodiscard]] uint64_t GetFailedFrameCount() const { return _failedFrames.load(); }
+
+  private:
+    struct QueuedFrame {
+        uint64_t index;
+        Resource::Image image;
+    };
+
+    void _Run(void);
+
+    WriteFunction _write;
+    size_t _maxQueuedFrames;
+    std::mutex _mutex;
+    std::condition_variable _hasFrames;
+    std::condition_variable _hasRoom;
+    std::deque<QueuedFrame> _queue;
+    uint64_t _nextFrameIndex = 0;
+    bool _stopping = false;
+    std::atomic<uint64_t> _writtenFrames{0};
+    std::atomic<uint64_t> _failedFrames{0};
+    std::vector<std::thread> _threads;
+};
+
+} // namespace Graphic::Utils
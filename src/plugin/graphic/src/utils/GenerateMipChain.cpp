@@ -0,0 +1,102 @@
+#include "utils/GenerateMipChain.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+
+namespace Graphic::Utils {
+
+static constexpr uint32_t LINEAR_TO_SRGB_TABLE_SIZE = 4096;
+
+static const std::array<float, 256> &GetSrgbToLinearTable()
+{
+    static const std::array<float, 256> table = []() {
+        std::array<float, 256> values{};
+        for (uint32_t i = 0; i < values.size(); ++i)
+        {
+            const float c = static_cast<float>(i) / 255.f;
+            values[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+        }
+        return values;
+    }();
+    return table;
+}
+
+static const std::array<uint8_t, LINEAR_TO_SRGB_TABLE_SIZE> &GetLinearToSrgbTable()
+{
+    static const std::array<uint8_t, LINEAR_TO_SRGB_TABLE_SIZE> table = []() {
+        std::array<uint8_t, LINEAR_TO_SRGB_TABLE_SIZE> values{};
+        for (uint32_t i = 0; i < values.size(); ++i)
+        {
+            const float l = static_cast<float>(i) / static_cast<float>(LINEAR_TO_SRGB_TABLE_SIZE - 1);
+            const float c = l <= 0.0031308f ? l * 12.92f : 1.055f * std::pow(l, 1.f / 2.4f) - 0.055f;
+            values[i] = static_cast<uint8_t>(std::clamp(c * 255.f + 0.5f, 0.f, 255.f));
+        }
+        return values;
+    }();
+    return table;
+}
+
+uint32_t GetMipLevelCount(uint32_t width, uint32_t height)
+{
+    return static_cast<uint32_t>(std::bit_width(std::max({width, height, 1u})));
+}
+
+static Resource::Image Downsample(const Resource::Image &source)
+{
+    const auto &toLinear = GetSrgbToLinearTable();
+    const auto &toSrgb = GetLinearToSrgbTable();
+
+    Resource::Image level;
+    level.width = std::max(source.width / 2, 1u);
+    level.height = std::max(source.height / 2, 1u);
+    level.channels = 4;
+    level.pixels.resize(size_t{level.width} * level.height);
+
+    for (uint32_t y = 0; y < level.height; ++y)
+    {
+        // Odd sizes drop the last row or column, except when the source is a single texel wide.
+        const uint32_t y0 = std::min(y * 2, source.height - 1);
+        const uint32_t y1 = std::min(y * 2 + 1, source.height - 1);
+        for (uint32_t x = 0; x < level.width; ++x)
+        {
+            const uint32_t x0 = std::min(x * 2, source.width - 1);
+            const uint32_t x1 = std::min(x * 2 + 1, source.width - 1);
+            const std::array<glm::u8vec4, 4> texels = {
+                source.pixels[size_t{y0} * source.width + x0], source.pixels[size_t{y0} * source.width + x1],
+                source.pixels[size_t{y1} * source.width + x0], source.pixels[size_t{y1} * source.width + x1]};
+
+            glm::u8vec4 result;
+            for (int channel = 0; channel < 3; ++channel)
+            {
+                float sum = 0.f;
+                for (const auto &texel : texels)
+                    sum += toLinear[texel[channel]];
+                const auto index = static_cast<uint32_t>(sum * 0.25f * (LINEAR_TO_SRGB_TABLE_SIZE - 1) + 0.5f);
+                result[channel] = toSrgb[std::min(index, LINEAR_TO_SRGB_TABLE_SIZE - 1)];
+            }
+            const uint32_t alpha = texels[0].a + texels[1].a + texels[2].a + texels[3].a;
+            result.a = static_cast<uint8_t>((alpha + 2) / 4);
+            level.pixels[size_t{y} * level.width + x] = result;
+        }
+    }
+    return level;
+}
+
+std::vector<Resource::Image> GenerateMipChain(const Resource::Image &image)
+{
+    std::vector<Resource::Image> levels;
+    const uint32_t levelCount = GetMipLevelCount(image.width, image.height);
+    if (levelCount <= 1 || image.pixels.size() != size_t{image.width} * image.height)
+        return levels;
+
+    levels.reserve(levelCount - 1);
+    levels.push_back(Downsample(image));
+    while (levels.size() < levelCount - 1)
+    {
+        levels.push_back(Downsample(levels.back()));
+    }
+    return levels;
+}
+
+} // namespace Graphic::Utils
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "resource/Image.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace Graphic::Utils {
+
+/**
+ * @brief Number of mip levels of a full chain for the given size, down to 1x1.
+ */
+uint32_t GetMipLevelCount(uint32_t width, uint32_t height);
+
+/**
+ * @brief Downsample an sRGB image into its mip levels 1 to GetMipLevelCount - 1 (level 0 is the image itself).
+ *
+ * Each level averages 2x2 texels of the previous one. Color channels are averaged in linear space, so a minified
+ * checkerboard does not darken, alpha is averaged as is.
+ */
+std::vector<Resource::Image> GenerateMipChain(const Resource::Image &image);
+
+} // namespace Graphic::Utils
@@ -0,0 +1,101 @@
+#include "utils/MappedFileWriter.hpp"
+#include "Logger.hpp"
+#include "exception/FileWritingError.hpp"
+#include <algorithm>
+#include <cstring>
+#ifndef _WIN32
+#    include <cerrno>
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+namespace Graphic::Utils {
+
+#ifdef _WIN32
+
+MappedFileWriter::MappedFileWriter(const std::filesystem::path &path, uint64_t growSize)
+    : _path(path), _growSize(growSize), _stream(path, std::ios::binary | std::ios::trunc)
+{
+    if (!_stream)
+        throw Exception::FileWritingError(fmt::format("Failed to open '{}' for writing.", path.string()));
+}
+
+void MappedFileWriter::Write(const void *data, uint64_t size)
+{
+    _stream.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+    if (!_stream)
+        throw Exception::FileWritingError(fmt::format("Failed to write to '{}'.", _path.string()));
+    _size += size;
+}
+
+void MappedFileWriter::Close()
+{
+    if (_stream.is_open())
+        _stream.close();
+}
+
+#else
+
+MappedFileWriter::MappedFileWriter(const std::filesystem::path &path, uint64_t growSize)
+    : _path(path), _growSize(std::max<uint64_t>(growSize, 1))
+{
+    _fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (_fd < 0)
+        throw Exception::FileWritingError(
+            fmt::format("Failed to open '{}' for writing: {}", path.string(), std::strerror(errno)));
+}
+
+void MappedFileWriter::Write(const void *data, uint64_t size)
+{
+    if (_fd < 0)
+        throw Exception::FileWritingError(fmt::format("Cannot write to '{}', it is closed.", _path.string()));
+    if (_size + size > _capacity)
+    {
+        const uint64_t chunks = (_size + size + _growSize - 1) / _growSize;
+        _Reserve(chunks * _growSize);
+    }
+    std::memcpy(_mapping + _size, data, size);
+    _size += size;
+}
+
+void MappedFileWriter::Close()
+{
+    if (_fd < 0)
+        return;
+    if (_mapping != nullptr)
+    {
+        ::munmap(_mapping, _capacity);
+        _mapping = nullptr;
+    }
+    // The file was grown by whole chunks, drop the unwritten tail.
+    if (::ftruncate(_fd, static_cast<off_t>(_size)) != 0)
+        Log::Warning(
+            fmt::format("MappedFileWriter: Failed to truncate '{}': {}", _path.string(), std::strerror(errno)));
+    ::close(_fd);
+    _fd = -1;
+    _capacity = 0;
+}
+
+void MappedFileWriter::_Reserve(uint64_t capacity)
+{
+    if (::ftruncate(_fd, static_cast<off_t>(capacity)) != 0)
+        throw Exception::FileWritingError(
+            fmt::format("Failed to grow '{}' to {} bytes: {}", _path.string(), capacity, std::strerror(errno)));
+    if (_mapping != nullptr)
+        ::munmap(_mapping, _capacity);
+    void *mapping = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if (mapping == MAP_FAILED)
+    {
+        _mapping = nullptr;
+        _capacity = 0;
+        throw Exception::FileWritingError(
+            fmt::format("Failed to map '{}': {}", _path.string(), std::strerror(errno)));
+    }
+    _mapping = static_cast<uint8_t *>(mapping);
+    _capacity = capacity;
+}
+
+#endif
+
+} // namespace Graphic::Utils
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#ifdef _WIN32
+#    include <fstream>
+#endif
+
+namespace Graphic::Utils {
+
+/**
+ * @brief Append-only file written through a memory mapping grown by chunks.
+ *
+ * Appending is a memcpy into the mapping: the kernel writes pages back in the background. The file is truncated to
+ * the written size when closed. Without POSIX mappings (Windows), a buffered stream is used instead.
+ *
+ * @throws Exception::FileWritingError if the file cannot be created, grown or mapped.
+ */
+class MappedFileWriter {
+  public:
+    static inline constexpr uint64_t DEFAULT_GROW_SIZE = 256ull << 20;
+
+    explicit MappedFileWriter(const std::filesystem::path &path, uint64_t growSize = DEFAULT_GROW_SIZE);
+    ~MappedFileWriter() { Close(); }
+
+    MappedFileWriter(const MappedFileWriter &) = delete;
+    MappedFileWriter &operator=(const MappedFileWriter &) = delete;
+    MappedFileWriter(MappedFileWriter &&) = delete;
+    MappedFileWriter &operator=(MappedFileWriter &&) = delete;
+
+    void Write(const void *data, uint64_t size);
+    void Close();
+
+    [[nodiscard]] uint64_t GetSize() const { return _size; }
+
+  private:
+    std::filesystem::path _path;
+    uint64_t _growSize;
+    uint64_t _size = 0;
+#ifdef _WIN32
+    std::ofstream _stream;
+#else
+    void _Reserve(uint64_t capacity);
+
+    int _fd = -1;
+    uint8_t *_mapping = nullptr;
+    uint64_t _capacity = 0;
+#endif
+};
+
+} // namespace Graphic::Utils
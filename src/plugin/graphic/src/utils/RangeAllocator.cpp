@@ -0,0 +1,90 @@
+#include "utils/RangeAllocator.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <fmt/format.h>
+#include <iterator>
+
+namespace Graphic::Utils {
+
+std::optional<uint64_t> RangeAllocator::Allocate(uint64_t size)
+{
+    if (size == 0)
+        return 0;
+
+    auto best = _freeBlocks.end();
+    for (auto it = _freeBlocks.begin(); it != _freeBlocks.end(); ++it)
+    {
+        if (it->second >= size && (best == _freeBlocks.end() || it->second < best->second))
+        {
+            best = it;
+            if (best->second == size)
+                break;
+        }
+    }
+
+    if (best == _freeBlocks.end())
+        return std::nullopt;
+
+    const uint64_t offset = best->first;
+    const uint64_t remaining = best->second - size;
+    _freeBlocks.erase(best);
+    if (remaining > 0)
+        _freeBlocks.emplace(offset + size, remaining);
+    _usedSize += size;
+    return offset;
+}
+
+void RangeAllocator::Free(uint64_t offset, uint64_t size)
+{
+    if (size == 0)
+        return;
+
+    if (offset + size > _capacity)
+    {
+        Log::Error(fmt::format("RangeAllocator: Cannot free range [{}, {}) outside of capacity {}.", offset,
+                               offset + size, _capacity));
+        return;
+    }
+
+    auto next = _freeBlocks.lower_bound(offset);
+    auto previous = next == _freeBlocks.begin() ? _freeBlocks.end() : std::prev(next);
+    if ((next != _freeBlocks.end() && next->first < offset + size) ||
+        (previous != _freeBlocks.end() && previous->first + previous->second > offset))
+    {
+        Log::Error(fmt::format("RangeAllocator: Range [{}, {}) overlaps a free block.", offset, offset + size));
+        return;
+    }
+
+    _usedSize -= size;
+
+    if (next != _freeBlocks.end() && offset + size == next->first)
+    {
+        size += next->second;
+        _freeBlocks.erase(next);
+    }
+    if (previous != _freeBlocks.end() && previous->first + previous->second == offset)
+    {
+        previous->second += size;
+        return;
+    }
+    _freeBlocks.emplace(offset, size);
+}
+
+void RangeAllocator::Reset(uint64_t capacity)
+{
+    _capacity = capacity;
+    _usedSize = 0;
+    _freeBlocks.clear();
+    if (capacity > 0)
+        _freeBlocks.emplace(0, capacity);
+}
+
+uint64_t RangeAllocator::GetLargestFreeBlock() const
+{
+    uint64_t largest = 0;
+    for (const auto &[offset, size] : _freeBlocks)
+        largest = std::max(largest, size);
+    return largest;
+}
+
+} // namespace Graphic::Utils
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <optional>
+
+namespace Graphic::Utils {
+
+/**
+ * @brief Free-list allocator handing out [offset, offset + size) ranges inside a fixed capacity.
+ *
+ * It only does the bookkeeping: the memory itself (usually a GPU buffer) is owned by the caller. Free blocks are kept
+ * sorted by offset so that freeing a range merges it with its neighbours, and allocation picks the smallest free
+ * block that fits to limit fragmentation. Units are up to the caller (bytes, vertices, indices...).
+ */
+class RangeAllocator {
+  public:
+    explicit RangeAllocator(uint64_t capacity = 0) { Reset(capacity); }
+    ~RangeAllocator() = default;
+
+    /**
+     * @brief Allocate a range of the given size.
+     *
+     * @return the offset of the range, or std::nullopt if no free block is large enough.
+     * @note Zero-sized allocations always succeed and return offset 0 without reserving anything.
+     */
+    [[nodiscard]] std::optional<uint64_t> Allocate(uint64_t size);
+
+    /**
+     * @brief Give back a range previously returned by Allocate.
+     */
+    void Free(uint64_t offset, uint64_t size);
+
+    /**
+     * @brief Drop every allocation and set a new capacity.
+     */
+    void Reset(uint64_t capacity);
+
+    [[nodiscard]] uint64_t GetCapacity() const { return _capacity; }
+    [[nodiscard]] uint64_t GetUsedSize() const { return _usedSize; }
+    [[nodiscard]] uint64_t GetFreeSize() const { return _capacity - _usedSize; }
+    [[nodiscard]] uint64_t GetLargestFreeBlock() const;
+    [[nodiscard]] size_t GetFreeBlockCount() const { return _freeBlocks.size(); }
+
+  private:
+    std::map<uint64_t /* offset */, uint64_t /* size */> _freeBlocks;
+    uint64_t _capacity = 0;
+    uint64_t _usedSize = 0;
+};
+
+} // namespace Graphic::Utils
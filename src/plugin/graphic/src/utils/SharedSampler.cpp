@@ -0,0 +1,48 @@
+#include "utils/SharedSampler.hpp"
+#include "Logger.hpp"
+#include "resource/DeviceContext.hpp"
+#include "resource/Sampler.hpp"
+#include "resource/SamplerContainer.hpp"
+#include <bit>
+#include <string>
+
+namespace Graphic::Utils {
+
+uint64_t HashSamplerDescriptor(const wgpu::SamplerDescriptor &descriptor)
+{
+    uint64_t hash = 0;
+    for (uint64_t part :
+         {static_cast<uint64_t>(descriptor.addressModeU), static_cast<uint64_t>(descriptor.addressModeV),
+          static_cast<uint64_t>(descriptor.addressModeW), static_cast<uint64_t>(descriptor.magFilter),
+          static_cast<uint64_t>(descriptor.minFilter), static_cast<uint64_t>(descriptor.mipmapFilter),
+          static_cast<uint64_t>(std::bit_cast<uint32_t>(descriptor.lodMinClamp)),
+          static_cast<uint64_t>(std::bit_cast<uint32_t>(descriptor.lodMaxClamp)),
+          static_cast<uint64_t>(descriptor.compare), static_cast<uint64_t>(descriptor.maxAnisotropy)})
+    {
+        hash ^= part + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
+entt::hashed_string GetSharedSampler(Engine::Core &core, const wgpu::SamplerDescriptor &descriptor)
+{
+    auto &samplerContainer = core.GetResource<Resource::SamplerContainer>();
+    const std::string name = fmt::format("SAMPLER_{:016x}", HashSamplerDescriptor(descriptor));
+    entt::hashed_string samplerId{name.data(), name.size()};
+
+    if (!samplerContainer.Contains(samplerId))
+    {
+        const auto &device = core.GetResource<Resource::DeviceContext>().GetDevice();
+        if (!device.has_value())
+        {
+            Log::Error("Graphic::Utils::GetSharedSampler: Graphic device not found");
+            return samplerId;
+        }
+        wgpu::SamplerDescriptor samplerDesc = descriptor;
+        samplerDesc.label = wgpu::StringView(name);
+        samplerContainer.Add(samplerId, Resource::Sampler(device.value(), samplerDesc));
+    }
+    return samplerId;
+}
+
+} // namespace Graphic::Utils
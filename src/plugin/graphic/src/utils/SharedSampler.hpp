@@ -0,0 +1,23 @@
+#pragma once
+
+#include "core/Core.hpp"
+#include "utils/webgpu.hpp"
+#include <cstdint>
+#include <entt/core/hashed_string.hpp>
+
+namespace Graphic::Utils {
+
+/**
+ * @brief Hash every field of a sampler descriptor but its label.
+ */
+uint64_t HashSamplerDescriptor(const wgpu::SamplerDescriptor &descriptor);
+
+/**
+ * @brief Get the id of the sampler created from the descriptor, adding it to the SamplerContainer on first use.
+ *
+ * Samplers are shared by descriptor: the id is "SAMPLER_<hash>", so every user asking for the same filtering and
+ * addressing binds the same sampler instead of creating its own.
+ */
+entt::hashed_string GetSharedSampler(Engine::Core &core, const wgpu::SamplerDescriptor &descriptor);
+
+} // namespace Graphic::Utils
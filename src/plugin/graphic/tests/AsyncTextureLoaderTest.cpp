@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
+#include "Graphic.hpp"
+#include "RenderingPipeline.hpp"
+
+void LoadTextureInBackgroundTest(Engine::Core &core)
+{
+    std::string testAssetPath = std::filesystem::current_path().string() + "/assets/test_texture.png";
+    auto &loader = core.GetResource<Graphic::Resource::AsyncTextureLoader>();
+    auto &textureContainer = core.GetResource<Graphic::Resource::TextureContainer>();
+    auto &deviceContext = core.GetResource<Graphic::Resource::DeviceContext>();
+    auto &queue = core.GetResource<Graphic::Resource::Queue>();
+
+    loader.Load(testAssetPath);
+    loader.Load(testAssetPath);
+    EXPECT_TRUE(loader.IsPending(testAssetPath));
+    EXPECT_EQ(loader.GetPendingCount(), 1u);
+
+    loader.Flush(core);
+
+    EXPECT_FALSE(loader.IsPending(testAssetPath));
+    EXPECT_TRUE(loader.IsResident(testAssetPath));
+    ASSERT_TRUE(textureContainer.Contains(testAssetPath));
+
+    Graphic::Resource::Image expected(testAssetPath);
+    auto data = textureContainer.Get(testAssetPath).RetrieveImage(deviceContext, queue);
+    EXPECT_EQ(data.pixels, expected.pixels);
+}
+
+void LoadMissingTextureTest(Engine::Core &core)
+{
+    auto &loader = core.GetResource<Graphic::Resource::AsyncTextureLoader>();
+
+    loader.Load("missing_texture.png");
+    loader.Flush(core);
+
+    EXPECT_TRUE(loader.HasFailed("missing_texture.png"));
+    EXPECT_FALSE(core.GetResource<Graphic::Resource::TextureContainer>().Contains("missing_texture.png"));
+}
+
+void UploadBudgetTest(Engine::Core &core)
+{
+    std::string testAssetPath = std::filesystem::current_path().string() + "/assets/test_texture.png";
+    std::string copyPath = std::filesystem::current_path().string() + "/async_loader_copy.png";
+    std::filesystem::copy_file(testAssetPath, copyPath, std::filesystem::copy_options::overwrite_existing);
+
+    Graphic::Resource::AsyncTextureLoader loader(2);
+    loader.SetUploadBudget(1);
+    loader.Load(testAssetPath);
+    loader.Load(copyPath);
+    while (loader.GetReadyCount() < 2)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    // A single texture exceeds the budget, but one upload per frame is always allowed.
+    loader.Update(core);
+    EXPECT_EQ(loader.GetPendingCount(), 1u);
+    loader.Update(core);
+    EXPECT_EQ(loader.GetPendingCount(), 0u);
+    EXPECT_TRUE(loader.IsResident(testAssetPath));
+    EXPECT_TRUE(loader.IsResident(copyPath));
+
+    loader.Stop();
+    std::filesystem::remove(copyPath);
+}
+
+TEST(AsyncTextureLoader, LoadsTextureInBackground)
+{
+    Engine::Core core;
+
+    core.AddPlugins<Graphic::Plugin>();
+
+    core.RegisterSystem<RenderingPipeline::Init>([](Engine::Core &c) {
+        c.GetResource<Graphic::Resource::GraphicSettings>().SetWindowSystem(Graphic::Resource::WindowSystem::None);
+    });
+
+    core.RegisterSystem(LoadTextureInBackgroundTest);
+
+    EXPECT_NO_THROW(core.RunSystems());
+}
+
+TEST(AsyncTextureLoader, MissingTextureFails)
+{
+    Engine::Core core;
+
+    core.AddPlugins<Graphic::Plugin>();
+
+    core.RegisterSystem<RenderingPipeline::Init>([](Engine::Core &c) {
+        c.GetResource<Graphic::Resource::GraphicSettings>().SetWindowSystem(Graphic::Resource::WindowSystem::None);
+    });
+
+    core.RegisterSystem(LoadMissingTextureTest);
+
+    EXPECT_NO_THROW(core.RunSystems());
+}
+
+TEST(AsyncTextureLoader, UploadsWithinBudget)
+{
+    Engine::Core core;
+
+    core.AddPlugins<Graphic::Plugin>();
+
+    core.RegisterSystem<RenderingPipeline::Init>([](Engine::Core &c) {
+        c.GetResource<Graphic::Resource::GraphicSettings>().SetWindowSystem(Graphic::Resource::WindowSystem::None);
+    });
+
+    core.RegisterSystem(UploadBudgetTest);
+
+    EXPECT_NO_THROW(core.RunSystems());
+}
+
+TEST(AsyncTextureLoader, StopDiscardsQueuedImages)
+{
+    std::string testAssetPath = std::filesystem::current_path().string() + "/assets/test_texture.png";
+    Graphic::Resource::AsyncTextureLoader loader(1);
+    loader.Load(testAssetPath);
+    loader.Load("missing_texture.png");
+    while (loader.GetReadyCount() < 1)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    loader.Stop();
+
+    EXPECT_EQ(loader.GetPendingCount(), 0u);
+    EXPECT_EQ(loader.GetReadyCount(), 0u);
+    EXPECT_FALSE(loader.IsPending(testAssetPath));
+    EXPECT_FALSE(loader.IsResident(testAssetPath));
+
+    loader.Load(testAssetPath);
+    EXPECT_FALSE(loader.IsPending(testAssetPath));
+}
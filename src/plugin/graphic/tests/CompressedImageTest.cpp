@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include "exception/FileReadingError.hpp"
+#include "exception/UnsupportedTextureFormatError.hpp"
+#include "resource/CompressedImage.hpp"
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace {
+
+void Append32(std::vector<uint8_t> &data, uint32_t value)
+{
+    for (int i = 0; i < 4; ++i)
+        data.push_back(static_cast<uint8_t>(value >> (8 * i)));
+}
+
+void Append64(std::vector<uint8_t> &data, uint64_t value)
+{
+    for (int i = 0; i < 8; ++i)
+        data.push_back(static_cast<uint8_t>(value >> (8 * i)));
+}
+
+std::filesystem::path WriteFile(const std::string &name, const std::vector<uint8_t> &data)
+{
+    auto path = std::filesystem::temp_directory_path() / name;
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+    return path;
+}
+
+/** @brief DDS file of an 8x8 texture with its 4x4, 2x2 and 1x1 mips. */
+std::vector<uint8_t> BuildDDS(const char fourCC[4], size_t blockSize)
+{
+    std::vector<uint8_t> data;
+    Append32(data, 0x20534444);
+    Append32(data, 124);
+    Append32(data, 0x1 | 0x2 | 0x4 | 0x1000 | 0x20000); // caps, height, width, pixel format, mipmap count
+    Append32(data, 8);                                     // height
+    Append32(data, 8);                                     // width
+    Append32(data, 0);                                     // pitch
+    Append32(data, 0);                                     // depth
+    Append32(data, 4);                                     // mipmap count
+    data.resize(data.size() + 11 * 4);                     // reserved
+    Append32(data, 32);                                    // pixel format size
+    Append32(data, 0x4);                                   // DDPF_FOURCC
+    data.insert(data.end(), fourCC, fourCC + 4);
+    data.resize(data.size() + 5 * 4 + 5 * 4); // masks, caps and reserved
+
+    // 4 blocks for level 0, then one block for each smaller level.
+    for (size_t block = 0; block < 4 + 3; ++block)
+        data.insert(data.end(), blockSize, static_cast<uint8_t>(block));
+    return data;
+}
+
+} // namespace
+
+TEST(CompressedImage, ReadsDDSMipLevels)
+{
+    auto path = WriteFile("CompressedImageTest.dds", BuildDDS("DXT1", 8));
+
+    Graphic::Resource::CompressedImage image(path);
+
+    EXPECT_EQ(image.format, wgpu::TextureFormat::BC1RGBAUnormSrgb);
+    EXPECT_EQ(image.width, 8u);
+    EXPECT_EQ(image.height, 8u);
+    ASSERT_EQ(image.levels.size(), 4u);
+    EXPECT_EQ(image.levels[0].size, 32u);
+    EXPECT_EQ(image.levels[1].width, 4u);
+    EXPECT_EQ(image.levels[1].offset, image.levels[0].offset + 32);
+    EXPECT_EQ(image.levels[3].width, 1u);
+    EXPECT_EQ(image.levels[3].size, 8u);
+    EXPECT_EQ(image.data[image.levels[3].offset], 6);
+    std::filesystem::remove(path);
+}
+
+TEST(CompressedImage, ReadsKTX2)
+{
+    std::vector<uint8_t> data = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A};
+    Append32(data, 145); // VK_FORMAT_BC7_UNORM_BLOCK
+    Append32(data, 1);   // type size
+    Append32(data, 4);   // width
+    Append32(data, 8);   // height
+    Append32(data, 0);   // depth
+    Append32(data, 0);   // layers
+    Append32(data, 1);   // faces
+    Append32(data, 2);   // levels
+    Append32(data, 0);   // supercompression
+    data.resize(80);     // data format and key/value descriptors are unused
+    // Levels are stored smallest first, the index points to them.
+    Append64(data, 144);
+    Append64(data, 32);
+    Append64(data, 32);
+    Append64(data, 128);
+    Append64(data, 16);
+    Append64(data, 16);
+    data.resize(128, 0);
+    data.insert(data.end(), 16, 1);
+    data.insert(data.end(), 32, 2);
+    auto path = WriteFile("CompressedImageTest.ktx2", data);
+
+    Graphic::Resource::CompressedImage image(path);
+
+    EXPECT_EQ(image.format, wgpu::TextureFormat::BC7RGBAUnorm);
+    ASSERT_EQ(image.levels.size(), 2u);
+    EXPECT_EQ(image.levels[0].offset, 144u);
+    EXPECT_EQ(image.levels[0].size, 32u);
+    EXPECT_EQ(image.levels[1].width, 2u);
+    EXPECT_EQ(image.levels[1].height, 4u);
+    EXPECT_EQ(image.levels[1].size, 16u);
+    EXPECT_EQ(image.data[image.levels[1].offset], 1);
+    std::filesystem::remove(path);
+}
+
+TEST(CompressedImage, RejectsTruncatedFiles)
+{
+    auto data = BuildDDS("DXT5", 16);
+    data.resize(data.size() - 1);
+    auto path = WriteFile("CompressedImageTruncated.dds", data);
+
+    EXPECT_THROW(Graphic::Resource::CompressedImage image(path), Graphic::Exception::FileReadingError);
+    std::filesystem::remove(path);
+}
+
+TEST(CompressedImage, RejectsMoreLevelsThanTheMipChain)
+{
+    for (uint32_t levelCount : {5u, 40u})
+    {
+        auto data = BuildDDS("DXT1", 8);
+        // Enough data follows for the extra levels, only their count is invalid.
+        data.insert(data.end(), 8 * 64, 0);
+        for (size_t i = 0; i < 4; ++i)
+            data[28 + i] = static_cast<uint8_t>(levelCount >> (8 * i));
+        auto path = WriteFile("CompressedImageTooManyLevels.dds", data);
+
+        EXPECT_THROW(Graphic::Resource::CompressedImage image(path), Graphic::Exception::FileReadingError);
+        std::filesystem::remove(path);
+    }
+}
+
+TEST(CompressedImage, RejectsUnsupportedFormats)
+{
+    auto path = WriteFile("CompressedImageUnsupported.dds", BuildDDS("ETC2", 16));
+
+    EXPECT_THROW(Graphic::Resource::CompressedImage image(path), Graphic::Exception::UnsupportedTextureFormatError);
+    std::filesystem::remove(path);
+}
+
+TEST(CompressedImage, RecognizesContainerExtensions)
+{
+    EXPECT_TRUE(Graphic::Resource::CompressedImage::IsCompressedImageFile("texture.KTX2"));
+    EXPECT_TRUE(Graphic::Resource::CompressedImage::IsCompressedImageFile("dir/texture.dds"));
+    EXPECT_FALSE(Graphic::Resource::CompressedImage::IsCompressedImageFile("texture.png"));
+}
@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include "exception/UnsupportedTextureFormatError.hpp"
+#include "utils/ConvertTexelsToRGBA8.hpp"
+#include <cstring>
+#include <vector>
+
+TEST(ConvertTexelsToRGBA8, CopiesRGBA8)
+{
+    std::vector<uint8_t> source = {1, 2, 3, 4, 5, 6, 7, 8};
+    std::vector<glm::u8vec4> pixels(2);
+
+    Graphic::Utils::ConvertTexelsToRGBA8(wgpu::TextureFormat::RGBA8Unorm, source.data(), pixels.data(), 2);
+
+    EXPECT_EQ(pixels[0], glm::u8vec4(1, 2, 3, 4));
+    EXPECT_EQ(pixels[1], glm::u8vec4(5, 6, 7, 8));
+}
+
+TEST(ConvertTexelsToRGBA8, SwizzlesBGRA8)
+{
+    // 7 texels: one full SIMD block and a scalar tail.
+    std::vector<uint8_t> source;
+    for (uint8_t i = 0; i < 7; ++i)
+    {
+        source.insert(source.end(), {static_cast<uint8_t>(i * 10), static_cast<uint8_t>(i * 10 + 1),
+                                     static_cast<uint8_t>(i * 10 + 2), static_cast<uint8_t>(i * 10 + 3)});
+    }
+    std::vector<glm::u8vec4> pixels(7);
+
+    Graphic::Utils::ConvertTexelsToRGBA8(wgpu::TextureFormat::BGRA8Unorm, source.data(), pixels.data(), 7);
+
+    for (uint8_t i = 0; i < 7; ++i)
+    {
+        EXPECT_EQ(pixels[i], glm::u8vec4(i * 10 + 2, i * 10 + 1, i * 10, i * 10 + 3));
+    }
+}
+
+TEST(ConvertTexelsToRGBA8, ClampsRGBA16Float)
+{
+    // Half floats: 0.0, 0.5, 1.0 and 2.0 (clamped to 1.0).
+    std::vector<uint16_t> source = {0x0000, 0x3800, 0x3C00, 0x4000};
+    std::vector<glm::u8vec4> pixels(1);
+
+    Graphic::Utils::ConvertTexelsToRGBA8(wgpu::TextureFormat::RGBA16Float,
+                                         reinterpret_cast<const uint8_t *>(source.data()), pixels.data(), 1);
+
+    EXPECT_EQ(pixels[0], glm::u8vec4(0, 127, 255, 255));
+}
+
+TEST(ConvertTexelsToRGBA8, MapsDepthToGrayscale)
+{
+    std::vector<float> source = {0.0f, 1.0f, 0.5f, -1.0f, 3.0f};
+    std::vector<glm::u8vec4> pixels(source.size());
+
+    Graphic::Utils::ConvertTexelsToRGBA8(wgpu::TextureFormat::Depth32Float,
+                                         reinterpret_cast<const uint8_t *>(source.data()), pixels.data(),
+                                         static_cast<uint32_t>(source.size()));
+
+    EXPECT_EQ(pixels[0], glm::u8vec4(0, 0, 0, 255));
+    EXPECT_EQ(pixels[1], glm::u8vec4(255, 255, 255, 255));
+    EXPECT_EQ(pixels[2], glm::u8vec4(127, 127, 127, 255));
+    EXPECT_EQ(pixels[3], glm::u8vec4(0, 0, 0, 255));
+    EXPECT_EQ(pixels[4], glm::u8vec4(255, 255, 255, 255));
+}
+
+TEST(ConvertTexelsToRGBA8, ThrowsOnUnsupportedFormat)
+{
+    uint8_t source[4] = {};
+    glm::u8vec4 pixel;
+
+    EXPECT_THROW(Graphic::Utils::ConvertTexelsToRGBA8(wgpu::TextureFormat::R8Unorm, source, &pixel, 1),
+                 Graphic::Exception::UnsupportedTextureFormatError);
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include "Graphic.hpp"
+#include "RenderingPipeline.hpp"
+#include <filesystem>
+#include <fstream>
+
+void FrameCaptureRawFileTest(Engine::Core &core)
+{
+    auto &deviceContext = core.GetResource<Graphic::Resource::DeviceContext>();
+    auto &queue = core.GetResource<Graphic::Resource::Queue>();
+    auto &textures = core.GetResource<Graphic::Resource::TextureContainer>();
+    Graphic::Resource::Image image({16, 8}, [](glm::uvec2 pos) {
+        return glm::u8vec4(static_cast<uint8_t>(pos.x), static_cast<uint8_t>(pos.y), 0, 255);
+    });
+    textures.Remove(Graphic::Utils::END_RENDER_TEXTURE_ID);
+    textures.Add(Graphic::Utils::END_RENDER_TEXTURE_ID,
+                 Graphic::Resource::Texture(deviceContext, queue, "end_render_texture", image));
+
+    const auto path = std::filesystem::temp_directory_path() / "FrameCaptureTest.raw";
+    auto &frameCapture = core.GetResource<Graphic::Resource::FrameCapture>();
+    frameCapture.SetDropFramesWhenBusy(false);
+    frameCapture.StartRawFile(path);
+    for (int frame = 0; frame < 5; ++frame)
+    {
+        frameCapture.Capture(core);
+    }
+    frameCapture.Stop(core);
+
+    EXPECT_FALSE(frameCapture.IsCapturing());
+    const uint64_t frameSize = 16 * 8 * sizeof(glm::u8vec4);
+    ASSERT_EQ(std::filesystem::file_size(path), 5 * frameSize);
+
+    std::ifstream file(path, std::ios::binary);
+    std::vector<glm::u8vec4> lastFrame(16 * 8);
+    file.seekg(static_cast<std::streamoff>(4 * frameSize));
+    file.read(reinterpret_cast<char *>(lastFrame.data()), static_cast<std::streamsize>(frameSize));
+    EXPECT_EQ(lastFrame, image.pixels);
+    file.close();
+    std::filesystem::remove(path);
+}
+
+void FrameCapturePngSequenceTest(Engine::Core &core)
+{
+    auto &deviceContext = core.GetResource<Graphic::Resource::DeviceContext>();
+    auto &queue = core.GetResource<Graphic::Resource::Queue>();
+    auto &textures = core.GetResource<Graphic::Resource::TextureContainer>();
+    Graphic::Resource::Image image({16, 8}, [](glm::uvec2 pos) {
+        return glm::u8vec4(static_cast<uint8_t>(pos.x * 16), static_cast<uint8_t>(pos.y * 32), 64, 255);
+    });
+    textures.Remove(Graphic::Utils::END_RENDER_TEXTURE_ID);
+    textures.Add(Graphic::Utils::END_RENDER_TEXTURE_ID,
+                 Graphic::Resource::Texture(deviceContext, queue, "end_render_texture", image));
+
+    const auto directory = std::filesystem::temp_directory_path() / "FrameCapturePngTest";
+    std::filesystem::remove_all(directory);
+    auto &frameCapture = core.GetResource<Graphic::Resource::FrameCapture>();
+    frameCapture.SetDropFramesWhenBusy(false);
+    frameCapture.StartPngSequence(directory, "capture");
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        frameCapture.Capture(core);
+    }
+    frameCapture.Stop(core);
+
+    EXPECT_FALSE(frameCapture.IsCapturing());
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        const auto path = directory / fmt::format("capture_{:06}.png", frame);
+        ASSERT_TRUE(std::filesystem::exists(path)) << path;
+        Graphic::Resource::Image written(path);
+        EXPECT_EQ(written.width, 16u);
+        EXPECT_EQ(written.height, 8u);
+        EXPECT_EQ(written.pixels, image.pixels);
+    }
+    EXPECT_FALSE(std::filesystem::exists(directory / "capture_000003.png"));
+    std::filesystem::remove_all(directory);
+}
+
+TEST(FrameCapture, RawFileContainsEveryFrame)
+{
+    Engine::Core core;
+
+    core.AddPlugins<Graphic::Plugin>();
+
+    core.RegisterSystem<RenderingPipeline::Init>([](Engine::Core &c) {
+        c.GetResource<Graphic::Resource::GraphicSettings>().SetWindowSystem(Graphic::Resource::WindowSystem::None);
+    });
+
+    core.RegisterSystem(FrameCaptureRawFileTest);
+
+    EXPECT_NO_THROW(core.RunSystems());
+}
+
+TEST(FrameCapture, PngSequenceContainsEveryFrame)
+{
+    Engine::Core core;
+
+    core.AddPlugins<Graphic::Plugin>();
+
+    core.RegisterSystem<RenderingPipeline::Init>([](Engine::Core &c) {
+        c.GetResource<Graphic::Resource::GraphicSettings>().SetWindowSystem(Graphic::Resource::WindowSystem::None);
+    });
+
+    core.RegisterSystem(FrameCapturePngSequenceTest);
+
+    EXPECT_NO_THROW(core.RunSystems());
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include "utils/FrameWriter.hpp"
+#include "utils/MappedFileWriter.hpp"
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+
+static Graphic::Resource::Image CreateFrame(uint8_t value)
+{
+    Graphic::Resource::Image image;
+    image.width = 2;
+    image.height = 2;
+    image.channels = 4;
+    image.pixels.assign(4, glm::u8vec4(value, value, value, 255));
+    return image;
+}
+
+TEST(FrameWriter, WritesEveryFrameWithItsIndex)
+{
+    std::mutex mutex;
+    std::set<uint64_t> indices;
+    {
+        Graphic::Utils::FrameWriter writer(
+            [&](const Graphic::Resource::Image &image, uint64_t frameIndex) {
+                std::scoped_lock lock(mutex);
+                EXPECT_EQ(image.pixels[0].x, static_cast<uint8_t>(frameIndex));
+                indices.insert(frameIndex);
+            },
+            2, 3);
+        for (uint8_t i = 0; i < 10; ++i)
+        {
+            EXPECT_TRUE(writer.Push(CreateFrame(i), true));
+        }
+        writer.Stop();
+        EXPECT_EQ(writer.GetWrittenFrameCount(), 10u);
+    }
+    EXPECT_EQ(indices.size(), 10u);
+}
+
+TEST(FrameWriter, DropsFramesWhenFull)
+{
+    std::promise<void> started;
+    std::promise<void> released;
+    std::shared_future<void> release = released.get_future().share();
+    Graphic::Utils::FrameWriter writer(
+        [&](const Graphic::Resource::Image &, uint64_t frameIndex) {
+            if (frameIndex == 0)
+                started.set_value();
+            release.wait();
+        },
+        1, 1);
+
+    // The first frame is taken by the thread (blocked), the second fills the queue.
+    EXPECT_TRUE(writer.Push(CreateFrame(0), false));
+    started.get_future().wait();
+    EXPECT_TRUE(writer.Push(CreateFrame(1), false));
+    EXPECT_FALSE(writer.Push(CreateFrame(2), false));
+
+    released.set_value();
+    writer.Stop();
+    EXPECT_EQ(writer.GetWrittenFrameCount(), 2u);
+}
+
+TEST(FrameWriter, CountsFailedFrames)
+{
+    Graphic::Utils::FrameWriter writer(
+        [](const Graphic::Resource::Image &, uint64_t frameIndex) {
+            if (frameIndex == 1)
+                throw std::runtime_error("disk full");
+        },
+        4, 1);
+
+    writer.Push(CreateFrame(0), true);
+    writer.Push(CreateFrame(1), true);
+    writer.Push(CreateFrame(2), true);
+    writer.Stop();
+
+    EXPECT_EQ(writer.GetWrittenFrameCount(), 2u);
+    EXPECT_EQ(writer.GetFailedFrameCount(), 1u);
+}
+
+TEST(MappedFileWriter, AppendsAcrossGrowth)
+{
+    const auto path = std::filesystem::temp_directory_path() / "MappedFileWriterTest.raw";
+    std::vector<uint8_t> data(100);
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<uint8_t>(i);
+
+    {
+        Graphic::Utils::MappedFileWriter writer(path, 64);
+        writer.Write(data.data(), 40);
+        writer.Write(data.data() + 40, 60);
+        EXPECT_EQ(writer.GetSize(), 100u);
+    }
+
+    ASSERT_EQ(std::filesystem::file_size(path), 100u);
+    std::ifstream file(path, std::ios::binary);
+    std::vector<uint8_t> read(100);
+    file.read(reinterpret_cast<char *>(read.data()), static_cast<std::streamsize>(read.size()));
+    EXPECT_EQ(read, data);
+    file.close();
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include "Graphic.hpp"
+#include "RenderingPipeline.hpp"
+#include "utils/ConfigureHeadlessGraphics.hpp"
+#include "utils/ThrowErrorIfGraphicalErrorHappened.hpp"
+
+namespace {
+// Clears its output texture, the smallest pass that can be timed.
+class ClearRenderPass : public Graphic::Resource::ARenderPass {
+  public:
+    explicit ClearRenderPass(std::string_view name) : ARenderPass(name)
+    {
+        AddOutput(0, Graphic::Resource::ColorOutput("target"));
+    }
+
+    void Execute(Engine::Core &core) override { _RecordAndSubmit(core); }
+
+    bool SupportsRecording() const override { return true; }
+
+    void Record(wgpu::CommandEncoder &encoder, Engine::Core &core) override
+    {
+        auto &texture = core.GetResource<Graphic::Resource::TextureContainer>().Get("target");
+
+        wgpu::RenderPassColorAttachment colorAttachment(wgpu::Default);
+        colorAttachment.view = texture.GetDefaultView().GetWebGPUView();
+        colorAttachment.loadOp = wgpu::LoadOp::Clear;
+        colorAttachment.storeOp = wgpu::StoreOp::Store;
+        colorAttachment.clearValue = wgpu::Color{0.0, 0.0, 0.0, 1.0};
+
+        wgpu::RenderPassDescriptor renderPassDesc(wgpu::Default);
+        renderPassDesc.colorAttachmentCount = 1;
+        renderPassDesc.colorAttachments = &colorAttachment;
+        wgpu::RenderPassTimestampWrites timestampWrites;
+        _SetTimestampWrites(renderPassDesc, timestampWrites, true, true);
+
+        auto renderPass = encoder.beginRenderPass(renderPassDesc);
+        renderPass.end();
+        renderPass.release();
+    }
+};
+
+Graphic::Resource::RenderGraph CreateGraph(Engine::Core &core)
+{
+    Graphic::Resource::RenderGraph graph;
+    graph.Add("first", ClearRenderPass("first"));
+    graph.Add("second", ClearRenderPass("second"));
+    graph.SetDependency("first", "second");
+    graph.AddTransientTexture("target", {});
+    graph.ResizeTransientTextures(core, {16, 16});
+    return graph;
+}
+} // namespace
+
+TEST(GPUPassTimer, PassesAreTimedAFewFramesLater)
+{
+    Engine::Core core;
+    core.AddPlugins<Graphic::Plugin>();
+    core.SetErrorPolicyForAllSchedulers(Engine::Scheduler::SchedulerErrorPolicy::Nothing);
+    core.RegisterSystem<RenderingPipeline::Init>(Graphic::Tests::Utils::ConfigureHeadlessGraphics,
+                                                 Graphic::Tests::Utils::ThrowErrorIfGraphicalErrorHappened);
+    core.RunSystems();
+
+    auto graph = CreateGraph(core);
+    auto &device = core.GetResource<Graphic::Resource::DeviceContext>().GetDevice().value();
+    for (uint32_t frame = 0; frame < 16 && graph.GetLastGPUTimings().empty(); ++frame)
+    {
+        graph.Execute(core);
+        device.poll(true, nullptr);
+    }
+
+    if (!graph.IsGPUTimingSupported())
+    {
+        EXPECT_TRUE(graph.GetLastGPUTimings().empty());
+        GTEST_SKIP() << "The adapter does not support timestamp queries.";
+    }
+
+    const auto &timings = graph.GetLastGPUTimings();
+    ASSERT_EQ(timings.size(), 2u);
+    EXPECT_EQ(timings[0].name, "first");
+    EXPECT_EQ(timings[1].name, "second");
+    for (const auto &timing : timings)
+        EXPECT_GE(timing.milliseconds, 0.0);
+    EXPECT_TRUE(graph.GetPassGPUMilliseconds("first").has_value());
+    EXPECT_FALSE(graph.GetPassGPUMilliseconds("missing").has_value());
+}
+
+TEST(GPUPassTimer, NothingIsTimedWithoutTheFeature)
+{
+    Engine::Core core;
+    core.AddPlugins<Graphic::Plugin>();
+    core.SetErrorPolicyForAllSchedulers(Engine::Scheduler::SchedulerErrorPolicy::Nothing);
+    core.RegisterSystem<RenderingPipeline::Init>(Graphic::Tests::Utils::ConfigureHeadlessGraphics,
+                                                 Graphic::Tests::Utils::ThrowErrorIfGraphicalErrorHappened);
+    core.RegisterSystem<RenderingPipeline::Init>([](Engine::Core &coreRef) {
+        coreRef.GetResource<Graphic::Resource::GraphicSettings>().RemoveOptionalFeature(
+            wgpu::FeatureName::TimestampQuery);
+    });
+    core.RunSystems();
+
+    auto graph = CreateGraph(core);
+    for (uint32_t frame = 0; frame < 4; ++frame)
+        EXPECT_NO_THROW(graph.Execute(core));
+
+    EXPECT_FALSE(graph.IsGPUTimingSupported());
+    EXPECT_TRUE(graph.GetLastGPUTimings().empty());
+}
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include "utils/GenerateMipChain.hpp"
+
+TEST(GenerateMipChain, LevelCount)
+{
+    EXPECT_EQ(Graphic::Utils::GetMipLevelCount(1, 1), 1u);
+    EXPECT_EQ(Graphic::Utils::GetMipLevelCount(2, 2), 2u);
+    EXPECT_EQ(Graphic::Utils::GetMipLevelCount(5, 3), 3u);
+    EXPECT_EQ(Graphic::Utils::GetMipLevelCount(1024, 16), 11u);
+}
+
+TEST(GenerateMipChain, HalvesEveryLevelDownToOneTexel)
+{
+    Graphic::Resource::Image image({5, 3}, [](glm::uvec2) { return glm::u8vec4(10, 20, 30, 40); });
+
+    auto levels = Graphic::Utils::GenerateMipChain(image);
+
+    ASSERT_EQ(levels.size(), 2u);
+    EXPECT_EQ(levels[0].width, 2u);
+    EXPECT_EQ(levels[0].height, 1u);
+    EXPECT_EQ(levels[1].width, 1u);
+    EXPECT_EQ(levels[1].height, 1u);
+    for (const auto &level : levels)
+    {
+        ASSERT_EQ(level.pixels.size(), size_t{level.width} * level.height);
+        for (const auto &pixel : level.pixels)
+        {
+            EXPECT_NEAR(pixel.r, 10, 1);
+            EXPECT_NEAR(pixel.g, 20, 1);
+            EXPECT_NEAR(pixel.b, 30, 1);
+            EXPECT_EQ(pixel.a, 40);
+        }
+    }
+}
+
+TEST(GenerateMipChain, AveragesInLinearSpace)
+{
+    Graphic::Resource::Image checkerboard({2, 2}, [](glm::uvec2 pos) {
+        const uint8_t value = (pos.x + pos.y) % 2 == 0 ? 255 : 0;
+        return glm::u8vec4(value, value, value, 255);
+    });
+
+    auto levels = Graphic::Utils::GenerateMipChain(checkerboard);
+
+    ASSERT_EQ(levels.size(), 1u);
+    // 50% linear intensity is 188 in sRGB, a naive average would give 128.
+    EXPECT_NEAR(levels[0].pixels[0].r, 188, 1);
+    EXPECT_EQ(levels[0].pixels[0].a, 255);
+}
+
+TEST(GenerateMipChain, SingleTexelHasNoMip)
+{
+    Graphic::Resource::Image image({1, 1}, [](glm::uvec2) { return glm::u8vec4(255); });
+
+    EXPECT_TRUE(Graphic::Utils::GenerateMipChain(image).empty());
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include "Graphic.hpp"
+#include "RenderingPipeline.hpp"
+
+namespace {
+
+const char *pipelineCacheShaderSource = R"(
+struct VertexOutput {
+  @builtin(position) position: vec4f,
+};
+
+@vertex
+fn vs_main(@location(0) position: vec3f) -> VertexOutput {
+    var output: VertexOutput;
+    output.position = vec4f(position, 1.0);
+    return output;
+}
+
+@fragment
+fn fs_main(input: VertexOutput) -> @location(0) vec4f {
+    return vec4f(1.0, 0.0, 0.0, 1.0);
+}
+)";
+
+Graphic::Resource::ShaderDescriptor CreateDescriptor(std::string_view name)
+{
+    Graphic::Resource::ShaderDescriptor shaderDescriptor;
+
+    auto vertexLayout = Graphic::Utils::VertexBufferLayout()
+                            .addVertexAttribute(wgpu::VertexFormat::Float32x3, 0, 0)
+                            .setArrayStride(3 * sizeof(float))
+                            .setStepMode(wgpu::VertexStepMode::Vertex);
+    auto colorOutput = Graphic::Utils::ColorTargetState("Color").setFormat(wgpu::TextureFormat::BGRA8Unorm);
+
+    shaderDescriptor.setShader(pipelineCacheShaderSource)
+        .setName(name)
+        .setVertexEntryPoint("vs_main")
+        .setFragmentEntryPoint("fs_main")
+        .addVertexBufferLayout(vertexLayout)
+        .addOutputColorFormat(colorOutput);
+    return shaderDescriptor;
+}
+
+void SharePipelineTest(Engine::Core &core)
+{
+    auto &pipelineCache = core.GetResource<Graphic::Resource::PipelineCache>();
+    auto &deviceContext = core.GetResource<Graphic::Resource::DeviceContext>();
+
+    auto first = pipelineCache.CreateShader(deviceContext, CreateDescriptor("First"));
+    auto second = pipelineCache.CreateShader(deviceContext, CreateDescriptor("Second"));
+
+    EXPECT_EQ(first.GetPipeline(), second.GetPipeline());
+    EXPECT_EQ(second.GetDescriptor().getName(), "Second");
+    EXPECT_EQ(pipelineCache.GetPipelineCount(), 1u);
+    EXPECT_EQ(pipelineCache.GetShaderModuleCount(), 1u);
+    EXPECT_EQ(pipelineCache.GetMissCount(), 1u);
+    EXPECT_EQ(pipelineCache.GetHitCount(), 1u);
+
+    // Another pipeline state compiles a new pipeline, but reuses the shader module of the source.
+    auto culled =
+        pipelineCache.CreateShader(deviceContext, CreateDescriptor("Culled").setCullMode(wgpu::CullMode::None));
+    EXPECT_NE(culled.GetPipeline(), first.GetPipeline());
+    EXPECT_EQ(pipelineCache.GetPipelineCount(), 2u);
+    EXPECT_EQ(pipelineCache.GetShaderModuleCount(), 1u);
+}
+
+void CreateAsyncTest(Engine::Core &core)
+{
+    auto &pipelineCache = core.GetResource<Graphic::Resource::PipelineCache>();
+    auto &shaderContainer = core.GetResource<Graphic::Resource::ShaderContainer>();
+
+    pipelineCache.CreateAsync(core, "AsyncShaderA", CreateDescriptor("AsyncShaderA"));
+    pipelineCache.CreateAsync(core, "AsyncShaderB", CreateDescriptor("AsyncShaderB"));
+    EXPECT_TRUE(pipelineCache.IsPending("AsyncShaderA"));
+    EXPECT_EQ(pipelineCache.GetPendingCount(), 2u);
+
+    pipelineCache.WaitAll(core);
+
+    EXPECT_FALSE(pipelineCache.IsPending("AsyncShaderA"));
+    ASSERT_TRUE(shaderContainer.Contains("AsyncShaderA"));
+    ASSERT_TRUE(shaderContainer.Contains("AsyncShaderB"));
+    EXPECT_EQ(shaderContainer.Get("AsyncShaderA").GetPipeline(), shaderContainer.Get("AsyncShaderB").GetPipeline());
+    EXPECT_EQ(pipelineCache.GetPipelineCount(), 1u);
+}
+} // namespace
+
+TEST(PipelineCache, DescriptorHashIgnoresName)
+{
+    EXPECT_EQ(CreateDescriptor("A").computeHash(), CreateDescriptor("B").computeHash());
+    EXPECT_NE(CreateDescriptor("A").computeHash(),
+              CreateDescriptor("A").setCullMode(wgpu::CullMode::None).computeHash());
+    EXPECT_NE(CreateDescriptor("A").computeHash(), CreateDescriptor("A").setFragmentEntryPoint("main").computeHash());
+}
+
+TEST(PipelineCache, DescriptorKeyIgnoresName)
+{
+    EXPECT_EQ(CreateDescriptor("A").computeKey(), CreateDescriptor("B").computeKey());
+    EXPECT_NE(CreateDescriptor("A").computeKey(), CreateDescriptor("A").setCullMode(wgpu::CullMode::None).computeKey());
+    EXPECT_NE(CreateDescriptor("A").computeKey(), CreateDescriptor("A").setFragmentEntryPoint("main").computeKey());
+    // Strings are length-prefixed: moving characters from one entry point to the other changes the key.
+    EXPECT_NE(CreateDescriptor("A").setVertexEntryPoint("vs").setFragmentEntryPoint("_main").computeKey(),
+              CreateDescriptor("A").setVertexEntryPoint("vs_").setFragmentEntryPoint("main").computeKey());
+}
+
+TEST(PipelineCache, SharesPipelineBetweenIdenticalDescriptors)
+{
+    Engine::Core core;
+
+    core.AddPlugins<Graphic::Plugin>();
+
+    core.RegisterSystem<RenderingPipeline::Init>([](Engine::Core &c) {
+        c.GetResource<Graphic::Resource::GraphicSettings>().SetWindowSystem(Graphic::Resource::WindowSystem::None);
+    });
+
+    core.RegisterSystem(SharePipelineTest);
+
+    EXPECT_NO_THROW(core.RunSystems());
+}
+
+TEST(PipelineCache, CreatesShadersAsynchronously)
+{
+    Engine::Core core;
+
+    core.AddPlugins<Graphic::Plugin>();
+
+    core.RegisterSystem<RenderingPipeline::Init>([](Engine::Core &c) {
+        c.GetResource<Graphic::Resource::GraphicSettings>().SetWindowSystem(Graphic::Resource::WindowSystem::None);
+    });
+
+    core.RegisterSystem(CreateAsyncTest);
+
+    EXPECT_NO_THROW(core.RunSystems());
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include "utils/RangeAllocator.hpp"
+
+TEST(RangeAllocator, AllocateSequentially)
+{
+    Graphic::Utils::RangeAllocator allocator(100);
+
+    auto first = allocator.Allocate(40);
+    auto second = allocator.Allocate(60);
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(first.value(), 0u);
+    EXPECT_EQ(second.value(), 40u);
+    EXPECT_EQ(allocator.GetUsedSize(), 100u);
+    EXPECT_FALSE(allocator.Allocate(1).has_value());
+}
+
+TEST(RangeAllocator, ZeroSizedAllocationAlwaysSucceeds)
+{
+    Graphic::Utils::RangeAllocator allocator(0);
+
+    auto range = allocator.Allocate(0);
+
+    ASSERT_TRUE(range.has_value());
+    EXPECT_EQ(allocator.GetUsedSize(), 0u);
+}
+
+TEST(RangeAllocator, FreeCoalescesNeighbours)
+{
+    Graphic::Utils::RangeAllocator allocator(90);
+
+    auto a = allocator.Allocate(30).value();
+    auto b = allocator.Allocate(30).value();
+    auto c = allocator.Allocate(30).value();
+
+    allocator.Free(a, 30);
+    allocator.Free(c, 30);
+    EXPECT_EQ(allocator.GetFreeBlockCount(), 2u);
+    EXPECT_EQ(allocator.GetLargestFreeBlock(), 30u);
+
+    allocator.Free(b, 30);
+    EXPECT_EQ(allocator.GetFreeBlockCount(), 1u);
+    EXPECT_EQ(allocator.GetLargestFreeBlock(), 90u);
+    EXPECT_EQ(allocator.GetUsedSize(), 0u);
+}
+
+TEST(RangeAllocator, PicksTheSmallestFittingBlock)
+{
+    Graphic::Utils::RangeAllocator allocator(100);
+
+    auto a = allocator.Allocate(50).value();
+    allocator.Allocate(10).value();
+    auto c = allocator.Allocate(20).value();
+    allocator.Allocate(20).value();
+
+    allocator.Free(a, 50);
+    allocator.Free(c, 20);
+
+    auto range = allocator.Allocate(15);
+    ASSERT_TRUE(range.has_value());
+    EXPECT_EQ(range.value(), c);
+}
+
+TEST(RangeAllocator, FragmentedSpaceCannotFitLargeRange)
+{
+    Graphic::Utils::RangeAllocator allocator(40);
+
+    auto a = allocator.Allocate(10).value();
+    allocator.Allocate(10).value();
+    auto c = allocator.Allocate(10).value();
+    allocator.Allocate(10).value();
+
+    allocator.Free(a, 10);
+    allocator.Free(c, 10);
+
+    EXPECT_EQ(allocator.GetFreeSize(), 20u);
+    EXPECT_FALSE(allocator.Allocate(20).has_value());
+
+    allocator.Reset(40);
+    EXPECT_TRUE(allocator.Allocate(40).has_value());
+}
+
+TEST(RangeAllocator, DoubleFreeIsIgnored)
+{
+    Graphic::Utils::RangeAllocator allocator(10);
+
+    auto a = allocator.Allocate(5).value();
+    allocator.Free(a, 5);
+    allocator.Free(a, 5);
+
+    EXPECT_EQ(allocator.GetUsedSize(), 0u);
+    EXPECT_EQ(allocator.GetFreeBlockCount(), 1u);
+}
@@ -23,6 +23,21 @@ class MockRenderPass : public Graphic::Resource::ARenderPass {
 
 std::vector<std::string> MockRenderPass::executionOrder;
 
+// Mock RenderPass recording into the frame encoder, so that it is batched by the graph
+class MockRecordingRenderPass : public Graphic::Resource::ARenderPass {
+  public:
+    explicit MockRecordingRenderPass(std::string_view name) : ARenderPass(name) {}
+
+    void Execute(Engine::Core &core) override { FAIL() << "A recording pass must not be executed"; }
+
+    bool SupportsRecording() const override { return true; }
+
+    void Record(wgpu::CommandEncoder &encoder, Engine::Core &core) override
+    {
+        MockRenderPass::executionOrder.push_back(GetName());
+    }
+};
+
 // Test fixture for RenderGraph tests
 class RenderGraphTest : public ::testing::Test {
   protected:
@@ -378,3 +393,224 @@ TEST_F(RenderGraphTest, ReExecuteAfterModification)
 
     ASSERT_EQ(MockRenderPass::executionOrder.size(), 3);
 }
+
+TEST_F(RenderGraphTest, PassesWithoutRecordingSupportAreNotBatched)
+{
+    Engine::Core core;
+    core.AddPlugins<Graphic::Plugin>();
+    core.SetErrorPolicyForAllSchedulers(Engine::Scheduler::SchedulerErrorPolicy::Nothing);
+    core.RegisterSystem<RenderingPipeline::Init>(Graphic::Tests::Utils::ConfigureHeadlessGraphics,
+                                                 Graphic::Tests::Utils::ThrowErrorIfGraphicalErrorHappened);
+    core.RunSystems();
+
+    Graphic::Resource::RenderGraph graph;
+
+    MockRenderPass pass1{};
+    MockRenderPass pass2{};
+
+    graph.Add("pass1", std::move(pass1));
+    graph.Add("pass2", std::move(pass2));
+    graph.SetDependency("pass1", "pass2");
+
+    graph.Record(core);
+    EXPECT_EQ(MockRenderPass::executionOrder.size(), 2);
+    graph.Submit(core);
+
+    const auto &statistics = graph.GetLastFrameStatistics();
+    EXPECT_EQ(statistics.recordedPasses, 0u);
+    EXPECT_EQ(statistics.commandBuffers, 0u);
+    EXPECT_EQ(statistics.submits, 0u);
+}
+
+TEST_F(RenderGraphTest, TextureReadsAndWritesOrderPasses)
+{
+    Engine::Core core;
+    core.AddPlugins<Graphic::Plugin>();
+    core.SetErrorPolicyForAllSchedulers(Engine::Scheduler::SchedulerErrorPolicy::Nothing);
+    core.RegisterSystem<RenderingPipeline::Init>(Graphic::Tests::Utils::ConfigureHeadlessGraphics,
+                                                 Graphic::Tests::Utils::ThrowErrorIfGraphicalErrorHappened);
+    core.RunSystems();
+
+    Graphic::Resource::RenderGraph graph;
+
+    MockRenderPass lighting("lighting");
+    lighting.AddTextureRead("albedo");
+    lighting.AddTextureRead("shadow");
+    lighting.AddOutput(0, Graphic::Resource::ColorOutput("final"));
+    MockRenderPass geometry("geometry");
+    geometry.AddOutput(0, Graphic::Resource::ColorOutput("albedo"));
+    MockRenderPass shadow("shadow");
+    shadow.AddTextureWrite("shadow");
+    MockRenderPass overlay("overlay");
+    overlay.AddOutput(0, Graphic::Resource::ColorOutput("final"));
+
+    graph.Add("lighting", std::move(lighting));
+    graph.Add("overlay", std::move(overlay));
+    graph.Add("geometry", std::move(geometry));
+    graph.Add("shadow", std::move(shadow));
+
+    graph.Execute(core);
+
+    std::vector<std::string> expectedOrder = {"geometry", "shadow", "lighting", "overlay"};
+    EXPECT_EQ(MockRenderPass::executionOrder, expectedOrder);
+}
+
+TEST_F(RenderGraphTest, PassesNotContributingToOutputsAreCulled)
+{
+    Engine::Core core;
+    core.AddPlugins<Graphic::Plugin>();
+    core.SetErrorPolicyForAllSchedulers(Engine::Scheduler::SchedulerErrorPolicy::Nothing);
+    core.RegisterSystem<RenderingPipeline::Init>(Graphic::Tests::Utils::ConfigureHeadlessGraphics,
+                                                 Graphic::Tests::Utils::ThrowErrorIfGraphicalErrorHappened);
+    core.RunSystems();
+
+    Graphic::Resource::RenderGraph graph;
+
+    MockRenderPass geometry("geometry");
+    geometry.AddOutput(0, Graphic::Resource::ColorOutput("albedo"));
+    MockRenderPass debug("debug");
+    debug.AddTextureRead("albedo");
+    debug.AddOutput(0, Graphic::Resource::ColorOutput("debug_view"));
+    MockRenderPass lighting("lighting");
+    lighting.AddTextureRead("albedo");
+    lighting.AddOutput(0, Graphic::Resource::ColorOutput("final"));
+
+    graph.Add("geometry", std::move(geometry));
+    graph.Add("debug", std::move(debug));
+    graph.Add("lighting", std::move(lighting));
+    graph.AddOutput("final");
+
+    graph.Execute(core);
+
+    std::vector<std::string> expectedOrder = {"geometry", "lighting"};
+    EXPECT_EQ(MockRenderPass::executionOrder, expectedOrder);
+    EXPECT_TRUE(graph.IsCulled("debug"));
+    EXPECT_FALSE(graph.IsCulled("geometry"));
+}
+
+TEST_F(RenderGraphTest, TransientTexturesWithDisjointLifetimesShareTextures)
+{
+    Engine::Core core;
+    core.AddPlugins<Graphic::Plugin>();
+    core.SetErrorPolicyForAllSchedulers(Engine::Scheduler::SchedulerErrorPolicy::Nothing);
+    core.RegisterSystem<RenderingPipeline::Init>(Graphic::Tests::Utils::ConfigureHeadlessGraphics,
+                                                 Graphic::Tests::Utils::ThrowErrorIfGraphicalErrorHappened);
+    core.RunSystems();
+
+    Graphic::Resource::RenderGraph graph;
+
+    // a -> b -> c -> d, each pass reading the previous texture: "first" is dead once "second" is read.
+    MockRenderPass a("a");
+    a.AddOutput(0, Graphic::Resource::ColorOutput("first"));
+    MockRenderPass b("b");
+    b.AddTextureRead("first");
+    b.AddOutput(0, Graphic::Resource::ColorOutput("second"));
+    MockRenderPass c("c");
+    c.AddTextureRead("second");
+    c.AddOutput(0, Graphic::Resource::ColorOutput("third"));
+    MockRenderPass d("d");
+    d.AddTextureRead("third");
+    d.AddOutput(0, Graphic::Resource::ColorOutput("final"));
+
+    graph.Add("a", std::move(a));
+    graph.Add("b", std::move(b));
+    graph.Add("c", std::move(c));
+    graph.Add("d", std::move(d));
+    graph.AddOutput("final");
+    graph.AddTransientTexture("first", {});
+    graph.AddTransientTexture("second", {});
+    graph.AddTransientTexture("third", {});
+    graph.AddTransientTexture("depth", {.format = wgpu::TextureFormat::Depth32Float});
+    graph.ResizeTransientTextures(core, {16, 16});
+
+    EXPECT_EQ(graph.GetTransientTextureSlotCount(), 3u);
+    EXPECT_EQ(graph.GetTransientTextureSlot("first"), graph.GetTransientTextureSlot("third"));
+    EXPECT_NE(graph.GetTransientTextureSlot("first"), graph.GetTransientTextureSlot("second"));
+    EXPECT_NE(graph.GetTransientTextureSlot("depth"), graph.GetTransientTextureSlot("first"));
+    EXPECT_FALSE(graph.GetTransientTextureSlot("final").has_value());
+
+    auto &textures = core.GetResource<Graphic::Resource::TextureContainer>();
+    ASSERT_TRUE(textures.Contains("first"));
+    ASSERT_TRUE(textures.Contains("third"));
+    EXPECT_EQ(textures.Get("first").GetSize(), glm::uvec2(16, 16));
+
+    graph.ResizeTransientTextures(core, {32, 8});
+    EXPECT_EQ(textures.Get("second").GetSize(), glm::uvec2(32, 8));
+}
+
+namespace {
+Graphic::Resource::FrameCommandEncoder::Statistics RecordChain(Engine::Core &core, uint32_t passCount,
+                                                               uint32_t passesPerSubmit)
+{
+    Graphic::Resource::RenderGraph graph;
+    graph.SetPassesPerSubmit(passesPerSubmit);
+    for (uint32_t i = 0; i < passCount; ++i)
+    {
+        const std::string name = fmt::format("pass{}", i);
+        graph.Add(name, MockRecordingRenderPass(name));
+        if (i > 0)
+            graph.SetDependency(fmt::format("pass{}", i - 1), name);
+    }
+    graph.Execute(core);
+    return graph.GetLastFrameStatistics();
+}
+} // namespace
+
+TEST_F(RenderGraphTest, RecordedPassesAreSubmittedInBatches)
+{
+    Engine::Core core;
+    core.AddPlugins<Graphic::Plugin>();
+    core.SetErrorPolicyForAllSchedulers(Engine::Scheduler::SchedulerErrorPolicy::Nothing);
+    core.RegisterSystem<RenderingPipeline::Init>(Graphic::Tests::Utils::ConfigureHeadlessGraphics,
+                                                 Graphic::Tests::Utils::ThrowErrorIfGraphicalErrorHappened);
+    core.RunSystems();
+
+    constexpr uint32_t passCount = 6;
+    struct Expected {
+        uint32_t passesPerSubmit;
+        uint32_t submits;
+    };
+    // 0 submits once per frame, a partial last batch is submitted when the frame ends.
+    for (const auto &[passesPerSubmit, submits] : {Expected{0, 1}, Expected{1, 6}, Expected{2, 3}, Expected{4, 2},
+                                                   Expected{6, 1}, Expected{10, 1}})
+    {
+        MockRenderPass::executionOrder.clear();
+        const auto statistics = RecordChain(core, passCount, passesPerSubmit);
+
+        EXPECT_EQ(MockRenderPass::executionOrder.size(), passCount) << "passesPerSubmit = " << passesPerSubmit;
+        EXPECT_EQ(statistics.recordedPasses, passCount) << "passesPerSubmit = " << passesPerSubmit;
+        EXPECT_EQ(statistics.submits, submits) << "passesPerSubmit = " << passesPerSubmit;
+        // One encoder per batch, each submit hands a single command buffer to the queue.
+        EXPECT_EQ(statistics.commandBuffers, submits) << "passesPerSubmit = " << passesPerSubmit;
+    }
+}
+
+TEST_F(RenderGraphTest, PassesWithoutRecordingSupportSplitTheBatch)
+{
+    Engine::Core core;
+    core.AddPlugins<Graphic::Plugin>();
+    core.SetErrorPolicyForAllSchedulers(Engine::Scheduler::SchedulerErrorPolicy::Nothing);
+    core.RegisterSystem<RenderingPipeline::Init>(Graphic::Tests::Utils::ConfigureHeadlessGraphics,
+                                                 Graphic::Tests::Utils::ThrowErrorIfGraphicalErrorHappened);
+    core.RunSystems();
+
+    Graphic::Resource::RenderGraph graph;
+
+    graph.Add("first", MockRecordingRenderPass("first"));
+    graph.Add("second", MockRecordingRenderPass("second"));
+    graph.Add("immediate", MockRenderPass("immediate"));
+    graph.Add("last", MockRecordingRenderPass("last"));
+    graph.SetDependency("first", "second");
+    graph.SetDependency("second", "immediate");
+    graph.SetDependency("immediate", "last");
+
+    graph.Execute(core);
+
+    std::vector<std::string> expectedOrder = {"first", "second", "immediate", "last"};
+    EXPECT_EQ(MockRenderPass::executionOrder, expectedOrder);
+    // The two first passes are flushed before the immediate one, the last one at the end of the frame.
+    const auto &statistics = graph.GetLastFrameStatistics();
+    EXPECT_EQ(statistics.recordedPasses, 3u);
+    EXPECT_EQ(statistics.commandBuffers, 2u);
+    EXPECT_EQ(statistics.submits, 2u);
+}
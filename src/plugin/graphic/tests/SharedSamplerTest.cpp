@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include "Graphic.hpp"
+#include "RenderingPipeline.hpp"
+
+namespace {
+wgpu::SamplerDescriptor CreateDescriptor(wgpu::FilterMode filter)
+{
+    wgpu::SamplerDescriptor samplerDesc(wgpu::Default);
+    samplerDesc.maxAnisotropy = 1;
+    samplerDesc.magFilter = filter;
+    samplerDesc.minFilter = filter;
+    samplerDesc.addressModeU = wgpu::AddressMode::Repeat;
+    samplerDesc.addressModeV = wgpu::AddressMode::Repeat;
+    samplerDesc.addressModeW = wgpu::AddressMode::Repeat;
+    return samplerDesc;
+}
+
+void SharedSamplerTest(Engine::Core &core)
+{
+    auto &samplerContainer = core.GetResource<Graphic::Resource::SamplerContainer>();
+
+    auto labelled = CreateDescriptor(wgpu::FilterMode::Linear);
+    labelled.label = wgpu::StringView(std::string_view("Labelled"));
+
+    const auto linear = Graphic::Utils::GetSharedSampler(core, CreateDescriptor(wgpu::FilterMode::Linear));
+    const auto sameLinear = Graphic::Utils::GetSharedSampler(core, labelled);
+    const auto nearest = Graphic::Utils::GetSharedSampler(core, CreateDescriptor(wgpu::FilterMode::Nearest));
+
+    EXPECT_EQ(linear.value(), sameLinear.value());
+    EXPECT_NE(linear.value(), nearest.value());
+    EXPECT_TRUE(samplerContainer.Contains(linear));
+    EXPECT_TRUE(samplerContainer.Contains(nearest));
+    EXPECT_EQ(samplerContainer.Get(linear).GetSampler(), samplerContainer.Get(sameLinear).GetSampler());
+}
+} // namespace
+
+TEST(SharedSampler, DescriptorHashIgnoresLabel)
+{
+    auto labelled = CreateDescriptor(wgpu::FilterMode::Linear);
+    labelled.label = wgpu::StringView(std::string_view("Labelled"));
+
+    EXPECT_EQ(Graphic::Utils::HashSamplerDescriptor(CreateDescriptor(wgpu::FilterMode::Linear)),
+              Graphic::Utils::HashSamplerDescriptor(labelled));
+    EXPECT_NE(Graphic::Utils::HashSamplerDescriptor(CreateDescriptor(wgpu::FilterMode::Linear)),
+              Graphic::Utils::HashSamplerDescriptor(CreateDescriptor(wgpu::FilterMode::Nearest)));
+}
+
+TEST(SharedSampler, SharesSamplersByDescriptor)
+{
+    Engine::Core core;
+
+    core.AddPlugins<Graphic::Plugin>();
+
+    core.RegisterSystem<RenderingPipeline::Init>([](Engine::Core &c) {
+        c.GetResource<Graphic::Resource::GraphicSettings>().SetWindowSystem(Graphic::Resource::WindowSystem::None);
+    });
+
+    core.RegisterSystem(SharedSamplerTest);
+
+    EXPECT_NO_THROW(core.RunSystems());
+}
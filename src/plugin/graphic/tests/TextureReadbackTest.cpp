@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include "Graphic.hpp"
+#include "RenderingPipeline.hpp"
+
+static Graphic::Resource::Image CreateTestImage()
+{
+    return Graphic::Resource::Image({13, 7}, [](glm::uvec2 pos) {
+        return glm::u8vec4(static_cast<uint8_t>(pos.x * 10), static_cast<uint8_t>(pos.y * 20), 128, 255);
+    });
+}
+
+void ReadbackWithFutureTest(Engine::Core &core)
+{
+    auto &deviceContext = core.GetResource<Graphic::Resource::DeviceContext>();
+    auto &queue = core.GetResource<Graphic::Resource::Queue>();
+    auto image = CreateTestImage();
+    Graphic::Resource::Texture texture(deviceContext, queue, "readback_texture", image);
+
+    Graphic::Resource::TextureReadback readback;
+    auto future = readback.Request(core, texture);
+    EXPECT_EQ(readback.GetPendingCount(), 1u);
+
+    readback.WaitAll(core);
+
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    auto data = future.get();
+    EXPECT_EQ(data.width, image.width);
+    EXPECT_EQ(data.height, image.height);
+    EXPECT_EQ(data.pixels, image.pixels);
+    EXPECT_EQ(readback.GetPendingCount(), 0u);
+}
+
+void ReadbackRingReuseTest(Engine::Core &core)
+{
+    auto &deviceContext = core.GetResource<Graphic::Resource::DeviceContext>();
+    auto &queue = core.GetResource<Graphic::Resource::Queue>();
+    auto image = CreateTestImage();
+    Graphic::Resource::Texture texture(deviceContext, queue, "readback_texture", image);
+
+    Graphic::Resource::TextureReadback readback(2);
+    std::vector<int> delivered;
+    for (int frame = 0; frame < 5; ++frame)
+    {
+        readback.Request(core, texture, [&delivered, &image, frame](const Graphic::Resource::Image &data) {
+            EXPECT_EQ(data.pixels, image.pixels);
+            delivered.push_back(frame);
+        });
+        readback.Update(core);
+    }
+    readback.WaitAll(core);
+
+    EXPECT_EQ(readback.GetRingSize(), 2u);
+    EXPECT_EQ(delivered, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+TEST(TextureReadback, FutureIsFulfilled)
+{
+    Engine::Core core;
+
+    core.AddPlugins<Graphic::Plugin>();
+
+    core.RegisterSystem<RenderingPipeline::Init>([](Engine::Core &c) {
+        c.GetResource<Graphic::Resource::GraphicSettings>().SetWindowSystem(Graphic::Resource::WindowSystem::None);
+    });
+
+    core.RegisterSystem(ReadbackWithFutureTest);
+
+    EXPECT_NO_THROW(core.RunSystems());
+}
+
+TEST(TextureReadback, RingBuffersAreReusedInOrder)
+{
+    Engine::Core core;
+
+    core.AddPlugins<Graphic::Plugin>();
+
+    core.RegisterSystem<RenderingPipeline::Init>([](Engine::Core &c) {
+        c.GetResource<Graphic::Resource::GraphicSettings>().SetWindowSystem(Graphic::Resource::WindowSystem::None);
+    });
+
+    core.RegisterSystem(ReadbackRingReuseTest);
+
+    EXPECT_NO_THROW(core.RunSystems());
+}
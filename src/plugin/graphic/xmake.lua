@@ -45,7 +45,9 @@ target(plugin_name)
     add_headerfiles("src/(system/GPUComponentManagement/*.hpp)")
     add_headerfiles("src/(system/preparation/*.hpp)")
     add_headerfiles("src/(system/commandCreation/*.hpp)")
+    add_headerfiles("src/(system/commandSubmission/*.hpp)")
     add_headerfiles("src/(system/presentation/*.hpp)")
+    add_headerfiles("src/(system/renderPipeline/*.hpp)")
     add_headerfiles("src/(system/shutdown/*.hpp)")
     add_headerfiles("src/(utils/*.hpp)")
     add_headerfiles("src/(utils/shader/*.hpp)")
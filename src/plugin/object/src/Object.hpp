@@ -4,21 +4,43 @@
 #include "component/AmbientLight.hpp"
 #include "component/Camera.hpp"
 #include "component/DirectionalLight.hpp"
+#include "component/GlobalTransform.hpp"
 #include "component/Material.hpp"
 #include "component/Mesh.hpp"
+#include "component/MeshHandle.hpp"
+#include "component/MeshLOD.hpp"
 #include "component/PointLight.hpp"
 #include "component/Transform.hpp"
 
 // Exceptions
+#include "exception/MeshFileError.hpp"
 #include "exception/ResourceManagerError.hpp"
 
 // Resources
+#include "resource/AssetDatabase.hpp"
+#include "resource/AsyncModelLoader.hpp"
+#include "resource/MeshContainer.hpp"
+#include "resource/MeshFile.hpp"
+#include "resource/MeshFileLoader.hpp"
 #include "resource/OBJLoader.hpp"
 #include "resource/ResourceManager.hpp"
 #include "resource/Shape.hpp"
+#include "resource/TransformHierarchy.hpp"
+
+// Systems
+#include "system/PropagateTransforms.hpp"
 
 // Helpers
 #include "utils/helper/CreateShape.hpp"
 
 // Utils
+#include "utils/FileWatcher.hpp"
+#include "utils/MappedFile.hpp"
+#include "utils/MeshAsset.hpp"
+#include "utils/MeshFileConverter.hpp"
+#include "utils/MeshOptimizer.hpp"
+#include "utils/MeshSimplifier.hpp"
 #include "utils/ShapeGenerator.hpp"
+
+// Plugin
+#include "plugin/PluginObject.hpp"
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "component/Transform.hpp"
+#include <glm/glm.hpp>
+
+namespace Object::Component {
+
+/**
+ * @brief World space transformation of an entity: its Transform combined with the GlobalTransform of its parent (see
+ * Relationship::Component::Relationship).
+ *
+ * Added and computed by Resource::TransformHierarchy::Propagate for every entity with a Transform. Renderers and
+ * physics read it, they never write it.
+ */
+struct GlobalTransform {
+    glm::mat4 matrix{1.0f};
+    /** @brief Whether the matrix changed during the last propagation, so that consumers can skip unchanged entities. */
+    bool changed = true;
+
+    [[nodiscard]] glm::vec3 GetPosition() const { return glm::vec3(matrix[3]); }
+
+    /**
+     * @brief World position, rotation and scale, for code computing its data from a Transform (e.g. cameras and
+     * lights). A shear from non-uniformly scaled parents is dropped, and a mirroring scale flips the X axis.
+     */
+    [[nodiscard]] Transform ToTransform() const
+    {
+        glm::vec3 scale(glm::length(glm::vec3(matrix[0])), glm::length(glm::vec3(matrix[1])),
+                        glm::length(glm::vec3(matrix[2])));
+        if (glm::determinant(glm::mat3(matrix)) < 0.0f)
+            scale.x = -scale.x;
+        if (scale.x == 0.0f || scale.y == 0.0f || scale.z == 0.0f)
+            return Transform(GetPosition(), scale);
+
+        const glm::mat3 rotation(glm::vec3(matrix[0]) / scale.x, glm::vec3(matrix[1]) / scale.y,
+                                 glm::vec3(matrix[2]) / scale.z);
+        return Transform(GetPosition(), scale, glm::normalize(glm::quat_cast(rotation)));
+    }
+};
+
+} // namespace Object::Component
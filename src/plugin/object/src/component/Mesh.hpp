@@ -22,7 +22,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <glm/glm.hpp>
+#include <utility>
 #include <vector>
 
 namespace Object::Component {
@@ -53,7 +55,7 @@ struct Mesh {
         : vertices(std::move(other.vertices)), normals(std::move(other.normals)), texCoords(std::move(other.texCoords)),
           indices(std::move(other.indices)), _dirty(true)
     {
-        other._dirty = false;
+        other.ClearDirty();
     }
 
     // Move assignment operator
@@ -65,8 +67,8 @@ struct Mesh {
             normals = std::move(other.normals);
             texCoords = std::move(other.texCoords);
             indices = std::move(other.indices);
-            _dirty = true;
-            other._dirty = false;
+            MarkDirty();
+            other.ClearDirty();
         }
         return *this;
     }
@@ -87,7 +89,7 @@ struct Mesh {
             normals = other.normals;
             texCoords = other.texCoords;
             indices = other.indices;
-            _dirty = true;
+            MarkDirty();
         }
         return *this;
     }
@@ -104,7 +106,13 @@ struct Mesh {
     void SetVertices(const std::vector<glm::vec3> &newVertices)
     {
         vertices = newVertices;
-        _dirty = true;
+        MarkDirty();
+    }
+
+    void SetVertices(std::vector<glm::vec3> &&newVertices)
+    {
+        vertices = std::move(newVertices);
+        MarkDirty();
     }
 
     void SetVertexAt(size_t index, const glm::vec3 &vertex)
@@ -112,7 +120,7 @@ struct Mesh {
         if (index >= vertices.size())
             return;
         vertices[index] = vertex;
-        _dirty = true;
+        MarkVertexDirty(index);
     }
 
     void ReserveVertices(size_t count) { vertices.reserve(count); }
@@ -120,14 +128,20 @@ struct Mesh {
     template <typename... Args> void EmplaceVertices(Args &&...args)
     {
         vertices.emplace_back(std::forward<Args>(args)...);
-        _dirty = true;
+        MarkDirty();
     }
 
     //---------------- Normal Methods ----------------//
     void SetNormals(const std::vector<glm::vec3> &newNormals)
     {
         normals = newNormals;
-        _dirty = true;
+        MarkDirty();
+    }
+
+    void SetNormals(std::vector<glm::vec3> &&newNormals)
+    {
+        normals = std::move(newNormals);
+        MarkDirty();
     }
 
     void SetNormalAt(size_t index, const glm::vec3 &normal)
@@ -135,7 +149,7 @@ struct Mesh {
         if (index >= normals.size())
             return;
         normals[index] = normal;
-        _dirty = true;
+        MarkVertexDirty(index);
     }
 
     void ReserveNormals(size_t count) { normals.reserve(count); }
@@ -143,14 +157,20 @@ struct Mesh {
     template <typename... Args> void EmplaceNormals(Args &&...args)
     {
         normals.emplace_back(std::forward<Args>(args)...);
-        _dirty = true;
+        MarkDirty();
     }
 
     //---------------- TexCoord Methods ----------------//
     void SetTexCoords(const std::vector<glm::vec2> &newTexCoords)
     {
         texCoords = newTexCoords;
-        _dirty = true;
+        MarkDirty();
+    }
+
+    void SetTexCoords(std::vector<glm::vec2> &&newTexCoords)
+    {
+        texCoords = std::move(newTexCoords);
+        MarkDirty();
     }
 
     void SetTexCoordAt(size_t index, const glm::vec2 &texCoord)
@@ -158,7 +178,7 @@ struct Mesh {
         if (index >= texCoords.size())
             return;
         texCoords[index] = texCoord;
-        _dirty = true;
+        MarkVertexDirty(index);
     }
 
     void ReserveTexCoords(size_t count) { texCoords.reserve(count); }
@@ -166,14 +186,20 @@ struct Mesh {
     template <typename... Args> void EmplaceTexCoords(Args &&...args)
     {
         texCoords.emplace_back(std::forward<Args>(args)...);
-        _dirty = true;
+        MarkDirty();
     }
 
     //---------------- Index Methods ----------------//
     void SetIndices(const std::vector<uint32_t> &newIndices)
     {
         indices = newIndices;
-        _dirty = true;
+        MarkDirty();
+    }
+
+    void SetIndices(std::vector<uint32_t> &&newIndices)
+    {
+        indices = std::move(newIndices);
+        MarkDirty();
     }
 
     void SetIndexAt(size_t index, uint32_t indexValue)
@@ -181,7 +207,7 @@ struct Mesh {
         if (index >= indices.size())
             return;
         indices[index] = indexValue;
-        _dirty = true;
+        MarkDirty();
     }
 
     void ReserveIndices(size_t count) { indices.reserve(count); }
@@ -189,7 +215,7 @@ struct Mesh {
     template <typename... Args> void EmplaceIndices(Args &&...args)
     {
         indices.emplace_back(std::forward<Args>(args)...);
-        _dirty = true;
+        MarkDirty();
     }
 
     /**
@@ -206,9 +232,60 @@ struct Mesh {
      * Called by the graphics system after successfully updating the GPU buffer
      * to indicate the mesh is now in sync.
      */
-    void ClearDirty() const { _dirty = false; }
+    void ClearDirty() const
+    {
+        _dirty = false;
+        _dirtyVertexBegin = 0;
+        _dirtyVertexEnd = 0;
+    }
+
+    /**
+     * @brief Get the [begin, end) range of vertices modified since last GPU sync.
+     *
+     * Only the per-vertex setters (SetVertexAt, SetNormalAt, SetTexCoordAt) narrow the range. Any other
+     * modification marks the whole mesh, in which case the range covers every vertex.
+     *
+     * @return the dirty range, empty if the mesh is not dirty.
+     */
+    [[nodiscard]] std::pair<size_t, size_t> GetDirtyVertexRange() const
+    {
+        if (!_dirty)
+            return {0, 0};
+        if (_dirtyVertexEnd == 0)
+            return {0, vertices.size()};
+        return {_dirtyVertexBegin, std::min(_dirtyVertexEnd, vertices.size())};
+    }
+
+    /**
+     * @brief Check if only some vertex attributes were modified since last GPU sync.
+     *
+     * When true, indices and vertex count are unchanged and only GetDirtyVertexRange needs to be uploaded.
+     */
+    [[nodiscard]] bool IsPartiallyDirty() const { return _dirty && _dirtyVertexEnd != 0; }
 
   private:
+    void MarkDirty()
+    {
+        _dirty = true;
+        _dirtyVertexBegin = 0;
+        _dirtyVertexEnd = 0;
+    }
+
+    void MarkVertexDirty(size_t index)
+    {
+        if (!_dirty)
+        {
+            _dirty = true;
+            _dirtyVertexBegin = index;
+            _dirtyVertexEnd = index + 1;
+        }
+        else if (_dirtyVertexEnd != 0)
+        {
+            _dirtyVertexBegin = std::min(_dirtyVertexBegin, index);
+            _dirtyVertexEnd = std::max(_dirtyVertexEnd, index + 1);
+        }
+    }
+
     std::vector<glm::vec3> vertices{};
     std::vector<glm::vec3> normals{};
     std::vector<glm::vec2> texCoords{};
@@ -222,5 +299,13 @@ struct Mesh {
      * needs to be updated.
      */
     mutable bool _dirty = false;
+
+    /**
+     * @brief Range of vertices touched by per-vertex setters while dirty.
+     *
+     * An empty range (end == 0) on a dirty mesh means the whole mesh is dirty.
+     */
+    mutable size_t _dirtyVertexBegin = 0;
+    mutable size_t _dirtyVertexEnd = 0;
 };
 } // namespace Object::Component
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "component/Mesh.hpp"
+#include <entt/core/fwd.hpp>
+#include <memory>
+
+namespace Object::Component {
+
+/**
+ * @brief References an immutable mesh asset of the Resource::MeshContainer instead of owning a copy of its data.
+ *
+ * Entities referencing the same asset share its data on the CPU, and renderers upload it once for all of them. The
+ * asset is never modified: a system that needs to mutate the geometry of one entity (e.g. soft body sync) promotes it
+ * to its own Mesh with Utils::PromoteToUniqueMesh first.
+ *
+ * An entity has either a Mesh or a MeshHandle. See Utils::TryGetMeshData to read the geometry of either.
+ */
+struct MeshHandle {
+    /** @brief Id of the asset in the Resource::MeshContainer. */
+    entt::id_type id = 0;
+    std::shared_ptr<const Mesh> mesh;
+
+    [[nodiscard]] bool IsValid() const { return mesh != nullptr; }
+    [[nodiscard]] const Mesh &Get() const { return *mesh; }
+};
+
+} // namespace Object::Component
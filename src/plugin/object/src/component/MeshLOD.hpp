@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Object::Component {
+
+/**
+ * @brief Simplified versions of the Mesh of the same entity, drawn when it covers a small part of the screen.
+ *
+ * Levels only store indices: they draw a subset of the vertices of the Mesh, so they stay valid as long as its
+ * vertices do not move. Levels are sorted from the most to the least detailed, level 0 being the Mesh itself.
+ *
+ * See Utils::GenerateMeshLOD to build them with the quadric simplifier.
+ */
+struct MeshLOD {
+    struct Level {
+        std::vector<uint32_t> indices;
+        /** @brief Projected diameter of the bounding sphere, as a fraction of the full screen height, under which
+         * the level is drawn. */
+        float screenSize = 0.0f;
+        /** @brief Simplification error of the level, relative to the size of the mesh. */
+        float error = 0.0f;
+    };
+
+    /** @brief Level i + 1 of the mesh, with decreasing screen sizes. */
+    std::vector<Level> levels;
+
+    /**
+     * @brief Relative margin around each screen size before the level changes, so that a mesh moving around a
+     * threshold does not flicker between two levels.
+     */
+    float hysteresis = 0.1f;
+};
+
+} // namespace Object::Component
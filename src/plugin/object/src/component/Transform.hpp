@@ -42,34 +42,47 @@ struct Transform {
     void SetPosition(const glm::vec3 &newPosition)
     {
         _dirty = true;
+        _changed = true;
         _position = newPosition;
     }
     void SetPosition(float x, float y, float z)
     {
         _dirty = true;
+        _changed = true;
         _position = glm::vec3(x, y, z);
     }
     void SetScale(const glm::vec3 &newScale)
     {
         _dirty = true;
+        _changed = true;
         _scale = newScale;
     }
     void SetScale(float x, float y, float z)
     {
         _dirty = true;
+        _changed = true;
         _scale = glm::vec3(x, y, z);
     }
     void SetRotation(const glm::quat &newRotation)
     {
         _dirty = true;
+        _changed = true;
         _rotation = newRotation;
     }
     void SetRotation(float x, float y, float z, float w)
     {
         _dirty = true;
+        _changed = true;
         _rotation = glm::quat(w, x, y, z);
     }
 
+    /**
+     * Whether the transform was modified since the last propagation of the world transforms, see
+     * Resource::TransformHierarchy.
+     */
+    bool HasChanged() const { return _changed; }
+    void ClearChanged() { _changed = false; }
+
     glm::vec3 GetForwardVector() const { return glm::normalize(_rotation * glm::vec3(0.0f, 0.0f, 1.0f)); }
 
     glm::vec3 GetRightVector() const { return glm::normalize(_rotation * glm::vec3(1.0f, 0.0f, 0.0f)); }
@@ -107,6 +120,7 @@ struct Transform {
     glm::quat _rotation;
 
     mutable bool _dirty = true;
+    bool _changed = true;
     mutable glm::mat4 _transformationMatrixCache = glm::mat4(1.0f);
 
     inline glm::mat4 _BuildTransformationMatrix() const
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+namespace Object {
+
+/**
+ * @brief MeshFileError is thrown when a binary mesh file cannot be written, mapped, or is not a valid mesh file.
+ *
+ * @example "Falling back to the OBJ file"
+ * @code
+ * try {
+ *     Object::MeshFileLoader loader("model.esmesh");
+ * } catch (const Object::MeshFileError &e) {
+ *     Log::Warning(e.what());
+ * }
+ * @endcode
+ */
+class MeshFileError : public std::exception {
+  public:
+    explicit MeshFileError(const std::string &message) : _msg("MeshFile error: " + message) {};
+
+    const char *what() const throw() override { return this->_msg.c_str(); };
+
+  private:
+    std::string _msg;
+};
+
+} // namespace Object
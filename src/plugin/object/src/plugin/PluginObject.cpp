@@ -0,0 +1,18 @@
+#include "plugin/PluginObject.hpp"
+#include "component/Transform.hpp"
+#include "plugin/PluginScene.hpp"
+#include "resource/SnapshotSerializers.hpp"
+#include "resource/TransformHierarchy.hpp"
+#include "scheduler/Update.hpp"
+#include "system/PropagateTransforms.hpp"
+
+void Object::Plugin::Bind()
+{
+    RequirePlugins<Scene::Plugin>();
+
+    auto &serializers = GetCore().GetResource<Scene::Resource::SnapshotSerializers>();
+    serializers.Register<Component::Transform>("Object::Transform");
+
+    RegisterResource(Resource::TransformHierarchy());
+    RegisterSystems<Engine::Scheduler::Update>(System::PropagateTransforms);
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "plugin/APlugin.hpp"
+
+namespace Object {
+/**
+ * @brief Register what every user of the object components shares: the snapshot serializer of Component::Transform
+ * (see Scene::Resource::SnapshotSerializers), and the Resource::TransformHierarchy computing the
+ * Component::GlobalTransform of every entity in the Update scheduler.
+ */
+class Plugin : public Engine::APlugin {
+  public:
+    explicit Plugin(Engine::Core &core)
+        : Engine::APlugin(core) {
+              // empty
+          };
+    ~Plugin() override = default;
+
+    void Bind() final;
+};
+} // namespace Object
@@ -0,0 +1,275 @@
+#include "resource/AssetDatabase.hpp"
+#include "Logger.hpp"
+#include "exception/ResourceManagerError.hpp"
+#include "utils/MeshFileConverter.hpp"
+#include <algorithm>
+#include <fmt/format.h>
+#include <unordered_set>
+
+namespace Object::Resource {
+
+static std::string NormalizeSource(const std::filesystem::path &path)
+{
+    std::error_code error;
+    auto absolute = std::filesystem::absolute(path, error);
+    if (error)
+        absolute = path;
+    return absolute.lexically_normal().string();
+}
+
+/** @brief Hash of the file, or 0 if it cannot be read (e.g. it is being replaced). */
+static uint64_t TryHashFile(const std::filesystem::path &path)
+{
+    try
+    {
+        return Utils::HashFile(path);
+    }
+    catch (const std::exception &)
+    {
+        return 0;
+    }
+}
+
+AssetDatabase::AssetId AssetDatabase::Register(std::string_view name, const std::filesystem::path &source,
+                                               Importer importer)
+{
+    const AssetId id = GetId(name);
+    auto &asset = _GetOrCreate(id, name);
+    const std::string key = NormalizeSource(source);
+
+    if (!asset.source.empty() && NormalizeSource(asset.source) != key)
+        _RemoveSource(id);
+
+    asset.source = source;
+    asset.sourceHash = TryHashFile(source);
+    asset.importer = std::move(importer);
+
+    auto &sourceAssets = _assetsBySource[key];
+    if (std::ranges::find(sourceAssets, id) == sourceAssets.end())
+        sourceAssets.push_back(id);
+    _watcher.Watch(source);
+    return id;
+}
+
+AssetDatabase::AssetId AssetDatabase::Register(std::string_view name, const std::vector<AssetId> &dependencies,
+                                               Importer importer)
+{
+    for (AssetId dependency : dependencies)
+    {
+        if (!Contains(dependency))
+            throw ResourceManagerError(fmt::format("Cannot register asset '{}': its dependency {} is not registered.",
+                                                   name, dependency));
+    }
+
+    const AssetId id = GetId(name);
+    _GetOrCreate(id, name).importer = std::move(importer);
+    for (AssetId dependency : dependencies)
+        AddDependency(id, dependency);
+    return id;
+}
+
+void AssetDatabase::AddDependency(AssetId asset, AssetId dependency)
+{
+    if (!Contains(asset) || !Contains(dependency))
+        throw ResourceManagerError(
+            fmt::format("Cannot add a dependency between {} and {}: both must be registered.", asset, dependency));
+    if (asset == dependency || _DependsOn(dependency, asset))
+        throw ResourceManagerError(fmt::format("Cannot make '{}' depend on '{}': '{}' already depends on it.",
+                                               _assets.at(asset).name, _assets.at(dependency).name,
+                                               _assets.at(dependency).name));
+
+    auto &dependencies = _assets.at(asset).dependencies;
+    if (std::ranges::find(dependencies, dependency) != dependencies.end())
+        return;
+    dependencies.push_back(dependency);
+    _assets.at(dependency).dependents.push_back(asset);
+}
+
+void AssetDatabase::Remove(AssetId asset)
+{
+    if (!Contains(asset))
+        return;
+    _Unlink(asset);
+    _assets.erase(asset);
+}
+
+const AssetDatabase::Asset &AssetDatabase::Get(AssetId asset) const
+{
+    auto it = _assets.find(asset);
+    if (it == _assets.end())
+        throw ResourceManagerError(fmt::format("Asset {} not found.", asset));
+    return it->second;
+}
+
+size_t AssetDatabase::Update(Engine::Core &core)
+{
+    std::vector<AssetId> changed;
+    std::unordered_map<AssetId, uint64_t> sourceHashes;
+    for (const auto &path : _watcher.Poll())
+    {
+        auto it = _assetsBySource.find(NormalizeSource(path));
+        if (it == _assetsBySource.end())
+            continue;
+
+        // A file being replaced may not be readable yet, it is reported again once written.
+        const uint64_t hash = TryHashFile(path);
+        if (hash == 0)
+            continue;
+        for (AssetId id : it->second)
+        {
+            auto &asset = _assets.at(id);
+            // The hash is only kept once imported, so that saving a file which failed to import retries it.
+            if (asset.sourceHash == hash || !sourceHashes.insert_or_assign(id, hash).second)
+                continue;
+            changed.push_back(id);
+        }
+    }
+    return changed.empty() ? 0 : _Reimport(core, changed, sourceHashes);
+}
+
+size_t AssetDatabase::Reimport(Engine::Core &core, AssetId asset)
+{
+    if (!Contains(asset))
+        throw ResourceManagerError(fmt::format("Cannot re-import asset {}: it is not registered.", asset));
+    std::unordered_map<AssetId, uint64_t> sourceHashes;
+    if (const auto &source = _assets.at(asset).source; !source.empty())
+        sourceHashes.emplace(asset, TryHashFile(source));
+    return _Reimport(core, {asset}, sourceHashes);
+}
+
+AssetDatabase::Asset &AssetDatabase::_GetOrCreate(AssetId asset, std::string_view name)
+{
+    auto [it, inserted] = _assets.try_emplace(asset);
+    if (inserted)
+        it->second.name = name;
+    else if (it->second.name != name)
+        Log::Warning(fmt::format("Assets '{}' and '{}' have the same id, '{}' replaces the other.", it->second.name,
+                                 name, name));
+    return it->second;
+}
+
+void AssetDatabase::_Unlink(AssetId id)
+{
+    auto &asset = _assets.at(id);
+    for (AssetId dependency : asset.dependencies)
+        std::erase(_assets.at(dependency).dependents, id);
+    for (AssetId dependent : asset.dependents)
+        std::erase(_assets.at(dependent).dependencies, id);
+
+    _RemoveSource(id);
+}
+
+void AssetDatabase::_RemoveSource(AssetId id)
+{
+    auto &asset = _assets.at(id);
+    if (asset.source.empty())
+        return;
+
+    const std::string key = NormalizeSource(asset.source);
+    auto &sourceAssets = _assetsBySource[key];
+    std::erase(sourceAssets, id);
+    // The file stays watched while other assets are imported from it.
+    if (sourceAssets.empty())
+    {
+        _assetsBySource.erase(key);
+        _watcher.Unwatch(asset.source);
+    }
+    asset.source.clear();
+}
+
+bool AssetDatabase::_DependsOn(AssetId asset, AssetId dependency) const
+{
+    std::vector<AssetId> stack{asset};
+    std::unordered_set<AssetId> visited;
+    while (!stack.empty())
+    {
+        const AssetId current = stack.back();
+        stack.pop_back();
+        if (current == dependency)
+            return true;
+        if (!visited.insert(current).second)
+            continue;
+        const auto &dependencies = _assets.at(current).dependencies;
+        stack.insert(stack.end(), dependencies.begin(), dependencies.end());
+    }
+    return false;
+}
+
+size_t AssetDatabase::_Reimport(Engine::Core &core, const std::vector<AssetId> &changed,
+                                const std::unordered_map<AssetId, uint64_t> &sourceHashes)
+{
+    // Every asset built from a changed one is affected, directly or not.
+    std::unordered_set<AssetId> affected;
+    std::vector<AssetId> stack(changed.begin(), changed.end());
+    while (!stack.empty())
+    {
+        const AssetId current = stack.back();
+        stack.pop_back();
+        if (!affected.insert(current).second)
+            continue;
+        const auto &dependents = _assets.at(current).dependents;
+        stack.insert(stack.end(), dependents.begin(), dependents.end());
+    }
+
+    // Affected assets are imported after their affected dependencies, the others did not change.
+    std::unordered_map<AssetId, size_t> pendingDependencies;
+    std::vector<AssetId> order;
+    for (AssetId id : affected)
+    {
+        const auto &dependencies = _assets.at(id).dependencies;
+        const auto count = std::ranges::count_if(dependencies, [&affected](AssetId d) { return affected.contains(d); });
+        pendingDependencies[id] = static_cast<size_t>(count);
+        if (count == 0)
+            order.push_back(id);
+    }
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        for (AssetId dependent : _assets.at(order[i]).dependents)
+        {
+            if (affected.contains(dependent) && --pendingDependencies[dependent] == 0)
+                order.push_back(dependent);
+        }
+    }
+
+    size_t reimported = 0;
+    std::unordered_set<AssetId> failed;
+    for (AssetId id : order)
+    {
+        // Importers may register or remove assets, so nothing is kept across calls.
+        auto it = _assets.find(id);
+        if (it == _assets.end())
+            continue;
+        const std::string name = it->second.name;
+        if (std::ranges::any_of(it->second.dependencies, [&failed](AssetId d) { return failed.contains(d); }))
+        {
+            Log::Warning(fmt::format("Asset '{}' is not re-imported, one of its dependencies failed to.", name));
+            failed.insert(id);
+            continue;
+        }
+
+        const Importer importer = it->second.importer;
+        try
+        {
+            if (importer)
+                importer(core);
+        }
+        catch (const std::exception &e)
+        {
+            Log::Error(fmt::format("Failed to re-import asset '{}': {}", name, e.what()));
+            failed.insert(id);
+            continue;
+        }
+        if (it = _assets.find(id); it != _assets.end())
+        {
+            it->second.version++;
+            if (auto hash = sourceHashes.find(id); hash != sourceHashes.end())
+                it->second.sourceHash = hash->second;
+        }
+        ++reimported;
+    }
+
+    Log::Info(fmt::format("Re-imported {} asset(s) out of {} affected.", reimported, order.size()));
+    return reimported;
+}
+
+} // namespace Object::Resource
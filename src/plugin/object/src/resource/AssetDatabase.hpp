@@ -0,0 +1,139 @@
+#pragma once
+
+#include "core/Core.hpp"
+#include "utils/FileWatcher.hpp"
+#include <cstdint>
+#include <entt/core/hashed_string.hpp>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Object::Resource {
+
+/**
+ * @brief Records where each asset comes from and what is built from it, so that an edited file re-imports only the
+ * assets affected by it, while the application keeps running.
+ *
+ * An asset is either imported from a source file, whose content hash is recorded, or built from other assets (e.g.
+ * the GPU geometry of a mesh, or the bind groups of a texture). Its dependents are re-imported after it, in
+ * dependency order. Importers run on the thread calling Update, between frames.
+ *
+ * Loaders register their assets only if the database is a resource of the core (see Utils::LoadOBJMeshAsset), so
+ * that applications without hot reload pay nothing for it.
+ *
+ * @example "Enabling hot reload"
+ * @code
+ * core.RegisterResource(Object::Resource::AssetDatabase());
+ * core.RegisterSystem<Engine::Scheduler::Update>(
+ *     [](Engine::Core &core) { core.GetResource<Object::Resource::AssetDatabase>().Update(core); });
+ * @endcode
+ */
+class AssetDatabase {
+  public:
+    using AssetId = entt::id_type;
+    /** @brief Builds the asset again from its source file or dependencies. */
+    using Importer = std::function<void(Engine::Core &)>;
+
+    struct Asset {
+        std::string name;
+        /** @brief File the asset is imported from, empty for assets built from other assets. */
+        std::filesystem::path source;
+        /** @brief Hash of the source file when the asset was last imported successfully. */
+        uint64_t sourceHash = 0;
+        Importer importer;
+        std::vector<AssetId> dependencies;
+        std::vector<AssetId> dependents;
+        /** @brief Number of times the asset was re-imported. */
+        uint32_t version = 0;
+    };
+
+    AssetDatabase() = default;
+    ~AssetDatabase() = default;
+
+    AssetDatabase(const AssetDatabase &) = delete;
+    AssetDatabase &operator=(const AssetDatabase &) = delete;
+    AssetDatabase(AssetDatabase &&) noexcept = default;
+    AssetDatabase &operator=(AssetDatabase &&) noexcept = default;
+
+    [[nodiscard]] static AssetId GetId(std::string_view name)
+    {
+        return entt::hashed_string{name.data(), name.size()}.value();
+    }
+
+    /**
+     * @brief Register an asset imported from a file, and start watching the file.
+     *
+     * @note If the asset is already registered, its importer and source are replaced; its dependents are kept.
+     *
+     * @param name      name of the asset, its id is GetId(name)
+     * @param source    file the asset is imported from
+     * @param importer  called each time the content of the file changes
+     * @return the id of the asset
+     */
+    AssetId Register(std::string_view name, const std::filesystem::path &source, Importer importer);
+
+    /**
+     * @brief Register an asset built from other assets, re-imported whenever one of them is.
+     *
+     * @throw ResourceManagerError if a dependency is not registered.
+     */
+    AssetId Register(std::string_view name, const std::vector<AssetId> &dependencies, Importer importer);
+
+    /**
+     * @brief Re-import an asset whenever another one is.
+     *
+     * @throw ResourceManagerError if one of the assets is not registered, or if the dependency depends on the asset.
+     */
+    void AddDependency(AssetId asset, AssetId dependency);
+
+    /**
+     * @brief Unregister an asset. Its dependents are not re-imported with its dependencies anymore.
+     */
+    void Remove(AssetId asset);
+
+    [[nodiscard]] bool Contains(AssetId asset) const { return _assets.contains(asset); }
+
+    /**
+     * @throw ResourceManagerError if the asset is not registered.
+     */
+    [[nodiscard]] const Asset &Get(AssetId asset) const;
+
+    [[nodiscard]] size_t GetAssetCount() const { return _assets.size(); }
+
+    /**
+     * @brief Re-import the assets whose source file changed since the last call, and their dependents.
+     *
+     * A file is considered changed only if its content hash differs from the last successful import, so saving a
+     * file without editing it does nothing. Errors of importers are logged, and the dependents of a failed asset keep
+     * their previous state; saving the failed file again retries it.
+     *
+     * @return the number of re-imported assets
+     */
+    size_t Update(Engine::Core &core);
+
+    /**
+     * @brief Re-import an asset and its dependents, whether or not its source changed.
+     *
+     * @return the number of re-imported assets
+     */
+    size_t Reimport(Engine::Core &core, AssetId asset);
+
+  private:
+    Asset &_GetOrCreate(AssetId asset, std::string_view name);
+    void _Unlink(AssetId asset);
+    void _RemoveSource(AssetId asset);
+    [[nodiscard]] bool _DependsOn(AssetId asset, AssetId dependency) const;
+    /** @brief Source hashes are stored for the assets that import successfully, failed ones are retried later. */
+    size_t _Reimport(Engine::Core &core, const std::vector<AssetId> &changed,
+                     const std::unordered_map<AssetId, uint64_t> &sourceHashes);
+
+    std::unordered_map<AssetId, Asset> _assets;
+    /** @brief Assets imported from each watched file, by normalized path. */
+    std::unordered_map<std::string, std::vector<AssetId>> _assetsBySource;
+    Utils::FileWatcher _watcher;
+};
+
+} // namespace Object::Resource
@@ -0,0 +1,254 @@
+#include "resource/AsyncModelLoader.hpp"
+#include "Logger.hpp"
+#include "resource/OBJLoader.hpp"
+#include <algorithm>
+#include <fmt/format.h>
+#include <stdexcept>
+
+namespace Object {
+
+AsyncModelLoader::AsyncModelLoader(uint32_t threadCount) : _threadCount(threadCount)
+{
+    if (_threadCount == 0)
+        _threadCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+}
+
+AsyncModelLoader &AsyncModelLoader::operator=(AsyncModelLoader &&other) noexcept
+{
+    if (this != &other)
+    {
+        Stop();
+        _state = std::move(other._state);
+        _threads = std::move(other._threads);
+        _threadCount = other._threadCount;
+    }
+    return *this;
+}
+
+AsyncModelLoader::Future AsyncModelLoader::Load(std::string_view path, const std::string &mtlSearchPath)
+{
+    return Load(path, Callback{}, mtlSearchPath);
+}
+
+AsyncModelLoader::Future AsyncModelLoader::Load(std::string_view path, Callback callback,
+                                                const std::string &mtlSearchPath)
+{
+    Future future;
+    {
+        std::scoped_lock lock(_state->mutex);
+        std::string key(path);
+        if (auto it = _state->requests.find(key); it != _state->requests.end())
+        {
+            if (callback)
+                it->second->callbacks.push_back(std::move(callback));
+            return it->second->future;
+        }
+
+        auto request = std::make_shared<Request>();
+        request->path = key;
+        request->mtlSearchPath = mtlSearchPath;
+        request->future = request->promise.get_future().share();
+        request->requestTime = Clock::now();
+        if (callback)
+            request->callbacks.push_back(std::move(callback));
+        future = request->future;
+
+        if (_state->stopping)
+        {
+            request->promise.set_exception(
+                std::make_exception_ptr(std::runtime_error("AsyncModelLoader: The loader is stopped.")));
+            return future;
+        }
+        _state->requests.emplace(std::move(key), request);
+        _state->jobs.emplace_back([request](State &state) { _Parse(state, request); });
+        // Workers are started on the first load, so a loader that is never used costs no thread. They are started
+        // under the lock, as Load can be called from several threads and Stop takes them under it.
+        while (_threads.size() < _threadCount)
+        {
+            _threads.emplace_back(&AsyncModelLoader::_Run, _state);
+        }
+    }
+    _state->hasJobs.notify_one();
+    return future;
+}
+
+size_t AsyncModelLoader::Update()
+{
+    std::deque<std::shared_ptr<Request>> finished;
+    {
+        std::scoped_lock lock(_state->mutex);
+        finished.swap(_state->finished);
+        for (const auto &request : finished)
+        {
+            // From now on, a request for the same path loads the file again.
+            if (auto it = _state->requests.find(request->path); it != _state->requests.end() && it->second == request)
+                _state->requests.erase(it);
+        }
+    }
+
+    for (const auto &request : finished)
+    {
+        const ModelPtr model = request->error ? nullptr : request->model;
+        for (const auto &callback : request->callbacks)
+            callback(model);
+    }
+    return finished.size();
+}
+
+void AsyncModelLoader::Wait()
+{
+    std::unique_lock lock(_state->mutex);
+    _state->idle.wait(lock, [this]() { return (_state->jobs.empty() && _state->running == 0) || _state->stopping; });
+}
+
+void AsyncModelLoader::Stop()
+{
+    if (_state == nullptr)
+        return;
+    std::vector<std::thread> threads;
+    {
+        std::scoped_lock lock(_state->mutex);
+        _state->stopping = true;
+        // Promises of unfinished requests are broken once the last job referencing them is gone.
+        _state->jobs.clear();
+        _state->requests.clear();
+        _state->finished.clear();
+        // No thread is started once the loader is stopping.
+        threads.swap(_threads);
+    }
+    _state->hasJobs.notify_all();
+    _state->idle.notify_all();
+    for (auto &thread : threads)
+    {
+        if (thread.joinable())
+            thread.join();
+    }
+}
+
+bool AsyncModelLoader::IsLoading(std::string_view path) const
+{
+    std::scoped_lock lock(_state->mutex);
+    return _state->requests.contains(std::string(path));
+}
+
+size_t AsyncModelLoader::GetLoadingCount() const
+{
+    std::scoped_lock lock(_state->mutex);
+    return _state->requests.size();
+}
+
+void AsyncModelLoader::_Run(std::shared_ptr<State> sharedState)
+{
+    State &state = *sharedState;
+    while (true)
+    {
+        std::function<void(State &)> job;
+        {
+            std::unique_lock lock(state.mutex);
+            state.hasJobs.wait(lock, [&state]() { return !state.jobs.empty() || state.stopping; });
+            if (state.stopping)
+                return;
+            job = std::move(state.jobs.front());
+            state.jobs.pop_front();
+            ++state.running;
+        }
+
+        job(state);
+
+        {
+            std::scoped_lock lock(state.mutex);
+            --state.running;
+        }
+        state.idle.notify_all();
+    }
+}
+
+void AsyncModelLoader::_Parse(State &state, const std::shared_ptr<Request> &request)
+{
+    const auto parseStartTime = Clock::now();
+    request->model = std::make_shared<Model>();
+    request->model->path = request->path;
+    request->model->timings.queued = parseStartTime - request->requestTime;
+
+    size_t shapeCount = 0;
+    try
+    {
+        request->loader = std::make_shared<OBJLoader>(request->path, request->mtlSearchPath);
+        request->model->materials = request->loader->GetMaterials();
+        shapeCount = request->loader->GetShapeCount();
+    }
+    catch (const std::exception &e)
+    {
+        Log::Error(fmt::format("AsyncModelLoader: Failed to load '{}': {}", request->path, e.what()));
+        request->error = std::current_exception();
+        _Finish(state, request);
+        return;
+    }
+
+    request->buildStartTime = Clock::now();
+    request->model->timings.parse = request->buildStartTime - parseStartTime;
+    if (shapeCount == 0)
+    {
+        _Finish(state, request);
+        return;
+    }
+
+    request->model->shapes.resize(shapeCount);
+    request->remainingShapes = shapeCount;
+    {
+        std::scoped_lock lock(state.mutex);
+        // Shapes go first, so models finish one after the other instead of all being half built.
+        for (size_t shape = shapeCount; shape-- > 0;)
+            state.jobs.emplace_front([request, shape](State &s) { _BuildShape(s, request, shape); });
+    }
+    state.hasJobs.notify_all();
+}
+
+void AsyncModelLoader::_BuildShape(State &state, const std::shared_ptr<Request> &request, size_t shape)
+{
+    try
+    {
+        request->model->shapes[shape] = request->loader->BuildShape(shape);
+    }
+    catch (const std::exception &e)
+    {
+        Log::Error(fmt::format("AsyncModelLoader: Failed to build shape {} of '{}': {}", shape, request->path,
+                               e.what()));
+        std::scoped_lock lock(state.mutex);
+        if (!request->error)
+            request->error = std::current_exception();
+    }
+
+    if (request->remainingShapes.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        request->model->timings.build = Clock::now() - request->buildStartTime;
+        _Finish(state, request);
+    }
+}
+
+void AsyncModelLoader::_Finish(State &state, const std::shared_ptr<Request> &request)
+{
+    // The parsed file is not needed anymore, only the shapes built from it.
+    request->loader.reset();
+    auto &timings = request->model->timings;
+    timings.total = Clock::now() - request->requestTime;
+
+    if (request->error)
+    {
+        request->promise.set_exception(request->error);
+    }
+    else
+    {
+        Log::Debug(fmt::format("AsyncModelLoader: Loaded '{}' ({} shapes) in {:.1f} ms: {:.1f} ms queued, "
+                               "{:.1f} ms parsing, {:.1f} ms building shapes",
+                               request->path, request->model->shapes.size(), timings.total.count(),
+                               timings.queued.count(), timings.parse.count(), timings.build.count()));
+        request->promise.set_value(request->model);
+    }
+
+    std::scoped_lock lock(state.mutex);
+    if (!state.stopping)
+        state.finished.push_back(request);
+}
+
+} // namespace Object
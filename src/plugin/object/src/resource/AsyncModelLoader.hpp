@@ -0,0 +1,159 @@
+#pragma once
+
+#include "component/Material.hpp"
+#include "resource/Shape.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Object {
+
+class OBJLoader;
+
+/**
+ * @brief Loads OBJ files on worker threads, so scenes can stream models in without blocking the main thread.
+ *
+ * A file is parsed by one worker, then its shapes are built in parallel by all of them (see OBJLoader::BuildShape).
+ * Each load is reported through a future, and through callbacks fired by Update on the thread calling it, typically
+ * once per frame from the main thread.
+ *
+ * Requests for a file already being loaded share its load, until Update reported it: call Update regularly, or
+ * finished models stay in memory and are returned again for the same path.
+ *
+ * @example "Streaming a model in"
+ * @code
+ * loader.Load("assets/level.obj", [&core](const Object::AsyncModelLoader::ModelPtr &model) {
+ *     if (model)
+ *         SpawnShapes(core, model->shapes);
+ * });
+ * // Every frame:
+ * loader.Update();
+ * @endcode
+ */
+class AsyncModelLoader {
+  public:
+    using Clock = std::chrono::steady_clock;
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+
+    /** @brief Time spent in each step of a load. */
+    struct Timings {
+        /** @brief From the request to the start of the parsing, waiting for a free worker. */
+        Milliseconds queued{};
+        Milliseconds parse{};
+        /** @brief Building the shapes, from the end of the parsing to the last built shape. */
+        Milliseconds build{};
+        Milliseconds total{};
+    };
+
+    struct Model {
+        std::string path;
+        std::vector<Resource::Shape> shapes;
+        std::vector<Component::Material> materials;
+        Timings timings;
+    };
+
+    using ModelPtr = std::shared_ptr<const Model>;
+    /** @brief Holds the loaded model, or rethrows the error that made the load fail (e.g. OBJLoaderError). */
+    using Future = std::shared_future<ModelPtr>;
+    /** @brief Called by Update with the loaded model, or nullptr if the load failed. */
+    using Callback = std::function<void(const ModelPtr &)>;
+
+    /**
+     * @param threadCount  number of worker threads, depending on the number of cores if 0
+     */
+    explicit AsyncModelLoader(uint32_t threadCount = 0);
+    ~AsyncModelLoader() { Stop(); }
+
+    AsyncModelLoader(const AsyncModelLoader &) = delete;
+    AsyncModelLoader &operator=(const AsyncModelLoader &) = delete;
+    AsyncModelLoader(AsyncModelLoader &&) noexcept = default;
+    AsyncModelLoader &operator=(AsyncModelLoader &&other) noexcept;
+
+    /**
+     * @brief Queue the loading of an OBJ file, unless it is already being loaded. Can be called from any thread.
+     *
+     * @param path           path of the OBJ file
+     * @param mtlSearchPath  directory of the material files, see OBJLoader
+     * @return the future of the load, shared with the other requests for the same path
+     */
+    Future Load(std::string_view path, const std::string &mtlSearchPath = "");
+
+    /**
+     * @brief Queue the loading of an OBJ file, and call the callback from Update once it is loaded or failed.
+     */
+    Future Load(std::string_view path, Callback callback, const std::string &mtlSearchPath = "");
+
+    /**
+     * @brief Fire the callbacks of the finished loads, on the calling thread.
+     *
+     * @return the number of finished loads
+     */
+    size_t Update();
+
+    /**
+     * @brief Wait for every queued load to finish. Callbacks are still fired by the next Update.
+     */
+    void Wait();
+
+    /**
+     * @brief Stop the worker threads. Loads that are not finished are dropped: their futures throw
+     * std::future_error, and their callbacks are never called. No file can be loaded afterwards.
+     */
+    void Stop();
+
+    [[nodiscard]] bool IsLoading(std::string_view path) const;
+    /** @brief Number of loads requested and not reported by Update yet. */
+    [[nodiscard]] size_t GetLoadingCount() const;
+
+  private:
+    struct Request {
+        std::string path;
+        std::string mtlSearchPath;
+        std::promise<ModelPtr> promise;
+        Future future;
+        std::vector<Callback> callbacks;
+        Clock::time_point requestTime;
+        Clock::time_point buildStartTime;
+        std::shared_ptr<OBJLoader> loader;
+        std::shared_ptr<Model> model;
+        std::atomic<size_t> remainingShapes = 0;
+        std::exception_ptr error;
+    };
+
+    /** @brief Shared with the worker threads, so that the loader itself can be moved. */
+    struct State {
+        mutable std::mutex mutex;
+        std::condition_variable hasJobs;
+        std::condition_variable idle;
+        std::deque<std::function<void(State &)>> jobs;
+        std::unordered_map<std::string, std::shared_ptr<Request>> requests;
+        std::deque<std::shared_ptr<Request>> finished;
+        /** @brief Number of jobs being run by the worker threads. */
+        size_t running = 0;
+        bool stopping = false;
+    };
+
+    static void _Run(std::shared_ptr<State> sharedState);
+    static void _Parse(State &state, const std::shared_ptr<Request> &request);
+    static void _BuildShape(State &state, const std::shared_ptr<Request> &request, size_t shape);
+    static void _Finish(State &state, const std::shared_ptr<Request> &request);
+
+    std::shared_ptr<State> _state = std::make_shared<State>();
+    /** @brief Started by Load and joined by Stop, under the mutex of the state. */
+    std::vector<std::thread> _threads;
+    uint32_t _threadCount = 0;
+};
+
+} // namespace Object
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "component/Mesh.hpp"
+#include "resource/ResourceManager.hpp"
+
+namespace Object::Resource {
+
+/**
+ * @brief Mesh assets shared by entities through Component::MeshHandle.
+ *
+ * Assets are immutable once added: replacing an asset does not update the entities that already reference it, unless
+ * it is replaced with Utils::ReplaceMeshAsset.
+ */
+using MeshContainer = ResourceManager<Component::Mesh>;
+
+} // namespace Object::Resource
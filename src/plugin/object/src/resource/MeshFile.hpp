@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <glm/glm.hpp>
+
+namespace Object::Resource {
+
+/**
+ * @brief Layout of the engine binary mesh files (".esmesh").
+ *
+ * A file starts with a MeshFileHeader, followed by blobs located by the offsets of the header, each aligned to
+ * MESH_FILE_ALIGNMENT bytes:
+ * - the submesh table (MeshFileSubmesh[submeshCount]),
+ * - the material table (MeshFileMaterial[materialCount]),
+ * - positions and normals (glm::vec3[vertexCount]) and texture coordinates (glm::vec2[vertexCount]),
+ * - indices (uint32_t[indexCount]), relative to the first vertex of their submesh,
+ * - the string table, holding names and texture paths referenced by (offset, size) pairs, without terminators.
+ *
+ * Blobs are laid out exactly as in memory, so loading a file is a copy (or a GPU upload) of each blob. The format is
+ * little endian, and any change to the layout must bump MESH_FILE_VERSION.
+ */
+inline constexpr std::array<char, 8> MESH_FILE_MAGIC = {'E', 'S', 'Q', 'M', 'E', 'S', 'H', '\0'};
+inline constexpr uint32_t MESH_FILE_VERSION = 1;
+inline constexpr uint64_t MESH_FILE_ALIGNMENT = 16;
+inline constexpr const char *MESH_FILE_EXTENSION = ".esmesh";
+
+static_assert(std::endian::native == std::endian::little, "Mesh files are only supported on little endian targets.");
+static_assert(sizeof(glm::vec3) == 3 * sizeof(float) && sizeof(glm::vec2) == 2 * sizeof(float));
+
+/** @brief Range of the string table. */
+struct MeshFileString {
+    uint32_t offset = 0;
+    uint32_t size = 0;
+};
+
+struct MeshFileHeader {
+    std::array<char, 8> magic = MESH_FILE_MAGIC;
+    uint32_t version = MESH_FILE_VERSION;
+    uint32_t submeshCount = 0;
+    /** @brief Hash of the file the mesh was converted from, 0 if unknown. */
+    uint64_t sourceHash = 0;
+    uint64_t fileSize = 0;
+    uint32_t materialCount = 0;
+    uint32_t reserved = 0;
+    uint64_t vertexCount = 0;
+    uint64_t indexCount = 0;
+    uint64_t submeshesOffset = 0;
+    uint64_t materialsOffset = 0;
+    uint64_t positionsOffset = 0;
+    uint64_t normalsOffset = 0;
+    uint64_t texCoordsOffset = 0;
+    uint64_t indicesOffset = 0;
+    uint64_t stringsOffset = 0;
+    uint64_t stringsSize = 0;
+};
+
+/** @brief A shape of the file: a range of the vertices and of the indices, with its material and bounds. */
+struct MeshFileSubmesh {
+    uint64_t firstVertex = 0;
+    uint64_t vertexCount = 0;
+    uint64_t firstIndex = 0;
+    uint64_t indexCount = 0;
+    /** @brief Index in the material table, or -1 for the default material. */
+    int32_t material = -1;
+    MeshFileString name{};
+    std::array<float, 3> boundsMin{};
+    std::array<float, 3> boundsMax{};
+    uint32_t reserved = 0;
+};
+
+struct MeshFileMaterial {
+    MeshFileString name{};
+    MeshFileString diffuseTexName{};
+    std::array<float, 3> ambient{};
+    std::array<float, 3> diffuse{};
+    std::array<float, 3> specular{};
+    std::array<float, 3> transmittance{};
+    std::array<float, 3> emission{};
+    float shininess = 0.0f;
+    float ior = 0.0f;
+    float dissolve = 0.0f;
+};
+
+static_assert(sizeof(MeshFileHeader) == 120);
+static_assert(sizeof(MeshFileSubmesh) == 72);
+static_assert(sizeof(MeshFileMaterial) == 88);
+
+} // namespace Object::Resource
@@ -0,0 +1,205 @@
+#include "resource/MeshFileLoader.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fmt/format.h>
+#include <fstream>
+
+namespace Object {
+
+namespace {
+
+glm::vec3 ToVec3(const std::array<float, 3> &value) { return {value[0], value[1], value[2]}; }
+
+} // namespace
+
+MeshFileLoader::MeshFileLoader(const std::filesystem::path &filepath) : _path(filepath), _file(filepath)
+{
+    const auto data = _file.GetData();
+    if (data.size() < sizeof(Resource::MeshFileHeader))
+        throw MeshFileError(fmt::format("'{}' is too small to be a mesh file.", _path.string()));
+
+    std::memcpy(&_header, data.data(), sizeof(_header));
+    if (_header.magic != Resource::MESH_FILE_MAGIC)
+        throw MeshFileError(fmt::format("'{}' is not a mesh file.", _path.string()));
+    if (_header.version != Resource::MESH_FILE_VERSION)
+        throw MeshFileError(fmt::format("'{}' has version {}, expected {}.", _path.string(), _header.version,
+                                        Resource::MESH_FILE_VERSION));
+    if (_header.fileSize != data.size())
+        throw MeshFileError(
+            fmt::format("'{}' is truncated: {} bytes out of {}.", _path.string(), data.size(), _header.fileSize));
+
+    _Validate();
+}
+
+template <typename T> std::span<const T> MeshFileLoader::_GetBlob(uint64_t offset, uint64_t count) const
+{
+    const auto data = _file.GetData();
+    if (offset % Resource::MESH_FILE_ALIGNMENT != 0 || offset > data.size() ||
+        count > (data.size() - offset) / sizeof(T))
+        throw MeshFileError(fmt::format("'{}' has a blob of {} elements at {} out of the file.", _path.string(), count,
+                                        offset));
+    // Blobs are aligned and laid out as in memory, they are used in place.
+    return {reinterpret_cast<const T *>(data.data() + offset), static_cast<size_t>(count)};
+}
+
+std::span<const Resource::MeshFileSubmesh> MeshFileLoader::GetSubmeshes() const
+{
+    return _GetBlob<Resource::MeshFileSubmesh>(_header.submeshesOffset, _header.submeshCount);
+}
+
+std::span<const Resource::MeshFileMaterial> MeshFileLoader::GetMaterialTable() const
+{
+    return _GetBlob<Resource::MeshFileMaterial>(_header.materialsOffset, _header.materialCount);
+}
+
+std::span<const glm::vec3> MeshFileLoader::GetPositions() const
+{
+    return _GetBlob<glm::vec3>(_header.positionsOffset, _header.vertexCount);
+}
+
+std::span<const glm::vec3> MeshFileLoader::GetNormals() const
+{
+    return _GetBlob<glm::vec3>(_header.normalsOffset, _header.vertexCount);
+}
+
+std::span<const glm::vec2> MeshFileLoader::GetTexCoords() const
+{
+    return _GetBlob<glm::vec2>(_header.texCoordsOffset, _header.vertexCount);
+}
+
+std::span<const uint32_t> MeshFileLoader::GetIndices() const
+{
+    return _GetBlob<uint32_t>(_header.indicesOffset, _header.indexCount);
+}
+
+std::string_view MeshFileLoader::GetString(const Resource::MeshFileString &string) const
+{
+    const auto strings = _GetBlob<char>(_header.stringsOffset, _header.stringsSize);
+    if (string.offset > strings.size() || string.size > strings.size() - string.offset)
+        throw MeshFileError(fmt::format("'{}' has a string out of its string table.", _path.string()));
+    return {strings.data() + string.offset, string.size};
+}
+
+void MeshFileLoader::_Validate() const
+{
+    (void) GetPositions();
+    (void) GetNormals();
+    (void) GetTexCoords();
+    const auto indices = GetIndices();
+    const auto materials = GetMaterialTable();
+
+    for (const auto &material : materials)
+    {
+        (void) GetString(material.name);
+        (void) GetString(material.diffuseTexName);
+    }
+
+    for (const auto &submesh : GetSubmeshes())
+    {
+        (void) GetString(submesh.name);
+        if (submesh.firstVertex > _header.vertexCount ||
+            submesh.vertexCount > _header.vertexCount - submesh.firstVertex ||
+            submesh.firstIndex > _header.indexCount || submesh.indexCount > _header.indexCount - submesh.firstIndex)
+            throw MeshFileError(fmt::format("'{}' has a submesh out of its vertices or indices.", _path.string()));
+        if (submesh.material >= static_cast<int64_t>(materials.size()))
+            throw MeshFileError(fmt::format("'{}' has a submesh with the unknown material {}.", _path.string(),
+                                            submesh.material));
+
+        // Checked once here, so the indices can be copied or uploaded as is afterwards.
+        const auto submeshIndices = indices.subspan(submesh.firstIndex, submesh.indexCount);
+        if (!submeshIndices.empty() && *std::ranges::max_element(submeshIndices) >= submesh.vertexCount)
+            throw MeshFileError(fmt::format("'{}' has an index out of its submesh.", _path.string()));
+    }
+}
+
+void MeshFileLoader::_ToMaterial(const Resource::MeshFileMaterial &source, Component::Material &material) const
+{
+    material.name = GetString(source.name);
+    material.diffuseTexName = GetString(source.diffuseTexName);
+    material.ambient = ToVec3(source.ambient);
+    material.diffuse = ToVec3(source.diffuse);
+    material.specular = ToVec3(source.specular);
+    material.transmittance = ToVec3(source.transmittance);
+    material.emission = ToVec3(source.emission);
+    material.shininess = source.shininess;
+    material.ior = source.ior;
+    material.dissolve = source.dissolve;
+}
+
+const Component::Mesh &MeshFileLoader::GetMesh()
+{
+    if (!_mesh.GetVertices().empty())
+        return _mesh;
+
+    const auto positions = GetPositions();
+    const auto normals = GetNormals();
+    const auto texCoords = GetTexCoords();
+    const auto indices = GetIndices();
+
+    _mesh.SetVertices(std::vector<glm::vec3>(positions.begin(), positions.end()));
+    _mesh.SetNormals(std::vector<glm::vec3>(normals.begin(), normals.end()));
+    _mesh.SetTexCoords(std::vector<glm::vec2>(texCoords.begin(), texCoords.end()));
+
+    std::vector<uint32_t> meshIndices(indices.begin(), indices.end());
+    for (const auto &submesh : GetSubmeshes())
+    {
+        const auto begin = meshIndices.begin() + static_cast<std::ptrdiff_t>(submesh.firstIndex);
+        const auto firstVertex = static_cast<uint32_t>(submesh.firstVertex);
+        std::for_each(begin, begin + static_cast<std::ptrdiff_t>(submesh.indexCount),
+                      [firstVertex](uint32_t &index) { index += firstVertex; });
+    }
+    _mesh.SetIndices(std::move(meshIndices));
+
+    return _mesh;
+}
+
+std::vector<Resource::Shape> MeshFileLoader::GetShapes() const
+{
+    const auto positions = GetPositions();
+    const auto normals = GetNormals();
+    const auto texCoords = GetTexCoords();
+    const auto indices = GetIndices();
+    const auto materials = GetMaterialTable();
+    const auto submeshes = GetSubmeshes();
+
+    std::vector<Resource::Shape> shapes(submeshes.size());
+    for (size_t i = 0; i < submeshes.size(); ++i)
+    {
+        const auto &submesh = submeshes[i];
+        auto &shape = shapes[i];
+        shape.name = GetString(submesh.name);
+
+        const auto vertices = positions.subspan(submesh.firstVertex, submesh.vertexCount);
+        const auto shapeNormals = normals.subspan(submesh.firstVertex, submesh.vertexCount);
+        const auto shapeTexCoords = texCoords.subspan(submesh.firstVertex, submesh.vertexCount);
+        const auto shapeIndices = indices.subspan(submesh.firstIndex, submesh.indexCount);
+        shape.mesh.SetVertices(std::vector<glm::vec3>(vertices.begin(), vertices.end()));
+        shape.mesh.SetNormals(std::vector<glm::vec3>(shapeNormals.begin(), shapeNormals.end()));
+        shape.mesh.SetTexCoords(std::vector<glm::vec2>(shapeTexCoords.begin(), shapeTexCoords.end()));
+        shape.mesh.SetIndices(std::vector<uint32_t>(shapeIndices.begin(), shapeIndices.end()));
+
+        if (submesh.material >= 0)
+            _ToMaterial(materials[static_cast<size_t>(submesh.material)], shape.material);
+    }
+    return shapes;
+}
+
+std::vector<Component::Material> MeshFileLoader::GetMaterials() const
+{
+    const auto table = GetMaterialTable();
+    std::vector<Component::Material> materials(table.size());
+    for (size_t i = 0; i < table.size(); ++i)
+        _ToMaterial(table[i], materials[i]);
+    return materials;
+}
+
+bool MeshFileLoader::ReadHeader(const std::filesystem::path &filepath, Resource::MeshFileHeader &header)
+{
+    std::ifstream stream(filepath, std::ios::binary);
+    if (!stream.read(reinterpret_cast<char *>(&header), sizeof(header)))
+        return false;
+    return header.magic == Resource::MESH_FILE_MAGIC && header.version == Resource::MESH_FILE_VERSION;
+}
+
+} // namespace Object
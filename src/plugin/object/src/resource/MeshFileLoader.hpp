@@ -0,0 +1,89 @@
+#pragma once
+
+#include "component/Material.hpp"
+#include "component/Mesh.hpp"
+#include "exception/MeshFileError.hpp"
+#include "resource/MeshFile.hpp"
+#include "resource/Shape.hpp"
+#include "utils/MappedFile.hpp"
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace Object {
+
+/**
+ * @brief MeshFileLoader loads the engine binary mesh files, written by Utils::WriteMeshFile.
+ *
+ * The file is memory mapped and checked once when the loader is built: its blobs are then copied as is into meshes,
+ * without any parsing. The raw blobs can also be read directly, e.g. to upload them to the GPU, for as long as the
+ * loader lives.
+ *
+ * It provides the same accessors as OBJLoader, so OBJ files can be swapped for their converted version (see
+ * Utils::GetCachedMeshFile).
+ *
+ * @example "Loading the converted version of an OBJ file"
+ * @code
+ * Object::MeshFileLoader loader(Object::Utils::GetCachedMeshFile("assets/model.obj", "cache"));
+ * for (const auto &shape : loader.GetShapes()) {}
+ * @endcode
+ *
+ * @see Resource::MeshFileHeader for the layout of the file.
+ */
+class MeshFileLoader {
+  public:
+    /**
+     * @brief Map a mesh file and check its content.
+     *
+     * @throws MeshFileError if the file cannot be mapped, has another version, or any of its ranges or indices is out
+     * of bounds.
+     */
+    explicit MeshFileLoader(const std::filesystem::path &filepath);
+    ~MeshFileLoader() = default;
+
+    /**
+     * @brief Retrieves all submeshes merged in a single mesh. It is built on the first call and cached in the loader.
+     */
+    [[nodiscard]] const Component::Mesh &GetMesh();
+
+    /**
+     * @brief Retrieves one shape per submesh, with its own mesh and material.
+     */
+    [[nodiscard]] std::vector<Resource::Shape> GetShapes() const;
+
+    /**
+     * @brief Retrieves the material table of the file.
+     */
+    [[nodiscard]] std::vector<Component::Material> GetMaterials() const;
+
+    [[nodiscard]] const Resource::MeshFileHeader &GetHeader() const { return _header; }
+    [[nodiscard]] std::span<const Resource::MeshFileSubmesh> GetSubmeshes() const;
+    [[nodiscard]] std::span<const Resource::MeshFileMaterial> GetMaterialTable() const;
+    [[nodiscard]] std::span<const glm::vec3> GetPositions() const;
+    [[nodiscard]] std::span<const glm::vec3> GetNormals() const;
+    [[nodiscard]] std::span<const glm::vec2> GetTexCoords() const;
+    /** @brief Indices of all submeshes, each relative to the first vertex of its submesh. */
+    [[nodiscard]] std::span<const uint32_t> GetIndices() const;
+    [[nodiscard]] std::string_view GetString(const Resource::MeshFileString &string) const;
+
+    /**
+     * @brief Read the header of a mesh file without mapping the whole file.
+     *
+     * @return false if the file cannot be read or is not a mesh file of the current version.
+     */
+    [[nodiscard]] static bool ReadHeader(const std::filesystem::path &filepath, Resource::MeshFileHeader &header);
+
+  private:
+    template <typename T> [[nodiscard]] std::span<const T> _GetBlob(uint64_t offset, uint64_t count) const;
+
+    void _Validate() const;
+    void _ToMaterial(const Resource::MeshFileMaterial &source, Component::Material &material) const;
+
+    std::filesystem::path _path;
+    Utils::MappedFile _file;
+    Resource::MeshFileHeader _header{};
+    Component::Mesh _mesh{};
+};
+
+} // namespace Object
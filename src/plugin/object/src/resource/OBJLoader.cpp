@@ -1,8 +1,62 @@
 #define TINYOBJLOADER_IMPLEMENTATION
 #include "OBJLoader.hpp"
 
+#include "utils/MeshOptimizer.hpp"
+#include <algorithm>
+#include <bit>
+#include <limits>
+
 namespace Object {
 
+class OBJLoader::VertexMap {
+  public:
+    /**
+     * @brief Create a map able to hold the given number of face corners without growing, at half its capacity at most.
+     */
+    explicit VertexMap(size_t cornerCount) : _slots(std::bit_ceil(std::max<size_t>(cornerCount * 2u, 16u))) {}
+
+    /**
+     * @brief Find the vertex of a face corner, or map the corner to the given new vertex.
+     *
+     * @return the vertex of the corner, and whether it was just inserted.
+     */
+    std::pair<uint32_t, bool> FindOrInsert(const tinyobj::index_t &corner, uint32_t vertex)
+    {
+        const size_t mask = _slots.size() - 1u;
+        for (size_t slot = Hash(corner) & mask;; slot = (slot + 1u) & mask)
+        {
+            Slot &current = _slots[slot];
+            if (current.vertex == EMPTY)
+            {
+                current = {corner, vertex};
+                return {vertex, true};
+            }
+            if (current.corner.vertex_index == corner.vertex_index &&
+                current.corner.normal_index == corner.normal_index &&
+                current.corner.texcoord_index == corner.texcoord_index)
+                return {current.vertex, false};
+        }
+    }
+
+  private:
+    static constexpr uint32_t EMPTY = std::numeric_limits<uint32_t>::max();
+
+    struct Slot {
+        tinyobj::index_t corner{};
+        uint32_t vertex = EMPTY;
+    };
+
+    static size_t Hash(const tinyobj::index_t &corner)
+    {
+        uint64_t hash = static_cast<uint32_t>(corner.vertex_index) * 0x9E3779B97F4A7C15ull;
+        hash ^= static_cast<uint32_t>(corner.normal_index) * 0xC2B2AE3D27D4EB4Full;
+        hash ^= static_cast<uint32_t>(corner.texcoord_index) * 0x165667B19E3779F9ull;
+        return static_cast<size_t>(hash ^ (hash >> 29u));
+    }
+
+    std::vector<Slot> _slots;
+};
+
 OBJLoader::OBJLoader(const std::string &filepath, const std::string &mtlSearchPath)
 {
     if (filepath.empty())
@@ -25,7 +79,7 @@ OBJLoader::OBJLoader(const std::string &filepath, const std::string &mtlSearchPa
         throw OBJLoaderError(_reader.Warning());
 }
 
-Component::Mesh OBJLoader::GetMesh()
+const Component::Mesh &OBJLoader::GetMesh()
 {
     if (!_mesh.GetVertices().empty())
         return _mesh;
@@ -33,10 +87,17 @@ Component::Mesh OBJLoader::GetMesh()
     const auto &attrib = _reader.GetAttrib();
     const auto &shapes = _reader.GetShapes();
 
+    size_t corner_count = 0u;
+    for (const auto &shape : shapes)
+        corner_count += shape.mesh.indices.size();
+
     _mesh.ReserveVertices(attrib.vertices.size() / 3u);
-    _mesh.ReserveNormals(attrib.normals.size() / 3u);
-    _mesh.ReserveTexCoords(attrib.texcoords.size() / 2u);
-    _mesh.ReserveIndices(shapes.size() * 3u);
+    _mesh.ReserveNormals(attrib.vertices.size() / 3u);
+    _mesh.ReserveTexCoords(attrib.vertices.size() / 3u);
+    _mesh.ReserveIndices(corner_count);
+
+    // Shapes index the same attribute arrays, so their corners are deduplicated together.
+    VertexMap vertexMap(corner_count);
 
     for (size_t shape = 0u; shape < shapes.size(); ++shape)
     {
@@ -46,12 +107,14 @@ Component::Mesh OBJLoader::GetMesh()
         {
             auto face_vertices = static_cast<size_t>(shapes[shape].mesh.num_face_vertices[face]);
 
-            ProcessMeshFace(_mesh, shapes, shape, face_vertices, index_offset);
+            ProcessMeshFace(_mesh, vertexMap, shapes, shape, face_vertices, index_offset);
 
             index_offset += face_vertices;
         }
     }
 
+    Utils::OptimizeMesh(_mesh);
+
     return _mesh;
 }
 
@@ -60,45 +123,55 @@ std::vector<Resource::Shape> OBJLoader::GetShapes()
     if (!_shapes.empty())
         return _shapes;
 
+    _shapes.reserve(GetShapeCount());
+
+    for (size_t shape = 0u; shape < GetShapeCount(); ++shape)
+        _shapes.emplace_back(BuildShape(shape));
+
+    return _shapes;
+}
+
+size_t OBJLoader::GetShapeCount() const { return _reader.GetShapes().size(); }
+
+Resource::Shape OBJLoader::BuildShape(size_t shape) const
+{
     const auto &attrib = _reader.GetAttrib();
     const auto &shapes = _reader.GetShapes();
 
-    _shapes.reserve(shapes.size());
-
-    for (size_t shape = 0u; shape < shapes.size(); ++shape)
-    {
-        Resource::Shape shapeResource;
-        shapeResource.name = shapes[shape].name;
-        Component::Mesh &mesh = shapeResource.mesh;
+    Resource::Shape shapeResource;
+    shapeResource.name = shapes[shape].name;
+    Component::Mesh &mesh = shapeResource.mesh;
 
-        mesh.ReserveVertices(attrib.vertices.size() / 3u);
-        mesh.ReserveNormals(attrib.normals.size() / 3u);
-        mesh.ReserveTexCoords(attrib.texcoords.size() / 2u);
-        mesh.ReserveIndices(shapes[shape].mesh.indices.size());
+    const size_t corner_count = shapes[shape].mesh.indices.size();
+    const size_t vertex_capacity = std::min(corner_count, attrib.vertices.size() / 3u);
+    mesh.ReserveVertices(vertex_capacity);
+    mesh.ReserveNormals(vertex_capacity);
+    mesh.ReserveTexCoords(vertex_capacity);
+    mesh.ReserveIndices(corner_count);
 
-        size_t index_offset = 0u;
+    VertexMap vertexMap(corner_count);
+    size_t index_offset = 0u;
 
-        for (size_t face = 0u; face < shapes[shape].mesh.num_face_vertices.size(); ++face)
-        {
-            auto face_vertices = static_cast<size_t>(shapes[shape].mesh.num_face_vertices[face]);
+    for (size_t face = 0u; face < shapes[shape].mesh.num_face_vertices.size(); ++face)
+    {
+        auto face_vertices = static_cast<size_t>(shapes[shape].mesh.num_face_vertices[face]);
 
-            ProcessMeshFace(mesh, shapes, shape, face_vertices, index_offset);
+        ProcessMeshFace(mesh, vertexMap, shapes, shape, face_vertices, index_offset);
 
-            index_offset += face_vertices;
-        }
+        index_offset += face_vertices;
+    }
 
-        int material_id = shapes[shape].mesh.material_ids.empty() ? -1 : shapes[shape].mesh.material_ids[0];
+    Utils::OptimizeMesh(mesh);
 
-        if (material_id >= 0 && static_cast<size_t>(material_id) < _reader.GetMaterials().size())
-        {
-            const auto &mat = _reader.GetMaterials()[material_id];
-            SetMaterialProperties(shapeResource.material, mat);
-        }
+    int material_id = shapes[shape].mesh.material_ids.empty() ? -1 : shapes[shape].mesh.material_ids[0];
 
-        _shapes.emplace_back(std::move(shapeResource));
+    if (material_id >= 0 && static_cast<size_t>(material_id) < _reader.GetMaterials().size())
+    {
+        const auto &mat = _reader.GetMaterials()[material_id];
+        SetMaterialProperties(shapeResource.material, mat);
     }
 
-    return _shapes;
+    return shapeResource;
 }
 
 std::vector<Component::Material> OBJLoader::GetMaterials()
@@ -120,8 +193,9 @@ std::vector<Component::Material> OBJLoader::GetMaterials()
     return _materials;
 }
 
-void OBJLoader::ProcessMeshFace(Component::Mesh &mesh, const std::vector<tinyobj::shape_t> &shapes, size_t shape,
-                                size_t face_vertices, size_t &index_offset) noexcept
+void OBJLoader::ProcessMeshFace(Component::Mesh &mesh, VertexMap &vertexMap,
+                                const std::vector<tinyobj::shape_t> &shapes, size_t shape, size_t face_vertices,
+                                size_t &index_offset) const noexcept
 {
     const auto &attrib = _reader.GetAttrib();
 
@@ -129,6 +203,12 @@ void OBJLoader::ProcessMeshFace(Component::Mesh &mesh, const std::vector<tinyobj
     {
         tinyobj::index_t idx = shapes[shape].mesh.indices[index_offset + vertex];
 
+        const auto [mesh_vertex, inserted] =
+            vertexMap.FindOrInsert(idx, static_cast<uint32_t>(mesh.GetVertices().size()));
+        mesh.EmplaceIndices(mesh_vertex);
+        if (!inserted)
+            continue;
+
         if (idx.vertex_index >= 0)
         {
             auto vertex_index = static_cast<size_t>(idx.vertex_index);
@@ -166,12 +246,10 @@ void OBJLoader::ProcessMeshFace(Component::Mesh &mesh, const std::vector<tinyobj
         {
             mesh.EmplaceTexCoords(0.0f, 0.0f);
         }
-
-        mesh.EmplaceIndices(static_cast<uint32_t>(mesh.GetVertices().size() - 1u));
     }
 }
 
-void OBJLoader::SetMaterialProperties(Component::Material &material, const tinyobj::material_t &mat) noexcept
+void OBJLoader::SetMaterialProperties(Component::Material &material, const tinyobj::material_t &mat) const noexcept
 {
     material.name = mat.name;
     material.ambient = glm::vec3(mat.ambient[0], mat.ambient[1], mat.ambient[2]);
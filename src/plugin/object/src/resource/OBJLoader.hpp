@@ -37,7 +37,9 @@ namespace Object {
  * It utilizes the TinyObjLoader library to read the contents of an OBJ file and
  * extract mesh data such as vertices, normals, texture coordinates, and indices.
  * The loaded data is stored in a Component::Mesh object, which can be retrieved
- * using the GetMesh() method.
+ * using the GetMesh() method. Meshes are indexed, with one vertex per distinct
+ * (position, normal, texcoord) triple, and ordered for the GPU vertex cache,
+ * overdraw and vertex fetch (see Utils::OptimizeMesh).
  *
  * @example "Loading an OBJ file"
  * @code
@@ -85,11 +87,14 @@ class OBJLoader {
     /**
      * @brief Retrieves the loaded mesh data.
      *
-     * @return Component::Mesh The mesh data extracted from the OBJ file.
+     * The mesh is built on the first call and cached in the loader: copy it only to own a mutable mesh, or share it
+     * between entities with Utils::LoadOBJMeshAsset.
+     *
+     * @return const Component::Mesh & The mesh data extracted from the OBJ file, valid as long as the loader.
      *
      * @see Component::Mesh
      */
-    [[nodiscard]] Component::Mesh GetMesh();
+    [[nodiscard]] const Component::Mesh &GetMesh();
 
     /**
      * @brief Retrieves the loaded shapes data.
@@ -100,6 +105,21 @@ class OBJLoader {
      */
     [[nodiscard]] std::vector<Resource::Shape> GetShapes();
 
+    /**
+     * @brief Retrieves the number of shapes of the OBJ file.
+     */
+    [[nodiscard]] size_t GetShapeCount() const;
+
+    /**
+     * @brief Builds a single shape, without caching it.
+     *
+     * It only reads the parsed file, so shapes can be built concurrently from several threads (see AsyncModelLoader).
+     *
+     * @param shape The index of the shape, lower than GetShapeCount().
+     * @return Resource::Shape The shape, as returned by GetShapes().
+     */
+    [[nodiscard]] Resource::Shape BuildShape(size_t shape) const;
+
     /**
      * @brief Retrieves the loaded materials data.
      *
@@ -110,10 +130,19 @@ class OBJLoader {
     [[nodiscard]] std::vector<Component::Material> GetMaterials();
 
   private:
+    /**
+     * @brief Flat hash map from the (position, normal, texcoord) index triple of a face corner to the vertex of the
+     * mesh it was emitted as.
+     */
+    class VertexMap;
+
     /**
      * @brief Processes a single face of the mesh and populates the Mesh object.
      *
+     * Face corners sharing the same position, normal and texcoord indices share the same vertex.
+     *
      * @param mesh The Mesh object to populate.
+     * @param vertexMap The vertices already emitted in the mesh.
      * @param shapes The vector of shapes loaded from the OBJ file.
      * @param shape The index of the current shape being processed.
      * @param face_vertices The number of vertices in the current face.
@@ -121,8 +150,8 @@ class OBJLoader {
      *
      * @see Component::Mesh
      */
-    void ProcessMeshFace(Component::Mesh &mesh, const std::vector<tinyobj::shape_t> &shapes, size_t shape,
-                         size_t face_vertices, size_t &index_offset) noexcept;
+    void ProcessMeshFace(Component::Mesh &mesh, VertexMap &vertexMap, const std::vector<tinyobj::shape_t> &shapes,
+                         size_t shape, size_t face_vertices, size_t &index_offset) const noexcept;
 
     /**
      * @brief Sets the properties of a material according to the tinyobj::material_t structure.
@@ -130,7 +159,7 @@ class OBJLoader {
      * @param material  The Material object to populate.
      * @param mat  The tinyobj::material_t object containing the material properties.
      */
-    void SetMaterialProperties(Component::Material &material, const tinyobj::material_t &mat) noexcept;
+    void SetMaterialProperties(Component::Material &material, const tinyobj::material_t &mat) const noexcept;
 
   protected:
   private:
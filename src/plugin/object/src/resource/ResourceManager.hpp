@@ -149,6 +149,14 @@ template <typename ResourceType> class ResourceManager {
         return Contains(entt::hashed_string{stringViewId.data(), stringViewId.size()});
     }
 
+    /**
+     * @brief Get a shared handle to a stored resource, which keeps it alive even if it is removed from the manager.
+     *
+     * @param id  id of the resource
+     * @return the resource, or an empty handle if it doesn't exist.
+     */
+    [[nodiscard]] entt::resource<ResourceType> GetHandle(const entt::hashed_string &id) { return cache[id]; }
+
     /**
      * @brief Set the default resource that will be used as fallback.
      *
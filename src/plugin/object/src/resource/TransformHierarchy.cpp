@@ -0,0 +1,363 @@
+#include "resource/TransformHierarchy.hpp"
+#include "Logger.hpp"
+#include "component/GlobalTransform.hpp"
+#include "component/Relationship.hpp"
+#include "component/Transform.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <fmt/format.h>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+namespace Object::Resource {
+
+struct TransformHierarchy::Workers {
+    std::mutex mutex;
+    std::condition_variable hasWork;
+    std::condition_variable done;
+    std::function<void(size_t)> task;
+    size_t taskCount = 0;
+    std::atomic<size_t> nextTask = 0;
+    /** @brief Number of worker threads that did not finish the current batch of tasks. */
+    size_t running = 0;
+    uint64_t batch = 0;
+    bool stopping = false;
+
+    void RunTasks()
+    {
+        for (size_t task_ = nextTask.fetch_add(1); task_ < taskCount; task_ = nextTask.fetch_add(1))
+            task(task_);
+    }
+};
+
+TransformHierarchy::TransformHierarchy(uint32_t threadCount)
+    : _workers(std::make_shared<Workers>()), _threadCount(threadCount)
+{
+    if (_threadCount == 0)
+        _threadCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+}
+
+TransformHierarchy &TransformHierarchy::operator=(TransformHierarchy &&other) noexcept
+{
+    if (this != &other)
+    {
+        _Stop();
+        _entities = std::move(other._entities);
+        _parents = std::move(other._parents);
+        _roots = std::move(other._roots);
+        _chunks = std::move(other._chunks);
+        _matrices = std::move(other._matrices);
+        _changed = std::move(other._changed);
+        _moved = std::move(other._moved);
+        _appended = std::move(other._appended);
+        _isOrderValid = other._isOrderValid;
+        _isForced = other._isForced;
+        _isConnected = other._isConnected;
+        _workers = std::move(other._workers);
+        _threads = std::move(other._threads);
+        _threadCount = other._threadCount;
+    }
+    return *this;
+}
+
+void TransformHierarchy::Propagate(Engine::Core &core)
+{
+    _Connect(core);
+
+    if (!_isOrderValid)
+        _Rebuild(core);
+    else if (!_appended.empty())
+        _Append(core);
+    _appended.clear();
+
+    _RunChunks(core.GetRegistry());
+}
+
+void TransformHierarchy::_OnTransformConstruct(Engine::Core &core, Engine::EntityId entity)
+{
+    if (!core.HasResource<TransformHierarchy>())
+        return;
+
+    // Without parent nor children, the entity is a hierarchy of its own: it goes at the end of the current order.
+    auto &hierarchy = core.GetResource<TransformHierarchy>();
+    const auto *relationship = core.GetRegistry().try_get<Relationship::Component::Relationship>(entity);
+    if (relationship == nullptr || (!relationship->parent.has_value() && relationship->children == 0))
+        hierarchy._appended.push_back(entity);
+    else
+        hierarchy._isOrderValid = false;
+}
+
+void TransformHierarchy::_OnHierarchyChange(Engine::Core &core, Engine::EntityId)
+{
+    if (core.HasResource<TransformHierarchy>())
+        core.GetResource<TransformHierarchy>()._isOrderValid = false;
+}
+
+void TransformHierarchy::_Connect(Engine::Core &core)
+{
+    if (_isConnected)
+        return;
+
+    auto &registry = core.GetRegistry();
+    registry.on_construct<Component::Transform>().connect<&TransformHierarchy::_OnTransformConstruct>(core);
+    registry.on_destroy<Component::Transform>().connect<&TransformHierarchy::_OnHierarchyChange>(core);
+    registry.on_construct<Relationship::Component::Relationship>().connect<&TransformHierarchy::_OnHierarchyChange>(
+        core);
+    registry.on_update<Relationship::Component::Relationship>().connect<&TransformHierarchy::_OnHierarchyChange>(core);
+    registry.on_destroy<Relationship::Component::Relationship>().connect<&TransformHierarchy::_OnHierarchyChange>(
+        core);
+    _isConnected = true;
+}
+
+void TransformHierarchy::_Rebuild(Engine::Core &core)
+{
+    auto &registry = core.GetRegistry();
+
+    // Entities that lost their Transform have no world transform anymore, new ones get one.
+    std::vector<Engine::EntityId> stale;
+    for (auto entity : registry.view<Component::GlobalTransform>(entt::exclude<Component::Transform>))
+        stale.emplace_back(entity);
+    for (auto entity : stale)
+        registry.remove<Component::GlobalTransform>(entity);
+
+    std::vector<Engine::EntityId> entities;
+    for (auto entity : registry.view<Component::Transform>())
+        entities.emplace_back(entity);
+    for (auto entity : entities)
+    {
+        if (!registry.all_of<Component::GlobalTransform>(entity))
+            registry.emplace<Component::GlobalTransform>(entity);
+    }
+
+    std::unordered_map<entt::id_type, uint32_t> indices;
+    indices.reserve(entities.size());
+    for (uint32_t i = 0; i < entities.size(); ++i)
+        indices.emplace(entities[i], i);
+
+    std::vector<uint32_t> parents(entities.size(), NO_PARENT);
+    for (uint32_t i = 0; i < entities.size(); ++i)
+    {
+        const auto *relationship = registry.try_get<Relationship::Component::Relationship>(entities[i]);
+        if (relationship == nullptr || !relationship->parent.has_value())
+            continue;
+        if (auto it = indices.find(relationship->parent->Id()); it != indices.end())
+            parents[i] = it->second;
+    }
+
+    // Children of each entity, contiguous in one array.
+    std::vector<uint32_t> childOffsets(entities.size() + 1, 0);
+    for (uint32_t parent : parents)
+    {
+        if (parent != NO_PARENT)
+            childOffsets[parent + 1]++;
+    }
+    for (size_t i = 1; i < childOffsets.size(); ++i)
+        childOffsets[i] += childOffsets[i - 1];
+    std::vector<uint32_t> children(childOffsets.back());
+    std::vector<uint32_t> childCursors(childOffsets.begin(), childOffsets.end() - 1);
+    for (uint32_t i = 0; i < entities.size(); ++i)
+    {
+        if (parents[i] != NO_PARENT)
+            children[childCursors[parents[i]]++] = i;
+    }
+
+    // Depth-first order: parents come before their children, and each hierarchy is one contiguous range.
+    const std::vector<Engine::EntityId> previousEntities = std::move(_entities);
+    const std::vector<uint32_t> previousParents = std::move(_parents);
+    const std::vector<glm::mat4> previousMatrices = std::move(_matrices);
+    _entities.clear();
+    _parents.clear();
+    _roots.clear();
+    std::vector<std::pair<uint32_t, uint32_t>> stack;
+    for (uint32_t root = 0; root < entities.size(); ++root)
+    {
+        if (parents[root] != NO_PARENT)
+            continue;
+        _roots.push_back(_entities.size());
+        stack.emplace_back(root, NO_PARENT);
+        while (!stack.empty())
+        {
+            const auto [entity, parent] = stack.back();
+            stack.pop_back();
+            const auto index = static_cast<uint32_t>(_entities.size());
+            _entities.push_back(entities[entity]);
+            _parents.push_back(parent);
+            for (uint32_t child = childOffsets[entity + 1]; child-- > childOffsets[entity];)
+                stack.emplace_back(children[child], index);
+        }
+    }
+    _roots.push_back(_entities.size());
+
+    if (_entities.size() != entities.size())
+    {
+        Log::Warning(fmt::format("TransformHierarchy: {} entities are parents of their own ancestors, their world "
+                                 "transform is not computed.",
+                                 entities.size() - _entities.size()));
+    }
+
+    _SplitChunks();
+
+    _matrices.assign(_entities.size(), glm::mat4(1.0f));
+    _changed.assign(_entities.size(), 0);
+    _moved.assign(_entities.size(), 1);
+    if (!_isForced)
+    {
+        // Entities under the same parent keep their world matrix, only the subtrees of the new and reparented ones
+        // are recomputed.
+        std::unordered_map<entt::id_type, uint32_t> previousIndices;
+        previousIndices.reserve(previousEntities.size());
+        for (uint32_t i = 0; i < previousEntities.size(); ++i)
+            previousIndices.emplace(previousEntities[i], i);
+        for (size_t i = 0; i < _entities.size(); ++i)
+        {
+            const auto it = previousIndices.find(_entities[i]);
+            if (it == previousIndices.end())
+                continue;
+            const uint32_t parent = _parents[i];
+            const uint32_t previousParent = previousParents[it->second];
+            const bool isSameParent = parent == NO_PARENT ? previousParent == NO_PARENT
+                                                          : previousParent != NO_PARENT &&
+                                                                previousEntities[previousParent] == _entities[parent];
+            if (!isSameParent)
+                continue;
+            _matrices[i] = previousMatrices[it->second];
+            _moved[i] = 0;
+        }
+    }
+    _isForced = false;
+    _isOrderValid = true;
+}
+
+void TransformHierarchy::_Append(Engine::Core &core)
+{
+    auto &registry = core.GetRegistry();
+    _roots.pop_back();
+    for (auto entity : _appended)
+    {
+        if (!registry.valid(entity) || !registry.all_of<Component::Transform>(entity))
+            continue;
+        if (!registry.all_of<Component::GlobalTransform>(entity))
+            registry.emplace<Component::GlobalTransform>(entity);
+        _roots.push_back(_entities.size());
+        _entities.push_back(entity);
+        _parents.push_back(NO_PARENT);
+        _matrices.emplace_back(1.0f);
+        _changed.push_back(0);
+        _moved.push_back(1);
+    }
+    _roots.push_back(_entities.size());
+    _SplitChunks();
+}
+
+void TransformHierarchy::_SplitChunks()
+{
+    // Hierarchies are grouped into a few tasks per thread, so that uneven hierarchies still balance.
+    _chunks.assign(1, 0);
+    if (_entities.size() >= PARALLEL_THRESHOLD && _threadCount > 0)
+    {
+        const size_t chunkSize = std::max<size_t>(_entities.size() / ((_threadCount + 1) * 4), 1);
+        for (size_t root = 1; root + 1 < _roots.size(); ++root)
+        {
+            if (_roots[root] - _chunks.back() >= chunkSize)
+                _chunks.push_back(_roots[root]);
+        }
+    }
+    _chunks.push_back(_entities.size());
+}
+
+void TransformHierarchy::_PropagateRange(Engine::Core::Registry &registry, size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; ++i)
+    {
+        auto [transform, globalTransform] =
+            registry.get<Component::Transform, Component::GlobalTransform>(_entities[i]);
+        const uint32_t parent = _parents[i];
+        const bool changed =
+            _moved[i] != 0 || transform.HasChanged() || (parent != NO_PARENT && _changed[parent] != 0);
+        _moved[i] = 0;
+        _changed[i] = changed ? 1 : 0;
+        globalTransform.changed = changed;
+        if (!changed)
+            continue;
+
+        const glm::mat4 local = transform.ComputeTransformationMatrix();
+        _matrices[i] = parent == NO_PARENT ? local : _matrices[parent] * local;
+        globalTransform.matrix = _matrices[i];
+        transform.ClearChanged();
+    }
+}
+
+void TransformHierarchy::_RunChunks(Engine::Core::Registry &registry)
+{
+    const size_t chunkCount = _chunks.size() - 1;
+    if (chunkCount <= 1)
+    {
+        _PropagateRange(registry, 0, _entities.size());
+        return;
+    }
+
+    // Workers are started on the first large propagation, so small scenes cost no thread.
+    while (_threads.size() < _threadCount)
+    {
+        uint64_t batch;
+        {
+            std::scoped_lock lock(_workers->mutex);
+            batch = _workers->batch;
+        }
+        _threads.emplace_back([workers = _workers, batch]() mutable {
+            while (true)
+            {
+                {
+                    std::unique_lock lock(workers->mutex);
+                    workers->hasWork.wait(lock, [&]() { return workers->stopping || workers->batch != batch; });
+                    if (workers->stopping)
+                        return;
+                    batch = workers->batch;
+                }
+                workers->RunTasks();
+                std::scoped_lock lock(workers->mutex);
+                if (--workers->running == 0)
+                    workers->done.notify_all();
+            }
+        });
+    }
+
+    {
+        std::scoped_lock lock(_workers->mutex);
+        _workers->task = [this, &registry](size_t chunk) {
+            _PropagateRange(registry, _chunks[chunk], _chunks[chunk + 1]);
+        };
+        _workers->taskCount = chunkCount;
+        _workers->nextTask = 0;
+        _workers->running = _threads.size();
+        _workers->batch++;
+    }
+    _workers->hasWork.notify_all();
+
+    // The calling thread takes tasks too, then waits for the workers to be done with theirs.
+    _workers->RunTasks();
+    std::unique_lock lock(_workers->mutex);
+    _workers->done.wait(lock, [this]() { return _workers->running == 0; });
+    _workers->task = nullptr;
+}
+
+void TransformHierarchy::_Stop()
+{
+    if (_workers == nullptr)
+        return;
+    {
+        std::scoped_lock lock(_workers->mutex);
+        _workers->stopping = true;
+    }
+    _workers->hasWork.notify_all();
+    for (auto &thread : _threads)
+    {
+        if (thread.joinable())
+            thread.join();
+    }
+    _threads.clear();
+}
+
+} // namespace Object::Resource
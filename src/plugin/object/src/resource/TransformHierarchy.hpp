@@ -0,0 +1,114 @@
+#pragma once
+
+#include "core/Core.hpp"
+#include "entity/EntityId.hpp"
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <memory>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace Object::Resource {
+
+/**
+ * @brief Computes the Component::GlobalTransform of every entity with a Component::Transform, following the parents
+ * of the Relationship plugin.
+ *
+ * Entities are kept in depth-first order, parents before their children and each hierarchy in one contiguous range,
+ * so a propagation is a single linear pass reading the world matrix of the parent from the same array. New entities
+ * without parent nor children are appended to the order, which is only rebuilt when a Relationship is added, changed or
+ * removed, or a Transform is removed. Only the subtrees of the transforms modified since the last propagation, and of
+ * the entities that were added or changed parent, are recomputed. Large scenes spread their hierarchies over worker
+ * threads.
+ *
+ * An entity whose parent has no Transform is a root: its world transform is its local one.
+ *
+ * @note The hierarchy must be a resource of the core, it is notified of hierarchy changes through registry signals.
+ * Object::Plugin registers it and propagates it in the Update scheduler, plugins reading world transforms later in
+ * the frame (e.g. a renderer) can propagate it again for the changes made since then.
+ *
+ * @example "Propagating the world transforms each frame"
+ * @code
+ * core.AddPlugins<Object::Plugin>();
+ * core.RegisterSystem<RenderingPipeline::Preparation>(Object::System::PropagateTransforms);
+ * @endcode
+ */
+class TransformHierarchy {
+  public:
+    /** @brief Below this number of entities, the propagation runs on the calling thread only. */
+    static inline constexpr size_t PARALLEL_THRESHOLD = 4096;
+
+    /**
+     * @param threadCount  number of worker threads, depending on the number of cores if 0
+     */
+    explicit TransformHierarchy(uint32_t threadCount = 0);
+    ~TransformHierarchy() { _Stop(); }
+
+    TransformHierarchy(const TransformHierarchy &) = delete;
+    TransformHierarchy &operator=(const TransformHierarchy &) = delete;
+    TransformHierarchy(TransformHierarchy &&) noexcept = default;
+    TransformHierarchy &operator=(TransformHierarchy &&other) noexcept;
+
+    /**
+     * @brief Update the GlobalTransform of the entities whose Transform, or the Transform of an ancestor, changed.
+     *
+     * Entities with a Transform get a GlobalTransform on their first propagation.
+     */
+    void Propagate(Engine::Core &core);
+
+    /**
+     * @brief Rebuild the order of the entities and recompute every world transform on the next propagation.
+     */
+    void Invalidate()
+    {
+        _isOrderValid = false;
+        _isForced = true;
+    }
+
+    /** @brief Entities of the last propagation, parents before their children. */
+    [[nodiscard]] std::span<const Engine::EntityId> GetOrder() const { return _entities; }
+    /** @brief Number of hierarchies of the last propagation, entities without parent included. */
+    [[nodiscard]] size_t GetRootCount() const { return _roots.empty() ? 0 : _roots.size() - 1; }
+
+  private:
+    static inline constexpr uint32_t NO_PARENT = UINT32_MAX;
+
+    /** @brief Shared with the worker threads, so that the hierarchy itself can be moved. */
+    struct Workers;
+
+    static void _OnTransformConstruct(Engine::Core &core, Engine::EntityId entity);
+    static void _OnHierarchyChange(Engine::Core &core, Engine::EntityId entity);
+    void _Connect(Engine::Core &core);
+    void _Rebuild(Engine::Core &core);
+    void _Append(Engine::Core &core);
+    void _SplitChunks();
+    void _PropagateRange(Engine::Core::Registry &registry, size_t begin, size_t end);
+    void _RunChunks(Engine::Core::Registry &registry);
+    void _Stop();
+
+    std::vector<Engine::EntityId> _entities;
+    /** @brief Index of the parent of each entity in _entities, NO_PARENT for roots. */
+    std::vector<uint32_t> _parents;
+    /** @brief Start of each hierarchy in _entities, followed by the number of entities. */
+    std::vector<size_t> _roots;
+    /** @brief Ranges of whole hierarchies propagated by one task, as boundaries in _entities. */
+    std::vector<size_t> _chunks;
+    /** @brief World matrix of each entity, read by its children without looking their parent up in the registry. */
+    std::vector<glm::mat4> _matrices;
+    std::vector<uint8_t> _changed;
+    /** @brief Whether each entity was added or changed parent since the last propagation, its subtree is recomputed. */
+    std::vector<uint8_t> _moved;
+    /** @brief Entities given a Transform since the last propagation, appended as roots while the order is valid. */
+    std::vector<Engine::EntityId> _appended;
+    bool _isOrderValid = false;
+    /** @brief Whether the next rebuild recomputes every world transform, see Invalidate. */
+    bool _isForced = false;
+    bool _isConnected = false;
+
+    std::shared_ptr<Workers> _workers;
+    std::vector<std::thread> _threads;
+    uint32_t _threadCount = 0;
+};
+
+} // namespace Object::Resource
@@ -0,0 +1,7 @@
+#include "system/PropagateTransforms.hpp"
+#include "resource/TransformHierarchy.hpp"
+
+void Object::System::PropagateTransforms(Engine::Core &core)
+{
+    core.GetResource<Resource::TransformHierarchy>().Propagate(core);
+}
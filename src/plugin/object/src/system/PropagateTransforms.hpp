@@ -0,0 +1,12 @@
+#pragma once
+
+#include "core/Core.hpp"
+
+namespace Object::System {
+
+/**
+ * @brief Compute the Component::GlobalTransform of every entity with the Resource::TransformHierarchy.
+ */
+void PropagateTransforms(Engine::Core &core);
+
+} // namespace Object::System
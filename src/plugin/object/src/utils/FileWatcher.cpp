@@ -0,0 +1,206 @@
+#include "utils/FileWatcher.hpp"
+#include "Logger.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fmt/format.h>
+#include <system_error>
+#include <utility>
+#ifdef __linux__
+#    include <cerrno>
+#    include <sys/inotify.h>
+#    include <unistd.h>
+#endif
+
+namespace Object::Utils {
+
+#ifdef __linux__
+static constexpr uint32_t INOTIFY_EVENTS = IN_CLOSE_WRITE | IN_MOVED_TO;
+#endif
+
+FileWatcher::FileWatcher()
+{
+#ifdef __linux__
+    _inotify = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (_inotify < 0)
+        Log::Warning(fmt::format("FileWatcher: inotify is unavailable ({}), file timestamps are polled instead.",
+                                 std::strerror(errno)));
+#endif
+}
+
+FileWatcher::~FileWatcher() { _Close(); }
+
+FileWatcher::FileWatcher(FileWatcher &&other) noexcept
+    : _files(std::move(other._files)), _directories(std::move(other._directories)),
+      _inotify(std::exchange(other._inotify, -1))
+{
+}
+
+FileWatcher &FileWatcher::operator=(FileWatcher &&other) noexcept
+{
+    if (this != &other)
+    {
+        _Close();
+        _files = std::move(other._files);
+        _directories = std::move(other._directories);
+        _inotify = std::exchange(other._inotify, -1);
+    }
+    return *this;
+}
+
+void FileWatcher::Watch(const std::filesystem::path &path)
+{
+    const std::string key = _Normalize(path);
+    if (_files.contains(key))
+        return;
+
+    WatchedFile file{.path = path};
+    _ReadTimestamp(file);
+#ifdef __linux__
+    if (_inotify >= 0)
+    {
+        // Editors usually save by writing another file and renaming it, so the directory is watched, not the file.
+        const std::string directory = std::filesystem::path(key).parent_path().string();
+        const int descriptor = ::inotify_add_watch(_inotify, directory.c_str(), INOTIFY_EVENTS);
+        if (descriptor >= 0)
+        {
+            _directories[descriptor] = directory;
+            file.polled = false;
+        }
+        else
+        {
+            Log::Warning(fmt::format("FileWatcher: Cannot watch '{}' ({}), its timestamp is polled instead.",
+                                     directory, std::strerror(errno)));
+        }
+    }
+#endif
+    _files.emplace(key, std::move(file));
+}
+
+void FileWatcher::Unwatch(const std::filesystem::path &path)
+{
+    const std::string key = _Normalize(path);
+    if (_files.erase(key) == 0)
+        return;
+
+#ifdef __linux__
+    const std::string directory = std::filesystem::path(key).parent_path().string();
+    const bool directoryInUse = std::ranges::any_of(_files, [&directory](const auto &entry) {
+        return !entry.second.polled && std::filesystem::path(entry.first).parent_path() == directory;
+    });
+    if (directoryInUse)
+        return;
+    for (auto it = _directories.begin(); it != _directories.end(); ++it)
+    {
+        if (it->second == directory)
+        {
+            ::inotify_rm_watch(_inotify, it->first);
+            _directories.erase(it);
+            break;
+        }
+    }
+#endif
+}
+
+bool FileWatcher::IsWatching(const std::filesystem::path &path) const { return _files.contains(_Normalize(path)); }
+
+std::vector<std::filesystem::path> FileWatcher::Poll()
+{
+    std::vector<std::filesystem::path> changes;
+    _ReadEvents(changes);
+    _PollTimestamps(changes, false);
+    return changes;
+}
+
+std::string FileWatcher::_Normalize(const std::filesystem::path &path)
+{
+    std::error_code error;
+    auto absolute = std::filesystem::absolute(path, error);
+    if (error)
+        absolute = path;
+    return absolute.lexically_normal().string();
+}
+
+void FileWatcher::_ReadTimestamp(WatchedFile &file)
+{
+    std::error_code error;
+    file.writeTime = std::filesystem::last_write_time(file.path, error);
+    if (error)
+        file.writeTime = {};
+    file.size = std::filesystem::file_size(file.path, error);
+    if (error)
+        file.size = 0;
+}
+
+void FileWatcher::_PollTimestamps(std::vector<std::filesystem::path> &changes, bool all)
+{
+    for (auto &[key, file] : _files)
+    {
+        if (!file.polled && !all)
+            continue;
+        const auto previousWriteTime = file.writeTime;
+        const auto previousSize = file.size;
+        _ReadTimestamp(file);
+        if ((file.writeTime != previousWriteTime || file.size != previousSize) &&
+            std::ranges::find(changes, file.path) == changes.end())
+            changes.push_back(file.path);
+    }
+}
+
+void FileWatcher::_ReadEvents(std::vector<std::filesystem::path> &changes)
+{
+#ifdef __linux__
+    if (_inotify < 0)
+        return;
+
+    alignas(inotify_event) std::array<char, 4096> buffer;
+    bool overflowed = false;
+    while (true)
+    {
+        const ssize_t length = ::read(_inotify, buffer.data(), buffer.size());
+        if (length <= 0)
+            break;
+
+        for (ssize_t offset = 0; offset < length;)
+        {
+            const auto *event = reinterpret_cast<const inotify_event *>(buffer.data() + offset);
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+            if ((event->mask & IN_Q_OVERFLOW) != 0)
+            {
+                overflowed = true;
+                continue;
+            }
+            const auto directory = _directories.find(event->wd);
+            if (directory == _directories.end() || event->len == 0)
+                continue;
+
+            const std::string key = (std::filesystem::path(directory->second) / event->name).string();
+            const auto file = _files.find(key);
+            if (file == _files.end())
+                continue;
+            _ReadTimestamp(file->second);
+            if (std::ranges::find(changes, file->second.path) == changes.end())
+                changes.push_back(file->second.path);
+        }
+    }
+
+    // Events were dropped by the kernel: fall back to the timestamps to find what changed.
+    if (overflowed)
+        _PollTimestamps(changes, true);
+#else
+    (void) changes;
+#endif
+}
+
+void FileWatcher::_Close() noexcept
+{
+#ifdef __linux__
+    if (_inotify >= 0)
+        ::close(_inotify);
+#endif
+    _inotify = -1;
+    _directories.clear();
+}
+
+} // namespace Object::Utils
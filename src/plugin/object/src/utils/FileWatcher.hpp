@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Object::Utils {
+
+/**
+ * @brief Reports the watched files that were written since the last poll, without blocking.
+ *
+ * On Linux, the directories of the watched files are watched with inotify, so polling costs nothing when no file
+ * changed. Files are reported once written and closed, or moved in place as editors do when saving. Elsewhere, or if
+ * a directory cannot be watched, the modification time and size of the files are compared at each poll instead.
+ */
+class FileWatcher {
+  public:
+    FileWatcher();
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher &) = delete;
+    FileWatcher &operator=(const FileWatcher &) = delete;
+    FileWatcher(FileWatcher &&other) noexcept;
+    FileWatcher &operator=(FileWatcher &&other) noexcept;
+
+    /**
+     * @brief Start watching a file. The file does not need to exist yet.
+     */
+    void Watch(const std::filesystem::path &path);
+
+    void Unwatch(const std::filesystem::path &path);
+
+    [[nodiscard]] bool IsWatching(const std::filesystem::path &path) const;
+
+    /**
+     * @brief Get the watched files changed since the last call, each once, as they were given to Watch.
+     */
+    [[nodiscard]] std::vector<std::filesystem::path> Poll();
+
+  private:
+    struct WatchedFile {
+        std::filesystem::path path;
+        std::filesystem::file_time_type writeTime{};
+        std::uintmax_t size = 0;
+        /** @brief Compared at each poll, its directory is not watched by inotify. */
+        bool polled = true;
+    };
+
+    static std::string _Normalize(const std::filesystem::path &path);
+    static void _ReadTimestamp(WatchedFile &file);
+    void _PollTimestamps(std::vector<std::filesystem::path> &changes, bool all);
+    void _ReadEvents(std::vector<std::filesystem::path> &changes);
+    void _Close() noexcept;
+
+    std::unordered_map<std::string, WatchedFile> _files;
+    /** @brief Directory watched by each inotify watch descriptor. */
+    std::unordered_map<int, std::string> _directories;
+    int _inotify = -1;
+};
+
+} // namespace Object::Utils
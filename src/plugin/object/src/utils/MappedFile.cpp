@@ -0,0 +1,112 @@
+#include "utils/MappedFile.hpp"
+#include "exception/MeshFileError.hpp"
+#include <cstring>
+#include <fmt/format.h>
+#include <utility>
+#ifdef _WIN32
+#    include <fstream>
+#else
+#    include <cerrno>
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace Object::Utils {
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::filesystem::path &path)
+{
+    std::ifstream stream(path, std::ios::binary | std::ios::ate);
+    if (!stream)
+        throw MeshFileError(fmt::format("Failed to open '{}'.", path.string()));
+    _buffer.resize(static_cast<size_t>(stream.tellg()));
+    stream.seekg(0);
+    if (!stream.read(reinterpret_cast<char *>(_buffer.data()), static_cast<std::streamsize>(_buffer.size())))
+        throw MeshFileError(fmt::format("Failed to read '{}'.", path.string()));
+    _data = _buffer.data();
+    _size = _buffer.size();
+}
+
+MappedFile::~MappedFile() = default;
+
+MappedFile::MappedFile(MappedFile &&other) noexcept
+    : _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0)),
+      _buffer(std::move(other._buffer))
+{
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+{
+    _buffer = std::move(other._buffer);
+    _data = std::exchange(other._data, nullptr);
+    _size = std::exchange(other._size, 0);
+    return *this;
+}
+
+void MappedFile::_Unmap() noexcept {}
+
+#else
+
+MappedFile::MappedFile(const std::filesystem::path &path)
+{
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        throw MeshFileError(fmt::format("Failed to open '{}': {}", path.string(), std::strerror(errno)));
+
+    struct stat status{};
+    if (::fstat(fd, &status) != 0)
+    {
+        const int error = errno;
+        ::close(fd);
+        throw MeshFileError(fmt::format("Failed to stat '{}': {}", path.string(), std::strerror(error)));
+    }
+
+    _size = static_cast<size_t>(status.st_size);
+    // Mapping an empty file fails, an empty view is enough.
+    if (_size != 0)
+    {
+        void *mapping = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED)
+        {
+            const int error = errno;
+            ::close(fd);
+            throw MeshFileError(fmt::format("Failed to map '{}': {}", path.string(), std::strerror(error)));
+        }
+        _data = static_cast<const std::byte *>(mapping);
+    }
+    // The mapping keeps its own reference to the file.
+    ::close(fd);
+}
+
+MappedFile::~MappedFile() { _Unmap(); }
+
+MappedFile::MappedFile(MappedFile &&other) noexcept
+    : _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0))
+{
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+{
+    if (this != &other)
+    {
+        _Unmap();
+        _data = std::exchange(other._data, nullptr);
+        _size = std::exchange(other._size, 0);
+    }
+    return *this;
+}
+
+void MappedFile::_Unmap() noexcept
+{
+    if (_data != nullptr)
+        ::munmap(const_cast<std::byte *>(_data), _size);
+    _data = nullptr;
+    _size = 0;
+}
+
+#endif
+
+} // namespace Object::Utils
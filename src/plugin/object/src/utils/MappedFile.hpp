@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#ifdef _WIN32
+#    include <vector>
+#endif
+
+namespace Object::Utils {
+
+/**
+ * @brief Read-only view of a whole file through a memory mapping.
+ *
+ * Pages are only read from disk when first accessed, and stay shared with the page cache. Without POSIX mappings
+ * (Windows), the file is read into memory instead.
+ *
+ * @throws MeshFileError if the file cannot be opened or mapped.
+ */
+class MappedFile {
+  public:
+    explicit MappedFile(const std::filesystem::path &path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    [[nodiscard]] std::span<const std::byte> GetData() const { return {_data, _size}; }
+    [[nodiscard]] size_t GetSize() const { return _size; }
+
+  private:
+    void _Unmap() noexcept;
+
+    const std::byte *_data = nullptr;
+    size_t _size = 0;
+#ifdef _WIN32
+    std::vector<std::byte> _buffer;
+#endif
+};
+
+} // namespace Object::Utils
@@ -0,0 +1,104 @@
+#include "utils/MeshAsset.hpp"
+
+#include "exception/ResourceManagerError.hpp"
+#include "resource/AssetDatabase.hpp"
+#include "resource/MeshContainer.hpp"
+#include "resource/OBJLoader.hpp"
+#include <fmt/format.h>
+
+namespace Object::Utils {
+
+static Component::MeshHandle MakeHandle(const entt::hashed_string &id, const entt::resource<Component::Mesh> &mesh)
+{
+    return Component::MeshHandle{.id = id.value(), .mesh = mesh.handle()};
+}
+
+Component::MeshHandle GetOrCreateMeshAsset(Engine::Core &core, std::string_view id,
+                                           const std::function<Component::Mesh()> &factory)
+{
+    if (!core.HasResource<Resource::MeshContainer>())
+        core.RegisterResource(Resource::MeshContainer());
+
+    auto &meshContainer = core.GetResource<Resource::MeshContainer>();
+    const entt::hashed_string hashedId{id.data(), id.size()};
+    if (auto mesh = meshContainer.GetHandle(hashedId))
+        return MakeHandle(hashedId, mesh);
+
+    return MakeHandle(hashedId, meshContainer.Add(hashedId, factory()));
+}
+
+Component::MeshHandle LoadOBJMeshAsset(Engine::Core &core, const std::string &filepath)
+{
+    auto handle = GetOrCreateMeshAsset(core, filepath, [&filepath] { return OBJLoader(filepath).GetMesh(); });
+
+    if (core.HasResource<Resource::AssetDatabase>())
+    {
+        auto &assetDatabase = core.GetResource<Resource::AssetDatabase>();
+        if (!assetDatabase.Contains(handle.id))
+        {
+            assetDatabase.Register(filepath, filepath, [filepath](Engine::Core &importCore) {
+                (void) ReplaceMeshAsset(importCore, filepath, OBJLoader(filepath).GetMesh());
+            });
+        }
+    }
+    return handle;
+}
+
+Component::MeshHandle GetMeshAsset(Engine::Core &core, std::string_view id)
+{
+    const entt::hashed_string hashedId{id.data(), id.size()};
+    if (core.HasResource<Resource::MeshContainer>())
+    {
+        if (auto mesh = core.GetResource<Resource::MeshContainer>().GetHandle(hashedId))
+            return MakeHandle(hashedId, mesh);
+    }
+    throw ResourceManagerError(fmt::format("Mesh asset {} not found.", id));
+}
+
+Component::MeshHandle ReplaceMeshAsset(Engine::Core &core, std::string_view id, Component::Mesh mesh)
+{
+    if (!core.HasResource<Resource::MeshContainer>())
+        core.RegisterResource(Resource::MeshContainer());
+
+    auto &meshContainer = core.GetResource<Resource::MeshContainer>();
+    const entt::hashed_string hashedId{id.data(), id.size()};
+    // Entities keep the previous data alive until their handle is updated below.
+    meshContainer.Remove(hashedId);
+    const auto handle = MakeHandle(hashedId, meshContainer.Add(hashedId, std::move(mesh)));
+
+    core.GetRegistry().view<Component::MeshHandle>().each([&handle](Component::MeshHandle &meshHandle) {
+        if (meshHandle.id == handle.id)
+            meshHandle.mesh = handle.mesh;
+    });
+    return handle;
+}
+
+const Component::Mesh *TryGetMeshData(const Engine::Core::Registry &registry, Engine::EntityId entity)
+{
+    if (const auto *mesh = registry.try_get<Component::Mesh>(entity))
+        return mesh;
+    if (const auto *handle = registry.try_get<Component::MeshHandle>(entity); handle && handle->IsValid())
+        return handle->mesh.get();
+    return nullptr;
+}
+
+Component::Mesh &PromoteToUniqueMesh(Engine::Core &core, Engine::EntityId entity)
+{
+    auto &registry = core.GetRegistry();
+    if (auto *mesh = registry.try_get<Component::Mesh>(entity))
+        return *mesh;
+
+    const auto *handle = registry.try_get<Component::MeshHandle>(entity);
+    if (!handle || !handle->IsValid())
+    {
+        throw ResourceManagerError(
+            fmt::format("Cannot promote entity {} to a unique mesh: it has no Mesh nor MeshHandle.", entity));
+    }
+
+    // The handle keeps the asset alive until the copy is made.
+    Component::Mesh copy = handle->Get();
+    registry.remove<Component::MeshHandle>(entity);
+    return registry.emplace<Component::Mesh>(entity, std::move(copy));
+}
+
+} // namespace Object::Utils
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "component/Mesh.hpp"
+#include "component/MeshHandle.hpp"
+#include "core/Core.hpp"
+#include "entity/EntityId.hpp"
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace Object::Utils {
+
+/**
+ * @brief Get a handle to a mesh asset, creating the asset with the factory if it is not loaded yet.
+ *
+ * The Resource::MeshContainer is registered in the core on first use.
+ */
+[[nodiscard]] Component::MeshHandle GetOrCreateMeshAsset(Engine::Core &core, std::string_view id,
+                                                         const std::function<Component::Mesh()> &factory);
+
+/**
+ * @brief Get a handle to the mesh of an OBJ file, loading it only the first time. The asset id is the file path.
+ *
+ * If the core has a Resource::AssetDatabase, the file is registered in it: when it is edited, the asset is loaded
+ * again and replaced with ReplaceMeshAsset.
+ *
+ * @throw OBJLoaderError if the file cannot be loaded.
+ */
+[[nodiscard]] Component::MeshHandle LoadOBJMeshAsset(Engine::Core &core, const std::string &filepath);
+
+/**
+ * @brief Get a handle to a loaded mesh asset.
+ *
+ * @throw ResourceManagerError if no asset has this id.
+ */
+[[nodiscard]] Component::MeshHandle GetMeshAsset(Engine::Core &core, std::string_view id);
+
+/**
+ * @brief Replace the data of a mesh asset, and point every MeshHandle referencing it at the new data.
+ *
+ * Handles are updated in place without notifying the registry: renderers uploading assets should re-upload the
+ * new data through a dependent of the asset in the Resource::AssetDatabase instead of once per entity.
+ *
+ * @return a handle to the new data.
+ */
+Component::MeshHandle ReplaceMeshAsset(Engine::Core &core, std::string_view id, Component::Mesh mesh);
+
+/**
+ * @brief Geometry of an entity: its own Mesh if it has one, the asset of its MeshHandle otherwise.
+ *
+ * @return nullptr if the entity has neither.
+ */
+[[nodiscard]] const Component::Mesh *TryGetMeshData(const Engine::Core::Registry &registry, Engine::EntityId entity);
+
+/**
+ * @brief Give an entity its own copy of the asset it references, so that its geometry can be modified.
+ *
+ * The MeshHandle is replaced by a Mesh component holding a copy of the asset. Entities that already own a Mesh are
+ * left untouched.
+ *
+ * @throw ResourceManagerError if the entity has neither a Mesh nor a valid MeshHandle.
+ * @return the Mesh of the entity.
+ */
+Component::Mesh &PromoteToUniqueMesh(Engine::Core &core, Engine::EntityId entity);
+
+} // namespace Object::Utils
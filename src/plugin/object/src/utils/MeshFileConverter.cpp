@@ -0,0 +1,313 @@
+#include "utils/MeshFileConverter.hpp"
+
+#include "Logger.hpp"
+#include "exception/MeshFileError.hpp"
+#include "resource/MeshFile.hpp"
+#include "resource/MeshFileLoader.hpp"
+#include "resource/OBJLoader.hpp"
+#include "utils/MappedFile.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fmt/format.h>
+#include <fstream>
+#include <limits>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace Object::Utils {
+
+namespace {
+
+uint64_t Align(uint64_t offset)
+{
+    return (offset + Resource::MESH_FILE_ALIGNMENT - 1) & ~(Resource::MESH_FILE_ALIGNMENT - 1);
+}
+
+std::array<float, 3> ToArray(const glm::vec3 &value) { return {value.x, value.y, value.z}; }
+
+class StringTable {
+  public:
+    Resource::MeshFileString Add(std::string_view string)
+    {
+        if (_data.size() + string.size() > std::numeric_limits<uint32_t>::max())
+            throw MeshFileError("The string table is larger than 4 GiB.");
+        Resource::MeshFileString range{static_cast<uint32_t>(_data.size()), static_cast<uint32_t>(string.size())};
+        _data.insert(_data.end(), string.begin(), string.end());
+        return range;
+    }
+
+    [[nodiscard]] const std::vector<char> &GetData() const { return _data; }
+
+  private:
+    std::vector<char> _data;
+};
+
+Resource::MeshFileMaterial ToFileMaterial(const Component::Material &material, StringTable &strings)
+{
+    Resource::MeshFileMaterial result;
+    result.name = strings.Add(material.name);
+    result.diffuseTexName = strings.Add(material.diffuseTexName);
+    result.ambient = ToArray(material.ambient);
+    result.diffuse = ToArray(material.diffuse);
+    result.specular = ToArray(material.specular);
+    result.transmittance = ToArray(material.transmittance);
+    result.emission = ToArray(material.emission);
+    result.shininess = material.shininess;
+    result.ior = material.ior;
+    result.dissolve = material.dissolve;
+    return result;
+}
+
+/** @brief Writes blobs at increasing aligned offsets, padding with zeros in between. */
+class BlobWriter {
+  public:
+    explicit BlobWriter(const std::filesystem::path &path)
+        : _path(path), _stream(path, std::ios::binary | std::ios::trunc)
+    {
+        if (!_stream)
+            throw MeshFileError(fmt::format("Failed to open '{}' for writing.", path.string()));
+    }
+
+    void Write(uint64_t offset, const void *data, uint64_t size)
+    {
+        static constexpr std::array<char, Resource::MESH_FILE_ALIGNMENT> ZEROS{};
+        while (_size < offset)
+        {
+            const uint64_t padding = std::min<uint64_t>(offset - _size, ZEROS.size());
+            _stream.write(ZEROS.data(), static_cast<std::streamsize>(padding));
+            _size += padding;
+        }
+        _stream.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+        _size += size;
+        if (!_stream)
+            throw MeshFileError(fmt::format("Failed to write to '{}'.", _path.string()));
+    }
+
+    template <typename T> void Write(uint64_t offset, std::span<const T> data)
+    {
+        Write(offset, data.data(), data.size_bytes());
+    }
+
+    void Close()
+    {
+        _stream.close();
+        if (!_stream)
+            throw MeshFileError(fmt::format("Failed to write to '{}'.", _path.string()));
+    }
+
+  private:
+    std::filesystem::path _path;
+    std::ofstream _stream;
+    uint64_t _size = 0;
+};
+
+/** @brief Hash 8 bytes at a time, fast enough to hash large models each time they are loaded. */
+uint64_t HashBytes(std::span<const std::byte> data)
+{
+    constexpr uint64_t PRIME = 0x9E3779B97F4A7C15ull;
+    uint64_t hash = 0xCBF29CE484222325ull ^ (data.size() * PRIME);
+    auto mix = [&hash](uint64_t word) {
+        hash ^= word * PRIME;
+        hash = ((hash << 31u) | (hash >> 33u)) * 0xC2B2AE3D27D4EB4Full;
+    };
+
+    size_t offset = 0;
+    for (; offset + sizeof(uint64_t) <= data.size(); offset += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, data.data() + offset, sizeof(word));
+        mix(word);
+    }
+    if (offset < data.size())
+    {
+        uint64_t word = 0;
+        std::memcpy(&word, data.data() + offset, data.size() - offset);
+        mix(word);
+    }
+    return hash ^ (hash >> 29u);
+}
+
+void ConvertOBJ(const std::filesystem::path &objPath, const std::filesystem::path &meshFilePath,
+                const std::string &mtlSearchPath, uint64_t sourceHash)
+{
+    OBJLoader loader(objPath.string(), mtlSearchPath);
+    const auto shapes = loader.GetShapes();
+    const auto materials = loader.GetMaterials();
+    WriteMeshFile(meshFilePath, shapes, materials, sourceHash);
+}
+
+} // namespace
+
+void WriteMeshFile(const std::filesystem::path &path, std::span<const Resource::Shape> shapes,
+                   std::span<const Component::Material> materials, uint64_t sourceHash)
+{
+    StringTable strings;
+    std::vector<Resource::MeshFileMaterial> fileMaterials;
+    std::vector<std::string_view> materialNames;
+    for (const auto &material : materials)
+    {
+        fileMaterials.push_back(ToFileMaterial(material, strings));
+        materialNames.emplace_back(material.name);
+    }
+
+    Resource::MeshFileHeader header;
+    std::vector<Resource::MeshFileSubmesh> submeshes;
+    submeshes.reserve(shapes.size());
+    for (const auto &shape : shapes)
+    {
+        const auto &mesh = shape.GetMesh();
+        Resource::MeshFileSubmesh submesh;
+        submesh.firstVertex = header.vertexCount;
+        submesh.vertexCount = mesh.GetVertices().size();
+        submesh.firstIndex = header.indexCount;
+        submesh.indexCount = mesh.GetIndices().size();
+        submesh.name = strings.Add(shape.GetName());
+
+        if (!mesh.GetVertices().empty())
+        {
+            glm::vec3 boundsMin = mesh.GetVertices().front();
+            glm::vec3 boundsMax = boundsMin;
+            for (const auto &vertex : mesh.GetVertices())
+            {
+                boundsMin = glm::min(boundsMin, vertex);
+                boundsMax = glm::max(boundsMax, vertex);
+            }
+            submesh.boundsMin = ToArray(boundsMin);
+            submesh.boundsMax = ToArray(boundsMax);
+        }
+
+        const auto &material = shape.GetMaterial();
+        if (!material.name.empty())
+        {
+            auto it = std::ranges::find(materialNames, std::string_view(material.name));
+            if (it == materialNames.end())
+            {
+                fileMaterials.push_back(ToFileMaterial(material, strings));
+                materialNames.emplace_back(material.name);
+                it = materialNames.end() - 1;
+            }
+            submesh.material = static_cast<int32_t>(it - materialNames.begin());
+        }
+
+        header.vertexCount += submesh.vertexCount;
+        header.indexCount += submesh.indexCount;
+        submeshes.push_back(submesh);
+    }
+
+    header.sourceHash = sourceHash;
+    header.submeshCount = static_cast<uint32_t>(submeshes.size());
+    header.materialCount = static_cast<uint32_t>(fileMaterials.size());
+    header.submeshesOffset = Align(sizeof(header));
+    header.materialsOffset = Align(header.submeshesOffset + submeshes.size() * sizeof(Resource::MeshFileSubmesh));
+    header.positionsOffset = Align(header.materialsOffset + fileMaterials.size() * sizeof(Resource::MeshFileMaterial));
+    header.normalsOffset = Align(header.positionsOffset + header.vertexCount * sizeof(glm::vec3));
+    header.texCoordsOffset = Align(header.normalsOffset + header.vertexCount * sizeof(glm::vec3));
+    header.indicesOffset = Align(header.texCoordsOffset + header.vertexCount * sizeof(glm::vec2));
+    header.stringsOffset = Align(header.indicesOffset + header.indexCount * sizeof(uint32_t));
+    header.stringsSize = strings.GetData().size();
+    header.fileSize = header.stringsOffset + header.stringsSize;
+
+    auto temporaryPath = path;
+    temporaryPath += ".tmp";
+    {
+        BlobWriter writer(temporaryPath);
+        writer.Write(0, &header, sizeof(header));
+        writer.Write<Resource::MeshFileSubmesh>(header.submeshesOffset, submeshes);
+        writer.Write<Resource::MeshFileMaterial>(header.materialsOffset, fileMaterials);
+
+        // Attributes missing from a mesh are written as zeros, so every submesh has all of them.
+        auto writeAttribute = [&writer, &shapes](uint64_t offset, auto getAttribute, auto zero) {
+            for (const auto &shape : shapes)
+            {
+                const auto &mesh = shape.GetMesh();
+                const auto &attribute = getAttribute(mesh);
+                using Element = typename std::remove_cvref_t<decltype(attribute)>::value_type;
+                if (attribute.size() == mesh.GetVertices().size())
+                    writer.Write<Element>(offset, attribute);
+                else
+                    writer.Write<Element>(offset, std::vector<Element>(mesh.GetVertices().size(), zero));
+                offset += mesh.GetVertices().size() * sizeof(Element);
+            }
+        };
+        writeAttribute(
+            header.positionsOffset, [](const Component::Mesh &mesh) -> const auto & { return mesh.GetVertices(); },
+            glm::vec3(0.0f));
+        writeAttribute(
+            header.normalsOffset, [](const Component::Mesh &mesh) -> const auto & { return mesh.GetNormals(); },
+            glm::vec3(0.0f));
+        writeAttribute(
+            header.texCoordsOffset, [](const Component::Mesh &mesh) -> const auto & { return mesh.GetTexCoords(); },
+            glm::vec2(0.0f));
+
+        uint64_t indicesOffset = header.indicesOffset;
+        for (const auto &shape : shapes)
+        {
+            writer.Write<uint32_t>(indicesOffset, shape.GetMesh().GetIndices());
+            indicesOffset += shape.GetMesh().GetIndices().size() * sizeof(uint32_t);
+        }
+
+        writer.Write<char>(header.stringsOffset, strings.GetData());
+        writer.Close();
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporaryPath, path, error);
+    if (error)
+    {
+        std::filesystem::remove(temporaryPath, error);
+        throw MeshFileError(fmt::format("Failed to move the mesh file to '{}'.", path.string()));
+    }
+}
+
+void ConvertOBJToMeshFile(const std::filesystem::path &objPath, const std::filesystem::path &meshFilePath,
+                          const std::string &mtlSearchPath)
+{
+    ConvertOBJ(objPath, meshFilePath, mtlSearchPath, HashFile(objPath));
+}
+
+uint64_t HashFile(const std::filesystem::path &path)
+{
+    const MappedFile file(path);
+    return HashBytes(file.GetData());
+}
+
+std::filesystem::path GetCachedMeshFile(const std::filesystem::path &objPath,
+                                        const std::filesystem::path &cacheDirectory, const std::string &mtlSearchPath)
+{
+    const uint64_t sourceHash = HashFile(objPath);
+    // Files with the same stem in other directories share the cache directory, the hash of the path tells them apart.
+    std::error_code error;
+    std::string sourcePath = std::filesystem::weakly_canonical(objPath, error).generic_string();
+    if (error)
+        sourcePath = std::filesystem::absolute(objPath).lexically_normal().generic_string();
+    const std::string prefix = fmt::format("{}.{:016x}.", objPath.stem().string(),
+                                           HashBytes(std::as_bytes(std::span(sourcePath.data(), sourcePath.size()))));
+    const auto meshFilePath =
+        cacheDirectory / fmt::format("{}{:016x}{}", prefix, sourceHash, Resource::MESH_FILE_EXTENSION);
+
+    Resource::MeshFileHeader header;
+    if (MeshFileLoader::ReadHeader(meshFilePath, header) && header.sourceHash == sourceHash)
+        return meshFilePath;
+
+    std::filesystem::create_directories(cacheDirectory, error);
+    if (error)
+        throw MeshFileError(fmt::format("Failed to create the cache directory '{}': {}", cacheDirectory.string(),
+                                        error.message()));
+
+    // Conversions of previous versions of the file have the same name with another hash of their content.
+    const size_t nameSize = meshFilePath.filename().string().size();
+    for (const auto &entry : std::filesystem::directory_iterator(cacheDirectory, error))
+    {
+        const std::string name = entry.path().filename().string();
+        if (name.size() == nameSize && name.starts_with(prefix) && name.ends_with(Resource::MESH_FILE_EXTENSION) &&
+            entry.path() != meshFilePath)
+            std::filesystem::remove(entry.path(), error);
+    }
+
+    ConvertOBJ(objPath, meshFilePath, mtlSearchPath, sourceHash);
+    Log::Info(fmt::format("Converted '{}' to '{}'.", objPath.string(), meshFilePath.string()));
+    return meshFilePath;
+}
+
+} // namespace Object::Utils
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "component/Material.hpp"
+#include "resource/Shape.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+
+namespace Object::Utils {
+
+/**
+ * @brief Write shapes to an engine binary mesh file, see Resource::MeshFileHeader for its layout.
+ *
+ * Each shape becomes a submesh. Its material refers to the entry of the given table with the same name, and is added
+ * to the table if there is none; shapes whose material has no name use the default material.
+ *
+ * The file is written next to its final path then renamed, so readers never see a partially written file.
+ *
+ * @param path        path of the file to write
+ * @param shapes      shapes to write
+ * @param materials   material table, including materials no shape uses
+ * @param sourceHash  hash of the file the shapes come from, see HashFile
+ *
+ * @throws MeshFileError if the file cannot be written.
+ */
+void WriteMeshFile(const std::filesystem::path &path, std::span<const Resource::Shape> shapes,
+                   std::span<const Component::Material> materials, uint64_t sourceHash = 0);
+
+/**
+ * @brief Convert an OBJ file, with its materials, to an engine binary mesh file.
+ *
+ * @throws OBJLoaderError if the OBJ file cannot be loaded.
+ * @throws MeshFileError if the mesh file cannot be written.
+ */
+void ConvertOBJToMeshFile(const std::filesystem::path &objPath, const std::filesystem::path &meshFilePath,
+                          const std::string &mtlSearchPath = "");
+
+/**
+ * @brief Hash the content of a file.
+ *
+ * @throws MeshFileError if the file cannot be read.
+ */
+[[nodiscard]] uint64_t HashFile(const std::filesystem::path &path);
+
+/**
+ * @brief Get the binary mesh file converted from an OBJ file, converting it only if the OBJ file changed.
+ *
+ * Converted files are named after the OBJ file, the hash of its path and the hash of its content, so an edited OBJ file
+ * is converted again and its previous conversions are removed, while OBJ files with the same name in other directories
+ * keep their own conversions. Material files are not hashed: touch the OBJ file after editing one.
+ *
+ * @param objPath         path of the OBJ file
+ * @param cacheDirectory  directory holding the converted files, created if needed
+ * @param mtlSearchPath   directory of the material files, the one of the OBJ file if empty
+ * @return the path of the converted file, to load with MeshFileLoader
+ *
+ * @throws OBJLoaderError if the OBJ file cannot be loaded.
+ * @throws MeshFileError if the OBJ file cannot be read or the mesh file cannot be written.
+ */
+[[nodiscard]] std::filesystem::path GetCachedMeshFile(const std::filesystem::path &objPath,
+                                                      const std::filesystem::path &cacheDirectory,
+                                                      const std::string &mtlSearchPath = "");
+
+} // namespace Object::Utils
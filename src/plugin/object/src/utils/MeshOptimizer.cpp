@@ -0,0 +1,339 @@
+#include "utils/MeshOptimizer.hpp"
+#include <glm/geometric.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace Object::Utils {
+
+namespace {
+
+/** @brief Cache modelled when ordering triangles, see Forsyth's "Linear-Speed Vertex Cache Optimisation". */
+constexpr uint32_t CACHE_SIZE = 32;
+constexpr float CACHE_DECAY_POWER = 1.5f;
+/** @brief Score of the vertices of the last triangle, lowered so its neighbours are not always preferred. */
+constexpr float LAST_TRIANGLE_SCORE = 0.75f;
+constexpr float VALENCE_BOOST_SCALE = 2.0f;
+constexpr float VALENCE_BOOST_POWER = 0.5f;
+
+/** @brief Size of the FIFO cache simulated to cut the triangle list into clusters. */
+constexpr uint32_t OVERDRAW_CACHE_SIZE = 16;
+
+constexpr uint32_t NO_VERTEX = std::numeric_limits<uint32_t>::max();
+
+float VertexScore(int32_t cachePosition, uint32_t remainingTriangles)
+{
+    // A vertex without triangles left must not attract any triangle.
+    if (remainingTriangles == 0)
+        return -1.0f;
+
+    float score = 0.0f;
+    if (cachePosition >= 0)
+    {
+        if (cachePosition < 3)
+            score = LAST_TRIANGLE_SCORE;
+        else
+            score = std::pow(1.0f - static_cast<float>(cachePosition - 3) / static_cast<float>(CACHE_SIZE - 3),
+                             CACHE_DECAY_POWER);
+    }
+    // Favour vertices with few triangles left, to finish them off instead of leaving lone triangles behind.
+    return score + VALENCE_BOOST_SCALE * std::pow(static_cast<float>(remainingTriangles), -VALENCE_BOOST_POWER);
+}
+
+bool IsValidTriangle(std::span<const uint32_t> indices, size_t triangle, size_t vertexCount)
+{
+    return indices[triangle * 3] < vertexCount && indices[triangle * 3 + 1] < vertexCount &&
+           indices[triangle * 3 + 2] < vertexCount;
+}
+
+/**
+ * @brief FIFO cache simulated with timestamps: a vertex is in the cache if less than cacheSize vertices were loaded
+ * since its own load.
+ */
+class FIFOCache {
+  public:
+    FIFOCache(size_t vertexCount, uint32_t cacheSize) : _timestamps(vertexCount, 0), _cacheSize(cacheSize) {}
+
+    /** @brief Access a vertex, and return whether it had to be loaded in the cache. */
+    bool Access(uint32_t vertex)
+    {
+        if (vertex >= _timestamps.size())
+            return true;
+        if (_timestamps[vertex] != 0 && _time - _timestamps[vertex] < _cacheSize)
+            return false;
+        _timestamps[vertex] = _time++;
+        return true;
+    }
+
+  private:
+    std::vector<uint32_t> _timestamps;
+    uint32_t _cacheSize;
+    uint32_t _time = 1;
+};
+
+template <typename T>
+std::vector<T> RemapAttribute(const std::vector<T> &attribute, const std::vector<uint32_t> &remap, uint32_t count)
+{
+    // Attributes that are not given per vertex can't be remapped, they are kept as is.
+    if (attribute.size() != remap.size())
+        return attribute;
+
+    std::vector<T> result(count);
+    for (size_t vertex = 0; vertex < remap.size(); ++vertex)
+    {
+        if (remap[vertex] != NO_VERTEX)
+            result[remap[vertex]] = attribute[vertex];
+    }
+    return result;
+}
+
+} // namespace
+
+void OptimizeVertexCache(std::span<uint32_t> indices, size_t vertexCount)
+{
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0)
+        return;
+
+    std::vector<uint32_t> validTriangles;
+    std::vector<uint32_t> invalidTriangles;
+    validTriangles.reserve(triangleCount);
+    for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+    {
+        if (IsValidTriangle(indices, triangle, vertexCount))
+            validTriangles.push_back(static_cast<uint32_t>(triangle));
+        else
+            invalidTriangles.push_back(static_cast<uint32_t>(triangle));
+    }
+
+    // Triangles of each vertex, the first remainingTriangles[vertex] of its range being the ones not emitted yet.
+    std::vector<uint32_t> remainingTriangles(vertexCount, 0);
+    for (uint32_t triangle : validTriangles)
+    {
+        for (size_t corner = 0; corner < 3; ++corner)
+            ++remainingTriangles[indices[triangle * 3 + corner]];
+    }
+    std::vector<uint32_t> offsets(vertexCount + 1, 0);
+    std::inclusive_scan(remainingTriangles.begin(), remainingTriangles.end(), offsets.begin() + 1);
+    std::vector<uint32_t> adjacency(offsets.back());
+    std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+    for (uint32_t triangle : validTriangles)
+    {
+        for (size_t corner = 0; corner < 3; ++corner)
+            adjacency[fill[indices[triangle * 3 + corner]]++] = triangle;
+    }
+
+    std::vector<int32_t> cachePositions(vertexCount, -1);
+    std::vector<float> vertexScores(vertexCount);
+    for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+        vertexScores[vertex] = VertexScore(-1, remainingTriangles[vertex]);
+
+    std::vector<bool> emitted(triangleCount, false);
+
+    std::vector<uint32_t> output;
+    output.reserve(triangleCount * 3);
+    std::vector<uint32_t> cache;
+    std::vector<uint32_t> nextCache;
+    cache.reserve(CACHE_SIZE + 3);
+    nextCache.reserve(CACHE_SIZE + 3);
+
+    int64_t bestTriangle = -1;
+    size_t cursor = 0;
+    for (size_t emittedCount = 0; emittedCount < validTriangles.size(); ++emittedCount)
+    {
+        // Dead end: no triangle is left around the cached vertices, start over from the input order.
+        if (bestTriangle < 0)
+        {
+            while (emitted[validTriangles[cursor]])
+                ++cursor;
+            bestTriangle = validTriangles[cursor];
+        }
+
+        const auto triangle = static_cast<size_t>(bestTriangle);
+        emitted[triangle] = true;
+
+        nextCache.clear();
+        for (size_t corner = 0; corner < 3; ++corner)
+        {
+            const uint32_t vertex = indices[triangle * 3 + corner];
+            output.push_back(vertex);
+
+            auto begin = adjacency.begin() + offsets[vertex];
+            auto end = begin + remainingTriangles[vertex];
+            auto it = std::find(begin, end, static_cast<uint32_t>(triangle));
+            if (it != end)
+            {
+                std::iter_swap(it, end - 1);
+                --remainingTriangles[vertex];
+            }
+
+            if (std::find(nextCache.begin(), nextCache.end(), vertex) == nextCache.end())
+                nextCache.push_back(vertex);
+        }
+        const auto triangleVertices = static_cast<std::ptrdiff_t>(nextCache.size());
+        for (uint32_t vertex : cache)
+        {
+            if (std::find(nextCache.begin(), nextCache.begin() + triangleVertices, vertex) ==
+                nextCache.begin() + triangleVertices)
+                nextCache.push_back(vertex);
+        }
+
+        // Vertices pushed out of the cache are updated as well, their triangles lose the cache bonus.
+        for (size_t position = 0; position < nextCache.size(); ++position)
+        {
+            const uint32_t vertex = nextCache[position];
+            cachePositions[vertex] = position < CACHE_SIZE ? static_cast<int32_t>(position) : -1;
+            vertexScores[vertex] = VertexScore(cachePositions[vertex], remainingTriangles[vertex]);
+        }
+
+        bestTriangle = -1;
+        float bestScore = -std::numeric_limits<float>::max();
+        for (uint32_t vertex : nextCache)
+        {
+            for (uint32_t i = 0; i < remainingTriangles[vertex]; ++i)
+            {
+                const uint32_t neighbour = adjacency[offsets[vertex] + i];
+                float score = 0.0f;
+                for (size_t corner = 0; corner < 3; ++corner)
+                    score += vertexScores[indices[neighbour * 3 + corner]];
+                if (score > bestScore)
+                {
+                    bestScore = score;
+                    bestTriangle = neighbour;
+                }
+            }
+        }
+
+        if (nextCache.size() > CACHE_SIZE)
+            nextCache.resize(CACHE_SIZE);
+        std::swap(cache, nextCache);
+    }
+
+    for (uint32_t triangle : invalidTriangles)
+    {
+        for (size_t corner = 0; corner < 3; ++corner)
+            output.push_back(indices[triangle * 3 + corner]);
+    }
+    std::copy(output.begin(), output.end(), indices.begin());
+}
+
+void OptimizeOverdraw(std::span<uint32_t> indices, std::span<const glm::vec3> positions)
+{
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0 || positions.empty())
+        return;
+
+    // A new cluster starts at each triangle whose vertices are all missing from the cache, so reordering the clusters
+    // keeps almost all of the vertex reuse.
+    std::vector<size_t> clusterStarts;
+    FIFOCache cache(positions.size(), OVERDRAW_CACHE_SIZE);
+    for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+    {
+        uint32_t misses = 0;
+        for (size_t corner = 0; corner < 3; ++corner)
+            misses += cache.Access(indices[triangle * 3 + corner]) ? 1 : 0;
+        if (triangle == 0 || misses == 3)
+            clusterStarts.push_back(triangle);
+    }
+    clusterStarts.push_back(triangleCount);
+    const size_t clusterCount = clusterStarts.size() - 1;
+    if (clusterCount < 2)
+        return;
+
+    glm::vec3 meshCenter(0.0f);
+    for (const auto &position : positions)
+        meshCenter += position;
+    meshCenter /= static_cast<float>(positions.size());
+
+    std::vector<float> sortKeys(clusterCount, 0.0f);
+    for (size_t cluster = 0; cluster < clusterCount; ++cluster)
+    {
+        glm::vec3 normal(0.0f);
+        glm::vec3 centroid(0.0f);
+        float area = 0.0f;
+        for (size_t triangle = clusterStarts[cluster]; triangle < clusterStarts[cluster + 1]; ++triangle)
+        {
+            if (!IsValidTriangle(indices, triangle, positions.size()))
+                continue;
+            const glm::vec3 &a = positions[indices[triangle * 3]];
+            const glm::vec3 &b = positions[indices[triangle * 3 + 1]];
+            const glm::vec3 &c = positions[indices[triangle * 3 + 2]];
+            const glm::vec3 triangleNormal = glm::cross(b - a, c - a);
+            const float triangleArea = glm::length(triangleNormal);
+            normal += triangleNormal;
+            centroid += (a + b + c) * (triangleArea / 3.0f);
+            area += triangleArea;
+        }
+        const float normalLength = glm::length(normal);
+        if (area > 0.0f && normalLength > 0.0f)
+            sortKeys[cluster] = glm::dot(centroid / area - meshCenter, normal / normalLength);
+    }
+
+    // Clusters far out and facing away from the center are the most likely to hide the others.
+    std::vector<size_t> order(clusterCount);
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::stable_sort(order.begin(), order.end(), [&sortKeys](size_t a, size_t b) { return sortKeys[a] > sortKeys[b]; });
+
+    std::vector<uint32_t> output;
+    output.reserve(indices.size());
+    for (size_t cluster : order)
+    {
+        output.insert(output.end(), indices.begin() + static_cast<std::ptrdiff_t>(clusterStarts[cluster] * 3),
+                      indices.begin() + static_cast<std::ptrdiff_t>(clusterStarts[cluster + 1] * 3));
+    }
+    std::copy(output.begin(), output.end(), indices.begin());
+}
+
+void OptimizeVertexFetch(Component::Mesh &mesh)
+{
+    const auto &vertices = mesh.GetVertices();
+    const auto &indices = mesh.GetIndices();
+
+    std::vector<uint32_t> remap(vertices.size(), NO_VERTEX);
+    std::vector<uint32_t> newIndices;
+    newIndices.reserve(indices.size());
+    uint32_t vertexCount = 0;
+    for (size_t triangle = 0; triangle < indices.size() / 3; ++triangle)
+    {
+        if (!IsValidTriangle(indices, triangle, vertices.size()))
+            continue;
+        for (size_t corner = 0; corner < 3; ++corner)
+        {
+            const uint32_t vertex = indices[triangle * 3 + corner];
+            if (remap[vertex] == NO_VERTEX)
+                remap[vertex] = vertexCount++;
+            newIndices.push_back(remap[vertex]);
+        }
+    }
+
+    mesh.SetNormals(RemapAttribute(mesh.GetNormals(), remap, vertexCount));
+    mesh.SetTexCoords(RemapAttribute(mesh.GetTexCoords(), remap, vertexCount));
+    mesh.SetVertices(RemapAttribute(vertices, remap, vertexCount));
+    mesh.SetIndices(newIndices);
+}
+
+void OptimizeMesh(Component::Mesh &mesh)
+{
+    std::vector<uint32_t> indices = mesh.GetIndices();
+    OptimizeVertexCache(indices, mesh.GetVertices().size());
+    OptimizeOverdraw(indices, mesh.GetVertices());
+    mesh.SetIndices(indices);
+    OptimizeVertexFetch(mesh);
+}
+
+float ComputeACMR(std::span<const uint32_t> indices, size_t vertexCount, uint32_t cacheSize)
+{
+    const size_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0)
+        return 0.0f;
+
+    FIFOCache cache(vertexCount, cacheSize);
+    size_t misses = 0;
+    for (size_t index = 0; index < triangleCount * 3; ++index)
+        misses += cache.Access(indices[index]) ? 1 : 0;
+    return static_cast<float>(misses) / static_cast<float>(triangleCount);
+}
+
+} // namespace Object::Utils
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "component/Mesh.hpp"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <span>
+
+namespace Object::Utils {
+
+/**
+ * @brief Reorder the triangles of a triangle list so that consecutive triangles reuse the vertices still in the
+ * post-transform cache of the GPU.
+ *
+ * Uses Tom Forsyth's linear-speed greedy algorithm, which does not depend on the actual cache size of the hardware.
+ * Triangles referencing a vertex out of [0, vertexCount) are left in place at the end of the list.
+ *
+ * @param indices      triangle list to reorder in place
+ * @param vertexCount  number of vertices referenced by the indices
+ */
+void OptimizeVertexCache(std::span<uint32_t> indices, size_t vertexCount);
+
+/**
+ * @brief Reorder clusters of triangles so that the ones most likely to occlude the rest of the mesh are drawn first.
+ *
+ * The triangle list should already be optimized for the vertex cache: it is cut into clusters where the cache starts
+ * over, so the order inside each cluster, and most of the vertex reuse, is kept. Clusters are then sorted by how far
+ * and how outward they face from the center of the mesh, following Sander et al., "Fast Triangle Reordering for Vertex
+ * Locality and Reduced Overdraw".
+ *
+ * @param indices    triangle list to reorder in place
+ * @param positions  vertex positions
+ */
+void OptimizeOverdraw(std::span<uint32_t> indices, std::span<const glm::vec3> positions);
+
+/**
+ * @brief Reorder the vertices of a mesh in the order the indices first reference them, so the GPU fetches vertex
+ * data sequentially. Unreferenced vertices are dropped.
+ */
+void OptimizeVertexFetch(Component::Mesh &mesh);
+
+/**
+ * @brief Run the vertex cache, overdraw and vertex fetch optimizations on a mesh, in this order.
+ */
+void OptimizeMesh(Component::Mesh &mesh);
+
+/**
+ * @brief Average number of vertices transformed per triangle with a FIFO post-transform cache of the given size.
+ *
+ * It lies between 0.5 for a large regular grid and 3 when no vertex is ever reused.
+ */
+[[nodiscard]] float ComputeACMR(std::span<const uint32_t> indices, size_t vertexCount, uint32_t cacheSize = 16);
+
+} // namespace Object::Utils
@@ -0,0 +1,370 @@
+#include "utils/MeshSimplifier.hpp"
+
+#include "Logger.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fmt/format.h>
+#include <glm/geometric.hpp>
+#include <numeric>
+#include <unordered_map>
+
+namespace Object::Utils {
+
+namespace {
+
+/** @brief Smallest dot product between the normals of a triangle before and after a collapse. */
+constexpr float MIN_NORMAL_DOT = 0.2f;
+
+/** @brief A level must remove at least this fraction of the triangles of the previous one to be kept. */
+constexpr float MIN_LEVEL_REDUCTION = 0.1f;
+
+/** @brief Sum of the squared distances to a set of planes, weighted by the area of the triangles they come from. */
+struct Quadric {
+    double a2 = 0.0, b2 = 0.0, c2 = 0.0, ab = 0.0, ac = 0.0, bc = 0.0;
+    double ad = 0.0, bd = 0.0, cd = 0.0, d2 = 0.0;
+    double weight = 0.0;
+
+    void AddPlane(const glm::dvec3 &normal, double d, double area)
+    {
+        a2 += area * normal.x * normal.x;
+        b2 += area * normal.y * normal.y;
+        c2 += area * normal.z * normal.z;
+        ab += area * normal.x * normal.y;
+        ac += area * normal.x * normal.z;
+        bc += area * normal.y * normal.z;
+        ad += area * normal.x * d;
+        bd += area * normal.y * d;
+        cd += area * normal.z * d;
+        d2 += area * d * d;
+        weight += area;
+    }
+
+    Quadric &operator+=(const Quadric &other)
+    {
+        a2 += other.a2;
+        b2 += other.b2;
+        c2 += other.c2;
+        ab += other.ab;
+        ac += other.ac;
+        bc += other.bc;
+        ad += other.ad;
+        bd += other.bd;
+        cd += other.cd;
+        d2 += other.d2;
+        weight += other.weight;
+        return *this;
+    }
+
+    /** @brief Area weighted mean of the squared distances from p to the planes. */
+    [[nodiscard]] double Error(const glm::dvec3 &p) const
+    {
+        if (weight <= 0.0)
+            return 0.0;
+        const double sum = a2 * p.x * p.x + b2 * p.y * p.y + c2 * p.z * p.z +
+                           2.0 * (ab * p.x * p.y + ac * p.x * p.z + bc * p.y * p.z) +
+                           2.0 * (ad * p.x + bd * p.y + cd * p.z) + d2;
+        return std::max(sum, 0.0) / weight;
+    }
+};
+
+struct Collapse {
+    uint32_t from;
+    uint32_t to;
+    double error;
+};
+
+/** @brief Map every vertex to the first vertex sharing its exact position. */
+std::vector<uint32_t> WeldPositions(std::span<const glm::vec3> positions)
+{
+    std::vector<uint32_t> order(positions.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::ranges::stable_sort(order, [&positions](uint32_t lhs, uint32_t rhs) {
+        const auto &a = positions[lhs];
+        const auto &b = positions[rhs];
+        if (a.x != b.x)
+            return a.x < b.x;
+        if (a.y != b.y)
+            return a.y < b.y;
+        return a.z < b.z;
+    });
+
+    std::vector<uint32_t> weld(positions.size());
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        const bool sameAsPrevious = i > 0 && positions[order[i]] == positions[order[i - 1]];
+        weld[order[i]] = sameAsPrevious ? weld[order[i - 1]] : order[i];
+    }
+    return weld;
+}
+
+glm::vec3 TriangleNormal(const glm::vec3 &a, const glm::vec3 &b, const glm::vec3 &c)
+{
+    return glm::cross(b - a, c - a);
+}
+
+} // namespace
+
+std::vector<uint32_t> SimplifyMesh(std::span<const glm::vec3> positions, std::span<const uint32_t> indices,
+                                   size_t targetIndexCount, float maxError, float *resultError)
+{
+    if (resultError != nullptr)
+        *resultError = 0.0f;
+
+    std::vector<uint32_t> triangles;
+    triangles.reserve(indices.size() - indices.size() % 3);
+    for (size_t i = 0; i + 2 < indices.size(); i += 3)
+    {
+        if (indices[i] >= positions.size() || indices[i + 1] >= positions.size() || indices[i + 2] >= positions.size())
+        {
+            Log::Warning(fmt::format("SimplifyMesh: Triangle {} references a vertex out of range, it is dropped.",
+                                     i / 3));
+            continue;
+        }
+        triangles.insert(triangles.end(), {indices[i], indices[i + 1], indices[i + 2]});
+    }
+    if (triangles.size() <= targetIndexCount || positions.empty())
+        return triangles;
+
+    // Errors are measured in a space where the mesh is one unit large, so that maxError does not depend on its scale.
+    glm::vec3 minBound(std::numeric_limits<float>::max());
+    glm::vec3 maxBound(std::numeric_limits<float>::lowest());
+    for (uint32_t index : triangles)
+    {
+        minBound = glm::min(minBound, positions[index]);
+        maxBound = glm::max(maxBound, positions[index]);
+    }
+    const glm::vec3 size = maxBound - minBound;
+    const float extent = std::max({size.x, size.y, size.z});
+    if (extent <= 0.0f)
+        return triangles;
+    const double scale = 1.0 / static_cast<double>(extent);
+
+    // Topology is built on welded positions: vertices duplicated for their normal or UV belong to the same corner.
+    const std::vector<uint32_t> weld = WeldPositions(positions);
+    std::vector<uint32_t> wedgeCount(positions.size(), 0);
+    {
+        std::vector<bool> referenced(positions.size(), false);
+        for (uint32_t index : triangles)
+        {
+            if (!referenced[index])
+                ++wedgeCount[weld[index]];
+            referenced[index] = true;
+        }
+    }
+
+    // Vertices on a seam or on an open (or non manifold) edge cannot move without tearing the mesh.
+    std::vector<bool> locked(positions.size(), false);
+    {
+        std::unordered_map<uint64_t, uint32_t> edgeUses;
+        edgeUses.reserve(triangles.size());
+        for (size_t t = 0; t < triangles.size(); t += 3)
+        {
+            for (size_t e = 0; e < 3; ++e)
+            {
+                const uint32_t a = weld[triangles[t + e]];
+                const uint32_t b = weld[triangles[t + (e + 1) % 3]];
+                ++edgeUses[(static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b)];
+            }
+        }
+        for (const auto &[edge, uses] : edgeUses)
+        {
+            if (uses == 2)
+                continue;
+            locked[static_cast<uint32_t>(edge >> 32)] = true;
+            locked[static_cast<uint32_t>(edge & 0xFFFFFFFFu)] = true;
+        }
+        for (size_t v = 0; v < positions.size(); ++v)
+        {
+            if (wedgeCount[v] > 1)
+                locked[v] = true;
+        }
+    }
+
+    std::vector<Quadric> quadrics(positions.size());
+    for (size_t t = 0; t < triangles.size(); t += 3)
+    {
+        const glm::dvec3 a = glm::dvec3(positions[triangles[t]]) * scale;
+        const glm::dvec3 b = glm::dvec3(positions[triangles[t + 1]]) * scale;
+        const glm::dvec3 c = glm::dvec3(positions[triangles[t + 2]]) * scale;
+        const glm::dvec3 cross = glm::cross(b - a, c - a);
+        const double length = glm::length(cross);
+        if (length <= 0.0)
+            continue;
+        const glm::dvec3 normal = cross / length;
+        const double area = length * 0.5;
+        for (size_t corner = 0; corner < 3; ++corner)
+            quadrics[weld[triangles[t + corner]]].AddPlane(normal, -glm::dot(normal, a), area);
+    }
+
+    const double errorLimit = static_cast<double>(maxError) * static_cast<double>(maxError);
+    double reachedError = 0.0;
+    std::vector<uint32_t> adjacencyOffsets(positions.size() + 1);
+    std::vector<uint32_t> adjacency;
+    std::vector<Collapse> collapses;
+    std::vector<bool> touched;
+    std::vector<bool> removed;
+
+    // Each pass collapses a batch of the cheapest independent edges, then the adjacency is rebuilt.
+    while (triangles.size() > targetIndexCount)
+    {
+        std::ranges::fill(adjacencyOffsets, 0u);
+        for (uint32_t index : triangles)
+            ++adjacencyOffsets[weld[index] + 1];
+        std::partial_sum(adjacencyOffsets.begin(), adjacencyOffsets.end(), adjacencyOffsets.begin());
+        adjacency.resize(triangles.size());
+        {
+            std::vector<uint32_t> cursor(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+            for (size_t i = 0; i < triangles.size(); ++i)
+                adjacency[cursor[weld[triangles[i]]]++] = static_cast<uint32_t>(i / 3);
+        }
+
+        collapses.clear();
+        for (size_t t = 0; t < triangles.size(); t += 3)
+        {
+            for (size_t e = 0; e < 3; ++e)
+            {
+                const uint32_t a = weld[triangles[t + e]];
+                const uint32_t b = weld[triangles[t + (e + 1) % 3]];
+                for (auto [from, to] : {std::pair{a, b}, std::pair{b, a}})
+                {
+                    if (from == to || locked[from])
+                        continue;
+                    Quadric merged = quadrics[from];
+                    merged += quadrics[to];
+                    collapses.push_back(Collapse{from, to, merged.Error(glm::dvec3(positions[to]) * scale)});
+                }
+            }
+        }
+        std::ranges::sort(collapses, [](const Collapse &lhs, const Collapse &rhs) { return lhs.error < rhs.error; });
+
+        touched.assign(positions.size(), false);
+        removed.assign(triangles.size() / 3, false);
+        size_t trianglesLeft = triangles.size() / 3;
+        const size_t targetTriangles = targetIndexCount / 3;
+        bool collapsed = false;
+
+        for (const Collapse &collapse : collapses)
+        {
+            if (trianglesLeft <= targetTriangles || collapse.error > errorLimit)
+                break;
+            if (touched[collapse.from] || touched[collapse.to])
+                continue;
+
+            const auto begin = adjacency.begin() + adjacencyOffsets[collapse.from];
+            const auto end = adjacency.begin() + adjacencyOffsets[collapse.from + 1];
+
+            // The removed vertex is not on a seam, but the target may be: pick the wedge the shared triangles use.
+            uint32_t target = UINT32_MAX;
+            bool consistent = true;
+            bool flips = false;
+            for (auto it = begin; it != end && consistent && !flips; ++it)
+            {
+                if (removed[*it])
+                    continue;
+                const uint32_t *corners = &triangles[*it * 3];
+                const auto shared = std::ranges::find_if(
+                    corners, corners + 3, [&](uint32_t index) { return weld[index] == collapse.to; });
+                if (shared != corners + 3)
+                {
+                    consistent = target == UINT32_MAX || target == *shared;
+                    target = *shared;
+                    continue;
+                }
+
+                glm::vec3 moved[3];
+                for (size_t corner = 0; corner < 3; ++corner)
+                    moved[corner] = weld[corners[corner]] == collapse.from ? positions[collapse.to]
+                                                                            : positions[corners[corner]];
+                const glm::vec3 before =
+                    TriangleNormal(positions[corners[0]], positions[corners[1]], positions[corners[2]]);
+                const glm::vec3 after = TriangleNormal(moved[0], moved[1], moved[2]);
+                // Triangles that were already degenerate cannot flip.
+                if (glm::length(before) <= 0.0f)
+                    continue;
+                const float lengths = glm::length(before) * glm::length(after);
+                flips = lengths <= 0.0f || glm::dot(before, after) < MIN_NORMAL_DOT * lengths;
+            }
+            if (!consistent || flips || target == UINT32_MAX)
+                continue;
+
+            for (auto it = begin; it != end; ++it)
+            {
+                if (removed[*it])
+                    continue;
+                uint32_t *corners = &triangles[*it * 3];
+                for (size_t corner = 0; corner < 3; ++corner)
+                {
+                    if (weld[corners[corner]] == collapse.from)
+                        corners[corner] = target;
+                }
+                // Triangles around the collapsed edge now use the target twice.
+                if (corners[0] == corners[1] || corners[1] == corners[2] || corners[0] == corners[2])
+                {
+                    removed[*it] = true;
+                    --trianglesLeft;
+                }
+            }
+
+            quadrics[collapse.to] += quadrics[collapse.from];
+            touched[collapse.from] = true;
+            touched[collapse.to] = true;
+            reachedError = std::max(reachedError, collapse.error);
+            collapsed = true;
+        }
+
+        if (!collapsed)
+            break;
+
+        size_t write = 0;
+        for (size_t t = 0; t < removed.size(); ++t)
+        {
+            if (removed[t])
+                continue;
+            std::copy_n(triangles.begin() + static_cast<std::ptrdiff_t>(t * 3), 3,
+                        triangles.begin() + static_cast<std::ptrdiff_t>(write * 3));
+            ++write;
+        }
+        triangles.resize(write * 3);
+    }
+
+    if (resultError != nullptr)
+        *resultError = static_cast<float>(std::sqrt(reachedError));
+    return triangles;
+}
+
+Component::MeshLOD GenerateMeshLOD(const Component::Mesh &mesh, const MeshLODSettings &settings)
+{
+    Component::MeshLOD lod;
+    std::vector<uint32_t> current = mesh.GetIndices();
+    float accumulatedError = 0.0f;
+
+    for (uint32_t level = 0; level < settings.levelCount; ++level)
+    {
+        const size_t currentTriangles = current.size() / 3;
+        const auto targetTriangles =
+            static_cast<size_t>(static_cast<float>(currentTriangles) * settings.triangleRatio);
+        // The error budget grows with the level, so that the first levels stay close to the mesh.
+        const float maxError =
+            settings.maxError * static_cast<float>(level + 1) / static_cast<float>(settings.levelCount);
+
+        float error = 0.0f;
+        std::vector<uint32_t> simplified =
+            SimplifyMesh(mesh.GetVertices(), current, targetTriangles * 3, maxError, &error);
+        const size_t simplifiedTriangles = simplified.size() / 3;
+        const auto maxTriangles = static_cast<float>(currentTriangles) * (1.0f - MIN_LEVEL_REDUCTION);
+        if (simplifiedTriangles == 0 || static_cast<float>(simplifiedTriangles) > maxTriangles)
+            break;
+
+        // Errors add up since each level is simplified from the previous one.
+        accumulatedError += error;
+        lod.levels.push_back(Component::MeshLOD::Level{
+            .indices = simplified,
+            .screenSize = settings.firstScreenSize * std::pow(settings.screenSizeRatio, static_cast<float>(level)),
+            .error = accumulatedError,
+        });
+        current = std::move(simplified);
+    }
+    return lod;
+}
+
+} // namespace Object::Utils
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "component/Mesh.hpp"
+#include "component/MeshLOD.hpp"
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <span>
+#include <vector>
+
+namespace Object::Utils {
+
+struct MeshLODSettings {
+    /** @brief Maximum number of levels generated, level 0 (the mesh itself) excluded. */
+    uint32_t levelCount = 3;
+    /** @brief Fraction of the triangles of the previous level each level aims for. */
+    float triangleRatio = 0.5f;
+    /** @brief Simplification error allowed for the last level, relative to the size of the mesh. */
+    float maxError = 0.05f;
+    /** @brief Screen size of the first level, see MeshLOD::Level::screenSize. */
+    float firstScreenSize = 0.3f;
+    /** @brief Factor between the screen sizes of consecutive levels. */
+    float screenSizeRatio = 0.5f;
+};
+
+/**
+ * @brief Simplify a triangle list with quadric error metrics, by collapsing edges onto existing vertices.
+ *
+ * The returned indices reference the same vertices, so the vertex data is shared with the original mesh. Vertices on
+ * open borders and on attribute seams (several vertices at the same position, e.g. UV seams or hard edges) are never
+ * collapsed away, which keeps the silhouette and texture mapping, at the cost of simplifying flat shaded meshes
+ * little.
+ *
+ * @param positions         vertex positions
+ * @param indices           triangle list to simplify
+ * @param targetIndexCount  number of indices to stop at
+ * @param maxError          largest error allowed, relative to the extent of the mesh
+ * @param resultError       if not null, receives the error of the result, relative to the extent of the mesh
+ * @return the simplified triangle list, with at least targetIndexCount indices if the error bound was reached first
+ */
+[[nodiscard]] std::vector<uint32_t> SimplifyMesh(std::span<const glm::vec3> positions,
+                                                 std::span<const uint32_t> indices, size_t targetIndexCount,
+                                                 float maxError, float *resultError = nullptr);
+
+/**
+ * @brief Generate the levels of detail of a mesh, each level simplifying the previous one.
+ *
+ * Generation stops early when a level no longer removes a significant number of triangles.
+ */
+[[nodiscard]] Component::MeshLOD GenerateMeshLOD(const Component::Mesh &mesh, const MeshLODSettings &settings = {});
+
+} // namespace Object::Utils
@@ -1,8 +1,10 @@
 #include "CreateShape.hpp"
 #include "Object.pch.hpp"
+#include "utils/MeshAsset.hpp"
 #include "utils/ShapeGenerator.hpp"
 
 #include <cmath>
+#include <fmt/format.h>
 
 namespace Object::Helper {
 
@@ -13,8 +15,9 @@ Engine::Entity CreateCube(Engine::Core &core, CreateCubeInfo info)
     auto transform = Component::Transform(info.position, info.scale, info.rotation);
     entity.AddComponent<Component::Transform>(transform);
 
-    auto mesh = Utils::GenerateCubeMesh(info.size);
-    entity.AddComponent<Component::Mesh>(std::move(mesh));
+    entity.AddComponent<Component::MeshHandle>(
+        Utils::GetOrCreateMeshAsset(core, fmt::format("Object::Helper::Cube({})", info.size),
+                                    [&info] { return Utils::GenerateCubeMesh(info.size); }));
 
     return entity;
 }
@@ -26,8 +29,9 @@ Engine::Entity CreateSphere(Engine::Core &core, CreateSphereInfo info)
     auto transform = Component::Transform(info.position, info.scale, info.rotation);
     entity.AddComponent<Component::Transform>(transform);
 
-    auto mesh = Utils::GenerateSphereMesh(info.radius, info.segments, info.rings);
-    entity.AddComponent<Component::Mesh>(std::move(mesh));
+    entity.AddComponent<Component::MeshHandle>(Utils::GetOrCreateMeshAsset(
+        core, fmt::format("Object::Helper::Sphere({}, {}, {})", info.radius, info.segments, info.rings),
+        [&info] { return Utils::GenerateSphereMesh(info.radius, info.segments, info.rings); }));
 
     return entity;
 }
@@ -39,8 +43,11 @@ Engine::Entity CreatePlane(Engine::Core &core, CreatePlaneInfo info)
     auto transform = Component::Transform(info.position, info.scale, info.rotation);
     entity.AddComponent<Component::Transform>(transform);
 
-    auto mesh = Utils::GeneratePlaneMesh(info.width, info.depth, info.subdivisionsX, info.subdivisionsZ);
-    entity.AddComponent<Component::Mesh>(std::move(mesh));
+    entity.AddComponent<Component::MeshHandle>(Utils::GetOrCreateMeshAsset(
+        core,
+        fmt::format("Object::Helper::Plane({}, {}, {}, {})", info.width, info.depth, info.subdivisionsX,
+                    info.subdivisionsZ),
+        [&info] { return Utils::GeneratePlaneMesh(info.width, info.depth, info.subdivisionsX, info.subdivisionsZ); }));
 
     return entity;
 }
@@ -52,9 +59,14 @@ Engine::Entity CreateCylinder(Engine::Core &core, CreateCylinderInfo info)
     auto transform = Component::Transform(info.position, info.scale, info.rotation);
     entity.AddComponent<Component::Transform>(transform);
 
-    auto mesh =
-        Utils::GenerateCylinderMesh(info.radiusTop, info.radiusBottom, info.height, info.segments, info.heightSegments);
-    entity.AddComponent<Component::Mesh>(std::move(mesh));
+    entity.AddComponent<Component::MeshHandle>(Utils::GetOrCreateMeshAsset(
+        core,
+        fmt::format("Object::Helper::Cylinder({}, {}, {}, {}, {})", info.radiusTop, info.radiusBottom, info.height,
+                    info.segments, info.heightSegments),
+        [&info] {
+            return Utils::GenerateCylinderMesh(info.radiusTop, info.radiusBottom, info.height, info.segments,
+                                               info.heightSegments);
+        }));
 
     return entity;
 }
@@ -66,8 +78,11 @@ Engine::Entity CreateCapsule(Engine::Core &core, CreateCapsuleInfo info)
     auto transform = Component::Transform(info.position, info.scale, info.rotation);
     entity.AddComponent<Component::Transform>(transform);
 
-    auto mesh = Utils::GenerateCapsuleMesh(info.radius, info.height, info.segments, info.heightSegments);
-    entity.AddComponent<Component::Mesh>(std::move(mesh));
+    entity.AddComponent<Component::MeshHandle>(Utils::GetOrCreateMeshAsset(
+        core,
+        fmt::format("Object::Helper::Capsule({}, {}, {}, {})", info.radius, info.height, info.segments,
+                    info.heightSegments),
+        [&info] { return Utils::GenerateCapsuleMesh(info.radius, info.height, info.segments, info.heightSegments); }));
 
     return entity;
 }
@@ -47,9 +47,12 @@ struct CreateCubeInfo {
  * @brief Create a cube entity with mesh and transform
  *
  * This is a high-level helper that creates an entity with:
- * - Mesh component (cube geometry)
+ * - MeshHandle component (cube geometry, shared by every cube of the same size)
  * - Transform component (position, rotation, scale)
  *
+ * The cube, sphere, plane, cylinder and capsule helpers share their geometry through a mesh asset per set of
+ * parameters (see Utils::GetOrCreateMeshAsset). Use Utils::PromoteToUniqueMesh to modify the geometry of one entity.
+ *
  * @param core Engine core reference
  * @param info Parameters for creating the cube (size, position, rotation, scale)
  * @return Engine::Entity The created entity with mesh and transform
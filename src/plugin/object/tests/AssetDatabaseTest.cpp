@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include "component/MeshHandle.hpp"
+#include "core/Core.hpp"
+#include "entity/Entity.hpp"
+#include "exception/ResourceManagerError.hpp"
+#include "resource/AssetDatabase.hpp"
+#include "utils/MeshAsset.hpp"
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "export.h"
+
+#define OBJ_FILE_PATH PROJECT_SOURCE_DIR "assets/"
+
+using namespace Object;
+
+namespace {
+std::filesystem::path CreateTestFile(const std::string &name)
+{
+    const auto directory = std::filesystem::temp_directory_path() / "EngineSquaredAssetDatabaseTest" / name;
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    const auto path = directory / "asset.txt";
+    std::ofstream(path) << "first version\n";
+    return path;
+}
+} // namespace
+
+TEST(AssetDatabase, DependentsAreReimportedAfterTheirDependencies)
+{
+    Engine::Core core;
+    Resource::AssetDatabase database;
+    std::vector<std::string> imported;
+    auto importer = [&imported](std::string name) {
+        return [&imported, name](Engine::Core &) { imported.push_back(name); };
+    };
+
+    const auto path = CreateTestFile("Order");
+    const auto texture = database.Register("texture", path, importer("texture"));
+    const auto material = database.Register("material", std::vector{texture}, importer("material"));
+    const auto bindGroup = database.Register("bind group", std::vector{material, texture}, importer("bind group"));
+    (void) database.Register("unrelated", std::vector<Resource::AssetDatabase::AssetId>{}, importer("unrelated"));
+
+    EXPECT_EQ(database.Reimport(core, texture), 3u);
+    EXPECT_EQ(imported, (std::vector<std::string>{"texture", "material", "bind group"}));
+    EXPECT_EQ(database.Get(bindGroup).version, 1u);
+    EXPECT_EQ(database.Get(texture).dependents.size(), 2u);
+
+    imported.clear();
+    EXPECT_EQ(database.Reimport(core, material), 2u);
+    EXPECT_EQ(imported, (std::vector<std::string>{"material", "bind group"}));
+}
+
+TEST(AssetDatabase, OnlyEditedFilesAreReimported)
+{
+    Engine::Core core;
+    Resource::AssetDatabase database;
+    int imports = 0;
+    const auto path = CreateTestFile("Edited");
+    const auto asset = database.Register("asset", path, [&imports](Engine::Core &) { ++imports; });
+
+    EXPECT_EQ(database.Update(core), 0u);
+
+    std::ofstream(path) << "second version\n";
+    EXPECT_EQ(database.Update(core), 1u);
+    EXPECT_EQ(imports, 1);
+    EXPECT_EQ(database.Get(asset).version, 1u);
+
+    // Saving the file without changing its content does nothing.
+    std::ofstream(path) << "second version\n";
+    EXPECT_EQ(database.Update(core), 0u);
+    EXPECT_EQ(imports, 1);
+}
+
+TEST(AssetDatabase, DependentsOfAFailedImportAreSkipped)
+{
+    Engine::Core core;
+    Resource::AssetDatabase database;
+    bool dependentImported = false;
+    const auto path = CreateTestFile("Failed");
+    const auto mesh =
+        database.Register("mesh", path, [](Engine::Core &) { throw std::runtime_error("invalid file"); });
+    (void) database.Register("geometry", std::vector{mesh},
+                             [&dependentImported](Engine::Core &) { dependentImported = true; });
+
+    EXPECT_EQ(database.Reimport(core, mesh), 0u);
+    EXPECT_FALSE(dependentImported);
+}
+
+TEST(AssetDatabase, FailedImportsAreRetriedWhenSavedAgain)
+{
+    Engine::Core core;
+    Resource::AssetDatabase database;
+    int attempts = 0;
+    bool isValid = false;
+    const auto path = CreateTestFile("Retried");
+    const auto asset = database.Register("asset", path, [&attempts, &isValid](Engine::Core &) {
+        ++attempts;
+        if (!isValid)
+            throw std::runtime_error("invalid file");
+    });
+
+    std::ofstream(path) << "second version\n";
+    EXPECT_EQ(database.Update(core), 0u);
+    EXPECT_EQ(attempts, 1);
+    EXPECT_EQ(database.Get(asset).version, 0u);
+
+    // The same bytes are saved again once the importer can read them: the file is not considered up to date.
+    isValid = true;
+    std::ofstream(path) << "second version\n";
+    EXPECT_EQ(database.Update(core), 1u);
+    EXPECT_EQ(attempts, 2);
+    EXPECT_EQ(database.Get(asset).version, 1u);
+
+    std::ofstream(path) << "second version\n";
+    EXPECT_EQ(database.Update(core), 0u);
+    EXPECT_EQ(attempts, 2);
+}
+
+TEST(AssetDatabase, CyclesAndUnknownAssetsAreRejected)
+{
+    Resource::AssetDatabase database;
+    const auto first = database.Register("first", std::vector<Resource::AssetDatabase::AssetId>{}, {});
+    const auto second = database.Register("second", std::vector{first}, {});
+
+    EXPECT_THROW(database.AddDependency(first, second), ResourceManagerError);
+    EXPECT_THROW(database.AddDependency(first, first), ResourceManagerError);
+    EXPECT_THROW(database.AddDependency(first, Resource::AssetDatabase::GetId("missing")), ResourceManagerError);
+    EXPECT_THROW((void) database.Get(Resource::AssetDatabase::GetId("missing")), ResourceManagerError);
+
+    database.Remove(first);
+    EXPECT_FALSE(database.Contains(first));
+    EXPECT_TRUE(database.Get(second).dependencies.empty());
+}
+
+TEST(AssetDatabase, ReloadedMeshesAreReboundToTheirEntities)
+{
+    Engine::Core core;
+    core.RegisterResource(Resource::AssetDatabase());
+    const auto path = CreateTestFile("Mesh").parent_path() / "model.obj";
+    std::filesystem::copy_file(OBJ_FILE_PATH "cube.obj", path);
+
+    const auto asset = Utils::LoadOBJMeshAsset(core, path.string());
+    auto first = core.CreateEntity();
+    first.AddComponent<Component::MeshHandle>(asset);
+    auto second = core.CreateEntity();
+    second.AddComponent<Component::MeshHandle>(asset);
+    const size_t cubeVertices = asset.Get().GetVertices().size();
+
+    // A dependent of the mesh, like the GPU geometry of a renderer, sees the entities already rebound.
+    auto &database = core.GetResource<Resource::AssetDatabase>();
+    std::vector<size_t> reboundVertices;
+    (void) database.Register("geometry", std::vector{asset.id}, [&reboundVertices, first](Engine::Core &) {
+        reboundVertices.push_back(first.GetComponents<Component::MeshHandle>().Get().GetVertices().size());
+    });
+
+    std::ofstream(path) << "v 0.0 0.0 0.0\nv 1.0 0.0 0.0\nv 0.0 1.0 0.0\nvt 0.0 0.0\nvn 0.0 0.0 1.0\n"
+                           "f 1/1/1 2/1/1 3/1/1\n";
+    EXPECT_EQ(database.Update(core), 2u);
+
+    const auto &firstHandle = first.GetComponents<Component::MeshHandle>();
+    const auto &secondHandle = second.GetComponents<Component::MeshHandle>();
+    EXPECT_NE(firstHandle.mesh, asset.mesh);
+    EXPECT_EQ(firstHandle.mesh, secondHandle.mesh);
+    EXPECT_EQ(firstHandle.mesh, Utils::GetMeshAsset(core, path.string()).mesh);
+    EXPECT_EQ(firstHandle.Get().GetVertices().size(), 3u);
+    EXPECT_EQ(reboundVertices, std::vector<size_t>{3u});
+    EXPECT_NE(cubeVertices, 3u);
+    EXPECT_EQ(database.Get(asset.id).version, 1u);
+}
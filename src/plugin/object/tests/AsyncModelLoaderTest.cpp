@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include "resource/AsyncModelLoader.hpp"
+#include "resource/OBJLoader.hpp"
+#include <thread>
+#include <vector>
+
+#include "export.h"
+
+#define OBJ_FILE_PATH PROJECT_SOURCE_DIR "assets/"
+
+using namespace Object;
+
+TEST(AsyncModelLoader, LoadsTheShapesOfTheFile)
+{
+    AsyncModelLoader loader(2);
+    const auto model = loader.Load(OBJ_FILE_PATH "cube_with_mat.obj").get();
+
+    OBJLoader objLoader(OBJ_FILE_PATH "cube_with_mat.obj");
+    const auto shapes = objLoader.GetShapes();
+    ASSERT_NE(model, nullptr);
+    ASSERT_EQ(model->shapes.size(), shapes.size());
+    for (size_t i = 0; i < shapes.size(); ++i)
+    {
+        EXPECT_EQ(model->shapes[i].GetName(), shapes[i].GetName());
+        EXPECT_EQ(model->shapes[i].mesh.GetVertices(), shapes[i].mesh.GetVertices());
+        EXPECT_EQ(model->shapes[i].mesh.GetIndices(), shapes[i].mesh.GetIndices());
+        EXPECT_EQ(model->shapes[i].material.name, shapes[i].material.name);
+    }
+    EXPECT_EQ(model->materials.size(), objLoader.GetMaterials().size());
+    EXPECT_GE(model->timings.total, model->timings.parse + model->timings.build);
+}
+
+TEST(AsyncModelLoader, RequestsForTheSameFileShareTheLoad)
+{
+    AsyncModelLoader loader(2);
+    std::vector<AsyncModelLoader::ModelPtr> reported;
+    auto callback = [&reported](const AsyncModelLoader::ModelPtr &model) { reported.push_back(model); };
+
+    auto first = loader.Load(OBJ_FILE_PATH "cube.obj", callback);
+    auto second = loader.Load(OBJ_FILE_PATH "cube.obj", callback);
+    EXPECT_EQ(loader.GetLoadingCount(), 1u);
+    EXPECT_EQ(first.get(), second.get());
+
+    // Callbacks are only fired by Update, on the calling thread.
+    loader.Wait();
+    EXPECT_TRUE(reported.empty());
+    EXPECT_EQ(loader.Update(), 1u);
+    ASSERT_EQ(reported.size(), 2u);
+    EXPECT_EQ(reported[0], first.get());
+    EXPECT_EQ(reported[1], first.get());
+
+    // Once reported, the file is loaded again.
+    EXPECT_FALSE(loader.IsLoading(OBJ_FILE_PATH "cube.obj"));
+    EXPECT_NE(loader.Load(OBJ_FILE_PATH "cube.obj").get(), first.get());
+}
+
+TEST(AsyncModelLoader, FailedLoadsReportTheError)
+{
+    AsyncModelLoader loader(1);
+    bool called = false;
+    auto future = loader.Load("missing.obj", [&called](const AsyncModelLoader::ModelPtr &model) {
+        called = true;
+        EXPECT_EQ(model, nullptr);
+    });
+
+    EXPECT_THROW(future.get(), OBJLoaderError);
+    loader.Wait();
+    loader.Update();
+    EXPECT_TRUE(called);
+}
+
+TEST(AsyncModelLoader, StoppedLoaderRejectsLoads)
+{
+    AsyncModelLoader loader(1);
+    loader.Stop();
+    EXPECT_THROW(loader.Load(OBJ_FILE_PATH "cube.obj").get(), std::runtime_error);
+}
+
+TEST(AsyncModelLoader, LoadsFromSeveralThreads)
+{
+    AsyncModelLoader loader(4);
+    std::vector<AsyncModelLoader::Future> futures(8);
+    {
+        std::vector<std::jthread> threads;
+        for (size_t i = 0; i < futures.size(); ++i)
+        {
+            threads.emplace_back([&loader, &futures, i]() {
+                futures[i] = loader.Load(i % 2 == 0 ? OBJ_FILE_PATH "cube.obj" : OBJ_FILE_PATH "cube_with_mat.obj");
+            });
+        }
+    }
+
+    for (const auto &future : futures)
+        EXPECT_NE(future.get(), nullptr);
+    loader.Wait();
+    EXPECT_EQ(loader.Update(), 2u);
+    EXPECT_EQ(loader.GetLoadingCount(), 0u);
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include "utils/FileWatcher.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+using namespace Object;
+
+namespace {
+std::filesystem::path CreateTestDirectory(const std::string &name)
+{
+    const auto directory = std::filesystem::temp_directory_path() / "EngineSquaredFileWatcherTest" / name;
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    return directory;
+}
+
+bool Contains(const std::vector<std::filesystem::path> &changes, const std::filesystem::path &path)
+{
+    return std::ranges::find(changes, path) != changes.end();
+}
+} // namespace
+
+TEST(FileWatcher, WrittenFilesAreReportedOnce)
+{
+    const auto directory = CreateTestDirectory("Written");
+    const auto path = directory / "mesh.obj";
+    const auto other = directory / "other.obj";
+    std::ofstream(path) << "v 0 0 0\n";
+    std::ofstream(other) << "v 0 0 0\n";
+
+    Utils::FileWatcher watcher;
+    watcher.Watch(path);
+    EXPECT_TRUE(watcher.IsWatching(path));
+    EXPECT_TRUE(watcher.Poll().empty());
+
+    std::ofstream(path, std::ios::app) << "v 1 0 0\n";
+    std::ofstream(other, std::ios::app) << "v 1 0 0\n";
+    const auto changes = watcher.Poll();
+    EXPECT_EQ(changes.size(), 1u);
+    EXPECT_TRUE(Contains(changes, path));
+    EXPECT_TRUE(watcher.Poll().empty());
+}
+
+TEST(FileWatcher, FilesReplacedByARenameAreReported)
+{
+    const auto directory = CreateTestDirectory("Renamed");
+    const auto path = directory / "mesh.obj";
+    std::ofstream(path) << "v 0 0 0\n";
+
+    Utils::FileWatcher watcher;
+    watcher.Watch(path);
+
+    // How most editors save a file.
+    std::ofstream(directory / "mesh.obj.swap") << "v 0 0 0\nv 1 0 0\n";
+    std::filesystem::rename(directory / "mesh.obj.swap", path);
+    EXPECT_TRUE(Contains(watcher.Poll(), path));
+}
+
+TEST(FileWatcher, UnwatchedFilesAreNotReported)
+{
+    const auto directory = CreateTestDirectory("Unwatched");
+    const auto path = directory / "mesh.obj";
+    std::ofstream(path) << "v 0 0 0\n";
+
+    Utils::FileWatcher watcher;
+    watcher.Watch(path);
+    watcher.Unwatch(path);
+    EXPECT_FALSE(watcher.IsWatching(path));
+
+    std::ofstream(path, std::ios::app) << "v 1 0 0\n";
+    EXPECT_TRUE(watcher.Poll().empty());
+}
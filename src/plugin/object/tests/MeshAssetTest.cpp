@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include "Object.hpp"
+#include "core/Core.hpp"
+#include "entity/Entity.hpp"
+
+using namespace Object;
+
+TEST(MeshAsset, AssetIsCreatedOnceAndShared)
+{
+    Engine::Core core;
+    int factoryCalls = 0;
+    auto factory = [&factoryCalls] {
+        ++factoryCalls;
+        return Utils::GenerateCubeMesh(1.0f);
+    };
+
+    const auto first = Utils::GetOrCreateMeshAsset(core, "cube", factory);
+    const auto second = Utils::GetOrCreateMeshAsset(core, "cube", factory);
+
+    EXPECT_EQ(factoryCalls, 1);
+    ASSERT_TRUE(first.IsValid());
+    EXPECT_EQ(first.mesh, second.mesh);
+    EXPECT_EQ(first.id, second.id);
+    EXPECT_EQ(Utils::GetMeshAsset(core, "cube").mesh, first.mesh);
+    EXPECT_THROW((void) Utils::GetMeshAsset(core, "missing"), ResourceManagerError);
+}
+
+TEST(MeshAsset, HelpersShareTheGeometryOfIdenticalShapes)
+{
+    Engine::Core core;
+    auto first = Helper::CreateCube(core, {.size = 2.0f});
+    auto second = Helper::CreateCube(core, {.size = 2.0f, .position = glm::vec3(5.0f, 0.0f, 0.0f)});
+    auto other = Helper::CreateCube(core, {.size = 3.0f});
+
+    const auto &firstHandle = first.GetComponents<Component::MeshHandle>();
+    EXPECT_FALSE(first.HasComponents<Component::Mesh>());
+    EXPECT_EQ(firstHandle.mesh, second.GetComponents<Component::MeshHandle>().mesh);
+    EXPECT_NE(firstHandle.mesh, other.GetComponents<Component::MeshHandle>().mesh);
+    EXPECT_EQ(Utils::TryGetMeshData(core.GetRegistry(), first), firstHandle.mesh.get());
+}
+
+TEST(MeshAsset, PromotionCopiesTheAssetForOneEntity)
+{
+    Engine::Core core;
+    auto first = Helper::CreateSphere(core);
+    auto second = Helper::CreateSphere(core);
+    const auto asset = second.GetComponents<Component::MeshHandle>().mesh;
+
+    auto &mesh = Utils::PromoteToUniqueMesh(core, first);
+    EXPECT_FALSE(first.HasComponents<Component::MeshHandle>());
+    EXPECT_EQ(mesh.GetVertices(), asset->GetVertices());
+
+    mesh.SetVertexAt(0, glm::vec3(42.0f));
+    EXPECT_NE(asset->GetVertices()[0], glm::vec3(42.0f));
+    EXPECT_EQ(Utils::TryGetMeshData(core.GetRegistry(), first), &mesh);
+    // Promoting an entity that already owns its mesh does nothing.
+    EXPECT_EQ(&Utils::PromoteToUniqueMesh(core, first), &mesh);
+}
+
+TEST(MeshAsset, EntitiesWithoutMeshHaveNoData)
+{
+    Engine::Core core;
+    auto entity = core.CreateEntity();
+
+    EXPECT_EQ(Utils::TryGetMeshData(core.GetRegistry(), entity), nullptr);
+    EXPECT_THROW((void) Utils::PromoteToUniqueMesh(core, entity), ResourceManagerError);
+}
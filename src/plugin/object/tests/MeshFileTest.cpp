@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+
+#include "resource/MeshFileLoader.hpp"
+#include "resource/OBJLoader.hpp"
+#include "utils/CubeGenerator.hpp"
+#include "utils/MeshFileConverter.hpp"
+#include "utils/SphereGenerator.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "export.h"
+
+#define OBJ_FILE_PATH PROJECT_SOURCE_DIR "assets/"
+
+using namespace Object;
+
+namespace {
+std::filesystem::path CreateTestDirectory(const std::string &name)
+{
+    const auto directory = std::filesystem::temp_directory_path() / "EngineSquaredMeshFileTest" / name;
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    return directory;
+}
+
+std::vector<Resource::Shape> CreateShapes()
+{
+    std::vector<Resource::Shape> shapes(2);
+    shapes[0].name = "sphere";
+    shapes[0].mesh = Utils::GenerateSphereMesh(1.0f, 16, 8);
+    shapes[1].name = "cube";
+    shapes[1].mesh = Utils::GenerateCubeMesh(2.0f);
+    shapes[1].material.name = "red";
+    shapes[1].material.diffuse = glm::vec3(1.0f, 0.0f, 0.0f);
+    shapes[1].material.diffuseTexName = "red.png";
+    return shapes;
+}
+
+void PatchFile(const std::filesystem::path &path, uint64_t offset, const void *data, size_t size)
+{
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(static_cast<std::streamoff>(offset));
+    file.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+}
+} // namespace
+
+TEST(MeshFile, ShapesAndMaterialsRoundTrip)
+{
+    const auto path = CreateTestDirectory("RoundTrip") / "shapes.esmesh";
+    const auto shapes = CreateShapes();
+    Utils::WriteMeshFile(path, shapes, {}, 42);
+
+    MeshFileLoader loader(path);
+    EXPECT_EQ(loader.GetHeader().sourceHash, 42u);
+
+    const auto loaded = loader.GetShapes();
+    ASSERT_EQ(loaded.size(), shapes.size());
+    for (size_t i = 0; i < shapes.size(); ++i)
+    {
+        EXPECT_EQ(loaded[i].GetName(), shapes[i].GetName());
+        EXPECT_EQ(loaded[i].mesh.GetVertices(), shapes[i].mesh.GetVertices());
+        EXPECT_EQ(loaded[i].mesh.GetNormals(), shapes[i].mesh.GetNormals());
+        EXPECT_EQ(loaded[i].mesh.GetTexCoords(), shapes[i].mesh.GetTexCoords());
+        EXPECT_EQ(loaded[i].mesh.GetIndices(), shapes[i].mesh.GetIndices());
+    }
+    EXPECT_TRUE(loaded[0].material.name.empty());
+    EXPECT_EQ(loaded[1].material.name, "red");
+    EXPECT_EQ(loaded[1].material.diffuse, glm::vec3(1.0f, 0.0f, 0.0f));
+    EXPECT_EQ(loaded[1].material.diffuseTexName, "red.png");
+
+    const auto materials = loader.GetMaterials();
+    ASSERT_EQ(materials.size(), 1u);
+    EXPECT_EQ(materials[0].name, "red");
+
+    const auto submeshes = loader.GetSubmeshes();
+    ASSERT_EQ(submeshes.size(), 2u);
+    EXPECT_EQ(submeshes[0].material, -1);
+    EXPECT_EQ(submeshes[1].material, 0);
+    EXPECT_FLOAT_EQ(submeshes[1].boundsMin[0], -1.0f);
+    EXPECT_FLOAT_EQ(submeshes[1].boundsMax[2], 1.0f);
+}
+
+TEST(MeshFile, MergedMeshOffsetsTheIndicesOfEachSubmesh)
+{
+    const auto path = CreateTestDirectory("Merged") / "shapes.esmesh";
+    const auto shapes = CreateShapes();
+    Utils::WriteMeshFile(path, shapes, {});
+
+    MeshFileLoader loader(path);
+    const auto &mesh = loader.GetMesh();
+    const size_t sphereVertices = shapes[0].mesh.GetVertices().size();
+    const size_t sphereIndices = shapes[0].mesh.GetIndices().size();
+
+    ASSERT_EQ(mesh.GetVertices().size(), sphereVertices + shapes[1].mesh.GetVertices().size());
+    ASSERT_EQ(mesh.GetIndices().size(), sphereIndices + shapes[1].mesh.GetIndices().size());
+    EXPECT_EQ(mesh.GetIndices()[sphereIndices], shapes[1].mesh.GetIndices()[0] + sphereVertices);
+    EXPECT_EQ(mesh.GetVertices()[sphereVertices], shapes[1].mesh.GetVertices()[0]);
+}
+
+TEST(MeshFile, InvalidFilesAreRejected)
+{
+    const auto directory = CreateTestDirectory("Invalid");
+    const auto path = directory / "shapes.esmesh";
+    Utils::WriteMeshFile(path, CreateShapes(), {});
+    const auto header = MeshFileLoader(path).GetHeader();
+
+    EXPECT_THROW(MeshFileLoader(directory / "missing.esmesh"), MeshFileError);
+
+    // An index out of its submesh.
+    const uint32_t index = 1000000;
+    PatchFile(path, header.indicesOffset, &index, sizeof(index));
+    EXPECT_THROW(MeshFileLoader{path}, MeshFileError);
+
+    // Another version of the format.
+    const uint32_t version = Resource::MESH_FILE_VERSION + 1;
+    PatchFile(path, offsetof(Resource::MeshFileHeader, version), &version, sizeof(version));
+    EXPECT_THROW(MeshFileLoader{path}, MeshFileError);
+
+    // A truncated file, written again so that only its size is wrong.
+    Utils::WriteMeshFile(path, CreateShapes(), {});
+    EXPECT_NO_THROW(MeshFileLoader{path});
+    std::filesystem::resize_file(path, header.fileSize / 2);
+    EXPECT_THROW(MeshFileLoader{path}, MeshFileError);
+}
+
+TEST(MeshFile, ConversionMatchesTheOBJFile)
+{
+    const auto path = CreateTestDirectory("Conversion") / "cube.esmesh";
+    Utils::ConvertOBJToMeshFile(OBJ_FILE_PATH "cube_with_mat.obj", path);
+
+    OBJLoader objLoader(OBJ_FILE_PATH "cube_with_mat.obj");
+    MeshFileLoader loader(path);
+    const auto objShapes = objLoader.GetShapes();
+    const auto shapes = loader.GetShapes();
+    ASSERT_EQ(shapes.size(), objShapes.size());
+    for (size_t i = 0; i < shapes.size(); ++i)
+    {
+        EXPECT_EQ(shapes[i].mesh.GetVertices(), objShapes[i].mesh.GetVertices());
+        EXPECT_EQ(shapes[i].mesh.GetIndices(), objShapes[i].mesh.GetIndices());
+        EXPECT_EQ(shapes[i].material.name, objShapes[i].material.name);
+    }
+    EXPECT_EQ(loader.GetMaterials().size(), objLoader.GetMaterials().size());
+    EXPECT_EQ(loader.GetHeader().sourceHash, Utils::HashFile(OBJ_FILE_PATH "cube_with_mat.obj"));
+}
+
+TEST(MeshFile, CacheIsOnlyRebuiltWhenTheSourceChanges)
+{
+    const auto directory = CreateTestDirectory("Cache");
+    const auto objPath = directory / "cube.obj";
+    const auto cacheDirectory = directory / "cache";
+    std::filesystem::copy_file(OBJ_FILE_PATH "cube.obj", objPath);
+
+    const auto first = Utils::GetCachedMeshFile(objPath, cacheDirectory);
+    ASSERT_TRUE(std::filesystem::exists(first));
+    const auto writeTime = std::filesystem::last_write_time(first);
+    EXPECT_EQ(Utils::GetCachedMeshFile(objPath, cacheDirectory), first);
+    EXPECT_EQ(std::filesystem::last_write_time(first), writeTime);
+
+    std::ofstream(objPath, std::ios::app) << "\n# edited\n";
+    const auto second = Utils::GetCachedMeshFile(objPath, cacheDirectory);
+    EXPECT_NE(second, first);
+    EXPECT_TRUE(std::filesystem::exists(second));
+    EXPECT_FALSE(std::filesystem::exists(first));
+    EXPECT_NO_THROW(MeshFileLoader{second});
+}
+
+TEST(MeshFile, CacheKeepsFilesWithTheSameNameApart)
+{
+    const auto directory = CreateTestDirectory("SameName");
+    const auto cacheDirectory = directory / "cache";
+    std::filesystem::create_directories(directory / "a");
+    std::filesystem::create_directories(directory / "b");
+    std::filesystem::copy_file(OBJ_FILE_PATH "cube.obj", directory / "a" / "model.obj");
+    std::filesystem::copy_file(OBJ_FILE_PATH "cube.obj", directory / "b" / "model.obj");
+    std::ofstream(directory / "b" / "model.obj", std::ios::app) << "\n# other model\n";
+
+    const auto first = Utils::GetCachedMeshFile(directory / "a" / "model.obj", cacheDirectory);
+    const auto second = Utils::GetCachedMeshFile(directory / "b" / "model.obj", cacheDirectory);
+    EXPECT_NE(first, second);
+    EXPECT_TRUE(std::filesystem::exists(first));
+    EXPECT_TRUE(std::filesystem::exists(second));
+
+    // Converting one of them again leaves the other one in the cache.
+    const auto writeTime = std::filesystem::last_write_time(second);
+    EXPECT_EQ(Utils::GetCachedMeshFile(directory / "a" / "model.obj", cacheDirectory), first);
+    EXPECT_EQ(Utils::GetCachedMeshFile(directory / "b" / "model.obj", cacheDirectory), second);
+    EXPECT_EQ(std::filesystem::last_write_time(second), writeTime);
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include "component/Mesh.hpp"
+#include "utils/MeshOptimizer.hpp"
+#include "utils/SphereGenerator.hpp"
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <set>
+#include <tuple>
+
+using namespace Object;
+
+namespace {
+// Flat grid of size x size quads in the XZ plane, with its triangles shuffled.
+Component::Mesh CreateShuffledGrid(uint32_t size)
+{
+    Component::Mesh mesh;
+    for (uint32_t y = 0; y <= size; ++y)
+    {
+        for (uint32_t x = 0; x <= size; ++x)
+        {
+            mesh.EmplaceVertices(static_cast<float>(x), 0.0f, static_cast<float>(y));
+            mesh.EmplaceNormals(0.0f, 1.0f, 0.0f);
+            mesh.EmplaceTexCoords(static_cast<float>(x), static_cast<float>(y));
+        }
+    }
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (uint32_t y = 0; y < size; ++y)
+    {
+        for (uint32_t x = 0; x < size; ++x)
+        {
+            const uint32_t a = y * (size + 1) + x;
+            const uint32_t b = a + size + 1;
+            triangles.push_back({a, b, a + 1});
+            triangles.push_back({a + 1, b, b + 1});
+        }
+    }
+    // Deterministic shuffle, so the test does not depend on the standard library.
+    for (size_t i = 0; i < triangles.size(); ++i)
+        std::swap(triangles[i], triangles[(i * 7919u + 13u) % triangles.size()]);
+    for (const auto &triangle : triangles)
+    {
+        for (uint32_t index : triangle)
+            mesh.EmplaceIndices(index);
+    }
+    return mesh;
+}
+
+// Triangles as sorted vertex positions, to compare meshes whatever their vertex and triangle order.
+std::multiset<std::array<float, 9>> GetTriangles(const Component::Mesh &mesh)
+{
+    std::multiset<std::array<float, 9>> triangles;
+    const auto &indices = mesh.GetIndices();
+    for (size_t i = 0; i + 2 < indices.size(); i += 3)
+    {
+        std::array<glm::vec3, 3> corners = {mesh.GetVertices()[indices[i]], mesh.GetVertices()[indices[i + 1]],
+                                            mesh.GetVertices()[indices[i + 2]]};
+        // Rotate the corners so the smallest comes first, which keeps the winding.
+        auto less = [](const glm::vec3 &a, const glm::vec3 &b) {
+            return std::tie(a.x, a.y, a.z) < std::tie(b.x, b.y, b.z);
+        };
+        std::rotate(corners.begin(), std::min_element(corners.begin(), corners.end(), less), corners.end());
+        triangles.insert({corners[0].x, corners[0].y, corners[0].z, corners[1].x, corners[1].y, corners[1].z,
+                          corners[2].x, corners[2].y, corners[2].z});
+    }
+    return triangles;
+}
+} // namespace
+
+TEST(MeshOptimizer, VertexCacheOptimizationLowersTheACMR)
+{
+    const auto grid = CreateShuffledGrid(32);
+    std::vector<uint32_t> indices = grid.GetIndices();
+    const float before = Utils::ComputeACMR(indices, grid.GetVertices().size());
+
+    Utils::OptimizeVertexCache(indices, grid.GetVertices().size());
+    const float after = Utils::ComputeACMR(indices, grid.GetVertices().size());
+
+    EXPECT_GT(before, 2.0f);
+    EXPECT_LT(after, 1.0f);
+}
+
+TEST(MeshOptimizer, OptimizationKeepsTheTriangles)
+{
+    const auto sphere = Utils::GenerateSphereMesh(1.0f, 32, 16);
+    auto optimized = sphere;
+    Utils::OptimizeMesh(optimized);
+
+    EXPECT_EQ(optimized.GetIndices().size(), sphere.GetIndices().size());
+    EXPECT_EQ(optimized.GetVertices().size(), sphere.GetVertices().size());
+    EXPECT_EQ(optimized.GetNormals().size(), sphere.GetNormals().size());
+    EXPECT_EQ(optimized.GetTexCoords().size(), sphere.GetTexCoords().size());
+    EXPECT_EQ(GetTriangles(optimized), GetTriangles(sphere));
+}
+
+TEST(MeshOptimizer, OverdrawOptimizationOnlyMovesClusters)
+{
+    const auto sphere = Utils::GenerateSphereMesh(1.0f, 32, 16);
+    std::vector<uint32_t> indices = sphere.GetIndices();
+    Utils::OptimizeVertexCache(indices, sphere.GetVertices().size());
+    const float acmr = Utils::ComputeACMR(indices, sphere.GetVertices().size());
+
+    Utils::OptimizeOverdraw(indices, sphere.GetVertices());
+
+    // Clusters start where the cache is empty anyway, so reordering them barely changes the vertex reuse.
+    EXPECT_LE(Utils::ComputeACMR(indices, sphere.GetVertices().size()), acmr * 1.05f);
+}
+
+TEST(MeshOptimizer, VertexFetchFollowsTheFirstUse)
+{
+    Component::Mesh mesh;
+    for (float x : {0.0f, 1.0f, 2.0f, 3.0f, 4.0f})
+    {
+        mesh.EmplaceVertices(x, 0.0f, 0.0f);
+        mesh.EmplaceNormals(0.0f, 0.0f, 1.0f);
+        mesh.EmplaceTexCoords(x, 0.0f);
+    }
+    mesh.SetIndices({4, 2, 3, 3, 2, 0});
+
+    Utils::OptimizeVertexFetch(mesh);
+
+    // Vertex 1 is not referenced and is dropped.
+    EXPECT_EQ(mesh.GetIndices(), std::vector<uint32_t>({0, 1, 2, 2, 1, 3}));
+    EXPECT_EQ(mesh.GetVertices(), std::vector<glm::vec3>({{4.0f, 0.0f, 0.0f},
+                                                          {2.0f, 0.0f, 0.0f},
+                                                          {3.0f, 0.0f, 0.0f},
+                                                          {0.0f, 0.0f, 0.0f}}));
+    EXPECT_EQ(mesh.GetTexCoords()[0], glm::vec2(4.0f, 0.0f));
+}
+
+TEST(MeshOptimizer, InvalidTrianglesAreKeptLast)
+{
+    const std::vector<glm::vec3> positions = {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+    std::vector<uint32_t> indices = {0, 1, 7, 0, 1, 2};
+
+    Utils::OptimizeVertexCache(indices, positions.size());
+    EXPECT_EQ(indices, std::vector<uint32_t>({0, 1, 2, 0, 1, 7}));
+
+    Utils::OptimizeOverdraw(indices, positions);
+    EXPECT_EQ(indices.size(), 6u);
+}
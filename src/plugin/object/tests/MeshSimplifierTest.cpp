@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include "component/Mesh.hpp"
+#include "utils/MeshSimplifier.hpp"
+#include "utils/SphereGenerator.hpp"
+
+using namespace Object;
+
+namespace {
+// Flat grid of size x size quads in the XZ plane.
+Component::Mesh CreateGrid(uint32_t size)
+{
+    Component::Mesh mesh;
+    for (uint32_t y = 0; y <= size; ++y)
+    {
+        for (uint32_t x = 0; x <= size; ++x)
+            mesh.EmplaceVertices(static_cast<float>(x), 0.0f, static_cast<float>(y));
+    }
+    for (uint32_t y = 0; y < size; ++y)
+    {
+        for (uint32_t x = 0; x < size; ++x)
+        {
+            const uint32_t a = y * (size + 1) + x;
+            const uint32_t b = a + size + 1;
+            for (uint32_t index : {a, b, a + 1, a + 1, b, b + 1})
+                mesh.EmplaceIndices(index);
+        }
+    }
+    return mesh;
+}
+
+bool IsOnGridBorder(const glm::vec3 &position, float size)
+{
+    return position.x == 0.0f || position.z == 0.0f || position.x == size || position.z == size;
+}
+} // namespace
+
+TEST(MeshSimplifier, FlatGridCollapsesToItsBorderWithoutError)
+{
+    const auto grid = CreateGrid(8);
+    float error = 1.0f;
+    const auto simplified = Utils::SimplifyMesh(grid.GetVertices(), grid.GetIndices(), 0, 0.01f, &error);
+
+    EXPECT_LT(simplified.size(), grid.GetIndices().size() / 4);
+    EXPECT_EQ(simplified.size() % 3, 0u);
+    EXPECT_NEAR(error, 0.0f, 1e-5f);
+    // Border vertices are locked, interior ones are all collapsed onto them.
+    for (uint32_t index : simplified)
+        EXPECT_TRUE(IsOnGridBorder(grid.GetVertices()[index], 8.0f));
+}
+
+TEST(MeshSimplifier, TargetIsReachedOnACurvedMesh)
+{
+    const auto sphere = Utils::GenerateSphereMesh(1.0f, 32, 16);
+    const size_t target = sphere.GetIndices().size() / 4;
+    float error = 0.0f;
+    const auto simplified = Utils::SimplifyMesh(sphere.GetVertices(), sphere.GetIndices(), target, 0.2f, &error);
+
+    EXPECT_LE(simplified.size(), target);
+    EXPECT_GT(simplified.size(), 0u);
+    EXPECT_GT(error, 0.0f);
+    EXPECT_LE(error, 0.2f);
+    for (uint32_t index : simplified)
+        EXPECT_LT(index, sphere.GetVertices().size());
+}
+
+TEST(MeshSimplifier, ErrorBoundStopsTheSimplification)
+{
+    const auto sphere = Utils::GenerateSphereMesh(1.0f, 32, 16);
+    const auto simplified = Utils::SimplifyMesh(sphere.GetVertices(), sphere.GetIndices(), 0, 0.0f);
+
+    // Every vertex of a sphere lies off the planes of its neighbours: no collapse is free.
+    EXPECT_EQ(simplified.size(), sphere.GetIndices().size());
+}
+
+TEST(MeshSimplifier, InvalidTrianglesAreDropped)
+{
+    const std::vector<glm::vec3> positions = {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+    const std::vector<uint32_t> indices = {0, 1, 2, 0, 1, 7};
+    const auto simplified = Utils::SimplifyMesh(positions, indices, indices.size(), 0.0f);
+
+    EXPECT_EQ(simplified, std::vector<uint32_t>({0, 1, 2}));
+}
+
+TEST(MeshSimplifier, LevelsGetCoarserAndSmaller)
+{
+    const auto sphere = Utils::GenerateSphereMesh(1.0f, 32, 16);
+    const auto lod = Utils::GenerateMeshLOD(sphere, {.levelCount = 3, .maxError = 0.2f});
+
+    ASSERT_FALSE(lod.levels.empty());
+    size_t previousSize = sphere.GetIndices().size();
+    float previousScreenSize = 1.0f;
+    float previousError = 0.0f;
+    for (const auto &level : lod.levels)
+    {
+        EXPECT_LT(level.indices.size(), previousSize);
+        EXPECT_LT(level.screenSize, previousScreenSize);
+        EXPECT_GE(level.error, previousError);
+        previousSize = level.indices.size();
+        previousScreenSize = level.screenSize;
+        previousError = level.error;
+    }
+}
+
+TEST(MeshSimplifier, EmptyMeshHasNoLevel)
+{
+    Component::Mesh mesh;
+    EXPECT_TRUE(Utils::GenerateMeshLOD(mesh).levels.empty());
+}
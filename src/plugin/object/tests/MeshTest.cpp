@@ -186,3 +186,34 @@ TEST(Mesh, dirty_flag_on_setters_texcoords)
     mesh.SetIndices({9});
     EXPECT_TRUE(mesh.IsDirty());
 }
+
+TEST(Mesh, dirty_vertex_range_on_per_vertex_setters)
+{
+    Component::Mesh mesh{};
+    mesh.SetVertices(std::vector<glm::vec3>(10, glm::vec3(0.0f)));
+    mesh.SetNormals(std::vector<glm::vec3>(10, glm::vec3(0.0f)));
+    EXPECT_FALSE(mesh.IsPartiallyDirty());
+    EXPECT_EQ(mesh.GetDirtyVertexRange(), (std::pair<size_t, size_t>{0, 10}));
+    mesh.ClearDirty();
+    EXPECT_EQ(mesh.GetDirtyVertexRange(), (std::pair<size_t, size_t>{0, 0}));
+
+    mesh.SetVertexAt(4, glm::vec3(1.0f));
+    mesh.SetNormalAt(2, glm::vec3(1.0f));
+    EXPECT_TRUE(mesh.IsPartiallyDirty());
+    EXPECT_EQ(mesh.GetDirtyVertexRange(), (std::pair<size_t, size_t>{2, 5}));
+}
+
+TEST(Mesh, dirty_vertex_range_widened_by_full_changes)
+{
+    Component::Mesh mesh{};
+    mesh.SetVertices(std::vector<glm::vec3>(10, glm::vec3(0.0f)));
+    mesh.ClearDirty();
+
+    mesh.SetVertexAt(4, glm::vec3(1.0f));
+    mesh.SetIndices({0, 1, 2});
+    EXPECT_FALSE(mesh.IsPartiallyDirty());
+    EXPECT_EQ(mesh.GetDirtyVertexRange(), (std::pair<size_t, size_t>{0, 10}));
+
+    mesh.SetVertexAt(7, glm::vec3(1.0f));
+    EXPECT_FALSE(mesh.IsPartiallyDirty());
+}
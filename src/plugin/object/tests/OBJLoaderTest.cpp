@@ -28,6 +28,28 @@ TEST(OBJLoaderTest, load_obj_file)
     });
 }
 
+TEST(OBJLoaderTest, corners_sharing_attributes_share_vertices)
+{
+    OBJLoader loader(OBJ_FILE_PATH "cube.obj");
+    const auto &mesh = loader.GetMesh();
+
+    // 12 triangles, and 4 distinct (position, normal, texcoord) triples on each of the 6 faces.
+    EXPECT_EQ(mesh.GetIndices().size(), 36u);
+    EXPECT_EQ(mesh.GetVertices().size(), 24u);
+    EXPECT_EQ(mesh.GetNormals().size(), 24u);
+    EXPECT_EQ(mesh.GetTexCoords().size(), 24u);
+
+    // Vertex fetch order: vertices appear in the order the indices first reference them.
+    uint32_t nextVertex = 0;
+    for (uint32_t index : mesh.GetIndices())
+    {
+        EXPECT_LE(index, nextVertex);
+        if (index == nextVertex)
+            ++nextVertex;
+    }
+    EXPECT_EQ(nextVertex, 24u);
+}
+
 TEST(OBJLoaderTest, load_empty_path) { EXPECT_THROW(OBJLoader(""), std::exception); }
 
 TEST(OBJLoaderTest, load_not_obj_file) { EXPECT_THROW(OBJLoader(OBJ_FILE_PATH "not_obj.txt"), std::exception); }
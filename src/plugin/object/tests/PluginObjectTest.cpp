@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include "Object.hpp"
+#include "core/Core.hpp"
+#include "entity/Entity.hpp"
+#include "resource/SnapshotSerializers.hpp"
+#include "utils/Snapshot.hpp"
+#include <sstream>
+
+TEST(PluginObject, TransformsAreSavedInSnapshots)
+{
+    Engine::Core core;
+    core.AddPlugins<Object::Plugin>();
+
+    const auto &serializers = core.GetResource<Scene::Resource::SnapshotSerializers>();
+    EXPECT_NE(serializers.Find(Scene::Resource::SnapshotSerializers::GetId("Object::Transform")), nullptr);
+
+    auto entity = core.CreateEntity();
+    entity.AddComponent<Object::Component::Transform>(glm::vec3(1.0f, 2.0f, 3.0f));
+    std::stringstream snapshot;
+    Scene::Utils::SaveSnapshot(core, snapshot);
+
+    Engine::Core other;
+    other.AddPlugins<Object::Plugin>();
+    const auto loaded = Scene::Utils::LoadSnapshot(other, snapshot);
+    ASSERT_EQ(loaded.size(), 1u);
+    Engine::Entity copy{other, loaded.front()};
+    ASSERT_TRUE(copy.HasComponents<Object::Component::Transform>());
+    EXPECT_EQ(copy.GetComponents<Object::Component::Transform>().GetPosition(), glm::vec3(1.0f, 2.0f, 3.0f));
+}
+
+TEST(PluginObject, WorldTransformsArePropagatedWithoutRenderer)
+{
+    Engine::Core core;
+    core.AddPlugins<Object::Plugin>();
+    auto entity = core.CreateEntity();
+    entity.AddComponent<Object::Component::Transform>(glm::vec3(1.0f, 2.0f, 3.0f));
+
+    core.RunSystems();
+
+    ASSERT_TRUE(entity.HasComponents<Object::Component::GlobalTransform>());
+    EXPECT_EQ(entity.GetComponents<Object::Component::GlobalTransform>().GetPosition(), glm::vec3(1.0f, 2.0f, 3.0f));
+}
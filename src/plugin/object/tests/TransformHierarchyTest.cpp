@@ -0,0 +1,235 @@
+#include <gtest/gtest.h>
+
+#include "component/GlobalTransform.hpp"
+#include "component/Transform.hpp"
+#include "core/Core.hpp"
+#include "resource/TransformHierarchy.hpp"
+#include "utils/Utils.hpp"
+#include <algorithm>
+#include <glm/gtc/epsilon.hpp>
+#include <vector>
+
+using namespace Object;
+
+namespace {
+Engine::Entity CreateTransformEntity(Engine::Core &core, const glm::vec3 &position)
+{
+    auto entity = core.CreateEntity();
+    entity.AddComponent<Component::Transform>(position);
+    return entity;
+}
+
+glm::vec3 GetWorldPosition(Engine::Entity entity)
+{
+    return entity.GetComponents<Component::GlobalTransform>().GetPosition();
+}
+
+void Propagate(Engine::Core &core) { core.GetResource<Resource::TransformHierarchy>().Propagate(core); }
+} // namespace
+
+TEST(TransformHierarchy, WorldTransformCombinesTheParents)
+{
+    Engine::Core core;
+    core.RegisterResource(Resource::TransformHierarchy(0));
+
+    auto root = CreateTransformEntity(core, {1, 0, 0});
+    auto child = CreateTransformEntity(core, {0, 2, 0});
+    auto grandChild = CreateTransformEntity(core, {0, 0, 3});
+    root.GetComponents<Component::Transform>().SetScale(2, 2, 2);
+    Relationship::Utils::SetChildOf(child, root);
+    Relationship::Utils::SetChildOf(grandChild, child);
+
+    Propagate(core);
+
+    EXPECT_EQ(GetWorldPosition(root), glm::vec3(1, 0, 0));
+    EXPECT_EQ(GetWorldPosition(child), glm::vec3(1, 4, 0));
+    EXPECT_EQ(GetWorldPosition(grandChild), glm::vec3(1, 4, 6));
+    EXPECT_EQ(core.GetResource<Resource::TransformHierarchy>().GetRootCount(), 1u);
+}
+
+TEST(TransformHierarchy, OnlyChangedSubtreesAreRecomputed)
+{
+    Engine::Core core;
+    core.RegisterResource(Resource::TransformHierarchy(0));
+
+    auto first = CreateTransformEntity(core, {1, 0, 0});
+    auto firstChild = CreateTransformEntity(core, {1, 0, 0});
+    auto second = CreateTransformEntity(core, {0, 1, 0});
+    auto secondChild = CreateTransformEntity(core, {0, 1, 0});
+    Relationship::Utils::SetChildOf(firstChild, first);
+    Relationship::Utils::SetChildOf(secondChild, second);
+
+    Propagate(core);
+    Propagate(core);
+    EXPECT_FALSE(first.GetComponents<Component::GlobalTransform>().changed);
+    EXPECT_FALSE(secondChild.GetComponents<Component::GlobalTransform>().changed);
+
+    first.GetComponents<Component::Transform>().SetPosition(5, 0, 0);
+    Propagate(core);
+
+    EXPECT_TRUE(first.GetComponents<Component::GlobalTransform>().changed);
+    EXPECT_TRUE(firstChild.GetComponents<Component::GlobalTransform>().changed);
+    EXPECT_FALSE(second.GetComponents<Component::GlobalTransform>().changed);
+    EXPECT_FALSE(secondChild.GetComponents<Component::GlobalTransform>().changed);
+    EXPECT_EQ(GetWorldPosition(firstChild), glm::vec3(6, 0, 0));
+    EXPECT_EQ(GetWorldPosition(secondChild), glm::vec3(0, 2, 0));
+}
+
+TEST(TransformHierarchy, ReparentingUpdatesTheOrder)
+{
+    Engine::Core core;
+    core.RegisterResource(Resource::TransformHierarchy(0));
+
+    auto first = CreateTransformEntity(core, {1, 0, 0});
+    auto second = CreateTransformEntity(core, {0, 1, 0});
+    auto child = CreateTransformEntity(core, {0, 0, 1});
+    Relationship::Utils::SetChildOf(child, first);
+    Propagate(core);
+    EXPECT_EQ(GetWorldPosition(child), glm::vec3(1, 0, 1));
+
+    Relationship::Utils::RemoveParent(child);
+    Relationship::Utils::SetChildOf(child, second);
+    Propagate(core);
+    EXPECT_EQ(GetWorldPosition(child), glm::vec3(0, 1, 1));
+
+    Relationship::Utils::RemoveParent(child);
+    Propagate(core);
+    EXPECT_EQ(GetWorldPosition(child), glm::vec3(0, 0, 1));
+    EXPECT_EQ(core.GetResource<Resource::TransformHierarchy>().GetRootCount(), 3u);
+}
+
+TEST(TransformHierarchy, ParentsComeBeforeTheirChildren)
+{
+    Engine::Core core;
+    core.RegisterResource(Resource::TransformHierarchy(0));
+
+    // Children are created first, so the order of the registry is the reverse of the hierarchy.
+    auto leaf = CreateTransformEntity(core, {});
+    auto middle = CreateTransformEntity(core, {});
+    auto root = CreateTransformEntity(core, {});
+    Relationship::Utils::SetChildOf(middle, root);
+    Relationship::Utils::SetChildOf(leaf, middle);
+    Propagate(core);
+
+    const auto order = core.GetResource<Resource::TransformHierarchy>().GetOrder();
+    auto indexOf = [&order](Engine::Entity entity) { return std::ranges::find(order, entity.Id()) - order.begin(); };
+    ASSERT_EQ(order.size(), 3u);
+    EXPECT_LT(indexOf(root), indexOf(middle));
+    EXPECT_LT(indexOf(middle), indexOf(leaf));
+}
+
+TEST(TransformHierarchy, ParallelPropagationMatchesTheHierarchy)
+{
+    Engine::Core core;
+    core.RegisterResource(Resource::TransformHierarchy(4));
+
+    // Many small hierarchies, enough to be split between the worker threads.
+    constexpr int rootCount = 1000;
+    constexpr int depth = 5;
+    std::vector<Engine::Entity> leaves;
+    std::vector<Engine::Entity> roots;
+    for (int i = 0; i < rootCount; ++i)
+    {
+        auto parent = CreateTransformEntity(core, {static_cast<float>(i), 0, 0});
+        roots.push_back(parent);
+        for (int level = 1; level < depth; ++level)
+        {
+            auto child = CreateTransformEntity(core, {0, 1, 0});
+            Relationship::Utils::SetChildOf(child, parent);
+            parent = child;
+        }
+        leaves.push_back(parent);
+    }
+    ASSERT_GE(static_cast<size_t>(rootCount * depth), Resource::TransformHierarchy::PARALLEL_THRESHOLD);
+
+    Propagate(core);
+    for (int i = 0; i < rootCount; ++i)
+        ASSERT_EQ(GetWorldPosition(leaves[i]), glm::vec3(static_cast<float>(i), depth - 1, 0));
+
+    for (int i = 0; i < rootCount; i += 2)
+        roots[i].GetComponents<Component::Transform>().SetPosition(static_cast<float>(i), 0, 10);
+    Propagate(core);
+    for (int i = 0; i < rootCount; ++i)
+    {
+        const float z = i % 2 == 0 ? 10.0f : 0.0f;
+        ASSERT_EQ(GetWorldPosition(leaves[i]), glm::vec3(static_cast<float>(i), depth - 1, z));
+        ASSERT_EQ(leaves[i].GetComponents<Component::GlobalTransform>().changed, i % 2 == 0);
+    }
+}
+
+TEST(TransformHierarchy, HierarchyChangesOnlyRecomputeTheirSubtree)
+{
+    Engine::Core core;
+    core.RegisterResource(Resource::TransformHierarchy(0));
+    auto &hierarchy = core.GetResource<Resource::TransformHierarchy>();
+    auto isChanged = [](Engine::Entity entity) { return entity.GetComponents<Component::GlobalTransform>().changed; };
+
+    auto first = CreateTransformEntity(core, {1, 0, 0});
+    auto firstChild = CreateTransformEntity(core, {1, 0, 0});
+    auto second = CreateTransformEntity(core, {0, 1, 0});
+    auto secondChild = CreateTransformEntity(core, {0, 1, 0});
+    Relationship::Utils::SetChildOf(firstChild, first);
+    Relationship::Utils::SetChildOf(secondChild, second);
+    Propagate(core);
+    Propagate(core);
+
+    // A new entity without parent is appended to the order, the others are not recomputed.
+    auto added = CreateTransformEntity(core, {0, 0, 1});
+    Propagate(core);
+    EXPECT_TRUE(isChanged(added));
+    EXPECT_FALSE(isChanged(first));
+    EXPECT_FALSE(isChanged(secondChild));
+    EXPECT_EQ(GetWorldPosition(added), glm::vec3(0, 0, 1));
+    EXPECT_EQ(hierarchy.GetOrder().size(), 5u);
+    EXPECT_EQ(hierarchy.GetRootCount(), 3u);
+
+    // Reparenting only recomputes the moved subtree.
+    Relationship::Utils::SetChildOf(second, first);
+    Propagate(core);
+    EXPECT_FALSE(isChanged(first));
+    EXPECT_FALSE(isChanged(firstChild));
+    EXPECT_FALSE(isChanged(added));
+    EXPECT_TRUE(isChanged(second));
+    EXPECT_TRUE(isChanged(secondChild));
+    EXPECT_EQ(GetWorldPosition(secondChild), glm::vec3(1, 2, 0));
+
+    // Children of an entity losing its Transform become roots.
+    first.RemoveComponent<Component::Transform>();
+    Propagate(core);
+    EXPECT_FALSE(first.HasComponents<Component::GlobalTransform>());
+    EXPECT_TRUE(isChanged(firstChild));
+    EXPECT_TRUE(isChanged(second));
+    EXPECT_FALSE(isChanged(added));
+    EXPECT_EQ(GetWorldPosition(firstChild), glm::vec3(1, 0, 0));
+    EXPECT_EQ(GetWorldPosition(secondChild), glm::vec3(0, 2, 0));
+
+    // Invalidating recomputes everything.
+    hierarchy.Invalidate();
+    Propagate(core);
+    EXPECT_TRUE(isChanged(added));
+    EXPECT_TRUE(isChanged(secondChild));
+}
+
+TEST(TransformHierarchy, WorldTransformIsDecomposed)
+{
+    Engine::Core core;
+    core.RegisterResource(Resource::TransformHierarchy(0));
+
+    auto parent = CreateTransformEntity(core, {1, 2, 3});
+    auto child = CreateTransformEntity(core, {0, 1, 0});
+    parent.GetComponents<Component::Transform>().SetScale(2, 2, 2);
+    parent.GetComponents<Component::Transform>().SetRotation(
+        glm::angleAxis(glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f)));
+    child.GetComponents<Component::Transform>().SetRotation(
+        glm::angleAxis(glm::radians(45.0f), glm::vec3(1.0f, 0.0f, 0.0f)));
+    Relationship::Utils::SetChildOf(child, parent);
+    Propagate(core);
+
+    const auto &globalTransform = child.GetComponents<Component::GlobalTransform>();
+    const auto transform = globalTransform.ToTransform();
+    EXPECT_EQ(transform.GetPosition(), globalTransform.GetPosition());
+    EXPECT_TRUE(glm::all(glm::epsilonEqual(transform.GetScale(), glm::vec3(2.0f), 1e-5f)));
+    const glm::mat4 matrix = transform.ComputeTransformationMatrix();
+    for (glm::length_t column = 0; column < 4; ++column)
+        EXPECT_TRUE(glm::all(glm::epsilonEqual(matrix[column], globalTransform.matrix[column], 1e-5f)));
+}
@@ -1,5 +1,7 @@
 includes("../../engine/xmake.lua")
 includes("../../utils/log/xmake.lua")
+includes("../relationship/xmake.lua")
+includes("../scene/xmake.lua")
 
 target("PluginObject")
     set_kind("static")
@@ -11,13 +13,17 @@ target("PluginObject")
     set_pcxxheader("src/Object.pch.hpp")
 
     add_deps("EngineSquaredCore")
+    add_deps("PluginRelationship")
+    add_deps("PluginScene")
     add_deps("UtilsLog")
 
     add_files("src/**.cpp")
 
     add_headerfiles("src/(component/*.hpp)")
     add_headerfiles("src/(exception/*.hpp)")
+    add_headerfiles("src/(plugin/*.hpp)")
     add_headerfiles("src/(resource/*.hpp)")
+    add_headerfiles("src/(system/*.hpp)")
     add_headerfiles("src/(utils/helper/*.hpp)")
     add_headerfiles("src/(utils/*.hpp)")
     add_headerfiles("src/(*.hpp)")
@@ -46,6 +52,8 @@ for _, file in ipairs(os.files("tests/**.cpp")) do
 
         add_deps("EngineSquaredCore")
         add_deps("PluginObject")
+        add_deps("PluginRelationship")
+        add_deps("PluginScene")
         add_deps("UtilsTools")
 
         add_files(file)
@@ -39,7 +39,7 @@ namespace Physics::Component {
  * If this component is present on an entity with RigidBody, it uses the
  * mesh geometry for collision instead of requiring an explicit collider.
  *
- * @note If mesh is not embedded, the entity MUST have an Object::Mesh component.
+ * @note If mesh is not embedded, the entity MUST have an Object::Mesh or Object::MeshHandle component.
  * @note Convex hulls are more expensive than primitives (Box, Sphere, Capsule)
  *       but much cheaper than concave mesh colliders.
  * @note Jolt automatically computes the convex hull from the provided points,
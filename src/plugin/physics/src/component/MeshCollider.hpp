@@ -39,7 +39,7 @@ namespace Physics::Component {
  * If this component is present on an entity with RigidBody, it uses the
  * mesh geometry for collision instead of requiring an explicit collider.
  *
- * @note If mesh is not embedded, the entity MUST have an Object::Mesh component.
+ * @note If mesh is not embedded, the entity MUST have an Object::Mesh or Object::MeshHandle component.
  * @note Triangle mesh colliders should ONLY be used for STATIC objects.
  *       For dynamic objects, use primitive colliders or convex hulls.
  * @note The mesh scale from the Transform component is automatically applied.
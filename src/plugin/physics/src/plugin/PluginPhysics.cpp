@@ -3,9 +3,16 @@
 #include "scheduler/Startup.hpp"
 
 #include "plugin/PluginEvent.hpp"
+#include "plugin/PluginObject.hpp"
 #include "plugin/PluginPhysics.hpp"
 
+#include "component/BoxCollider.hpp"
+#include "component/CapsuleCollider.hpp"
+#include "component/RigidBody.hpp"
+#include "component/SphereCollider.hpp"
+
 #include "resource/BodyEntityMap.hpp"
+#include "resource/SnapshotSerializers.hpp"
 #include "resource/VehicleTelemetry.hpp"
 
 #include "system/CharacterControllerSystem.hpp"
@@ -24,11 +31,18 @@
 
 void Physics::Plugin::Bind()
 {
-    RequirePlugins<Event::Plugin>();
+    RequirePlugins<Event::Plugin, Object::Plugin>();
 
     RegisterResource(Resource::VehicleTelemetry{});
     RegisterResource(Resource::BodyEntityMap{});
 
+    // Colliders are registered before the rigid bodies, so that a loaded body is created with its collider.
+    auto &serializers = GetCore().GetResource<Scene::Resource::SnapshotSerializers>();
+    serializers.Register<Component::BoxCollider>("Physics::BoxCollider");
+    serializers.Register<Component::SphereCollider>("Physics::SphereCollider");
+    serializers.Register<Component::CapsuleCollider>("Physics::CapsuleCollider");
+    serializers.Register<Component::RigidBody>("Physics::RigidBody");
+
     RegisterSystems<Engine::Scheduler::Startup>(System::InitJoltPhysics);
     RegisterSystems<Engine::Scheduler::Startup>(System::InitPhysicsManager);
     RegisterSystems<Engine::Scheduler::Startup>(System::InitRigidBodySystem);
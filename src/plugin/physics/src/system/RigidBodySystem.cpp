@@ -17,6 +17,7 @@
 #include <fmt/format.h>
 
 #include "Object.hpp"
+#include "component/Relationship.hpp"
 
 #include <Jolt/Geometry/IndexedTriangle.h>
 #include <Jolt/Physics/Body/BodyCreationSettings.h>
@@ -197,7 +198,7 @@ static JPH::RefConst<JPH::Shape> CreateShapeFromColliders(Engine::Core::Registry
         }
         else
         {
-            mesh = registry.try_get<Object::Component::Mesh>(entity);
+            mesh = Object::Utils::TryGetMeshData(registry, entity);
         }
 
         if (!mesh)
@@ -225,7 +226,7 @@ static JPH::RefConst<JPH::Shape> CreateShapeFromColliders(Engine::Core::Registry
     }
     else
     {
-        mesh = registry.try_get<Object::Component::Mesh>(entity);
+        mesh = Object::Utils::TryGetMeshData(registry, entity);
     }
 
     if (!mesh)
@@ -278,6 +279,14 @@ static void OnRigidBodyConstruct(Engine::Core::Registry &registry, Engine::Entit
             Log::Warning("RigidBody added to entity without Transform - creating default Transform");
             transform = &entity.AddComponent<Object::Component::Transform>();
         }
+        // Bodies read and write the local Transform as their world one, which only holds for hierarchy roots.
+        if (const auto *relationship = entity.TryGetComponent<Relationship::Component::Relationship>();
+            relationship != nullptr && relationship->parent.has_value())
+        {
+            Log::Warning(fmt::format("RigidBody added to entity {} which has a parent: its Transform is simulated as a "
+                                     "world transform, the entity should be a root of its hierarchy",
+                                     entityId));
+        }
 
         auto shape = CreateShapeFromColliders(registry, entity);
         if (!shape)
@@ -124,10 +124,10 @@ struct DeduplicatedMesh {
 };
 
 /**
- * @brief Convert a potentially "flat" mesh (with duplicated vertices) to an indexed mesh with unique vertices
+ * @brief Weld the vertices of a mesh that share the same position
  *
- * OBJLoader creates meshes where each face has its own copy of vertices, resulting in
- * indices like [0, 1, 2, 3, 4, 5, ...] where vertices are duplicated.
+ * Render meshes keep one vertex per distinct (position, normal, texcoord) triple, so a position is
+ * still duplicated along UV seams and hard edges (e.g. the 24 vertices of an OBJ cube).
  * Jolt SoftBody needs a proper indexed mesh with shared vertices for constraint creation.
  *
  * @param mesh The input mesh (potentially with duplicated vertices)
@@ -348,7 +348,11 @@ static void OnSoftBodyConstruct(Engine::Core::Registry &registry, Engine::Entity
 
         auto &softBody = entity.GetComponents<Component::SoftBody>();
 
-        // SoftBody requires a Mesh component for geometry
+        // SoftBody requires a Mesh component for geometry. Its vertices are written back every step, so a shared
+        // MeshHandle is first promoted to a unique copy.
+        if (entity.HasComponents<Object::Component::MeshHandle>() && !entity.HasComponents<Object::Component::Mesh>())
+            Object::Utils::PromoteToUniqueMesh(core, entityId);
+
         auto *mesh = entity.TryGetComponent<Object::Component::Mesh>();
         if (!mesh)
         {
@@ -1,6 +1,7 @@
 includes("../../engine/xmake.lua")
 includes("../object/xmake.lua")
 includes("../event/xmake.lua")
+includes("../scene/xmake.lua")
 
 target("PluginPhysics")
     set_group(PLUGINS_GROUP_NAME)
@@ -13,6 +14,7 @@ target("PluginPhysics")
     add_deps("EngineSquaredCore")
     add_deps("PluginObject")
     add_deps("PluginEvent")
+    add_deps("PluginScene")
 
     add_files("src/**.cpp")
 
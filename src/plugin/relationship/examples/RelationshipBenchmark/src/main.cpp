@@ -0,0 +1,112 @@
+#include "Engine.hpp"
+#include "Relationship.hpp"
+#include <chrono>
+#include <vector>
+
+// Built and run like the other examples (see examples/README.md), in release mode to get meaningful timings:
+//   xmake f -m release --RelationshipBenchmark=y
+//   xmake run -y RelationshipBenchmark
+
+namespace {
+constexpr std::size_t NODE_COUNT = 10000;
+constexpr std::size_t FAN_OUT = 4;
+constexpr int ITERATIONS = 100;
+
+template <typename TFunc> double MeasureMicroseconds(int iterations, TFunc &&func)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i)
+    {
+        func();
+    }
+    const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / iterations;
+}
+
+/**
+ * Build a tree where the parent of the node i is the node (i - 1) / FAN_OUT.
+ */
+std::vector<Engine::Entity> CreateTree(Engine::Core &core)
+{
+    std::vector<Engine::Entity> nodes;
+    nodes.reserve(NODE_COUNT);
+    for (std::size_t i = 0; i < NODE_COUNT; ++i)
+    {
+        nodes.push_back(core.CreateEntity());
+        if (i > 0)
+        {
+            Relationship::Utils::SetChildOf(nodes[i], nodes[(i - 1) / FAN_OUT]);
+        }
+    }
+    return nodes;
+}
+
+/**
+ * Visit the tree through the sibling list of Relationship: one registry lookup per entity.
+ */
+std::size_t VisitSiblingLists(Engine::Entity root)
+{
+    std::size_t count = 0;
+    std::vector<Engine::Entity> stack{root};
+    while (!stack.empty())
+    {
+        Engine::Entity current = stack.back();
+        stack.pop_back();
+        auto child = current.GetComponents<Relationship::Component::Relationship>().first;
+        while (child.has_value())
+        {
+            stack.push_back(*child);
+            ++count;
+            child = child->GetComponents<Relationship::Component::Relationship>().next;
+        }
+    }
+    return count;
+}
+
+/**
+ * Visit the tree through the Children arrays: one registry lookup per parent.
+ */
+std::size_t VisitChildrenArrays(const Engine::Core &core, Engine::EntityId root)
+{
+    std::size_t count = 0;
+    for ([[maybe_unused]] Engine::EntityId descendant : Relationship::Utils::GetDescendants(core, root))
+    {
+        ++count;
+    }
+    return count;
+}
+} // namespace
+
+int main(void)
+{
+    Engine::Core core;
+    std::vector<Engine::Entity> nodes = CreateTree(core);
+    Engine::Entity root = nodes.front();
+
+    std::size_t visited = 0;
+    const double siblingLists = MeasureMicroseconds(ITERATIONS, [&]() { visited = VisitSiblingLists(root); });
+    Log::Info(fmt::format("Sibling lists: {} entities visited in {:.1f} us", visited, siblingLists));
+    const double childrenArrays = MeasureMicroseconds(ITERATIONS, [&]() { visited = VisitChildrenArrays(core, root); });
+    Log::Info(fmt::format("Children arrays: {} entities visited in {:.1f} us", visited, childrenArrays));
+
+    // Move the grandchildren of the root under a new parent, one by one then all at once.
+    const auto firstGrandChild = nodes.begin() + 1 + FAN_OUT;
+    std::vector<Engine::Entity> grandChildren(firstGrandChild, firstGrandChild + FAN_OUT * FAN_OUT);
+    Engine::Entity firstParent = core.CreateEntity();
+    Engine::Entity secondParent = core.CreateEntity();
+    const double oneByOne = MeasureMicroseconds(1, [&]() {
+        for (Engine::Entity grandChild : grandChildren)
+        {
+            Relationship::Utils::SetChildOf(grandChild, firstParent);
+        }
+    });
+    const double bulk =
+        MeasureMicroseconds(1, [&]() { Relationship::Utils::SetChildrenOf(grandChildren, secondParent); });
+    Log::Info(fmt::format("Reparenting {} subtrees: {:.1f} us one by one, {:.1f} us in bulk", grandChildren.size(),
+                          oneByOne, bulk));
+
+    const double destroy = MeasureMicroseconds(1, [&]() { Relationship::Utils::DestroySubtree(core, root); });
+    Log::Info(fmt::format("Destroying the remaining tree: {:.1f} us", destroy));
+
+    return 0;
+}
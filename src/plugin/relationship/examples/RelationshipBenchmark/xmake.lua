@@ -0,0 +1,11 @@
+target("RelationshipBenchmark")
+    set_kind("binary")
+    set_default(true)
+    add_deps("PluginRelationship")
+
+    add_files("src/**.cpp")
+    add_includedirs("$(projectdir)/src/")
+
+    add_packages("entt", "spdlog", "fmt")
+
+    set_rundir("$(projectdir)")
@@ -1,7 +1,9 @@
 #pragma once
 
 // Component
+#include "component/Children.hpp"
 #include "component/Relationship.hpp"
 
 // Utils
+#include "utils/Descendants.hpp"
 #include "utils/Utils.hpp"
@@ -0,0 +1,35 @@
+/**************************************************************************
+ * Relationship v0.0.0
+ *
+ * Relationship is a software package, part of the Engine².
+ *
+ * This file is part of the EngineSquared project that is under GPL-3.0 License.
+ * Copyright © 2024 by @EngineSquared, All rights reserved.
+ *
+ * EngineSquared is a free software: you can redistribute it and/or modify
+ * it under the terms of the GPL-3.0 License as published by the
+ * Free Software Foundation. See the GPL-3.0 License for more details.
+ *
+ * @file Children.hpp
+ * @brief component storing the children of a parent contiguously
+ *
+ * This file contains the declaration of the Children component.
+ **************************************************************************/
+
+#pragma once
+
+#include "entity/EntityId.hpp"
+#include <vector>
+
+namespace Relationship::Component {
+/**
+ * Component that stores the children of a parent entity in one array, in the order they were added.
+ *
+ * It is kept in sync with the sibling list of Relationship by Relationship::Utils, and lets the children be visited
+ * without looking each sibling up in the registry (see Relationship::Utils::GetChildren and GetDescendants).
+ */
+struct Children {
+    // @brief children of the entity, oldest first
+    std::vector<Engine::EntityId> entities;
+};
+} // namespace Relationship::Component
@@ -0,0 +1,107 @@
+/**************************************************************************
+ * Relationship v0.0.0
+ *
+ * Relationship is a software package, part of the Engine².
+ *
+ * This file is part of the EngineSquared project that is under GPL-3.0 License.
+ * Copyright © 2024 by @EngineSquared, All rights reserved.
+ *
+ * EngineSquared is a free software: you can redistribute it and/or modify
+ * it under the terms of the GPL-3.0 License as published by the
+ * Free Software Foundation. See the GPL-3.0 License for more details.
+ *
+ * @file Descendants.hpp
+ * @brief range over the descendants of an entity
+ *
+ * This file contains the declaration of the Descendants range.
+ **************************************************************************/
+
+#pragma once
+
+#include "component/Children.hpp"
+#include "core/Core.hpp"
+#include <iterator>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace Relationship::Utils {
+/**
+ * Range over the descendants of an entity, in depth-first order: each entity comes right before its own descendants.
+ * The entity itself is not part of the range.
+ *
+ * Only the Children components are read, so a hierarchy costs one registry lookup per entity and none per sibling.
+ *
+ * @note The hierarchy must not be modified while it is iterated.
+ */
+class Descendants {
+  public:
+    class Iterator {
+      public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Engine::EntityId;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+        Iterator(const Engine::Core::Registry &registry, Engine::EntityId root) : _registry(&registry) { _Push(root); }
+
+        Engine::EntityId operator*() const { return _stack.back().first[_stack.back().second]; }
+
+        Iterator &operator++()
+        {
+            // The children of the current entity come before its next sibling.
+            if (_Push(**this))
+            {
+                return *this;
+            }
+            ++_stack.back().second;
+            while (_stack.back().second >= _stack.back().first.size())
+            {
+                _stack.pop_back();
+                if (_stack.empty())
+                {
+                    break;
+                }
+                ++_stack.back().second;
+            }
+            return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        bool operator==(std::default_sentinel_t) const { return _stack.empty(); }
+
+        /**
+         * Get the depth of the current entity below the root of the range.
+         *
+         * @return  1 for the children of the root, 2 for their children, and so on
+         */
+        std::size_t GetDepth() const { return _stack.size(); }
+
+      private:
+        bool _Push(Engine::EntityId entity)
+        {
+            const auto *children = _registry->try_get<Component::Children>(entity);
+            if (children == nullptr || children->entities.empty())
+            {
+                return false;
+            }
+            _stack.emplace_back(children->entities, 0);
+            return true;
+        }
+
+        const Engine::Core::Registry *_registry = nullptr;
+        // @brief children being visited at each depth, with the index of the current one
+        std::vector<std::pair<std::span<const Engine::EntityId>, std::size_t>> _stack;
+    };
+
+    Descendants(const Engine::Core &core, Engine::EntityId root) : _registry(core.GetRegistry()), _root(root) {}
+
+    Iterator begin() const { return Iterator(_registry, _root); }
+    std::default_sentinel_t end() const { return std::default_sentinel; }
+
+  private:
+    const Engine::Core::Registry &_registry;
+    Engine::EntityId _root;
+};
+} // namespace Relationship::Utils
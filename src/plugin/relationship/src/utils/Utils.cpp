@@ -1,36 +1,134 @@
 #include "utils/Utils.hpp"
 #include "Logger.hpp"
+#include <algorithm>
 #include <fmt/format.h>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+using RelationshipComponent = Relationship::Component::Relationship;
+
+/**
+ * Insert the child at the front of the sibling list of the parent. The Children component is left to the caller.
+ */
+void LinkChild(Engine::Entity child, RelationshipComponent &childRS, Engine::Entity parent,
+               RelationshipComponent &parentRS)
+{
+    if (parentRS.first.has_value())
+    {
+        parentRS.first->GetComponents<RelationshipComponent>().prev = child;
+    }
+    childRS.prev = std::nullopt;
+    childRS.next = parentRS.first;
+    childRS.parent = parent;
+    parentRS.first = child;
+    parentRS.children++;
+}
+
+/**
+ * Remove the child from the sibling list of its parent. The Children component is left to the caller.
+ */
+void UnlinkChild(Engine::Entity child, RelationshipComponent &childRS, RelationshipComponent &parentRS)
+{
+    parentRS.children--;
+    if (parentRS.first == child)
+    {
+        parentRS.first = childRS.next;
+    }
+    if (childRS.prev.has_value())
+    {
+        childRS.prev->GetComponents<RelationshipComponent>().next = childRS.next;
+    }
+    if (childRS.next.has_value())
+    {
+        childRS.next->GetComponents<RelationshipComponent>().prev = childRS.prev;
+    }
+    childRS.parent = std::nullopt;
+    childRS.prev = std::nullopt;
+    childRS.next = std::nullopt;
+}
+} // namespace
 
 auto Relationship::Utils::SetChildOf(Engine::Entity child, Engine::Entity parent) -> void
 {
-    if (IsChildOf(parent, child))
+    if (child == parent || IsDescendantOf(parent, child))
     {
-        Log::Warning(fmt::format("Entity {} is already a child of the parent {}", child, parent));
+        Log::Warning(fmt::format("Entity {} cannot be a child of its descendant {}", child, parent));
         return;
     }
-    auto &parentRS = parent.AddComponentIfNotExists<Relationship::Component::Relationship>();
-    auto &newChildRS = child.AddComponentIfNotExists<Relationship::Component::Relationship>();
-
-    parentRS.children++;
-    if (parentRS.children == 1)
+    if (IsChildOf(child, parent))
     {
-        parentRS.first = child;
-        newChildRS.parent = parent;
         return;
     }
+    if (GetParent(child).has_value())
+    {
+        RemoveParent(child);
+    }
+
+    auto &parentRS = parent.AddComponentIfNotExists<RelationshipComponent>();
+    auto &childRS = child.AddComponentIfNotExists<RelationshipComponent>();
+    LinkChild(child, childRS, parent, parentRS);
+    parent.AddComponentIfNotExists<Component::Children>().entities.push_back(child.Id());
+    // Notifies the observers of the hierarchy (e.g. transform propagation) through on_update.
+    child.UpdateComponent<RelationshipComponent>();
+}
 
-    if (!parentRS.first.has_value())
+auto Relationship::Utils::SetChildrenOf(std::span<const Engine::Entity> children, Engine::Entity parent) -> void
+{
+    // The ancestors of the parent cannot become its children, they are the same for every child.
+    std::unordered_set<entt::id_type> ancestors{parent.Id()};
+    for (auto ancestor = GetParent(parent); ancestor.has_value(); ancestor = GetParent(*ancestor))
     {
-        Log::Error("Relationship::Utils::SetChildOf: parentRS.first is empty");
-        return;
+        ancestors.insert(ancestor->Id());
     }
 
-    auto &firstChildRS = parentRS.first->GetComponents<Relationship::Component::Relationship>();
-    firstChildRS.prev = child;
-    newChildRS.next = parentRS.first;
-    parentRS.first = child;
-    newChildRS.parent = parent;
+    auto &parentRS = parent.AddComponentIfNotExists<RelationshipComponent>();
+    std::unordered_map<entt::id_type, std::pair<Engine::Entity, std::unordered_set<entt::id_type>>> moved;
+    std::vector<Engine::Entity> added;
+    added.reserve(children.size());
+    for (Engine::Entity child : children)
+    {
+        if (ancestors.contains(child.Id()))
+        {
+            Log::Warning(fmt::format("Entity {} cannot be a child of its descendant {}", child, parent));
+            continue;
+        }
+        auto &childRS = child.AddComponentIfNotExists<RelationshipComponent>();
+        if (childRS.parent == parent)
+        {
+            continue;
+        }
+        if (childRS.parent.has_value())
+        {
+            Engine::Entity previous = childRS.parent.value();
+            UnlinkChild(child, childRS, previous.GetComponents<RelationshipComponent>());
+            auto [it, inserted] = moved.try_emplace(previous.Id(), previous, std::unordered_set<entt::id_type>{});
+            it->second.second.insert(child.Id());
+        }
+        LinkChild(child, childRS, parent, parentRS);
+        added.push_back(child);
+    }
+
+    for (auto &[id, entry] : moved)
+    {
+        auto &[previous, movedChildren] = entry;
+        if (auto *previousChildren = previous.TryGetComponent<Component::Children>())
+        {
+            std::erase_if(previousChildren->entities,
+                          [&movedChildren](Engine::EntityId child) { return movedChildren.contains(child); });
+        }
+    }
+
+    auto &parentChildren = parent.AddComponentIfNotExists<Component::Children>().entities;
+    parentChildren.reserve(parentChildren.size() + added.size());
+    for (Engine::Entity child : added)
+    {
+        parentChildren.push_back(child.Id());
+    }
+    for (Engine::Entity child : added)
+    {
+        child.UpdateComponent<RelationshipComponent>();
+    }
 }
 
 auto Relationship::Utils::IsChildOf(Engine::Entity child, Engine::Entity parent) -> bool
@@ -40,6 +138,18 @@ auto Relationship::Utils::IsChildOf(Engine::Entity child, Engine::Entity parent)
     return childRS && childRS->parent == parent;
 }
 
+auto Relationship::Utils::IsDescendantOf(Engine::Entity entity, Engine::Entity ancestor) -> bool
+{
+    for (auto parent = GetParent(entity); parent.has_value(); parent = GetParent(*parent))
+    {
+        if (*parent == ancestor)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 auto Relationship::Utils::RemoveParent(Engine::Entity child) -> void
 {
     std::optional<Engine::Entity> parentOpt = GetParent(child);
@@ -49,33 +159,15 @@ auto Relationship::Utils::RemoveParent(Engine::Entity child) -> void
         return;
     }
     Engine::Entity parent = parentOpt.value();
-    auto &childRS = child.GetComponents<Relationship::Component::Relationship>();
-    auto &parentRS = parent.GetComponents<Relationship::Component::Relationship>();
+    auto &childRS = child.GetComponents<RelationshipComponent>();
+    auto &parentRS = parent.GetComponents<RelationshipComponent>();
 
-    parentRS.children--;
-    if (parentRS.first == child)
-    {
-        if (!childRS.next.has_value())
-        {
-            parentRS.first = std::nullopt;
-        }
-        else
-        {
-            auto &secondChildRS = childRS.next->GetComponents<Relationship::Component::Relationship>();
-            secondChildRS.prev = std::nullopt;
-            parentRS.first = childRS.next;
-        }
-    }
-
-    childRS.parent = std::nullopt;
-    if (childRS.prev.has_value())
-    {
-        childRS.prev->GetComponents<Relationship::Component::Relationship>().next = childRS.next;
-    }
-    if (childRS.next.has_value())
+    UnlinkChild(child, childRS, parentRS);
+    if (auto *parentChildren = parent.TryGetComponent<Component::Children>())
     {
-        childRS.next->GetComponents<Relationship::Component::Relationship>().prev = childRS.prev;
+        std::erase(parentChildren->entities, child.Id());
     }
+    child.UpdateComponent<RelationshipComponent>();
 }
 
 auto Relationship::Utils::GetParent(Engine::Entity child) -> std::optional<Engine::Entity>
@@ -92,3 +184,38 @@ auto Relationship::Utils::GetParent(Engine::Entity child) -> std::optional<Engin
     }
     return childRS->parent;
 }
+
+auto Relationship::Utils::GetChildren(Engine::Entity parent) -> std::span<const Engine::EntityId>
+{
+    const Component::Children *children = parent.TryGetComponent<Component::Children>();
+    if (!children)
+    {
+        return {};
+    }
+    return children->entities;
+}
+
+auto Relationship::Utils::GetDescendants(const Engine::Core &core, Engine::EntityId root) -> Descendants
+{
+    return Descendants(core, root);
+}
+
+auto Relationship::Utils::DestroySubtree(Engine::Core &core, Engine::EntityId root) -> void
+{
+    std::vector<Engine::EntityId> subtree{root};
+    for (Engine::EntityId descendant : GetDescendants(core, root))
+    {
+        subtree.push_back(descendant);
+    }
+
+    Engine::Entity rootEntity{core, root};
+    if (GetParent(rootEntity).has_value())
+    {
+        RemoveParent(rootEntity);
+    }
+    // Descendants come after their ancestors in the subtree, so the reverse order never leaves an orphan behind.
+    for (auto entity = subtree.rbegin(); entity != subtree.rend(); ++entity)
+    {
+        core.KillEntity(*entity);
+    }
+}
@@ -22,17 +22,31 @@
 
 #pragma once
 
+#include "component/Children.hpp"
 #include "component/Relationship.hpp"
+#include "utils/Descendants.hpp"
+#include <span>
 
 namespace Relationship::Utils {
 /**
- * Set the child of an entity to another entity.
+ * Set the child of an entity to another entity. If the child already has another parent, it is moved from it.
  *
  * @param   parent  parent entity
  * @param   child   child entity
  */
 auto SetChildOf(Engine::Entity child, Engine::Entity parent) -> void;
 
+/**
+ * Set the parent of several entities at once. Entities that already have another parent are moved from it, and the
+ * children of each previous parent are updated once for all of them.
+ *
+ * Entities that would become their own ancestor are skipped.
+ *
+ * @param   children    child entities
+ * @param   parent      parent entity
+ */
+auto SetChildrenOf(std::span<const Engine::Entity> children, Engine::Entity parent) -> void;
+
 /**
  * Check if an entity is a child of another entity.
  *
@@ -42,6 +56,15 @@ auto SetChildOf(Engine::Entity child, Engine::Entity parent) -> void;
  */
 auto IsChildOf(Engine::Entity child, Engine::Entity parent) -> bool;
 
+/**
+ * Check if an entity is a descendant of another one: its child, the child of its child, and so on.
+ *
+ * @param   entity      entity that may be a descendant
+ * @param   ancestor    entity that may be an ancestor
+ * @return  true if the ancestor is found among the parents of the entity
+ */
+auto IsDescendantOf(Engine::Entity entity, Engine::Entity ancestor) -> bool;
+
 /**
  * Remove the parent of an entity.
  *
@@ -57,6 +80,33 @@ auto RemoveParent(Engine::Entity child) -> void;
  */
 auto GetParent(Engine::Entity child) -> std::optional<Engine::Entity>;
 
+/**
+ * Get the children of an entity, stored contiguously in its Children component.
+ *
+ * @param   parent  parent entity
+ * @return  the children, oldest first, or an empty span if the entity has none
+ * @note    The span is invalidated when a child is added to or removed from the parent.
+ */
+auto GetChildren(Engine::Entity parent) -> std::span<const Engine::EntityId>;
+
+/**
+ * Get the descendants of an entity, each one right before its own descendants.
+ *
+ * @param   core    core of the entity
+ * @param   root    entity whose descendants are visited, not part of the range
+ * @return  a range of the descendants
+ */
+auto GetDescendants(const Engine::Core &core, Engine::EntityId root) -> Descendants;
+
+/**
+ * Destroy an entity and all its descendants, each descendant before its parent. The entity is first removed from
+ * the children of its own parent.
+ *
+ * @param   core    core of the entity
+ * @param   root    entity to destroy with its descendants
+ */
+auto DestroySubtree(Engine::Core &core, Engine::EntityId root) -> void;
+
 /**
  * Apply a function to each child of an entity.
  *
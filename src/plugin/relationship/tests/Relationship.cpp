@@ -281,4 +281,161 @@ TEST(Relationship, try_get_child_components_children_have_no_component)
     auto childComponents = Relationship::Utils::GetChildComponents<TestComponent>(parent);
 
     ASSERT_TRUE(childComponents.empty());
-}
\ No newline at end of file
+}
+
+TEST(Relationship, get_children_follows_the_sibling_list)
+{
+    Engine::Core core;
+
+    auto child1 = core.CreateEntity();
+    auto child2 = core.CreateEntity();
+    auto child3 = core.CreateEntity();
+    auto parent = core.CreateEntity();
+
+    ASSERT_TRUE(Relationship::Utils::GetChildren(parent).empty());
+
+    Relationship::Utils::SetChildOf(child1, parent);
+    Relationship::Utils::SetChildOf(child2, parent);
+    Relationship::Utils::SetChildOf(child3, parent);
+    Relationship::Utils::RemoveParent(child2);
+
+    auto children = Relationship::Utils::GetChildren(parent);
+
+    ASSERT_EQ(children.size(), 2);
+    ASSERT_EQ(children[0], child1.Id());
+    ASSERT_EQ(children[1], child3.Id());
+    ASSERT_EQ(parent.GetComponents<Relationship::Component::Relationship>().children, 2);
+}
+
+TEST(Relationship, set_child_of_moves_from_the_previous_parent)
+{
+    Engine::Core core;
+
+    auto child = core.CreateEntity();
+    auto sibling = core.CreateEntity();
+    auto previousParent = core.CreateEntity();
+    auto parent = core.CreateEntity();
+
+    Relationship::Utils::SetChildOf(sibling, previousParent);
+    Relationship::Utils::SetChildOf(child, previousParent);
+    Relationship::Utils::SetChildOf(child, parent);
+
+    ASSERT_TRUE(Relationship::Utils::IsChildOf(child, parent));
+    ASSERT_EQ(previousParent.GetComponents<Relationship::Component::Relationship>().children, 1);
+    ASSERT_EQ(previousParent.GetComponents<Relationship::Component::Relationship>().first, sibling);
+    ASSERT_FALSE(sibling.GetComponents<Relationship::Component::Relationship>().prev.has_value());
+    ASSERT_EQ(Relationship::Utils::GetChildren(previousParent).size(), 1);
+    ASSERT_EQ(Relationship::Utils::GetChildren(parent).size(), 1);
+}
+
+TEST(Relationship, set_child_of_rejects_cycles)
+{
+    Engine::Core core;
+
+    auto root = core.CreateEntity();
+    auto child = core.CreateEntity();
+    auto grandChild = core.CreateEntity();
+
+    Relationship::Utils::SetChildOf(child, root);
+    Relationship::Utils::SetChildOf(grandChild, child);
+    Relationship::Utils::SetChildOf(root, grandChild);
+    Relationship::Utils::SetChildOf(root, root);
+
+    ASSERT_FALSE(Relationship::Utils::GetParent(root).has_value());
+    ASSERT_TRUE(Relationship::Utils::IsDescendantOf(grandChild, root));
+    ASSERT_FALSE(Relationship::Utils::IsDescendantOf(root, grandChild));
+}
+
+TEST(Relationship, descendants_are_visited_depth_first)
+{
+    Engine::Core core;
+
+    auto root = core.CreateEntity();
+    auto child1 = core.CreateEntity();
+    auto child1_1 = core.CreateEntity();
+    auto child1_2 = core.CreateEntity();
+    auto child2 = core.CreateEntity();
+    auto child2_1 = core.CreateEntity();
+
+    Relationship::Utils::SetChildOf(child1, root);
+    Relationship::Utils::SetChildOf(child2, root);
+    Relationship::Utils::SetChildOf(child1_1, child1);
+    Relationship::Utils::SetChildOf(child1_2, child1);
+    Relationship::Utils::SetChildOf(child2_1, child2);
+
+    std::vector<Engine::EntityId> visited;
+    std::vector<std::size_t> depths;
+    auto descendants = Relationship::Utils::GetDescendants(core, root);
+    for (auto it = descendants.begin(); it != descendants.end(); ++it)
+    {
+        visited.push_back(*it);
+        depths.push_back(it.GetDepth());
+    }
+
+    std::vector<Engine::EntityId> expected{child1, child1_1, child1_2, child2, child2_1};
+    ASSERT_EQ(visited, expected);
+    ASSERT_EQ(depths, (std::vector<std::size_t>{1, 2, 2, 1, 2}));
+    ASSERT_TRUE(Relationship::Utils::GetDescendants(core, child1_1).begin() == std::default_sentinel);
+}
+
+TEST(Relationship, set_children_of_moves_children_in_bulk)
+{
+    Engine::Core core;
+
+    auto previousParent = core.CreateEntity();
+    auto parent = core.CreateEntity();
+    std::vector<Engine::Entity> children;
+    for (int i = 0; i < 6; ++i)
+    {
+        children.push_back(core.CreateEntity());
+        Relationship::Utils::SetChildOf(children.back(), previousParent);
+    }
+
+    std::vector<Engine::Entity> moved{children[0], children[2], children[4], parent, children[2]};
+    Relationship::Utils::SetChildrenOf(moved, parent);
+
+    auto previousChildren = Relationship::Utils::GetChildren(previousParent);
+    ASSERT_EQ(previousChildren.size(), 3);
+    ASSERT_EQ(previousChildren[0], children[1].Id());
+    ASSERT_EQ(previousChildren[1], children[3].Id());
+    ASSERT_EQ(previousChildren[2], children[5].Id());
+    ASSERT_EQ(previousParent.GetComponents<Relationship::Component::Relationship>().children, 3);
+
+    auto parentChildren = Relationship::Utils::GetChildren(parent);
+    ASSERT_EQ(parentChildren.size(), 3);
+    ASSERT_EQ(parent.GetComponents<Relationship::Component::Relationship>().children, 3);
+
+    // The sibling lists agree with the children arrays.
+    std::vector<Engine::Entity> listed;
+    Relationship::Utils::ForEachChild(previousParent, [&listed](Engine::Entity child) { listed.push_back(child); });
+    ASSERT_EQ(listed.size(), 3);
+    listed.clear();
+    Relationship::Utils::ForEachChild(parent, [&listed](Engine::Entity child) { listed.push_back(child); });
+    ASSERT_EQ(listed.size(), 3);
+}
+
+TEST(Relationship, destroy_subtree)
+{
+    Engine::Core core;
+
+    auto root = core.CreateEntity();
+    auto child = core.CreateEntity();
+    auto grandChild = core.CreateEntity();
+    auto sibling = core.CreateEntity();
+    auto parent = core.CreateEntity();
+
+    Relationship::Utils::SetChildOf(root, parent);
+    Relationship::Utils::SetChildOf(sibling, parent);
+    Relationship::Utils::SetChildOf(child, root);
+    Relationship::Utils::SetChildOf(grandChild, child);
+
+    Relationship::Utils::DestroySubtree(core, root);
+
+    ASSERT_FALSE(root.Id().IsValid(core));
+    ASSERT_FALSE(child.Id().IsValid(core));
+    ASSERT_FALSE(grandChild.Id().IsValid(core));
+    ASSERT_TRUE(sibling.Id().IsValid(core));
+    ASSERT_EQ(parent.GetComponents<Relationship::Component::Relationship>().children, 1);
+    ASSERT_EQ(Relationship::Utils::GetChildren(parent).size(), 1);
+    ASSERT_EQ(Relationship::Utils::GetChildren(parent)[0], sibling.Id());
+}
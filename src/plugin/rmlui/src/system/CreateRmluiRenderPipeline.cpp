@@ -8,6 +8,7 @@
 
 #include "resource/ARenderPass.hpp"
 #include "resource/DeviceContext.hpp"
+#include "resource/PipelineCache.hpp"
 #include "resource/RenderGraph.hpp"
 #include "resource/RenderGraphContainer.hpp"
 #include "resource/Shader.hpp"
@@ -33,8 +34,8 @@ void Rmlui::System::CreateRmluiRenderPipeline(Engine::Core &core)
     }
 
     Utils::RmluiRenderPass renderPass{};
-    Graphic::Resource::Shader shader =
-        Utils::RmluiRenderPass::CreateShader(core.GetResource<Graphic::Resource::DeviceContext>());
+    Graphic::Resource::Shader shader = core.GetResource<Graphic::Resource::PipelineCache>().CreateShader(
+        core.GetResource<Graphic::Resource::DeviceContext>(), Utils::RmluiRenderPass::CreateShaderDescriptor());
     core.GetResource<Graphic::Resource::ShaderContainer>().Add(Utils::RMLUI_RENDER_PASS_SHADER_ID, std::move(shader));
     renderPass.BindShader(std::string_view(Utils::RMLUI_RENDER_PASS_SHADER_NAME));
 
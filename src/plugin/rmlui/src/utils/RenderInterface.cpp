@@ -30,10 +30,12 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <exception>
 #include <filesystem>
 #include <glm/vec4.hpp>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -78,7 +80,23 @@ wgpu::BindGroup CreateTextureBindGroup(Engine::Core &core, const wgpu::BindGroup
 } // namespace
 
 RenderInterface *RenderInterface::_active = nullptr;
-RenderInterface::RenderInterface(Engine::Core &core) : _core(core) {}
+RenderInterface::RenderInterface(Engine::Core &core)
+    : _core(core), _vertexAllocator(INITIAL_VERTEX_CAPACITY), _indexAllocator(INITIAL_INDEX_CAPACITY)
+{
+}
+
+RenderInterface::~RenderInterface()
+{
+    for (auto *buffer : {&_vertexBuffer, &_indexBuffer, &_drawBuffer})
+    {
+        if (*buffer != nullptr)
+            buffer->release();
+    }
+    if (_drawBindGroup != nullptr)
+        _drawBindGroup.release();
+    if (_active == this)
+        _active = nullptr;
+}
 
 RenderInterface *RenderInterface::GetActive() { return _active; }
 
@@ -96,6 +114,17 @@ void RenderInterface::FlushDrawCommands(wgpu::RenderPassEncoder const &renderPas
             renderSize.y = textureSize.y;
         }
     }
+    if (_drawCommands.empty())
+        return;
+    WriteDrawData();
+    if (_vertexBuffer == nullptr || _indexBuffer == nullptr || _drawBindGroup == nullptr)
+    {
+        _drawCommands.clear();
+        return;
+    }
+
+    renderPass.setVertexBuffer(0, _vertexBuffer, 0, _vertexBuffer.getSize());
+    renderPass.setIndexBuffer(_indexBuffer, wgpu::IndexFormat::Uint32, 0, _indexBuffer.getSize());
     for (auto const &command : _drawCommands)
     {
         if (command.textureBindGroup != nullptr)
@@ -106,8 +135,7 @@ void RenderInterface::FlushDrawCommands(wgpu::RenderPassEncoder const &renderPas
         {
             renderPass.setBindGroup(1, command.screenBindGroup, 0, nullptr);
         }
-        renderPass.setVertexBuffer(0, command.vertexBuffer, 0, command.vertexBuffer.getSize());
-        renderPass.setIndexBuffer(command.indexBuffer, wgpu::IndexFormat::Uint32, 0, command.indexBuffer.getSize());
+        renderPass.setBindGroup(2, _drawBindGroup, 1, &command.drawDataOffset);
         if (command.scissorEnabled)
         {
             const int left = std::max(0, command.scissorRegion.Left());
@@ -125,10 +153,9 @@ void RenderInterface::FlushDrawCommands(wgpu::RenderPassEncoder const &renderPas
         {
             renderPass.setScissorRect(0, 0, renderSize.x, renderSize.y);
         }
-        renderPass.drawIndexed(command.indexCount, 1, 0, 0, 0);
-
-        command.vertexBuffer.release();
-        command.indexBuffer.release();
+        const auto &geometry = *command.geometry;
+        renderPass.drawIndexed(static_cast<uint32_t>(geometry.indices.size()), 1, geometry.firstIndex,
+                               static_cast<int32_t>(geometry.baseVertex), 0);
     }
     _drawCommands.clear();
 }
@@ -138,7 +165,12 @@ Rml::CompiledGeometryHandle RenderInterface::CompileGeometry(Rml::Span<const Rml
 {
     auto geometry = std::make_unique<GeometryData>();
     geometry->vertices.assign(vertices.begin(), vertices.end());
-    geometry->indices.assign(indices.begin(), indices.end());
+    geometry->indices.reserve(indices.size());
+    for (const auto &index : indices)
+    {
+        geometry->indices.push_back(static_cast<uint32_t>(index));
+    }
+    UploadGeometry(*geometry);
 
     const auto handle = reinterpret_cast<Rml::CompiledGeometryHandle>(geometry.get());
     _geometries.emplace(handle, std::move(geometry));
@@ -154,99 +186,196 @@ void RenderInterface::RenderGeometry(Rml::CompiledGeometryHandle handle, Rml::Ve
         return;
     }
 
-    auto const &geometry = *geometryIt->second;
+    auto &geometry = *geometryIt->second;
     if (geometry.vertices.empty() || geometry.indices.empty())
     {
         return;
     }
-
-    const auto &deviceContext = _core.GetResource<Graphic::Resource::DeviceContext>();
-    const auto &optDevice = deviceContext.GetDevice();
-    if (!optDevice.has_value())
+    // Geometry compiled before the device existed is uploaded on first use.
+    if (!geometry.uploaded && !UploadGeometry(geometry))
     {
         return;
     }
-    const auto &device = optDevice.value();
-    if (!_core.HasResource<Graphic::Resource::Queue>())
-        return;
-    const auto &queue = _core.GetResource<Graphic::Resource::Queue>();
 
-    std::vector<Rml::Vertex> translatedVertices = geometry.vertices;
-    for (auto &vertex : translatedVertices)
+    wgpu::BindGroup textureBindGroup = ResolveTextureBindGroup(texture_handle);
+
+    if (textureBindGroup == nullptr && _defaultTexture)
     {
-        const float pos_x = vertex.position.x + translation.x;
-        const float pos_y = vertex.position.y + translation.y;
+        textureBindGroup = _defaultTexture->bindGroup;
+    }
 
-        if (_transform.has_value())
-        {
-            const auto &matrix = *_transform;
-            const float pos_z = 0.0F;
-            const float pos_w = 1.0F;
-            const float transformed_x =
-                (matrix[0][0] * pos_x) + (matrix[1][0] * pos_y) + (matrix[2][0] * pos_z) + (matrix[3][0] * pos_w);
-            const float transformed_y =
-                (matrix[0][1] * pos_x) + (matrix[1][1] * pos_y) + (matrix[2][1] * pos_z) + (matrix[3][1] * pos_w);
-            const float transformed_w =
-                (matrix[0][3] * pos_x) + (matrix[1][3] * pos_y) + (matrix[2][3] * pos_z) + (matrix[3][3] * pos_w);
-
-            if (transformed_w != 0.0F)
-            {
-                vertex.position.x = transformed_x / transformed_w;
-                vertex.position.y = transformed_y / transformed_w;
-            }
-            else
-            {
-                vertex.position.x = transformed_x;
-                vertex.position.y = transformed_y;
-            }
-        }
-        else
+    if (textureBindGroup == nullptr || _screenBindGroup == nullptr)
+    {
+        return;
+    }
+
+    DrawData drawData{};
+    for (int column = 0; column < 4; ++column)
+    {
+        for (int row = 0; row < 4; ++row)
         {
-            vertex.position.x = pos_x;
-            vertex.position.y = pos_y;
+            const float identity = column == row ? 1.0F : 0.0F;
+            drawData.transform[column * 4 + row] = _transform.has_value() ? (*_transform)[column][row] : identity;
         }
     }
+    drawData.translation = {translation.x, translation.y};
+
+    const size_t drawDataOffset = _drawData.size();
+    _drawData.resize(drawDataOffset + DRAW_DATA_ALIGNMENT);
+    std::memcpy(_drawData.data() + drawDataOffset, &drawData, sizeof(DrawData));
+
+    DrawCommand cmd;
+    cmd.geometry = &geometry;
+    cmd.drawDataOffset = static_cast<uint32_t>(drawDataOffset);
+    cmd.textureBindGroup = textureBindGroup;
+    cmd.screenBindGroup = _screenBindGroup;
+    cmd.scissorEnabled = _scissorEnabled;
+    cmd.scissorRegion = _scissorRegion;
+    _drawCommands.push_back(cmd);
+}
+
+bool RenderInterface::UploadGeometry(GeometryData &geometry)
+{
+    if (!_core.GetResource<Graphic::Resource::DeviceContext>().GetDevice().has_value() ||
+        !_core.HasResource<Graphic::Resource::Queue>())
+    {
+        return false;
+    }
 
-    std::vector<uint32_t> indices;
-    indices.reserve(geometry.indices.size());
-    for (const auto &index : geometry.indices)
+    const uint64_t vertexCount = geometry.vertices.size();
+    const uint64_t indexCount = geometry.indices.size();
+    auto baseVertex = _vertexBuffer != nullptr ? _vertexAllocator.Allocate(vertexCount) : std::nullopt;
+    auto firstIndex = _indexBuffer != nullptr ? _indexAllocator.Allocate(indexCount) : std::nullopt;
+    if (!baseVertex.has_value() || !firstIndex.has_value())
     {
-        indices.push_back(static_cast<uint32_t>(index));
+        if (baseVertex.has_value())
+            _vertexAllocator.Free(baseVertex.value(), vertexCount);
+        if (firstIndex.has_value())
+            _indexAllocator.Free(firstIndex.value(), indexCount);
+        GrowGeometryBuffers(vertexCount, indexCount);
+        baseVertex = _vertexAllocator.Allocate(vertexCount);
+        firstIndex = _indexAllocator.Allocate(indexCount);
+    }
+
+    geometry.baseVertex = static_cast<uint32_t>(baseVertex.value());
+    geometry.firstIndex = static_cast<uint32_t>(firstIndex.value());
+    geometry.uploaded = true;
+    WriteGeometry(geometry);
+    return true;
+}
+
+void RenderInterface::GrowGeometryBuffers(uint64_t vertexCount, uint64_t indexCount)
+{
+    uint64_t vertexCapacity = std::max<uint64_t>(_vertexAllocator.GetCapacity(), 1);
+    while (vertexCapacity < _vertexAllocator.GetUsedSize() + vertexCount)
+        vertexCapacity *= 2;
+    uint64_t indexCapacity = std::max<uint64_t>(_indexAllocator.GetCapacity(), 1);
+    while (indexCapacity < _indexAllocator.GetUsedSize() + indexCount)
+        indexCapacity *= 2;
+
+    const auto &device = _core.GetResource<Graphic::Resource::DeviceContext>().GetDevice().value();
+    for (auto *buffer : {&_vertexBuffer, &_indexBuffer})
+    {
+        if (*buffer != nullptr)
+            buffer->release();
     }
 
     wgpu::BufferDescriptor vertexDesc(wgpu::Default);
-    vertexDesc.size = translatedVertices.size() * sizeof(Rml::Vertex);
+    vertexDesc.label = wgpu::StringView("RmluiVertexBuffer");
+    vertexDesc.size = vertexCapacity * sizeof(Rml::Vertex);
     vertexDesc.usage = wgpu::BufferUsage::Vertex | wgpu::BufferUsage::CopyDst;
-    wgpu::Buffer vertexBuffer = device.createBuffer(vertexDesc);
-    queue->writeBuffer(vertexBuffer, 0, translatedVertices.data(), vertexDesc.size);
+    _vertexBuffer = device.createBuffer(vertexDesc);
 
     wgpu::BufferDescriptor indexDesc(wgpu::Default);
-    indexDesc.size = indices.size() * sizeof(uint32_t);
+    indexDesc.label = wgpu::StringView("RmluiIndexBuffer");
+    indexDesc.size = indexCapacity * sizeof(uint32_t);
     indexDesc.usage = wgpu::BufferUsage::Index | wgpu::BufferUsage::CopyDst;
-    wgpu::Buffer indexBuffer = device.createBuffer(indexDesc);
-    queue->writeBuffer(indexBuffer, 0, indices.data(), indexDesc.size);
+    _indexBuffer = device.createBuffer(indexDesc);
 
-    wgpu::BindGroup textureBindGroup = ResolveTextureBindGroup(texture_handle);
-
-    if (textureBindGroup == nullptr && _defaultTexture)
+    // Live geometries, and those released this frame that may still be drawn, are packed into the new buffers.
+    _vertexAllocator.Reset(vertexCapacity);
+    _indexAllocator.Reset(indexCapacity);
+    auto repack = [this](GeometryData &geometry) {
+        if (!geometry.uploaded)
+            return;
+        geometry.baseVertex = static_cast<uint32_t>(_vertexAllocator.Allocate(geometry.vertices.size()).value());
+        geometry.firstIndex = static_cast<uint32_t>(_indexAllocator.Allocate(geometry.indices.size()).value());
+        WriteGeometry(geometry);
+    };
+    for (auto &[handle, geometry] : _geometries)
     {
-        textureBindGroup = _defaultTexture->bindGroup;
+        repack(*geometry);
     }
+    for (auto &geometry : _releasedGeometries)
+    {
+        repack(*geometry);
+    }
+}
 
-    if (textureBindGroup == nullptr || _screenBindGroup == nullptr)
+void RenderInterface::WriteGeometry(const GeometryData &geometry)
+{
+    if (geometry.vertices.empty() || geometry.indices.empty())
+        return;
+    const auto &queue = _core.GetResource<Graphic::Resource::Queue>();
+    queue->writeBuffer(_vertexBuffer, uint64_t{geometry.baseVertex} * sizeof(Rml::Vertex), geometry.vertices.data(),
+                       geometry.vertices.size() * sizeof(Rml::Vertex));
+    queue->writeBuffer(_indexBuffer, uint64_t{geometry.firstIndex} * sizeof(uint32_t), geometry.indices.data(),
+                       geometry.indices.size() * sizeof(uint32_t));
+}
+
+void RenderInterface::FreeReleasedGeometries()
+{
+    for (const auto &geometry : _releasedGeometries)
     {
+        if (!geometry->uploaded)
+            continue;
+        _vertexAllocator.Free(geometry->baseVertex, geometry->vertices.size());
+        _indexAllocator.Free(geometry->firstIndex, geometry->indices.size());
+    }
+    _releasedGeometries.clear();
+}
+
+void RenderInterface::WriteDrawData()
+{
+    if (_drawData.empty())
         return;
+
+    const auto &shaders = _core.GetResource<Graphic::Resource::ShaderContainer>();
+    if (!shaders.Contains(Rmlui::Utils::RMLUI_RENDER_PASS_SHADER_ID))
+        return;
+
+    if (_drawBuffer == nullptr || _drawBuffer.getSize() < _drawData.size())
+    {
+        uint64_t capacity = _drawBuffer != nullptr ? _drawBuffer.getSize() : DRAW_DATA_ALIGNMENT * 64;
+        while (capacity < _drawData.size())
+            capacity *= 2;
+        if (_drawBuffer != nullptr)
+            _drawBuffer.release();
+        if (_drawBindGroup != nullptr)
+            _drawBindGroup.release();
+
+        const auto &device = _core.GetResource<Graphic::Resource::DeviceContext>().GetDevice().value();
+        wgpu::BufferDescriptor bufferDesc(wgpu::Default);
+        bufferDesc.label = wgpu::StringView("RmluiDrawBuffer");
+        bufferDesc.size = capacity;
+        bufferDesc.usage = wgpu::BufferUsage::Uniform | wgpu::BufferUsage::CopyDst;
+        _drawBuffer = device.createBuffer(bufferDesc);
+
+        wgpu::BindGroupEntry entry(wgpu::Default);
+        entry.binding = 0U;
+        entry.buffer = _drawBuffer;
+        entry.size = sizeof(DrawData);
+
+        wgpu::BindGroupDescriptor descriptor(wgpu::Default);
+        descriptor.layout = shaders.Get(Rmlui::Utils::RMLUI_RENDER_PASS_SHADER_ID).GetBindGroupLayout(2);
+        descriptor.entryCount = 1UL;
+        descriptor.entries = &entry;
+        _drawBindGroup = device.createBindGroup(descriptor);
     }
 
-    DrawCommand cmd;
-    cmd.vertexBuffer = vertexBuffer;
-    cmd.indexBuffer = indexBuffer;
-    cmd.indexCount = static_cast<uint32_t>(indices.size());
-    cmd.textureBindGroup = textureBindGroup;
-    cmd.screenBindGroup = _screenBindGroup;
-    cmd.scissorEnabled = _scissorEnabled;
-    cmd.scissorRegion = _scissorRegion;
-    _drawCommands.push_back(cmd);
+    // One write per frame for every draw of the frame, the queue stages it before the pass is submitted.
+    _core.GetResource<Graphic::Resource::Queue>()->writeBuffer(_drawBuffer, 0, _drawData.data(), _drawData.size());
+    _drawData.clear();
 }
 
 wgpu::BindGroup RenderInterface::ResolveTextureBindGroup(Rml::TextureHandle texture_handle)
@@ -296,7 +425,15 @@ wgpu::BindGroup RenderInterface::ResolveTextureBindGroup(Rml::TextureHandle text
     return texture.bindGroup;
 }
 
-void RenderInterface::ReleaseGeometry(Rml::CompiledGeometryHandle handle) { _geometries.erase(handle); }
+void RenderInterface::ReleaseGeometry(Rml::CompiledGeometryHandle handle)
+{
+    auto geometryIt = _geometries.find(handle);
+    if (geometryIt == _geometries.end())
+        return;
+    // Draws recorded this frame may still use the geometry: its ranges are freed by the next BeginFrame.
+    _releasedGeometries.push_back(std::move(geometryIt->second));
+    _geometries.erase(geometryIt);
+}
 
 Rml::TextureHandle RenderInterface::LoadTexture(Rml::Vector2i &texture_dimensions, const Rml::String &source)
 {
@@ -452,6 +589,8 @@ void RenderInterface::BeginFrame()
 {
     _active = this;
     _drawCommands.clear();
+    _drawData.clear();
+    FreeReleasedGeometries();
 
     const auto &deviceContext = _core.GetResource<Graphic::Resource::DeviceContext>();
     const auto &queue = _core.GetResource<Graphic::Resource::Queue>();
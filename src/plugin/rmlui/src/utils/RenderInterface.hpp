@@ -2,6 +2,7 @@
 
 #include <RmlUi/Core.h>
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -18,16 +19,24 @@
 
 #include "core/Core.hpp"
 #include "resource/Texture.hpp"
+#include "utils/RangeAllocator.hpp"
 
 #include "utils/IRenderer.hpp"
 #include "utils/webgpu.hpp"
 
 namespace Rmlui::Utils {
+/**
+ * @brief RmlUi renderer drawing into the end render texture.
+ *
+ * Compiled geometry is uploaded once into vertex and index buffers shared by every geometry, and stays on the GPU
+ * until RmlUi releases it. Per-draw data (translation and transform) is packed into a uniform buffer rewritten once per
+ * frame and selected with a dynamic offset, so rendering a geometry allocates nothing on the GPU.
+ */
 class RenderInterface : public Rmlui::Utils::IRenderer {
   public:
     RenderInterface() = delete;
     explicit RenderInterface(Engine::Core &core);
-    ~RenderInterface() override = default;
+    ~RenderInterface() override;
 
     static RenderInterface *GetActive();
     void FlushDrawCommands(wgpu::RenderPassEncoder const &renderPass);
@@ -51,9 +60,24 @@ class RenderInterface : public Rmlui::Utils::IRenderer {
     void SetTransform(const Rml::Matrix4f *new_transform) override;
 
   private:
+    /** @brief Mirrors the DrawData struct of the shader. */
+    struct DrawData {
+        std::array<float, 16> transform;
+        std::array<float, 2> translation;
+        std::array<float, 2> padding;
+    };
+
+    /** @brief Dynamic uniform offsets must be multiples of minUniformBufferOffsetAlignment, at most 256. */
+    static inline constexpr uint64_t DRAW_DATA_ALIGNMENT = 256;
+    static inline constexpr uint64_t INITIAL_VERTEX_CAPACITY = 1 << 14;
+    static inline constexpr uint64_t INITIAL_INDEX_CAPACITY = 1 << 15;
+
     struct GeometryData {
         std::vector<Rml::Vertex> vertices;
-        std::vector<int> indices;
+        std::vector<uint32_t> indices;
+        uint32_t baseVertex = 0;
+        uint32_t firstIndex = 0;
+        bool uploaded = false;
     };
 
     struct TextureData {
@@ -65,21 +89,36 @@ class RenderInterface : public Rmlui::Utils::IRenderer {
     };
 
     struct DrawCommand {
-        wgpu::Buffer vertexBuffer;
-        wgpu::Buffer indexBuffer;
-        uint32_t indexCount = 0;
+        // Read when the pass executes, the geometry may have moved if the buffers grew since.
+        const GeometryData *geometry = nullptr;
+        uint32_t drawDataOffset = 0;
         wgpu::BindGroup textureBindGroup;
         wgpu::BindGroup screenBindGroup;
         bool scissorEnabled = false;
         Rml::Rectanglei scissorRegion;
     };
 
+    bool UploadGeometry(GeometryData &geometry);
+    void GrowGeometryBuffers(uint64_t vertexCount, uint64_t indexCount);
+    void WriteGeometry(const GeometryData &geometry);
+    void FreeReleasedGeometries();
+    void WriteDrawData();
+
     wgpu::BindGroup ResolveTextureBindGroup(Rml::TextureHandle texture_handle);
 
     static RenderInterface *_active;
 
     Engine::Core &_core;
     std::unordered_map<Rml::CompiledGeometryHandle, std::unique_ptr<GeometryData>> _geometries;
+    /** @brief Geometries released during the frame, their ranges are reused once the frame is drawn. */
+    std::vector<std::unique_ptr<GeometryData>> _releasedGeometries;
+    wgpu::Buffer _vertexBuffer;
+    wgpu::Buffer _indexBuffer;
+    Graphic::Utils::RangeAllocator _vertexAllocator;
+    Graphic::Utils::RangeAllocator _indexAllocator;
+    std::vector<std::byte> _drawData;
+    wgpu::Buffer _drawBuffer;
+    wgpu::BindGroup _drawBindGroup;
     std::unordered_map<Rml::TextureHandle, std::unique_ptr<TextureData>> _textures;
     size_t _textureCounter = 0;
     Rml::TextureHandle _nextTextureHandle = 1;
@@ -21,6 +21,11 @@
 #include <cstddef>
 
 Graphic::Resource::Shader Rmlui::Utils::RmluiRenderPass::CreateShader(Graphic::Resource::DeviceContext &deviceContext)
+{
+    return Graphic::Resource::Shader::Create(CreateShaderDescriptor(), deviceContext);
+}
+
+Graphic::Resource::ShaderDescriptor Rmlui::Utils::RmluiRenderPass::CreateShaderDescriptor()
 {
     Graphic::Resource::ShaderDescriptor shaderDescriptor;
 
@@ -49,6 +54,15 @@ Graphic::Resource::Shader Rmlui::Utils::RmluiRenderPass::CreateShader(Graphic::R
                                           .setVisibility(wgpu::ShaderStage::Vertex)
                                           .setBinding(0));
 
+    // Translation and transform of each draw, selected with a dynamic offset into a buffer shared by the frame.
+    auto drawLayout = Graphic::Utils::BindGroupLayout("RmluiDrawLayout")
+                          .addEntry(Graphic::Utils::BufferBindGroupLayoutEntry("draw")
+                                        .setType(wgpu::BufferBindingType::Uniform)
+                                        .setHasDynamicOffset(true)
+                                        .setMinBindingSize(sizeof(float) * 20)
+                                        .setVisibility(wgpu::ShaderStage::Vertex)
+                                        .setBinding(0));
+
     wgpu::BlendState blendState(wgpu::Default);
     blendState.color.srcFactor = wgpu::BlendFactor::One;
     blendState.color.dstFactor = wgpu::BlendFactor::OneMinusSrcAlpha;
@@ -67,6 +81,7 @@ Graphic::Resource::Shader Rmlui::Utils::RmluiRenderPass::CreateShader(Graphic::R
         .setFragmentEntryPoint("fs_main")
         .addBindGroupLayout(textureLayout)
         .addBindGroupLayout(screenLayout)
+        .addBindGroupLayout(drawLayout)
         .addVertexBufferLayout(vertexLayout)
         .addOutputColorFormat(colorOutput)
         .setCullMode(wgpu::CullMode::None);
@@ -88,5 +103,5 @@ Graphic::Resource::Shader Rmlui::Utils::RmluiRenderPass::CreateShader(Graphic::R
         }
     }
 
-    return Graphic::Resource::Shader::Create(shaderDescriptor, deviceContext);
+    return shaderDescriptor;
 }
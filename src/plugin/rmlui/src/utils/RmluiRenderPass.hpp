@@ -29,6 +29,14 @@ struct ScreenData {
 @group(0) @binding(1) var uiSampler : sampler;
 @group(1) @binding(0) var<uniform> screen : ScreenData;
 
+struct DrawData {
+    transform : mat4x4f,
+    translation : vec2f,
+    _pad : vec2f,
+};
+
+@group(2) @binding(0) var<uniform> draw : DrawData;
+
 struct VertexInput {
     @location(0) position : vec2f,
     @location(1) color : vec4<u32>,
@@ -44,9 +52,12 @@ struct VertexOutput {
 @vertex
 fn vs_main(input : VertexInput) -> VertexOutput {
     var output : VertexOutput;
+    let transformed = draw.transform * vec4f(input.position + draw.translation, 0.0, 1.0);
+    let w = select(transformed.w, 1.0, transformed.w == 0.0);
+    let position = transformed.xy / w;
     let ndc = vec2f(
-        (input.position.x / screen.size.x) * 2.0 - 1.0,
-        1.0 - (input.position.y / screen.size.y) * 2.0
+        (position.x / screen.size.x) * 2.0 - 1.0,
+        1.0 - (position.y / screen.size.y) * 2.0
     );
     output.Position = vec4f(ndc, 0.0, 1.0);
     output.color = vec4f(input.color) / 255.0;
@@ -77,5 +88,6 @@ class RmluiRenderPass : public Graphic::Resource::ASingleExecutionRenderPass<Rml
     }
 
     static Graphic::Resource::Shader CreateShader(Graphic::Resource::DeviceContext &deviceContext);
+    static Graphic::Resource::ShaderDescriptor CreateShaderDescriptor();
 };
 } // namespace Rmlui::Utils
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "core/Core.hpp"
+#include "plugin/PluginRmlui.hpp"
+#include "resource/GraphicSettings.hpp"
+#include "scheduler/Init.hpp"
+#include "utils/RenderInterface.hpp"
+
+namespace {
+std::vector<Rml::Vertex> CreateQuads(size_t quadCount, std::vector<int> &indices)
+{
+    std::vector<Rml::Vertex> vertices(quadCount * 4);
+    indices.clear();
+    for (size_t quad = 0; quad < quadCount; ++quad)
+    {
+        const auto x = static_cast<float>(quad % 64) * 4.0F;
+        const auto y = static_cast<float>(quad / 64) * 4.0F;
+        vertices[quad * 4 + 0].position = {x, y};
+        vertices[quad * 4 + 1].position = {x + 4.0F, y};
+        vertices[quad * 4 + 2].position = {x + 4.0F, y + 4.0F};
+        vertices[quad * 4 + 3].position = {x, y + 4.0F};
+        const int first = static_cast<int>(quad * 4);
+        indices.insert(indices.end(), {first, first + 1, first + 2, first, first + 2, first + 3});
+    }
+    return vertices;
+}
+
+void CompiledGeometryTest(Engine::Core &core)
+{
+    Rmlui::Utils::RenderInterface renderer(core);
+    std::vector<int> indices;
+
+    renderer.BeginFrame();
+    auto small = CreateQuads(1, indices);
+    const auto first = renderer.CompileGeometry(small, indices);
+    // Larger than the initial buffers: they grow and the first geometry is packed into the new ones.
+    auto large = CreateQuads(8192, indices);
+    const auto second = renderer.CompileGeometry(large, indices);
+    EXPECT_NE(first, second);
+
+    renderer.RenderGeometry(first, Rml::Vector2f(10.0F, 10.0F), 0);
+    renderer.RenderGeometry(second, Rml::Vector2f(0.0F, 0.0F), 0);
+    renderer.ReleaseGeometry(first);
+    renderer.EndFrame();
+
+    // Ranges of released geometries are reused from the next frame on.
+    renderer.BeginFrame();
+    small = CreateQuads(1, indices);
+    const auto third = renderer.CompileGeometry(small, indices);
+    renderer.RenderGeometry(third, Rml::Vector2f(0.0F, 0.0F), 0);
+    renderer.ReleaseGeometry(second);
+    renderer.ReleaseGeometry(third);
+    renderer.EndFrame();
+    renderer.BeginFrame();
+}
+} // namespace
+
+TEST(RmluiRenderInterface, CompiledGeometry)
+{
+    Engine::Core core;
+
+    core.AddPlugins<Rmlui::Plugin>();
+
+    core.RegisterSystem<RenderingPipeline::Init>([](Engine::Core &coreRef) {
+        coreRef.GetResource<Graphic::Resource::GraphicSettings>().SetWindowSystem(
+            Graphic::Resource::WindowSystem::None);
+    });
+
+    core.RegisterSystem(CompiledGeometryTest);
+
+    EXPECT_NO_THROW(core.RunSystems());
+}
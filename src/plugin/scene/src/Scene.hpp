@@ -3,11 +3,22 @@
 // System
 #include "system/UpdateScene.hpp"
 
+// Event
+#include "event/SceneEvent.hpp"
+
+// Exception
+#include "exception/SnapshotError.hpp"
+
 // Resource
 #include "resource/SceneManager.hpp"
+#include "resource/SnapshotSerializers.hpp"
 
 // Utils
 #include "utils/AScene.hpp"
+#include "utils/AStreamedScene.hpp"
+#include "utils/Snapshot.hpp"
+#include "utils/SnapshotArchive.hpp"
+#include "utils/SnapshotScene.hpp"
 
 // Plugin
 #include "plugin/PluginScene.hpp"
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace Scene::Event {
+
+/**
+ * @brief Event triggered when the scene manager starts to load a scene.
+ */
+struct SceneLoadStartedEvent {
+    std::string name; ///< The name of the scene.
+    bool isAdditive;  ///< Whether the scene is loaded next to the current one instead of replacing it.
+};
+
+/**
+ * @brief Event triggered each frame a streamed scene is merged into the registry.
+ */
+struct SceneLoadProgressEvent {
+    std::string name; ///< The name of the scene.
+    float progress;   ///< Part of the scene merged so far, between 0 and 1.
+};
+
+/**
+ * @brief Event triggered when a scene is fully loaded.
+ */
+struct SceneLoadedEvent {
+    std::string name;   ///< The name of the scene.
+    size_t entityCount; ///< The number of entities created by a streamed scene, 0 for the other scenes.
+};
+
+/**
+ * @brief Event triggered when a scene cannot be loaded. The entities it created so far are destroyed.
+ */
+struct SceneLoadFailedEvent {
+    std::string name;  ///< The name of the scene.
+    std::string error; ///< The reason of the failure.
+};
+
+/**
+ * @brief Event triggered when a scene is unloaded.
+ */
+struct SceneUnloadedEvent {
+    std::string name; ///< The name of the scene.
+};
+
+} // namespace Scene::Event
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+namespace Scene {
+
+/**
+ * @brief SnapshotError is an exception class that should be thrown when a snapshot of the registry cannot be written
+ * or read, e.g. a truncated stream or an unknown format.
+ *
+ * @example "Catching an exception"
+ * @code
+ * try {
+ * } catch (SnapshotError &e) {
+ *   std::cerr << e.what() << std::endl;
+ * }
+ * @endcode
+ *
+ * @example "Throwing an exception"
+ * @code
+ * throw SnapshotError("Failed to do something");
+ * @endcode
+ */
+class SnapshotError : public std::exception {
+  public:
+    explicit SnapshotError(const std::string &message) : msg("Snapshot error: " + message) {};
+
+    const char *what() const throw() override { return this->msg.c_str(); };
+
+  private:
+    std::string msg;
+};
+
+} // namespace Scene
@@ -1,10 +1,15 @@
+#include "plugin/PluginEvent.hpp"
 #include "plugin/PluginScene.hpp"
 #include "resource/SceneManager.hpp"
+#include "resource/SnapshotSerializers.hpp"
 #include "scheduler/Update.hpp"
 #include "system/UpdateScene.hpp"
 
 void Scene::Plugin::Bind()
 {
+    RequirePlugins<::Event::Plugin>();
+
     RegisterResource<Resource::SceneManager>(Resource::SceneManager());
+    RegisterResource<Resource::SnapshotSerializers>(Resource::SnapshotSerializers());
     RegisterSystems<Engine::Scheduler::Update>(System::UpdateScene);
 }
@@ -2,55 +2,101 @@
 
 #include "Logger.hpp"
 
+#include "event/SceneEvent.hpp"
+#include "resource/EventManager.hpp"
+#include "resource/SnapshotSerializers.hpp"
 #include "utils/AScene.hpp"
 
 #include "resource/SceneManager.hpp"
 
+#include <algorithm>
+#include <utility>
+
+namespace {
+template <typename TEvent> void PushSceneEvent(Engine::Core &core, const TEvent &event)
+{
+    if (core.HasResource<::Event::Resource::EventManager>())
+    {
+        core.GetResource<::Event::Resource::EventManager>().PushEvent(event);
+    }
+}
+} // namespace
+
+void Scene::Resource::SceneManager::LoadSceneAdditive(const std::string_view &name)
+{
+    _pendingAdditive.emplace_back(name);
+}
+
+void Scene::Resource::SceneManager::UnloadScene(const std::string_view &name) { _pendingUnloads.emplace_back(name); }
+
 void Scene::Resource::SceneManager::Update(Engine::Core &core)
 {
-    if (!_nextScene.has_value())
+    for (const auto &name : std::exchange(_pendingUnloads, {}))
     {
-        return;
+        _unloadAdditiveScene(core, name);
     }
-    if (_currentScene.has_value())
+    for (const auto &name : std::exchange(_pendingAdditive, {}))
     {
-        _unloadScene(core, _currentScene.value());
+        _startScene(core, name, true);
     }
-    if (!_nextScene.has_value())
+
+    // A transition waits for the previous one, so that the scene it replaces is known.
+    bool isInTransition = std::ranges::any_of(_streams, [](const Stream &stream) { return !stream.isAdditive; });
+    if (_nextScene.has_value() && !isInTransition)
     {
-        return;
+        const std::string name = std::move(_nextScene.value());
+        _nextScene.reset();
+        _startScene(core, name, false);
     }
-    _loadScene(core, _nextScene.value());
-    _currentScene = _nextScene;
-    _nextScene.reset();
-}
-void Scene::Resource::SceneManager::_loadScene(Engine::Core &core, const std::string &name)
-{
-    if (!_nextScene.has_value())
+
+    const auto deadline = std::chrono::steady_clock::now() + _budget.time;
+    size_t records = _budget.records;
+    bool hasMerged = false;
+    for (auto &stream : _streams)
     {
-        Log::Error("Scene::Resource::SceneManager::_loadScene: _nextScene is empty");
-        return;
+        if (stream.isCancelled)
+        {
+            // The worker thread cannot be interrupted, its snapshot is dropped once prepared.
+            if (!stream.isDone)
+            {
+                stream.isDone = stream.snapshot.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+            }
+            continue;
+        }
+        if (records == 0 || (hasMerged && std::chrono::steady_clock::now() >= deadline))
+        {
+            continue;
+        }
+        if (stream.loader == nullptr && !_startMerge(core, stream))
+        {
+            continue;
+        }
+        _merge(core, stream, records, deadline);
+        hasMerged = true;
     }
-    Log::Info("Loading scene: " + _nextScene.value());
+    std::erase_if(_streams, [](const Stream &stream) { return stream.isDone; });
+}
+
+void Scene::Resource::SceneManager::_loadScene(Engine::Core &core, const std::string &name, bool isAdditive)
+{
+    Log::Info("Loading scene: " + name);
     std::optional<std::shared_ptr<Utils::AScene>> scene = _getScene(name);
     if (scene.has_value())
     {
+        PushSceneEvent(core, Event::SceneLoadStartedEvent{name, isAdditive});
         scene.value()->Load(core);
+        PushSceneEvent(core, Event::SceneLoadedEvent{name, 0});
     }
 }
 
 void Scene::Resource::SceneManager::_unloadScene(Engine::Core &core, const std::string &name)
 {
-    if (!_currentScene.has_value())
-    {
-        Log::Error("Scene::Resource::SceneManager::_unloadScene: _currentScene is empty");
-        return;
-    }
-    Log::Info("Unloading scene: " + _currentScene.value());
+    Log::Info("Unloading scene: " + name);
     std::optional<std::shared_ptr<Utils::AScene>> scene = _getScene(name);
     if (scene.has_value())
     {
         scene.value()->Unload(core);
+        PushSceneEvent(core, Event::SceneUnloadedEvent{name});
     }
 }
 
@@ -67,3 +113,182 @@ std::optional<std::shared_ptr<Scene::Utils::AScene>> Scene::Resource::SceneManag
         return std::nullopt;
     }
 }
+
+bool Scene::Resource::SceneManager::_isStreaming(std::string_view name) const
+{
+    return std::ranges::any_of(_streams,
+                               [name](const Stream &stream) { return !stream.isCancelled && stream.name == name; });
+}
+
+void Scene::Resource::SceneManager::_startScene(Engine::Core &core, const std::string &name, bool isAdditive)
+{
+    if (isAdditive && (std::ranges::find(_additiveScenes, name) != _additiveScenes.end() || _isStreaming(name) ||
+                       _currentScene == name))
+    {
+        Log::Warning(fmt::format("Scene {} is already loaded", name));
+        return;
+    }
+
+    std::optional<std::shared_ptr<Utils::AScene>> scene = _getScene(name);
+    auto streamed = scene.has_value() ? std::dynamic_pointer_cast<Utils::AStreamedScene>(scene.value()) : nullptr;
+    if (streamed == nullptr)
+    {
+        // Scenes built by code are loaded in the frame they are requested.
+        if (isAdditive)
+        {
+            if (scene.has_value())
+            {
+                _loadScene(core, name, true);
+                _additiveScenes.push_back(name);
+            }
+            return;
+        }
+        if (_currentScene.has_value())
+        {
+            _unloadScene(core, _currentScene.value());
+        }
+        _loadScene(core, name);
+        _currentScene = name;
+        return;
+    }
+
+    PushSceneEvent(core, Event::SceneLoadStartedEvent{name, isAdditive});
+    if (!core.HasResource<SnapshotSerializers>())
+    {
+        Log::Error(fmt::format("Cannot stream scene {}: Scene::Resource::SnapshotSerializers is not registered", name));
+        PushSceneEvent(core, Event::SceneLoadFailedEvent{name, "Scene::Resource::SnapshotSerializers is missing"});
+        return;
+    }
+
+    Log::Info("Streaming scene: " + name);
+    Stream &stream = _streams.emplace_back();
+    stream.name = name;
+    stream.scene = streamed;
+    stream.isAdditive = isAdditive;
+    stream.snapshot = std::async(std::launch::async,
+                                 [scene = streamed, serializers = core.GetResource<SnapshotSerializers>()]() {
+                                     return scene->Prepare(serializers);
+                                 });
+}
+
+void Scene::Resource::SceneManager::_unloadAdditiveScene(Engine::Core &core, const std::string &name)
+{
+    for (auto &stream : _streams)
+    {
+        if (stream.isCancelled || !stream.isAdditive || stream.name != name)
+        {
+            continue;
+        }
+        Log::Info("Cancelling scene: " + name);
+        if (stream.loader != nullptr)
+        {
+            stream.loader->Rollback(core);
+            stream.isDone = true;
+        }
+        stream.isCancelled = true;
+        PushSceneEvent(core, Event::SceneUnloadedEvent{name});
+        return;
+    }
+
+    auto it = std::ranges::find(_additiveScenes, name);
+    if (it == _additiveScenes.end())
+    {
+        Log::Warning(fmt::format("Scene {} is not loaded additively, it cannot be unloaded", name));
+        return;
+    }
+    _additiveScenes.erase(it);
+    _unloadScene(core, name);
+}
+
+bool Scene::Resource::SceneManager::_startMerge(Engine::Core &core, Stream &stream)
+{
+    if (stream.snapshot.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    {
+        return false;
+    }
+
+    try
+    {
+        stream.input = stream.snapshot.get();
+        // The size is only used to report the progress of the merge.
+        stream.input->seekg(0, std::ios::end);
+        const std::streamoff size = stream.input->tellg();
+        stream.input->clear();
+        stream.input->seekg(0, std::ios::beg);
+        stream.size = size < 0 ? 0 : static_cast<size_t>(size);
+        stream.loader = std::make_unique<Utils::SnapshotLoader>(*stream.input, Utils::SnapshotLoadMode::Append);
+    }
+    catch (const std::exception &e)
+    {
+        // The current scene keeps running when the next one cannot be prepared.
+        _failStream(core, stream, e.what());
+        return false;
+    }
+
+    if (!stream.isAdditive && _currentScene.has_value())
+    {
+        _unloadScene(core, _currentScene.value());
+        _currentScene.reset();
+    }
+    return true;
+}
+
+void Scene::Resource::SceneManager::_merge(Engine::Core &core, Stream &stream, size_t &records,
+                                           std::chrono::steady_clock::time_point deadline)
+{
+    while (records > 0)
+    {
+        const size_t slice = std::min(records, MERGE_SLICE);
+        bool isLoaded = false;
+        try
+        {
+            isLoaded = stream.loader->Load(core, slice);
+        }
+        catch (const std::exception &e)
+        {
+            stream.loader->Rollback(core);
+            _failStream(core, stream, e.what());
+            return;
+        }
+        records -= slice;
+        if (isLoaded)
+        {
+            _finishStream(core, stream);
+            return;
+        }
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            break;
+        }
+    }
+
+    const std::streamoff position = stream.input->tellg();
+    const float progress =
+        position < 0 || stream.size == 0 ? 0.0f : static_cast<float>(position) / static_cast<float>(stream.size);
+    PushSceneEvent(core, Event::SceneLoadProgressEvent{stream.name, std::min(progress, 1.0f)});
+}
+
+void Scene::Resource::SceneManager::_finishStream(Engine::Core &core, Stream &stream)
+{
+    const size_t entityCount = stream.loader->GetEntities().size();
+    stream.scene->Merge(core, stream.loader->GetEntities());
+    if (stream.isAdditive)
+    {
+        _additiveScenes.push_back(stream.name);
+    }
+    else
+    {
+        _currentScene = stream.name;
+    }
+    stream.isDone = true;
+    Log::Info(fmt::format("Scene {} loaded with {} entities", stream.name, entityCount));
+    PushSceneEvent(core, Event::SceneLoadProgressEvent{stream.name, 1.0f});
+    PushSceneEvent(core, Event::SceneLoadedEvent{stream.name, entityCount});
+}
+
+void Scene::Resource::SceneManager::_failStream(Engine::Core &core, Stream &stream, const std::string &error)
+{
+    Log::Error(fmt::format("Failed to load scene {}: {}", stream.name, error));
+    stream.isDone = true;
+    PushSceneEvent(core, Event::SceneLoadFailedEvent{stream.name, error});
+}
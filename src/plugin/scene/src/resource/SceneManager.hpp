@@ -1,37 +1,98 @@
 #pragma once
 
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <future>
 #include <iostream>
+#include <memory>
 #include <optional>
+#include <sstream>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "Engine.hpp"
 
 #include "Logger.hpp"
 
 #include "utils/AScene.hpp"
+#include "utils/AStreamedScene.hpp"
+#include "utils/Snapshot.hpp"
 
 namespace Scene::Resource {
+/**
+ * @brief Loads and unloads the registered scenes.
+ *
+ * Scenes derived from Utils::AStreamedScene are streamed: they are prepared on a worker thread while the current
+ * scene keeps running, then merged into the registry within a budget per frame (see SetMergeBudget). The current
+ * scene is unloaded once the next one is prepared. Other scenes are loaded at once, in the frame they are requested.
+ *
+ * Additive scenes, e.g. the chunks of a world, are loaded next to the current scene and stay loaded until
+ * UnloadScene. Progress is reported by the events of Scene::Event, pushed to the Event::Resource::EventManager if the
+ * core has one.
+ *
+ * @note Streamed scenes are merged with the serializers of Resource::SnapshotSerializers, registered by Scene::Plugin.
+ */
 class SceneManager {
   public:
+    /**
+     * @brief Work done per frame to merge streamed scenes. A record is an entity or one of its components.
+     */
+    struct MergeBudget {
+        size_t records = 16384;
+        std::chrono::microseconds time = std::chrono::milliseconds(2);
+    };
+
+    /** @brief Number of records merged between two checks of the time budget. */
+    static inline constexpr size_t MERGE_SLICE = 256;
+
     SceneManager() = default;
     ~SceneManager() = default;
 
+    SceneManager(const SceneManager &) = delete;
+    SceneManager &operator=(const SceneManager &) = delete;
+    SceneManager(SceneManager &&) noexcept = default;
+    SceneManager &operator=(SceneManager &&) noexcept = default;
+
     /**
      * @brief Set the next scene to load.
-     * It will be loaded at the next call of Update.
+     * It will be loaded at the next call of Update, or start streaming then if it is a Utils::AStreamedScene.
+     * While a streamed scene is loading, the next scene waits for it to be loaded.
      *
      * @param name  name of the scene to load
      */
     inline void SetNextScene(const std::string_view &name) { _nextScene = name; }
 
     /**
-     * @brief Unload the current scene and load the next scene.
+     * @brief Load a scene next to the current one at the next call of Update.
+     *
+     * @param name  name of the scene to load
+     */
+    void LoadSceneAdditive(const std::string_view &name);
+
+    /**
+     * @brief Unload an additive scene at the next call of Update. A scene still streaming is cancelled.
+     *
+     * @param name  name of the scene to unload
+     */
+    void UnloadScene(const std::string_view &name);
+
+    /**
+     * @brief Unload the current scene and load the next scene, load and unload additive scenes, and merge the
+     * streamed scenes within the budget.
      *
      * @param core  core that contains all components
      */
     void Update(Engine::Core &core);
 
+    /**
+     * @brief Set the work done per frame to merge streamed scenes. The time is checked every MERGE_SLICE records, so
+     * at least one slice is merged each frame.
+     */
+    void SetMergeBudget(const MergeBudget &budget) { _budget = budget; }
+    [[nodiscard]] const MergeBudget &GetMergeBudget() const { return _budget; }
+
     /**
      * @brief Register a scene using a name as a key.
      *
@@ -53,13 +114,52 @@ class SceneManager {
 
     const std::optional<std::string> &GetCurrentScene() const { return _currentScene; }
 
+    /** @brief Additive scenes loaded, in loading order. Scenes still streaming are not included. */
+    const std::vector<std::string> &GetAdditiveScenes() const { return _additiveScenes; }
+
+    /** @brief Whether a scene is streaming or waits to be loaded. */
+    [[nodiscard]] bool IsLoading() const
+    {
+        return _nextScene.has_value() || !_pendingAdditive.empty() || !_streams.empty();
+    }
+
+    /** @brief Whether a scene is streaming or waits to be loaded additively. */
+    [[nodiscard]] bool IsLoading(std::string_view name) const
+    {
+        return std::ranges::find(_pendingAdditive, name) != _pendingAdditive.end() || _isStreaming(name);
+    }
+
   private:
-    void _loadScene(Engine::Core &core, const std::string &name);
+    /** @brief Streamed scene being prepared, then merged. */
+    struct Stream {
+        std::string name;
+        std::shared_ptr<Utils::AStreamedScene> scene;
+        bool isAdditive = false;
+        bool isCancelled = false;
+        bool isDone = false;
+        std::future<std::unique_ptr<std::istream>> snapshot;
+        size_t size = 0;
+        /** @brief Snapshot read by the loader, from memory or from a file, once prepared. */
+        std::unique_ptr<std::istream> input;
+        std::unique_ptr<Utils::SnapshotLoader> loader;
+    };
+
+    void _loadScene(Engine::Core &core, const std::string &name, bool isAdditive = false);
 
     void _unloadScene(Engine::Core &core, const std::string &name);
 
     [[nodiscard]] std::optional<std::shared_ptr<Utils::AScene>> _getScene(const std::string &name);
 
+    [[nodiscard]] bool _isStreaming(std::string_view name) const;
+    void _startScene(Engine::Core &core, const std::string &name, bool isAdditive);
+    void _unloadAdditiveScene(Engine::Core &core, const std::string &name);
+    /** @return false if the stream is not prepared yet */
+    bool _startMerge(Engine::Core &core, Stream &stream);
+    /** @brief Merge the stream until it is loaded, or the records or the time of the frame run out. */
+    void _merge(Engine::Core &core, Stream &stream, size_t &records, std::chrono::steady_clock::time_point deadline);
+    void _finishStream(Engine::Core &core, Stream &stream);
+    void _failStream(Engine::Core &core, Stream &stream, const std::string &error);
+
     struct TransparentHash {
         using is_transparent = void;
         std::size_t operator()(const std::string &str) const noexcept { return std::hash<std::string>{}(str); }
@@ -70,5 +170,12 @@ class SceneManager {
 
     std::optional<std::string> _nextScene;
     std::optional<std::string> _currentScene;
+
+    std::vector<std::string> _pendingAdditive;
+    std::vector<std::string> _pendingUnloads;
+    std::vector<std::string> _additiveScenes;
+    /** @brief Streamed scenes in request order, which is the order they are merged in. */
+    std::deque<Stream> _streams;
+    MergeBudget _budget;
 };
 } // namespace Scene::Resource
@@ -0,0 +1,237 @@
+#pragma once
+
+#include "Engine.hpp"
+#include "Logger.hpp"
+#include "exception/SnapshotError.hpp"
+#include "utils/SnapshotArchive.hpp"
+#include <algorithm>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Scene::Resource {
+
+/**
+ * @brief Serializers of the components saved in snapshots of the registry (see Utils::SaveSnapshot), registered by the
+ * plugins that own the components. Components without a serializer are not saved, e.g. GPU resources that are
+ * recreated from the saved components when they are loaded.
+ *
+ * Components are identified in snapshots by the hash of the name they are registered with, which must not change
+ * between the save and the load.
+ *
+ * @example "Registering the components of a plugin"
+ * @code
+ * void MyPlugin::Plugin::Bind()
+ * {
+ *     RequirePlugins<Scene::Plugin>();
+ *     auto &serializers = GetCore().GetResource<Scene::Resource::SnapshotSerializers>();
+ *     serializers.Register<Component::Health>("MyPlugin::Health");
+ *     serializers.Register<Component::Name>(
+ *         "MyPlugin::Name",
+ *         [](Scene::Utils::SnapshotWriter &writer, const Component::Name &name) { writer.WriteString(name.value); },
+ *         [](Scene::Utils::SnapshotReader &reader, Component::Name &name) { name.value = reader.ReadString(); });
+ * }
+ * @endcode
+ */
+class SnapshotSerializers {
+  public:
+    using ComponentId = Utils::SnapshotSectionId;
+    template <typename TComponent>
+    using SaveFunction = std::function<void(Utils::SnapshotWriter &, const TComponent &)>;
+    template <typename TComponent> using LoadFunction = std::function<void(Utils::SnapshotReader &, TComponent &)>;
+
+    struct Serializer {
+        ComponentId id;
+        std::string name;
+        /** @brief Number of components saved from the registry. */
+        std::function<uint32_t(const Engine::Core::Registry &)> count;
+        /** @brief Write each component with its entity in the current section. */
+        std::function<void(const Engine::Core::Registry &, Utils::SnapshotWriter &)> save;
+        /** @brief Number of components saved from some entities of the registry. */
+        std::function<uint32_t(const Engine::Core::Registry &, std::span<const Engine::EntityId>)> countEntities;
+        /** @brief Write the component of each of the entities that has one, with its entity. */
+        std::function<void(const Engine::Core::Registry &, std::span<const Engine::EntityId>, Utils::SnapshotWriter &)>
+            saveEntities;
+        /** @brief Read a number of components with their entities and add them by batches of BATCH_SIZE. */
+        std::function<void(Engine::Core::Registry &, Utils::SnapshotReader &, uint32_t)> load;
+    };
+
+    /** @brief Number of components read before they are added to the registry at once. */
+    static inline constexpr size_t BATCH_SIZE = 1024;
+
+    SnapshotSerializers() = default;
+    ~SnapshotSerializers() = default;
+
+    [[nodiscard]] static ComponentId GetId(std::string_view name)
+    {
+        return entt::hashed_string{name.data(), name.size()}.value();
+    }
+
+    /**
+     * @brief Register a trivially copyable component, saved as its bytes.
+     *
+     * @note Components holding pointers or entities must use custom functions, see the other overload.
+     */
+    template <typename TComponent> void Register(std::string_view name)
+    {
+        static_assert(std::is_trivially_copyable_v<TComponent>,
+                      "TComponent must be trivially copyable, or registered with save and load functions");
+        Register<TComponent>(
+            name, [](Utils::SnapshotWriter &writer, const TComponent &component) { writer.Write(component); },
+            [](Utils::SnapshotReader &reader, TComponent &component) { component = reader.Read<TComponent>(); });
+    }
+
+    /**
+     * @brief Register a component saved and loaded by custom functions. Entities referenced by the component must
+     * be written with SnapshotWriter::WriteEntity and read with SnapshotReader::ReadEntity, which remaps them.
+     *
+     * @note Registering a name again replaces its serializer.
+     *
+     * @throw SnapshotError if the id of the name is already used by another name.
+     */
+    template <typename TComponent>
+    void Register(std::string_view name, SaveFunction<TComponent> save, LoadFunction<TComponent> load)
+    {
+        static_assert(std::is_default_constructible_v<TComponent>, "TComponent must be default constructible");
+
+        Serializer serializer{.id = GetId(name), .name = std::string(name)};
+        serializer.count = [](const Engine::Core::Registry &registry) -> uint32_t {
+            const auto *storage = registry.storage<TComponent>();
+            return storage == nullptr ? 0 : static_cast<uint32_t>(storage->size());
+        };
+        serializer.countEntities = [](const Engine::Core::Registry &registry,
+                                      std::span<const Engine::EntityId> entities) -> uint32_t {
+            const auto *storage = registry.storage<TComponent>();
+            if (storage == nullptr)
+                return 0;
+            const auto count = std::ranges::count_if(
+                entities, [storage](Engine::EntityId entity) { return storage->contains(entity); });
+            return static_cast<uint32_t>(count);
+        };
+        serializer.saveEntities = [save](const Engine::Core::Registry &registry,
+                                         std::span<const Engine::EntityId> entities, Utils::SnapshotWriter &writer) {
+            const auto *storage = registry.storage<TComponent>();
+            if (storage == nullptr)
+                return;
+            for (auto entity : entities)
+            {
+                if (!storage->contains(entity))
+                    continue;
+                writer.WriteEntity(entity);
+                if constexpr (!std::is_empty_v<TComponent>)
+                    save(writer, storage->get(entity));
+            }
+        };
+        serializer.save = [save = std::move(save)](const Engine::Core::Registry &registry,
+                                                   Utils::SnapshotWriter &writer) {
+            const auto *storage = registry.storage<TComponent>();
+            if (storage == nullptr)
+                return;
+            if constexpr (std::is_empty_v<TComponent>)
+            {
+                for (auto [entity] : storage->each())
+                    writer.WriteEntity(entity);
+            }
+            else
+            {
+                for (auto [entity, component] : storage->each())
+                {
+                    writer.WriteEntity(entity);
+                    save(writer, component);
+                }
+            }
+        };
+        serializer.load = [load = std::move(load)](Engine::Core::Registry &registry, Utils::SnapshotReader &reader,
+                                                   uint32_t count) {
+            std::vector<Engine::Id> entities;
+            std::vector<TComponent> components;
+            entities.reserve(std::min<size_t>(count, BATCH_SIZE));
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                entities.push_back(reader.ReadEntity());
+                if constexpr (!std::is_empty_v<TComponent>)
+                    load(reader, components.emplace_back());
+                if (entities.size() == BATCH_SIZE || i + 1 == count)
+                {
+                    _Insert(registry, entities, components);
+                    entities.clear();
+                    components.clear();
+                }
+            }
+        };
+        _Add(std::move(serializer));
+        _types.insert(entt::type_id<TComponent>().hash());
+    }
+
+    [[nodiscard]] const Serializer *Find(ComponentId id) const
+    {
+        auto it = _indices.find(id);
+        return it == _indices.end() ? nullptr : &_serializers[it->second];
+    }
+
+    /** @brief Whether components of a type are saved, e.g. for the type of a storage of the registry. */
+    [[nodiscard]] bool HasSerializer(const entt::type_info &type) const { return _types.contains(type.hash()); }
+
+    /** @brief Serializers in registration order, which is the order of the sections of a snapshot. */
+    [[nodiscard]] const std::vector<Serializer> &GetSerializers() const { return _serializers; }
+
+  private:
+    template <typename TComponent>
+    static void _Insert(Engine::Core::Registry &registry, const std::vector<Engine::Id> &entities,
+                        std::vector<TComponent> &components)
+    {
+        auto &storage = registry.storage<TComponent>();
+        const bool isFree = std::ranges::none_of(entities, [&storage](Engine::Id entity) {
+            return storage.contains(entity);
+        });
+        // Components already added by the construction signals of other components are replaced one by one.
+        if (!isFree)
+        {
+            for (size_t i = 0; i < entities.size(); ++i)
+            {
+                if constexpr (std::is_empty_v<TComponent>)
+                    registry.emplace_or_replace<TComponent>(entities[i]);
+                else
+                    registry.emplace_or_replace<TComponent>(entities[i], std::move(components[i]));
+            }
+        }
+        else if constexpr (std::is_empty_v<TComponent>)
+            registry.insert<TComponent>(entities.begin(), entities.end());
+        else
+            registry.insert<TComponent>(entities.begin(), entities.end(), components.begin());
+    }
+
+    void _Add(Serializer serializer)
+    {
+        if (serializer.id == Utils::SnapshotFormat::END_SECTION ||
+            serializer.id == Utils::SnapshotFormat::ENTITIES_SECTION)
+            throw SnapshotError(fmt::format("Component name '{}' has a reserved id.", serializer.name));
+
+        auto it = _indices.find(serializer.id);
+        if (it == _indices.end())
+        {
+            _indices.emplace(serializer.id, _serializers.size());
+            _serializers.push_back(std::move(serializer));
+            return;
+        }
+
+        auto &existing = _serializers[it->second];
+        if (existing.name != serializer.name)
+            throw SnapshotError(fmt::format("Component names '{}' and '{}' have the same id.", existing.name,
+                                            serializer.name));
+        Log::Warning(fmt::format("Snapshot serializer of {} already exists, it is replaced", serializer.name));
+        existing = std::move(serializer);
+    }
+
+    std::vector<Serializer> _serializers;
+    std::unordered_map<ComponentId, size_t> _indices;
+    /** @brief Hashes of the registered component types. */
+    std::unordered_set<entt::id_type> _types;
+};
+
+} // namespace Scene::Resource
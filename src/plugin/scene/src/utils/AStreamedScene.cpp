@@ -0,0 +1,47 @@
+#include "utils/AStreamedScene.hpp"
+#include "Logger.hpp"
+#include "exception/SnapshotError.hpp"
+#include "utils/Snapshot.hpp"
+#include <fmt/format.h>
+#include <sstream>
+
+std::unique_ptr<std::istream> Scene::Utils::AStreamedScene::Prepare(const Resource::SnapshotSerializers &serializers)
+{
+    Engine::Core staging;
+    staging.RegisterResource(Resource::SnapshotSerializers(serializers));
+    _onPrepare(staging);
+
+    std::ostringstream stream;
+    SaveSnapshot(staging, stream);
+    return std::make_unique<std::istringstream>(std::move(stream).str());
+}
+
+void Scene::Utils::AStreamedScene::Merge(Engine::Core &core, std::vector<Engine::EntityId> entities)
+{
+    _entities = std::move(entities);
+    _onMerged(core);
+}
+
+void Scene::Utils::AStreamedScene::_onCreate(Engine::Core &core)
+{
+    try
+    {
+        const auto stream = Prepare(core.GetResource<Resource::SnapshotSerializers>());
+        Merge(core, LoadSnapshot(core, *stream, SnapshotLoadMode::Append));
+    }
+    catch (const SnapshotError &e)
+    {
+        Log::Error(fmt::format("Failed to load a streamed scene: {}", e.what()));
+    }
+}
+
+void Scene::Utils::AStreamedScene::_onDestroy(Engine::Core &core)
+{
+    // Entities destroyed while the scene was loaded are already gone.
+    for (auto entity : _entities)
+    {
+        if (entity.IsValid(core))
+            core.KillEntity(entity);
+    }
+    _entities.clear();
+}
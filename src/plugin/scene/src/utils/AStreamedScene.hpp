@@ -0,0 +1,82 @@
+#pragma once
+
+#include "resource/SnapshotSerializers.hpp"
+#include "utils/AScene.hpp"
+#include <istream>
+#include <memory>
+#include <vector>
+
+namespace Scene::Utils {
+
+/**
+ * @brief Scene built away from the live registry, so that the scene manager can prepare it on a worker thread while
+ * the current scene keeps running, then merge it into the registry over several frames (see
+ * Resource::SceneManager::SetMergeBudget).
+ *
+ * The entities are created by _onPrepare in a staging core, which is encoded as a snapshot: only the components with
+ * a serializer in Resource::SnapshotSerializers are merged. Files can be read and decoded in _onPrepare too; what
+ * must be done on the main thread with the decoded data (e.g. GPU uploads) belongs in _onMerged. The staging core
+ * may create component storages while the live one does too, which is why the engine builds EnTT with
+ * ENTT_USE_ATOMIC.
+ *
+ * Loading the scene without the scene manager prepares and merges it at once.
+ *
+ * @example "Streaming a generated level"
+ * @code
+ * class Forest : public Scene::Utils::AStreamedScene {
+ *   protected:
+ *     void _onPrepare(Engine::Core &staging) override
+ *     {
+ *         for (int i = 0; i < 100000; ++i)
+ *             staging.CreateEntity().AddComponent<Tree>(RandomPosition());
+ *     }
+ * };
+ *
+ * sceneManager.RegisterScene<Forest>("forest");
+ * sceneManager.SetNextScene("forest");
+ * @endcode
+ */
+class AStreamedScene : public AScene {
+  public:
+    AStreamedScene(void) = default;
+    ~AStreamedScene() override = default;
+
+    /**
+     * @brief Build the scene and encode it as a snapshot. Called on a worker thread: it must not access the live core.
+     *
+     * The staging core is encoded in memory. Scenes already stored as a snapshot return a stream reading it instead
+     * (e.g. a file, see SnapshotScene), so that it is never held in memory as a whole.
+     *
+     * @param serializers  serializers of the live core, the snapshot is loaded with them
+     * @return the stream of the snapshot, read by a Utils::SnapshotLoader on the main thread while it is merged
+     * @throw SnapshotError if the scene cannot be built.
+     */
+    [[nodiscard]] virtual std::unique_ptr<std::istream> Prepare(const Resource::SnapshotSerializers &serializers);
+
+    /**
+     * @brief Take ownership of the merged entities, destroyed when the scene is unloaded, and finish the scene.
+     */
+    void Merge(Engine::Core &core, std::vector<Engine::EntityId> entities);
+
+    /** @brief Entities created by the last load, until the scene is unloaded. */
+    [[nodiscard]] const std::vector<Engine::EntityId> &GetEntities() const { return _entities; }
+
+  protected:
+    /**
+     * @brief Create the entities of the scene in the staging core, on the thread calling Prepare.
+     */
+    virtual void _onPrepare(Engine::Core &staging) { (void) staging; }
+
+    /**
+     * @brief Called on the main thread once the entities of the scene are in the registry.
+     */
+    virtual void _onMerged(Engine::Core &core) { (void) core; }
+
+    void _onCreate(Engine::Core &core) override;
+    void _onDestroy(Engine::Core &core) override;
+
+  private:
+    std::vector<Engine::EntityId> _entities;
+};
+
+} // namespace Scene::Utils
@@ -0,0 +1,198 @@
+#include "utils/Snapshot.hpp"
+#include "Logger.hpp"
+#include "exception/SnapshotError.hpp"
+#include "resource/SnapshotSerializers.hpp"
+#include "utils/SnapshotArchive.hpp"
+#include <algorithm>
+#include <fmt/format.h>
+#include <fstream>
+#include <limits>
+#include <unordered_set>
+#include <utility>
+
+namespace Scene::Utils {
+
+static void LoadEntities(Engine::Core::Registry &registry, SnapshotReader &reader, uint32_t count,
+                         SnapshotLoadMode mode, std::vector<Engine::EntityId> &loaded)
+{
+    std::vector<Engine::Id::ValueType> saved;
+    std::vector<Engine::Id> created;
+    saved.reserve(std::min<size_t>(count, Resource::SnapshotSerializers::BATCH_SIZE));
+    for (uint32_t first = 0; first < count; first += static_cast<uint32_t>(saved.size()))
+    {
+        saved.resize(std::min<size_t>(count - first, Resource::SnapshotSerializers::BATCH_SIZE));
+        reader.ReadBytes(saved.data(), saved.size() * sizeof(Engine::Id::ValueType));
+
+        created.resize(saved.size());
+        if (mode == SnapshotLoadMode::Replace)
+        {
+            // The saved ids are free after the registry is cleared, so references outside the registry stay valid.
+            for (size_t i = 0; i < saved.size(); ++i)
+                created[i] = registry.create(Engine::Id(saved[i]));
+        }
+        else
+        {
+            registry.create(created.begin(), created.end());
+        }
+
+        for (size_t i = 0; i < saved.size(); ++i)
+        {
+            reader.MapEntity(saved[i], created[i]);
+            loaded.emplace_back(created[i]);
+        }
+    }
+}
+
+void SaveSnapshot(Engine::Core &core, std::ostream &stream)
+{
+    const auto &registry = std::as_const(core).GetRegistry();
+    const auto &serializers = core.GetResource<Resource::SnapshotSerializers>();
+    SnapshotWriter writer(stream);
+
+    const auto *entities = registry.storage<Engine::Id>();
+    uint32_t entityCount = 0;
+    for (auto [entity] : entities->each())
+    {
+        (void) entity;
+        ++entityCount;
+    }
+    writer.BeginSection(SnapshotFormat::ENTITIES_SECTION, entityCount);
+    for (auto [entity] : entities->each())
+        writer.WriteEntity(entity);
+    writer.EndSection();
+
+    for (const auto &serializer : serializers.GetSerializers())
+    {
+        const uint32_t count = serializer.count(registry);
+        if (count == 0)
+            continue;
+        writer.BeginSection(serializer.id, count);
+        serializer.save(registry, writer);
+        writer.EndSection();
+    }
+    writer.Finish();
+}
+
+void SaveSnapshot(Engine::Core &core, const std::filesystem::path &path)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file)
+        throw SnapshotError(fmt::format("Cannot open '{}' to write a snapshot.", path.string()));
+    SaveSnapshot(core, file);
+}
+
+void SaveSnapshot(Engine::Core &core, std::ostream &stream, std::span<const Engine::EntityId> entities)
+{
+    const auto &registry = std::as_const(core).GetRegistry();
+    const auto &serializers = core.GetResource<Resource::SnapshotSerializers>();
+    std::unordered_set<Engine::Id::ValueType> saved;
+    saved.reserve(entities.size());
+    for (auto entity : entities)
+        saved.insert(static_cast<Engine::Id::ValueType>(entity));
+
+    SnapshotWriter writer(stream);
+    writer.SetSavedEntities(&saved);
+    writer.BeginSection(SnapshotFormat::ENTITIES_SECTION, static_cast<uint32_t>(entities.size()));
+    for (auto entity : entities)
+        writer.WriteEntity(entity);
+    writer.EndSection();
+
+    for (const auto &serializer : serializers.GetSerializers())
+    {
+        const uint32_t count = serializer.countEntities(registry, entities);
+        if (count == 0)
+            continue;
+        writer.BeginSection(serializer.id, count);
+        serializer.saveEntities(registry, entities, writer);
+        writer.EndSection();
+    }
+    writer.Finish();
+}
+
+SnapshotLoader::SnapshotLoader(std::istream &stream, SnapshotLoadMode mode) : _reader(stream), _mode(mode) {}
+
+bool SnapshotLoader::Load(Engine::Core &core, size_t maxRecords)
+{
+    auto &registry = core.GetRegistry();
+    const auto &serializers = core.GetResource<Resource::SnapshotSerializers>();
+
+    if (!_isStarted && _mode == SnapshotLoadMode::Replace)
+        registry.clear();
+    _isStarted = true;
+
+    try
+    {
+        while (!_isDone && maxRecords > 0)
+        {
+            if (!_section.has_value())
+            {
+                _section = _reader.NextSection();
+                if (!_section.has_value())
+                {
+                    _isDone = true;
+                    break;
+                }
+                if (_section->id != SnapshotFormat::ENTITIES_SECTION && serializers.Find(_section->id) == nullptr)
+                {
+                    Log::Warning(fmt::format("Snapshot: {} components of unknown id {} are skipped, their serializer "
+                                             "is not registered.",
+                                             _section->count, _section->id));
+                    _reader.SkipSection();
+                    _section.reset();
+                    continue;
+                }
+            }
+
+            // Sections are read record by record, so a section can be left and resumed on the next call.
+            const auto count = static_cast<uint32_t>(std::min<size_t>(_section->count, maxRecords));
+            if (_section->id == SnapshotFormat::ENTITIES_SECTION)
+                LoadEntities(registry, _reader, count, _mode, _entities);
+            else
+                serializers.Find(_section->id)->load(registry, _reader, count);
+            _section->count -= count;
+            maxRecords -= count;
+            if (_section->count == 0)
+            {
+                _reader.EndSection();
+                _section.reset();
+            }
+        }
+    }
+    catch (...)
+    {
+        // Serializers may throw anything, the scene is never left half loaded.
+        Rollback(core);
+        throw;
+    }
+    return _isDone;
+}
+
+void SnapshotLoader::Rollback(Engine::Core &core)
+{
+    auto &registry = core.GetRegistry();
+    for (auto entity : _entities)
+    {
+        if (registry.valid(entity))
+            registry.destroy(entity);
+    }
+    _entities.clear();
+    _isDone = true;
+}
+
+std::vector<Engine::EntityId> LoadSnapshot(Engine::Core &core, std::istream &stream, SnapshotLoadMode mode)
+{
+    SnapshotLoader loader(stream, mode);
+    loader.Load(core, std::numeric_limits<size_t>::max());
+    return loader.GetEntities();
+}
+
+std::vector<Engine::EntityId> LoadSnapshot(Engine::Core &core, const std::filesystem::path &path,
+                                           SnapshotLoadMode mode)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        throw SnapshotError(fmt::format("Cannot open snapshot '{}'.", path.string()));
+    return LoadSnapshot(core, file, mode);
+}
+
+} // namespace Scene::Utils
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Engine.hpp"
+#include "utils/SnapshotArchive.hpp"
+#include <filesystem>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <vector>
+
+namespace Scene::Utils {
+
+enum class SnapshotLoadMode {
+    /** @brief Destroy every entity first, then recreate the saved ones with their saved ids when possible. */
+    Replace,
+    /** @brief Create the saved entities next to the existing ones, e.g. to load a level. */
+    Append
+};
+
+/**
+ * @brief Loads a snapshot written by SaveSnapshot a few records at a time, a record being an entity or one of its
+ * components, so that a large snapshot can be merged into the registry over several frames.
+ *
+ * Entities referenced by components are remapped to the loaded ones. Components without serializer in
+ * Resource::SnapshotSerializers are skipped with a warning.
+ *
+ * @note The stream must outlive the loader.
+ *
+ * @example "Loading a snapshot over several frames"
+ * @code
+ * Scene::Utils::SnapshotLoader loader(stream);
+ * core.RegisterSystem([&loader](Engine::Core &core) {
+ *     if (!loader.IsDone())
+ *         loader.Load(core, 4096);
+ * });
+ * @endcode
+ */
+class SnapshotLoader {
+  public:
+    /**
+     * @throw SnapshotError if the stream does not start with a snapshot header of a supported version.
+     */
+    explicit SnapshotLoader(std::istream &stream, SnapshotLoadMode mode = SnapshotLoadMode::Append);
+
+    /**
+     * @brief Load the next records of the snapshot. In Replace mode, the registry is cleared by the first call.
+     *
+     * @param maxRecords  maximum number of entities and components to load
+     * @return true once the whole snapshot is loaded
+     * @throw SnapshotError if the snapshot is invalid. The entities loaded so far are destroyed, whatever a
+     * serializer throws.
+     */
+    bool Load(Engine::Core &core, size_t maxRecords);
+
+    /**
+     * @brief Destroy the entities loaded so far, e.g. to cancel a load. Nothing more is loaded afterwards.
+     */
+    void Rollback(Engine::Core &core);
+
+    [[nodiscard]] bool IsDone() const { return _isDone; }
+
+    /** @brief Entities created so far, in the order of the snapshot. */
+    [[nodiscard]] const std::vector<Engine::EntityId> &GetEntities() const { return _entities; }
+
+  private:
+    SnapshotReader _reader;
+    SnapshotLoadMode _mode;
+    /** @brief Section being loaded, with its number of records left. */
+    std::optional<SnapshotReader::Section> _section;
+    bool _isStarted = false;
+    bool _isDone = false;
+    std::vector<Engine::EntityId> _entities;
+};
+
+/**
+ * @brief Write every entity, and those of its components that have a serializer in
+ * Resource::SnapshotSerializers, to a stream. Components are written as they are iterated, without being copied.
+ *
+ * @throw SnapshotError if the stream fails.
+ */
+void SaveSnapshot(Engine::Core &core, std::ostream &stream);
+
+/**
+ * @throw SnapshotError if the file cannot be written.
+ */
+void SaveSnapshot(Engine::Core &core, const std::filesystem::path &path);
+
+/**
+ * @brief Write some entities only, e.g. to unload a part of the world. References to other entities are saved as null
+ * entities.
+ *
+ * @throw SnapshotError if the stream fails.
+ */
+void SaveSnapshot(Engine::Core &core, std::ostream &stream, std::span<const Engine::EntityId> entities);
+
+/**
+ * @brief Read a snapshot written by SaveSnapshot at once, see SnapshotLoader. Entities are created and components
+ * added by batches, while the stream is read.
+ *
+ * @return the loaded entities
+ * @throw SnapshotError if the snapshot is invalid. The entities loaded so far are destroyed.
+ */
+std::vector<Engine::EntityId> LoadSnapshot(Engine::Core &core, std::istream &stream,
+                                           SnapshotLoadMode mode = SnapshotLoadMode::Append);
+
+/**
+ * @throw SnapshotError if the file cannot be read or is invalid.
+ */
+std::vector<Engine::EntityId> LoadSnapshot(Engine::Core &core, const std::filesystem::path &path,
+                                           SnapshotLoadMode mode = SnapshotLoadMode::Append);
+
+} // namespace Scene::Utils
@@ -0,0 +1,208 @@
+#include "utils/SnapshotArchive.hpp"
+#include "exception/SnapshotError.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fmt/format.h>
+
+namespace Scene::Utils {
+
+SnapshotWriter::SnapshotWriter(std::ostream &stream) : _stream(stream)
+{
+    _chunk.reserve(SnapshotFormat::CHUNK_SIZE);
+    _WriteRaw(&SnapshotFormat::MAGIC, sizeof(SnapshotFormat::MAGIC));
+    _WriteRaw(&SnapshotFormat::VERSION, sizeof(SnapshotFormat::VERSION));
+}
+
+void SnapshotWriter::BeginSection(SnapshotSectionId id, uint32_t count)
+{
+    if (_isInSection)
+        throw SnapshotError(fmt::format("Cannot begin section {} before the previous one is ended.", id));
+    if (id == SnapshotFormat::END_SECTION)
+        throw SnapshotError(fmt::format("Section id {} is reserved for the end of the snapshot.", id));
+
+    _WriteRaw(&id, sizeof(id));
+    _WriteRaw(&count, sizeof(count));
+    _isInSection = true;
+}
+
+void SnapshotWriter::EndSection()
+{
+    if (!_isInSection)
+        throw SnapshotError("Cannot end a section that was not begun.");
+
+    _FlushChunk();
+    const uint32_t end = 0;
+    _WriteRaw(&end, sizeof(end));
+    _isInSection = false;
+}
+
+void SnapshotWriter::Finish()
+{
+    if (_isInSection)
+        EndSection();
+
+    const SnapshotSectionId end = SnapshotFormat::END_SECTION;
+    const uint32_t count = 0;
+    _WriteRaw(&end, sizeof(end));
+    _WriteRaw(&count, sizeof(count));
+    _stream.flush();
+    if (!_stream)
+        throw SnapshotError("Failed to write the snapshot to its stream.");
+}
+
+void SnapshotWriter::WriteBytes(const void *data, size_t size)
+{
+    if (!_isInSection)
+        throw SnapshotError("Records must be written inside a section.");
+
+    const auto *bytes = static_cast<const char *>(data);
+    while (size > 0)
+    {
+        const size_t written = std::min<size_t>(size, SnapshotFormat::CHUNK_SIZE - _chunk.size());
+        _chunk.insert(_chunk.end(), bytes, bytes + written);
+        bytes += written;
+        size -= written;
+        if (_chunk.size() == SnapshotFormat::CHUNK_SIZE)
+            _FlushChunk();
+    }
+}
+
+void SnapshotWriter::WriteString(std::string_view string)
+{
+    Write(static_cast<uint32_t>(string.size()));
+    WriteBytes(string.data(), string.size());
+}
+
+void SnapshotWriter::_WriteRaw(const void *data, size_t size)
+{
+    _stream.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+    if (!_stream)
+        throw SnapshotError("Failed to write the snapshot to its stream.");
+}
+
+void SnapshotWriter::_FlushChunk()
+{
+    if (_chunk.empty())
+        return;
+    const auto size = static_cast<uint32_t>(_chunk.size());
+    _WriteRaw(&size, sizeof(size));
+    _WriteRaw(_chunk.data(), _chunk.size());
+    _chunk.clear();
+}
+
+SnapshotReader::SnapshotReader(std::istream &stream) : _stream(stream)
+{
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    _ReadRaw(&magic, sizeof(magic));
+    _ReadRaw(&version, sizeof(version));
+    if (magic != SnapshotFormat::MAGIC)
+        throw SnapshotError("The stream does not contain a snapshot.");
+    if (version != SnapshotFormat::VERSION)
+        throw SnapshotError(fmt::format("Unsupported snapshot version {}, expected {}.", version,
+                                        SnapshotFormat::VERSION));
+}
+
+std::optional<SnapshotReader::Section> SnapshotReader::NextSection()
+{
+    if (_isInSection)
+        throw SnapshotError("Cannot read the next section before the current one is ended.");
+
+    Section section{};
+    _ReadRaw(&section.id, sizeof(section.id));
+    _ReadRaw(&section.count, sizeof(section.count));
+    if (section.id == SnapshotFormat::END_SECTION)
+        return std::nullopt;
+
+    _chunk.clear();
+    _offset = 0;
+    _isInSection = true;
+    _isSectionEnded = false;
+    return section;
+}
+
+void SnapshotReader::EndSection()
+{
+    if (!_isInSection)
+        throw SnapshotError("Cannot end a section that was not begun.");
+
+    // Unread chunks are discarded without being kept in memory.
+    while (!_isSectionEnded)
+    {
+        uint32_t size = 0;
+        _ReadRaw(&size, sizeof(size));
+        if (size == 0)
+        {
+            _isSectionEnded = true;
+            break;
+        }
+        _stream.ignore(size);
+        if (_stream.gcount() != static_cast<std::streamsize>(size))
+            throw SnapshotError("The snapshot is truncated.");
+    }
+    _chunk.clear();
+    _offset = 0;
+    _isInSection = false;
+}
+
+void SnapshotReader::ReadBytes(void *data, size_t size)
+{
+    if (!_isInSection)
+        throw SnapshotError("Records must be read inside a section.");
+
+    auto *bytes = static_cast<char *>(data);
+    while (size > 0)
+    {
+        if (_offset == _chunk.size() && (_isSectionEnded || !_NextChunk()))
+            throw SnapshotError("A section of the snapshot has less data than its records need.");
+        const size_t read = std::min(size, _chunk.size() - _offset);
+        std::memcpy(bytes, _chunk.data() + _offset, read);
+        _offset += read;
+        bytes += read;
+        size -= read;
+    }
+}
+
+std::string SnapshotReader::ReadString()
+{
+    std::string string(Read<uint32_t>(), '\0');
+    ReadBytes(string.data(), string.size());
+    return string;
+}
+
+Engine::EntityId SnapshotReader::GetEntity(Engine::Id::ValueType saved) const
+{
+    if (saved == Engine::Id::NullValue())
+        return Engine::EntityId::Null();
+    auto it = _entities.find(saved);
+    if (it == _entities.end())
+        throw SnapshotError(fmt::format("Entity {} is referenced but not part of the snapshot.", saved));
+    return it->second;
+}
+
+void SnapshotReader::_ReadRaw(void *data, size_t size)
+{
+    _stream.read(static_cast<char *>(data), static_cast<std::streamsize>(size));
+    if (_stream.gcount() != static_cast<std::streamsize>(size))
+        throw SnapshotError("The snapshot is truncated.");
+}
+
+bool SnapshotReader::_NextChunk()
+{
+    uint32_t size = 0;
+    _ReadRaw(&size, sizeof(size));
+    if (size == 0)
+    {
+        // The end of the section is consumed, EndSection must not look for it again.
+        _isSectionEnded = true;
+        return false;
+    }
+    if (size > SnapshotFormat::CHUNK_SIZE)
+        throw SnapshotError(fmt::format("Invalid chunk of {} bytes in the snapshot.", size));
+    _chunk.resize(size);
+    _offset = 0;
+    _ReadRaw(_chunk.data(), size);
+    return true;
+}
+
+} // namespace Scene::Utils
@@ -0,0 +1,182 @@
+#pragma once
+
+#include "Engine.hpp"
+#include <cstdint>
+#include <entt/core/hashed_string.hpp>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace Scene::Utils {
+
+/** @brief Identifies the content of a section of a snapshot, see Resource::SnapshotSerializers::GetId. */
+using SnapshotSectionId = entt::id_type;
+
+/**
+ * @brief Binary layout shared by SnapshotWriter and SnapshotReader.
+ *
+ * A snapshot is a header followed by sections, each made of a section id, a number of records, and the records split
+ * in chunks of at most CHUNK_SIZE bytes. An empty chunk ends a section, so a reader can skip the sections it does not
+ * know without understanding their records, and neither side ever holds more than one chunk in memory.
+ *
+ * Values are written in the byte order of the machine, snapshots are not meant to be shared between architectures.
+ */
+struct SnapshotFormat {
+    static inline constexpr uint32_t MAGIC = 0x4E533245; // "E2SN"
+    static inline constexpr uint32_t VERSION = 1;
+    static inline constexpr uint32_t CHUNK_SIZE = 64 * 1024;
+    /** @brief Section id ending the snapshot. */
+    static inline constexpr SnapshotSectionId END_SECTION = 0;
+    /** @brief Section listing the saved entities, before any component. */
+    static inline constexpr SnapshotSectionId ENTITIES_SECTION = entt::hashed_string::value("Scene::Entities");
+};
+
+/**
+ * @brief Writes a snapshot to a stream, one chunk at a time.
+ */
+class SnapshotWriter {
+  public:
+    explicit SnapshotWriter(std::ostream &stream);
+
+    /**
+     * @brief Start a section. The previous section must be ended.
+     *
+     * @param id        id of the content of the section, never SnapshotFormat::END_SECTION
+     * @param count     number of records the section holds
+     */
+    void BeginSection(SnapshotSectionId id, uint32_t count);
+
+    /**
+     * @brief End the current section, flushing its last chunk.
+     */
+    void EndSection();
+
+    /**
+     * @brief End the snapshot and flush the stream.
+     *
+     * @throw SnapshotError if the stream failed.
+     */
+    void Finish();
+
+    void WriteBytes(const void *data, size_t size);
+
+    template <typename TValue> void Write(const TValue &value)
+    {
+        static_assert(std::is_trivially_copyable_v<TValue>, "TValue must be trivially copyable");
+        WriteBytes(&value, sizeof(TValue));
+    }
+
+    /**
+     * @brief Write a reference to an entity, remapped when the snapshot is loaded. References to entities that are
+     * not saved are written as null entities.
+     */
+    void WriteEntity(Engine::EntityId entity)
+    {
+        auto value = static_cast<Engine::Id::ValueType>(entity);
+        if (_savedEntities != nullptr && !_savedEntities->contains(value))
+            value = Engine::Id::NullValue();
+        Write(value);
+    }
+
+    /**
+     * @brief Restrict the entities written by WriteEntity, when only some entities of the registry are saved.
+     *
+     * @param entities  saved entities, which must outlive the writer, or nullptr if every entity is saved
+     */
+    void SetSavedEntities(const std::unordered_set<Engine::Id::ValueType> *entities) { _savedEntities = entities; }
+
+    void WriteString(std::string_view string);
+
+  private:
+    void _WriteRaw(const void *data, size_t size);
+    void _FlushChunk();
+
+    std::ostream &_stream;
+    std::vector<char> _chunk;
+    bool _isInSection = false;
+    const std::unordered_set<Engine::Id::ValueType> *_savedEntities = nullptr;
+};
+
+/**
+ * @brief Reads a snapshot from a stream, one chunk at a time, and maps the saved entities to the loaded ones.
+ */
+class SnapshotReader {
+  public:
+    struct Section {
+        SnapshotSectionId id;
+        uint32_t count;
+    };
+
+    /**
+     * @throw SnapshotError if the stream does not start with a snapshot header of a supported version.
+     */
+    explicit SnapshotReader(std::istream &stream);
+
+    /**
+     * @brief Start the next section. The previous one must be ended or skipped.
+     *
+     * @return the section, or nullopt at the end of the snapshot
+     */
+    std::optional<Section> NextSection();
+
+    /**
+     * @brief End the current section, skipping the records that were not read.
+     */
+    void EndSection();
+
+    /**
+     * @brief Skip the records of the current section.
+     */
+    void SkipSection() { EndSection(); }
+
+    /**
+     * @throw SnapshotError if the section has less bytes left than requested.
+     */
+    void ReadBytes(void *data, size_t size);
+
+    template <typename TValue> TValue Read()
+    {
+        static_assert(std::is_trivially_copyable_v<TValue>, "TValue must be trivially copyable");
+        TValue value;
+        ReadBytes(&value, sizeof(TValue));
+        return value;
+    }
+
+    /**
+     * @brief Read a reference to an entity written by SnapshotWriter::WriteEntity.
+     *
+     * @return the loaded entity the saved one maps to, or a null entity if the saved one was null
+     * @throw SnapshotError if the entity is not part of the snapshot.
+     */
+    Engine::EntityId ReadEntity() { return GetEntity(Read<Engine::Id::ValueType>()); }
+
+    std::string ReadString();
+
+    void MapEntity(Engine::Id::ValueType saved, Engine::EntityId loaded) { _entities[saved] = loaded; }
+
+    /**
+     * @throw SnapshotError if the entity is not part of the snapshot.
+     */
+    [[nodiscard]] Engine::EntityId GetEntity(Engine::Id::ValueType saved) const;
+
+  private:
+    void _ReadRaw(void *data, size_t size);
+    /** @brief Load the next chunk of the section, false at its end. */
+    bool _NextChunk();
+
+    std::istream &_stream;
+    std::vector<char> _chunk;
+    size_t _offset = 0;
+    bool _isInSection = false;
+    /** @brief Whether the empty chunk ending the current section was read. */
+    bool _isSectionEnded = false;
+    std::unordered_map<Engine::Id::ValueType, Engine::EntityId> _entities;
+};
+
+} // namespace Scene::Utils
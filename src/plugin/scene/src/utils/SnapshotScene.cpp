@@ -0,0 +1,12 @@
+#include "utils/SnapshotScene.hpp"
+#include "exception/SnapshotError.hpp"
+#include <fmt/format.h>
+#include <fstream>
+
+std::unique_ptr<std::istream> Scene::Utils::SnapshotScene::Prepare(const Resource::SnapshotSerializers &)
+{
+    auto file = std::make_unique<std::ifstream>(_path, std::ios::binary);
+    if (!*file)
+        throw SnapshotError(fmt::format("Cannot open snapshot '{}'.", _path.string()));
+    return file;
+}
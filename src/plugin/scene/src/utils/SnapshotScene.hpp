@@ -0,0 +1,38 @@
+#pragma once
+
+#include "utils/AStreamedScene.hpp"
+#include <filesystem>
+
+namespace Scene::Utils {
+
+/**
+ * @brief Scene loaded from a snapshot file (see SaveSnapshot) instead of being built by code. The scene manager reads
+ * the file on a worker thread and merges it over several frames. Unloading the scene destroys the entities it loaded.
+ *
+ * @example "Loading a level saved as a snapshot"
+ * @code
+ * auto &sceneManager = core.GetResource<Scene::Resource::SceneManager>();
+ * sceneManager.RegisterScene<Scene::Utils::SnapshotScene>("level1").SetPath("assets/level1.snapshot");
+ * sceneManager.SetNextScene("level1");
+ * @endcode
+ */
+class SnapshotScene : public AStreamedScene {
+  public:
+    SnapshotScene(void) = default;
+    ~SnapshotScene() override = default;
+
+    void SetPath(const std::filesystem::path &path) { _path = path; }
+    [[nodiscard]] const std::filesystem::path &GetPath() const { return _path; }
+
+    /**
+     * @brief Open the file, which already is a snapshot. It is read while the scene is merged, not loaded in memory.
+     *
+     * @throw SnapshotError if the file cannot be opened.
+     */
+    [[nodiscard]] std::unique_ptr<std::istream> Prepare(const Resource::SnapshotSerializers &serializers) override;
+
+  private:
+    std::filesystem::path _path;
+};
+
+} // namespace Scene::Utils
@@ -0,0 +1,206 @@
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Engine.hpp"
+
+#include "Scene.hpp"
+#include "resource/EventManager.hpp"
+
+using namespace Scene;
+
+namespace {
+struct Position {
+    float x = 0;
+    float y = 0;
+};
+
+/**
+ * Streamed scene of entities with a position, whose preparation waits for the test to release it if it is gated.
+ */
+class GridScene : public Utils::AStreamedScene {
+  public:
+    int size = 10;
+    std::shared_future<void> gate;
+    bool isFailing = false;
+    int mergeCount = 0;
+
+  protected:
+    void _onPrepare(Engine::Core &staging) override
+    {
+        if (gate.valid())
+            gate.wait();
+        if (isFailing)
+            throw SnapshotError("cannot build the grid");
+        for (int i = 0; i < size; ++i)
+            staging.CreateEntity().AddComponent<Position>(Position{.x = static_cast<float>(i)});
+    }
+
+    void _onMerged(Engine::Core &) override { ++mergeCount; }
+};
+
+struct Events {
+    std::vector<std::string> loaded;
+    std::vector<std::string> unloaded;
+    std::vector<std::string> failed;
+    std::vector<float> progress;
+};
+
+void SetUpCore(Engine::Core &core, Events &events)
+{
+    core.AddPlugins<Scene::Plugin>();
+    core.GetResource<Resource::SnapshotSerializers>().Register<Position>("Test::Position");
+
+    auto &eventManager = core.GetResource<::Event::Resource::EventManager>();
+    eventManager.RegisterCallback<Scene::Event::SceneLoadedEvent>(
+        [&events](const Scene::Event::SceneLoadedEvent &event) { events.loaded.push_back(event.name); });
+    eventManager.RegisterCallback<Scene::Event::SceneUnloadedEvent>(
+        [&events](const Scene::Event::SceneUnloadedEvent &event) { events.unloaded.push_back(event.name); });
+    eventManager.RegisterCallback<Scene::Event::SceneLoadFailedEvent>(
+        [&events](const Scene::Event::SceneLoadFailedEvent &event) { events.failed.push_back(event.name); });
+    eventManager.RegisterCallback<Scene::Event::SceneLoadProgressEvent>(
+        [&events](const Scene::Event::SceneLoadProgressEvent &event) { events.progress.push_back(event.progress); });
+}
+
+size_t CountPositions(Engine::Core &core) { return core.GetRegistry().view<Position>().size(); }
+
+void RunUntilLoaded(Engine::Core &core)
+{
+    while (core.GetResource<Resource::SceneManager>().IsLoading())
+        core.RunSystems();
+}
+} // namespace
+
+TEST(SceneStreaming, CurrentSceneRunsUntilTheNextOneIsPrepared)
+{
+    Engine::Core core;
+    Events events;
+    SetUpCore(core, events);
+    auto &sceneManager = core.GetResource<Resource::SceneManager>();
+    sceneManager.SetMergeBudget({.records = 1000, .time = std::chrono::hours(1)});
+
+    auto &first = sceneManager.RegisterScene<GridScene>("first");
+    auto &second = sceneManager.RegisterScene<GridScene>("second");
+    second.size = 5000;
+    std::promise<void> release;
+    second.gate = release.get_future().share();
+
+    sceneManager.SetNextScene("first");
+    RunUntilLoaded(core);
+    ASSERT_EQ(sceneManager.GetCurrentScene(), "first");
+    ASSERT_EQ(first.GetEntities().size(), 10u);
+    EXPECT_EQ(first.mergeCount, 1);
+
+    sceneManager.SetNextScene("second");
+    for (int i = 0; i < 3; ++i)
+        core.RunSystems();
+    EXPECT_TRUE(sceneManager.IsLoading());
+    EXPECT_EQ(sceneManager.GetCurrentScene(), "first");
+    EXPECT_EQ(CountPositions(core), 10u);
+
+    events.progress.clear();
+    release.set_value();
+    size_t previous = 0;
+    while (sceneManager.IsLoading())
+    {
+        core.RunSystems();
+        const size_t count = CountPositions(core);
+        // 1000 records per frame: entities first, then their positions.
+        ASSERT_LE(count, previous + 1000);
+        previous = count;
+    }
+
+    EXPECT_EQ(sceneManager.GetCurrentScene(), "second");
+    EXPECT_EQ(CountPositions(core), 5000u);
+    EXPECT_EQ(second.GetEntities().size(), 5000u);
+    EXPECT_TRUE(first.GetEntities().empty());
+    EXPECT_EQ(events.loaded, (std::vector<std::string>{"first", "second"}));
+    EXPECT_EQ(events.unloaded, (std::vector<std::string>{"first"}));
+    // 5000 entities and 5000 positions, merged over at least 10 frames.
+    EXPECT_GE(events.progress.size(), 10u);
+    EXPECT_TRUE(std::ranges::is_sorted(events.progress));
+    EXPECT_EQ(events.progress.back(), 1.0f);
+}
+
+TEST(SceneStreaming, AdditiveScenesAreLoadedAndUnloaded)
+{
+    Engine::Core core;
+    Events events;
+    SetUpCore(core, events);
+    auto &sceneManager = core.GetResource<Resource::SceneManager>();
+
+    sceneManager.RegisterScene<GridScene>("level");
+    auto &chunk0 = sceneManager.RegisterScene<GridScene>("chunk0");
+    auto &chunk1 = sceneManager.RegisterScene<GridScene>("chunk1");
+    chunk0.size = 100;
+    chunk1.size = 200;
+
+    sceneManager.SetNextScene("level");
+    sceneManager.LoadSceneAdditive("chunk0");
+    sceneManager.LoadSceneAdditive("chunk1");
+    RunUntilLoaded(core);
+    EXPECT_EQ(sceneManager.GetCurrentScene(), "level");
+    EXPECT_EQ(sceneManager.GetAdditiveScenes().size(), 2u);
+    EXPECT_EQ(CountPositions(core), 310u);
+
+    // Loading a chunk again is ignored.
+    sceneManager.LoadSceneAdditive("chunk1");
+    RunUntilLoaded(core);
+    EXPECT_EQ(CountPositions(core), 310u);
+
+    sceneManager.UnloadScene("chunk0");
+    core.RunSystems();
+    EXPECT_EQ(sceneManager.GetAdditiveScenes(), (std::vector<std::string>{"chunk1"}));
+    EXPECT_EQ(CountPositions(core), 210u);
+    EXPECT_TRUE(chunk0.GetEntities().empty());
+    EXPECT_EQ(chunk1.GetEntities().size(), 200u);
+}
+
+TEST(SceneStreaming, UnloadingAStreamingSceneCancelsIt)
+{
+    Engine::Core core;
+    Events events;
+    SetUpCore(core, events);
+    auto &sceneManager = core.GetResource<Resource::SceneManager>();
+
+    auto &chunk = sceneManager.RegisterScene<GridScene>("chunk");
+    chunk.size = 1000;
+    std::promise<void> release;
+    chunk.gate = release.get_future().share();
+
+    sceneManager.LoadSceneAdditive("chunk");
+    core.RunSystems();
+    sceneManager.UnloadScene("chunk");
+    core.RunSystems();
+    release.set_value();
+    RunUntilLoaded(core);
+
+    EXPECT_TRUE(sceneManager.GetAdditiveScenes().empty());
+    EXPECT_EQ(CountPositions(core), 0u);
+    EXPECT_EQ(chunk.mergeCount, 0);
+    EXPECT_TRUE(events.loaded.empty());
+}
+
+TEST(SceneStreaming, FailedSceneKeepsTheCurrentOne)
+{
+    Engine::Core core;
+    Events events;
+    SetUpCore(core, events);
+    auto &sceneManager = core.GetResource<Resource::SceneManager>();
+
+    sceneManager.RegisterScene<GridScene>("level");
+    sceneManager.RegisterScene<GridScene>("broken").isFailing = true;
+
+    sceneManager.SetNextScene("level");
+    RunUntilLoaded(core);
+    sceneManager.SetNextScene("broken");
+    RunUntilLoaded(core);
+
+    EXPECT_EQ(sceneManager.GetCurrentScene(), "level");
+    EXPECT_EQ(CountPositions(core), 10u);
+    EXPECT_EQ(events.failed, (std::vector<std::string>{"broken"}));
+}
@@ -0,0 +1,311 @@
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Engine.hpp"
+
+#include "Scene.hpp"
+
+using namespace Scene;
+
+namespace {
+struct Position {
+    float x = 0;
+    float y = 0;
+};
+
+struct Name {
+    std::string value;
+};
+
+struct Target {
+    Engine::EntityId entity;
+};
+
+struct Tag {};
+
+class EmptyScene : public Utils::AScene {
+  protected:
+    void _onCreate(Engine::Core &) final {}
+    void _onDestroy(Engine::Core &) final {}
+};
+
+void RegisterSerializers(Engine::Core &core, bool withName = true)
+{
+    auto &serializers = core.RegisterResource(Resource::SnapshotSerializers());
+    serializers.Register<Position>("Test::Position");
+    serializers.Register<Tag>("Test::Tag");
+    serializers.Register<Target>(
+        "Test::Target", [](Utils::SnapshotWriter &writer, const Target &target) { writer.WriteEntity(target.entity); },
+        [](Utils::SnapshotReader &reader, Target &target) { target.entity = reader.ReadEntity(); });
+    if (withName)
+    {
+        serializers.Register<Name>(
+            "Test::Name", [](Utils::SnapshotWriter &writer, const Name &name) { writer.WriteString(name.value); },
+            [](Utils::SnapshotReader &reader, Name &name) { name.value = reader.ReadString(); });
+    }
+}
+
+/**
+ * Entities pointing to the previous one, with enough of them to fill several batches and chunks.
+ */
+std::vector<Engine::Entity> CreateEntities(Engine::Core &core, int count)
+{
+    std::vector<Engine::Entity> entities;
+    for (int i = 0; i < count; ++i)
+    {
+        auto entity = core.CreateEntity();
+        entity.AddComponent<Position>(Position{.x = static_cast<float>(i), .y = -static_cast<float>(i)});
+        entity.AddComponent<Name>(Name{.value = fmt::format("entity {}", i)});
+        if (i % 3 == 0)
+            entity.AddComponent<Tag>();
+        if (i > 0)
+            entity.AddComponent<Target>(Target{.entity = entities.back().Id()});
+        entities.push_back(entity);
+    }
+    return entities;
+}
+} // namespace
+
+TEST(Snapshot, AppendRemapsEntities)
+{
+    Engine::Core source;
+    RegisterSerializers(source);
+    CreateEntities(source, 3000);
+    std::stringstream stream;
+    Utils::SaveSnapshot(source, stream);
+
+    Engine::Core destination;
+    RegisterSerializers(destination);
+    // Existing entities take the saved ids, so the loaded entities must be remapped.
+    CreateEntities(destination, 10);
+    const auto loaded = Utils::LoadSnapshot(destination, stream, Utils::SnapshotLoadMode::Append);
+
+    ASSERT_EQ(loaded.size(), 3000u);
+    auto &registry = destination.GetRegistry();
+    EXPECT_EQ(registry.view<Position>().size(), 3010u);
+    EXPECT_EQ(registry.storage<Tag>().size(), 1000u + 4u);
+    for (size_t i = 0; i < loaded.size(); ++i)
+    {
+        ASSERT_EQ(registry.get<Position>(loaded[i]).x, static_cast<float>(i));
+        ASSERT_EQ(registry.get<Name>(loaded[i]).value, fmt::format("entity {}", i));
+        if (i > 0)
+            ASSERT_EQ(registry.get<Target>(loaded[i]).entity, loaded[i - 1]);
+    }
+}
+
+TEST(Snapshot, ReplaceRestoresTheSavedState)
+{
+    Engine::Core core;
+    RegisterSerializers(core);
+    auto entities = CreateEntities(core, 100);
+    std::stringstream stream;
+    Utils::SaveSnapshot(core, stream);
+
+    entities[5].GetComponents<Position>().x = 1000;
+    entities[6].Kill();
+    CreateEntities(core, 20);
+
+    const auto loaded = Utils::LoadSnapshot(core, stream, Utils::SnapshotLoadMode::Replace);
+
+    ASSERT_EQ(loaded.size(), 100u);
+    EXPECT_EQ(core.GetRegistry().view<Position>().size(), 100u);
+    for (size_t i = 0; i < entities.size(); ++i)
+    {
+        // Saved ids are reused, so entities kept outside the registry are still valid.
+        ASSERT_EQ(loaded[i], entities[i].Id());
+        ASSERT_EQ(entities[i].GetComponents<Position>().x, static_cast<float>(i));
+    }
+}
+
+TEST(Snapshot, UnknownComponentsAreSkipped)
+{
+    Engine::Core source;
+    RegisterSerializers(source);
+    CreateEntities(source, 50);
+    std::stringstream stream;
+    Utils::SaveSnapshot(source, stream);
+
+    Engine::Core destination;
+    RegisterSerializers(destination, false);
+    const auto loaded = Utils::LoadSnapshot(destination, stream);
+
+    ASSERT_EQ(loaded.size(), 50u);
+    EXPECT_EQ(destination.GetRegistry().view<Position>().size(), 50u);
+    EXPECT_EQ(destination.GetRegistry().view<Target>().size(), 49u);
+    EXPECT_TRUE(destination.GetRegistry().view<Name>().empty());
+}
+
+TEST(Snapshot, SerializersReportTheTypesTheySave)
+{
+    Engine::Core core;
+    RegisterSerializers(core, false);
+    const auto &serializers = core.GetResource<Resource::SnapshotSerializers>();
+
+    EXPECT_TRUE(serializers.HasSerializer(entt::type_id<Position>()));
+    EXPECT_TRUE(serializers.HasSerializer(entt::type_id<Tag>()));
+    EXPECT_FALSE(serializers.HasSerializer(entt::type_id<Name>()));
+}
+
+TEST(Snapshot, TruncatedSnapshotIsRolledBack)
+{
+    Engine::Core source;
+    RegisterSerializers(source);
+    CreateEntities(source, 50);
+    std::stringstream stream;
+    Utils::SaveSnapshot(source, stream);
+    const std::string data = stream.str();
+
+    Engine::Core destination;
+    RegisterSerializers(destination);
+    std::stringstream truncated(data.substr(0, data.size() / 2));
+    EXPECT_THROW(Utils::LoadSnapshot(destination, truncated), SnapshotError);
+    EXPECT_TRUE(destination.GetRegistry().view<Position>().empty());
+
+    std::stringstream invalid("not a snapshot");
+    EXPECT_THROW(Utils::LoadSnapshot(destination, invalid), SnapshotError);
+}
+
+TEST(Snapshot, ThrowingSerializerIsRolledBack)
+{
+    Engine::Core source;
+    RegisterSerializers(source);
+    CreateEntities(source, 50);
+    std::stringstream stream;
+    Utils::SaveSnapshot(source, stream);
+
+    Engine::Core destination;
+    RegisterSerializers(destination);
+    destination.GetResource<Resource::SnapshotSerializers>().Register<Name>(
+        "Test::Name", [](Utils::SnapshotWriter &writer, const Name &name) { writer.WriteString(name.value); },
+        [](Utils::SnapshotReader &, Name &) { throw std::runtime_error("cannot build the component"); });
+
+    EXPECT_THROW(Utils::LoadSnapshot(destination, stream), std::runtime_error);
+    EXPECT_TRUE(destination.GetRegistry().view<Position>().empty());
+    EXPECT_TRUE(destination.GetRegistry().view<Target>().empty());
+}
+
+TEST(Snapshot, LoaderResumesWhereItStopped)
+{
+    Engine::Core source;
+    RegisterSerializers(source);
+    CreateEntities(source, 3000);
+    std::stringstream stream;
+    Utils::SaveSnapshot(source, stream);
+
+    Engine::Core destination;
+    RegisterSerializers(destination);
+    Utils::SnapshotLoader loader(stream);
+    int calls = 1;
+    while (!loader.Load(destination, 500))
+    {
+        ++calls;
+        ASSERT_LE(destination.GetRegistry().view<Position>().size(), static_cast<size_t>(calls) * 500);
+    }
+
+    // 3000 entities, 3000 positions, 3000 names, 1000 tags and 2999 targets.
+    EXPECT_GE(calls, 12999 / 500);
+    const auto &loaded = loader.GetEntities();
+    ASSERT_EQ(loaded.size(), 3000u);
+    auto &registry = destination.GetRegistry();
+    for (size_t i = 1; i < loaded.size(); ++i)
+    {
+        ASSERT_EQ(registry.get<Name>(loaded[i]).value, fmt::format("entity {}", i));
+        ASSERT_EQ(registry.get<Target>(loaded[i]).entity, loaded[i - 1]);
+    }
+
+    loader.Rollback(destination);
+    EXPECT_TRUE(registry.view<Position>().empty());
+}
+
+TEST(Snapshot, SectionsSpanSeveralChunks)
+{
+    std::stringstream stream;
+    const std::string large(Utils::SnapshotFormat::CHUNK_SIZE * 2 + 17, 'a');
+    {
+        Utils::SnapshotWriter writer(stream);
+        writer.BeginSection(1, 1);
+        writer.WriteString(large);
+        writer.EndSection();
+        writer.BeginSection(2, 2);
+        writer.Write<uint64_t>(42);
+        writer.WriteString("after");
+        writer.EndSection();
+        writer.Finish();
+    }
+
+    Utils::SnapshotReader reader(stream);
+    auto first = reader.NextSection();
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(first->id, 1u);
+    reader.SkipSection();
+
+    auto second = reader.NextSection();
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(second->count, 2u);
+    EXPECT_EQ(reader.Read<uint64_t>(), 42u);
+    EXPECT_EQ(reader.ReadString(), "after");
+    EXPECT_THROW(reader.Read<uint32_t>(), SnapshotError);
+    reader.EndSection();
+    EXPECT_FALSE(reader.NextSection().has_value());
+}
+
+TEST(Snapshot, SnapshotSceneLoadsAndUnloadsAFile)
+{
+    const auto path = std::filesystem::temp_directory_path() / "EngineSquaredSnapshotTest.snapshot";
+    {
+        Engine::Core source;
+        RegisterSerializers(source);
+        CreateEntities(source, 20);
+        Utils::SaveSnapshot(source, path);
+    }
+
+    Engine::Core core;
+    RegisterSerializers(core);
+    core.RegisterResource<Resource::SceneManager>(Resource::SceneManager());
+    core.RegisterSystem(System::UpdateScene);
+    auto &sceneManager = core.GetResource<Resource::SceneManager>();
+    auto &scene = sceneManager.RegisterScene<Utils::SnapshotScene>("level");
+    scene.SetPath(path);
+    sceneManager.RegisterScene<EmptyScene>("empty");
+
+    sceneManager.SetNextScene("level");
+    // The file is opened on a worker thread, then read while it is merged over a few frames.
+    while (sceneManager.IsLoading())
+        core.RunSystems();
+    EXPECT_EQ(sceneManager.GetCurrentScene(), "level");
+    EXPECT_EQ(scene.GetEntities().size(), 20u);
+    EXPECT_EQ(core.GetRegistry().view<Position>().size(), 20u);
+
+    sceneManager.SetNextScene("empty");
+    core.RunSystems();
+    EXPECT_TRUE(scene.GetEntities().empty());
+    EXPECT_TRUE(core.GetRegistry().view<Position>().empty());
+
+    std::filesystem::remove(path);
+}
+
+TEST(Snapshot, SnapshotSceneStreamsTheFile)
+{
+    const auto path = std::filesystem::temp_directory_path() / "EngineSquaredSnapshotStreamTest.snapshot";
+    Engine::Core core;
+    RegisterSerializers(core);
+    CreateEntities(core, 5);
+    Utils::SaveSnapshot(core, path);
+
+    Utils::SnapshotScene scene;
+    scene.SetPath(path);
+    const auto stream = scene.Prepare(core.GetResource<Resource::SnapshotSerializers>());
+    ASSERT_NE(stream, nullptr);
+    Engine::Core loaded;
+    RegisterSerializers(loaded);
+    EXPECT_EQ(Utils::LoadSnapshot(loaded, *stream).size(), 5u);
+
+    scene.SetPath(path.parent_path() / "EngineSquaredMissing.snapshot");
+    EXPECT_THROW((void) scene.Prepare(core.GetResource<Resource::SnapshotSerializers>()), SnapshotError);
+    std::filesystem::remove(path);
+}
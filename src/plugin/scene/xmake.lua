@@ -1,5 +1,6 @@
 includes("../../engine/xmake.lua")
 includes("../../utils/log/xmake.lua")
+includes("../event/xmake.lua")
 
 target("PluginScene")
     set_kind("static")
@@ -10,9 +11,12 @@ target("PluginScene")
 
     add_deps("EngineSquaredCore")
     add_deps("UtilsLog")
+    add_deps("PluginEvent")
 
     add_files("src/**.cpp")
 
+    add_headerfiles("src/(event/*.hpp)")
+    add_headerfiles("src/(exception/*.hpp)")
     add_headerfiles("src/(plugin/*.hpp)")
     add_headerfiles("src/(resource/*.hpp)")
     add_headerfiles("src/(system/*.hpp)")
@@ -41,6 +45,7 @@ for _, file in ipairs(os.files("tests/**.cpp")) do
         add_packages("glm", "entt", "gtest", "spdlog", "fmt")
 
         add_deps("PluginScene")
+        add_deps("PluginEvent")
         add_deps("EngineSquaredCore")
 
         add_files(file)
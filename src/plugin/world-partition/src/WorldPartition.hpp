@@ -0,0 +1,18 @@
+#pragma once
+
+// Component
+#include "component/Partitioned.hpp"
+#include "component/StreamingSource.hpp"
+
+// System
+#include "system/UpdateWorldPartition.hpp"
+
+// Resource
+#include "resource/WorldGrid.hpp"
+
+// Utils
+#include "utils/CellCoord.hpp"
+#include "utils/CellScene.hpp"
+
+// Plugin
+#include "plugin/PluginWorldPartition.hpp"
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "utils/CellCoord.hpp"
+
+namespace WorldPartition::Component {
+
+/**
+ * @brief Streams an entity with the cell of the world grid its Object::Component::Transform is in: the entity is
+ * saved and destroyed when its cell is unloaded, then loaded back with it.
+ *
+ * Only the components with a serializer in Scene::Resource::SnapshotSerializers are saved, the others (e.g. meshes
+ * and materials) are lost and reported once per type when a cell is unloaded. References to entities of other cells
+ * are saved as null entities, and children are not streamed with their parent: partitioned entities should be roots
+ * of their hierarchy.
+ */
+struct Partitioned {
+    /** @brief Cell the entity is in, set by Resource::WorldGrid. */
+    Utils::CellCoord cell;
+};
+
+} // namespace WorldPartition::Component
@@ -0,0 +1,11 @@
+#pragma once
+
+namespace WorldPartition::Component {
+
+/**
+ * @brief Keeps the cells around the Object::Component::Transform of the entity loaded, like the cameras do, e.g. for
+ * a player that is not followed by a camera on a server.
+ */
+struct StreamingSource {};
+
+} // namespace WorldPartition::Component
@@ -0,0 +1,19 @@
+#include "plugin/PluginWorldPartition.hpp"
+#include "component/Partitioned.hpp"
+#include "plugin/PluginPhysics.hpp"
+#include "plugin/PluginScene.hpp"
+#include "resource/SnapshotSerializers.hpp"
+#include "resource/WorldGrid.hpp"
+#include "scheduler/Update.hpp"
+#include "system/UpdateWorldPartition.hpp"
+
+void WorldPartition::Plugin::Bind()
+{
+    RequirePlugins<Scene::Plugin, Physics::Plugin>();
+
+    RegisterResource<Resource::WorldGrid>(Resource::WorldGrid());
+    // The other components streamed with the cells are registered by the plugins owning them.
+    GetCore().GetResource<Scene::Resource::SnapshotSerializers>().Register<Component::Partitioned>(
+        "WorldPartition::Partitioned");
+    RegisterSystems<Engine::Scheduler::Update>(System::UpdateWorldPartition);
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "plugin/APlugin.hpp"
+
+namespace WorldPartition {
+class Plugin : public Engine::APlugin {
+  public:
+    explicit Plugin(Engine::Core &core)
+        : Engine::APlugin(core) {
+              // empty
+          };
+    ~Plugin() = default;
+
+    void Bind() final;
+};
+} // namespace WorldPartition
@@ -0,0 +1,423 @@
+#include "resource/WorldGrid.hpp"
+
+#include "Logger.hpp"
+#include "component/Camera.hpp"
+#include "component/GlobalTransform.hpp"
+#include "component/Partitioned.hpp"
+#include "component/RigidBody.hpp"
+#include "component/RigidBodyInternal.hpp"
+#include "component/StreamingSource.hpp"
+#include "component/Transform.hpp"
+#include "resource/PhysicsManager.hpp"
+#include "resource/SceneManager.hpp"
+#include "resource/SnapshotSerializers.hpp"
+#include "utils/Snapshot.hpp"
+
+#include <Jolt/Physics/Body/BodyInterface.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fmt/format.h>
+#include <limits>
+#include <sstream>
+#include <utility>
+
+namespace WorldPartition::Resource {
+
+namespace {
+/** @brief World position of an entity: its GlobalTransform once propagated, its local Transform before that. */
+glm::vec3 GetWorldPosition(const Engine::Core::Registry &registry, Engine::EntityId entity,
+                           const Object::Component::Transform &transform)
+{
+    const auto *globalTransform = registry.try_get<Object::Component::GlobalTransform>(entity);
+    return globalTransform == nullptr ? transform.GetPosition() : globalTransform->GetPosition();
+}
+} // namespace
+
+WorldGrid::WorldGrid(const Settings &settings) { SetSettings(settings); }
+
+void WorldGrid::SetSettings(const Settings &settings)
+{
+    _settings = settings;
+    if (_settings.cellSize <= 0.0f)
+    {
+        Log::Warning(fmt::format("WorldGrid: invalid cell size {}, the default one is used.", _settings.cellSize));
+        _settings.cellSize = Settings{}.cellSize;
+    }
+    if (_settings.unloadRadius < _settings.loadRadius)
+    {
+        Log::Warning(fmt::format("WorldGrid: unload radius {} is below the load radius {}, it is raised to it.",
+                                 _settings.unloadRadius, _settings.loadRadius));
+        _settings.unloadRadius = _settings.loadRadius;
+    }
+}
+
+Utils::CellCoord WorldGrid::GetCellCoord(const glm::vec3 &position) const
+{
+    return Utils::CellCoord{.x = static_cast<int32_t>(std::floor(position.x / _settings.cellSize)),
+                            .z = static_cast<int32_t>(std::floor(position.z / _settings.cellSize))};
+}
+
+const WorldGrid::Cell *WorldGrid::FindCell(Utils::CellCoord coord) const
+{
+    auto it = _cells.find(coord);
+    return it == _cells.end() ? nullptr : &it->second;
+}
+
+size_t WorldGrid::GetLoadedSize() const
+{
+    size_t size = 0;
+    for (const auto &[coord, cell] : _cells)
+        size += _GetCellSize(cell);
+    return size;
+}
+
+size_t WorldGrid::GetUnloadedSize() const
+{
+    size_t size = 0;
+    for (const auto &[coord, cell] : _cells)
+    {
+        if (cell.state == CellState::Unloaded)
+            size += cell.snapshotSize;
+    }
+    return size;
+}
+
+std::string WorldGrid::GetSceneName(Utils::CellCoord coord)
+{
+    return fmt::format("WorldPartition::Cell({}, {})", coord.x, coord.z);
+}
+
+void WorldGrid::Update(Engine::Core &core)
+{
+    _Connect(core);
+    _AssignEntities(core);
+    _FinishLoading(core);
+
+    const std::vector<glm::vec3> sources = _GetSources(core);
+    if (sources.empty())
+        return;
+
+    for (auto &[coord, cell] : _cells)
+        cell.distance = _GetDistance(coord, sources);
+
+    for (auto &[coord, cell] : _cells)
+    {
+        if (cell.state != CellState::Active && cell.state != CellState::Dormant)
+            continue;
+        if (cell.distance > _settings.unloadRadius && !cell.entities.empty())
+        {
+            _UnloadCell(core, coord, cell);
+            continue;
+        }
+        const CellState state = cell.distance <= _settings.activeRadius ? CellState::Active : CellState::Dormant;
+        if (state != cell.state)
+        {
+            _SetBodiesActive(core, cell.entities, state == CellState::Active);
+            cell.state = state;
+        }
+    }
+
+    // Cells are evicted before new ones are loaded, so that the nearest cells get the memory first.
+    _EvictCells(core);
+    _LoadCells(core);
+}
+
+void WorldGrid::_OnPartitionedConstruct(Engine::Core &core, Engine::EntityId entity)
+{
+    if (core.HasResource<WorldGrid>())
+        core.GetResource<WorldGrid>()._unassigned.push_back(entity);
+}
+
+void WorldGrid::_OnPartitionedDestroy(Engine::Core &core, Engine::EntityId entity)
+{
+    if (core.HasResource<WorldGrid>())
+    {
+        const auto &partitioned = core.GetRegistry().get<Component::Partitioned>(entity);
+        core.GetResource<WorldGrid>()._RemoveFromCell(entity, partitioned.cell);
+    }
+}
+
+void WorldGrid::_Connect(Engine::Core &core)
+{
+    if (_isConnected)
+        return;
+
+    auto &registry = core.GetRegistry();
+    registry.on_construct<Component::Partitioned>().connect<&WorldGrid::_OnPartitionedConstruct>(core);
+    registry.on_destroy<Component::Partitioned>().connect<&WorldGrid::_OnPartitionedDestroy>(core);
+    // Entities created before the grid was connected are assigned by the first update.
+    for (auto entity : registry.view<Component::Partitioned>())
+        _unassigned.emplace_back(entity);
+    _isConnected = true;
+}
+
+void WorldGrid::_AssignEntities(Engine::Core &core)
+{
+    auto &registry = core.GetRegistry();
+
+    // A component added, removed then added again in the same frame is only assigned once.
+    std::ranges::sort(_unassigned);
+    const auto duplicates = std::ranges::unique(_unassigned);
+    _unassigned.erase(duplicates.begin(), duplicates.end());
+    for (auto entity : std::exchange(_unassigned, {}))
+    {
+        if (!registry.valid(entity) || !registry.all_of<Component::Partitioned>(entity))
+            continue;
+        const auto *transform = registry.try_get<Object::Component::Transform>(entity);
+        const glm::vec3 position =
+            transform == nullptr ? glm::vec3(0.0f) : GetWorldPosition(registry, entity, *transform);
+        _AddToCell(core, entity, GetCellCoord(position));
+    }
+
+    for (auto [entity, partitioned, transform] :
+         registry.view<Component::Partitioned, Object::Component::Transform>().each())
+    {
+        const Utils::CellCoord coord = GetCellCoord(GetWorldPosition(registry, entity, transform));
+        if (coord == partitioned.cell)
+            continue;
+        _RemoveFromCell(entity, partitioned.cell);
+        _AddToCell(core, entity, coord);
+    }
+}
+
+void WorldGrid::_AddToCell(Engine::Core &core, Engine::EntityId entity, Utils::CellCoord coord)
+{
+    Cell &cell = _cells[coord];
+    cell.entities.push_back(entity);
+    core.GetRegistry().get<Component::Partitioned>(entity).cell = coord;
+    // A body moving into a dormant cell stops there, like the bodies already in it.
+    if (cell.state == CellState::Dormant)
+        _SetBodiesActive(core, std::span(&entity, 1), false);
+}
+
+void WorldGrid::_RemoveFromCell(Engine::EntityId entity, Utils::CellCoord coord)
+{
+    auto it = _cells.find(coord);
+    if (it == _cells.end())
+        return;
+    auto &entities = it->second.entities;
+    auto found = std::ranges::find(entities, entity);
+    if (found == entities.end())
+        return;
+    *found = entities.back();
+    entities.pop_back();
+}
+
+std::vector<glm::vec3> WorldGrid::_GetSources(Engine::Core &core) const
+{
+    auto &registry = core.GetRegistry();
+    std::vector<glm::vec3> sources;
+    // Sources attached to a parent (e.g. a camera following a vehicle) stream around their world position.
+    auto cameras = registry.view<Object::Component::Camera, Object::Component::Transform>();
+    for (auto entity : cameras)
+        sources.push_back(GetWorldPosition(registry, entity, cameras.get<Object::Component::Transform>(entity)));
+    auto streamingSources = registry.view<Component::StreamingSource, Object::Component::Transform>();
+    for (auto entity : streamingSources)
+    {
+        sources.push_back(
+            GetWorldPosition(registry, entity, streamingSources.get<Object::Component::Transform>(entity)));
+    }
+    return sources;
+}
+
+float WorldGrid::_GetDistance(Utils::CellCoord coord, const std::vector<glm::vec3> &sources) const
+{
+    const float minX = static_cast<float>(coord.x) * _settings.cellSize;
+    const float minZ = static_cast<float>(coord.z) * _settings.cellSize;
+    const float maxX = minX + _settings.cellSize;
+    const float maxZ = minZ + _settings.cellSize;
+
+    float nearest = std::numeric_limits<float>::max();
+    for (const auto &source : sources)
+    {
+        const float dx = std::max({minX - source.x, 0.0f, source.x - maxX});
+        const float dz = std::max({minZ - source.z, 0.0f, source.z - maxZ});
+        nearest = std::min(nearest, dx * dx + dz * dz);
+    }
+    return std::sqrt(nearest);
+}
+
+size_t WorldGrid::_GetEntitySize() const
+{
+    return _savedEntities == 0 ? DEFAULT_ENTITY_SIZE : _savedBytes / _savedEntities;
+}
+
+size_t WorldGrid::_GetCellSize(const Cell &cell) const
+{
+    // Entities can move into an unloaded cell, they are loaded until the cell is unloaded again.
+    size_t size = cell.entities.size() * _GetEntitySize();
+    if (cell.state == CellState::Loading)
+        size += cell.snapshotSize;
+    return size;
+}
+
+void WorldGrid::_FinishLoading(Engine::Core &core)
+{
+    auto &sceneManager = core.GetResource<Scene::Resource::SceneManager>();
+    const auto &additiveScenes = sceneManager.GetAdditiveScenes();
+    for (auto &[coord, cell] : _cells)
+    {
+        if (cell.state != CellState::Loading)
+            continue;
+        const std::string name = GetSceneName(coord);
+        if (sceneManager.IsLoading(name))
+            continue;
+
+        cell.isInSceneManager = std::ranges::find(additiveScenes, name) != additiveScenes.end();
+        if (!cell.isInSceneManager)
+        {
+            Log::Error(fmt::format("WorldGrid: cell ({}, {}) cannot be loaded back, its saved entities are lost.",
+                                   coord.x, coord.z));
+        }
+        cell.snapshotSize = 0;
+        // Bodies are created active, the next update deactivates them if the cell is not near a source.
+        cell.state = CellState::Active;
+    }
+}
+
+void WorldGrid::_LoadCells(Engine::Core &core)
+{
+    std::vector<std::pair<float, Utils::CellCoord>> candidates;
+    for (const auto &[coord, cell] : _cells)
+    {
+        if (cell.state == CellState::Unloaded && (cell.distance <= _settings.loadRadius || !cell.entities.empty()))
+            candidates.emplace_back(cell.distance, coord);
+    }
+    if (candidates.empty())
+        return;
+    std::ranges::sort(candidates, {}, &std::pair<float, Utils::CellCoord>::first);
+
+    auto &sceneManager = core.GetResource<Scene::Resource::SceneManager>();
+    size_t loadedSize = GetLoadedSize();
+    for (const auto &[distance, coord] : candidates)
+    {
+        Cell &cell = _cells.at(coord);
+        // Entities that moved into the cell need the saved ones back before it can be unloaded again.
+        const bool isRequired = distance <= _settings.activeRadius || !cell.entities.empty();
+        if (!isRequired && loadedSize + cell.snapshotSize > _settings.memoryBudget)
+            continue;
+        sceneManager.LoadSceneAdditive(GetSceneName(coord));
+        cell.state = CellState::Loading;
+        loadedSize += cell.snapshotSize;
+    }
+}
+
+void WorldGrid::_WarnUnsavedComponents(Engine::Core &core, std::span<const Engine::EntityId> entities)
+{
+    const auto &serializers = core.GetResource<Scene::Resource::SnapshotSerializers>();
+    for (auto [id, storage] : core.GetRegistry().storage())
+    {
+        if (serializers.HasSerializer(storage.type()) || _unsavedTypes.contains(storage.type().hash()))
+            continue;
+        if (std::ranges::none_of(entities, [&storage](Engine::EntityId entity) { return storage.contains(entity); }))
+            continue;
+        _unsavedTypes.insert(storage.type().hash());
+        Log::Warning(fmt::format("WorldGrid: {} components have no snapshot serializer, partitioned entities lose "
+                                 "them when their cell is unloaded.",
+                                 storage.type().name()));
+    }
+}
+
+void WorldGrid::_UnloadCell(Engine::Core &core, Utils::CellCoord coord, Cell &cell)
+{
+    const std::vector<Engine::EntityId> entities = std::exchange(cell.entities, {});
+    _WarnUnsavedComponents(core, entities);
+
+    std::ostringstream stream;
+    Scene::Utils::SaveSnapshot(core, stream, entities);
+    std::string snapshot = std::move(stream).str();
+    _savedBytes += snapshot.size();
+    _savedEntities += entities.size();
+    cell.snapshotSize = snapshot.size();
+
+    for (auto entity : entities)
+        core.KillEntity(entity);
+
+    auto &sceneManager = core.GetResource<Scene::Resource::SceneManager>();
+    const std::string name = GetSceneName(coord);
+    if (cell.scene == nullptr)
+        cell.scene = &sceneManager.RegisterScene<Utils::CellScene>(name);
+    cell.scene->SetSnapshot(std::move(snapshot));
+    if (cell.isInSceneManager)
+    {
+        sceneManager.UnloadScene(name);
+        cell.isInSceneManager = false;
+    }
+    cell.state = CellState::Unloaded;
+}
+
+void WorldGrid::_EvictCells(Engine::Core &core)
+{
+    // Same estimate as GetLoadedSize, kept as running totals: each unloaded cell updates the size of an entity.
+    size_t loadedEntities = 0;
+    size_t loadingBytes = 0;
+    for (const auto &[coord, cell] : _cells)
+    {
+        loadedEntities += cell.entities.size();
+        if (cell.state == CellState::Loading)
+            loadingBytes += cell.snapshotSize;
+    }
+    auto loadedSize = [this, &loadedEntities, &loadingBytes]() {
+        return loadedEntities * _GetEntitySize() + loadingBytes;
+    };
+
+    if (loadedSize() <= _settings.memoryBudget)
+    {
+        _isOverBudget = false;
+        return;
+    }
+
+    std::vector<std::pair<float, Utils::CellCoord>> candidates;
+    for (const auto &[coord, cell] : _cells)
+    {
+        if (cell.state == CellState::Dormant && !cell.entities.empty())
+            candidates.emplace_back(cell.distance, coord);
+    }
+    std::ranges::sort(candidates, std::ranges::greater{}, &std::pair<float, Utils::CellCoord>::first);
+
+    for (const auto &[distance, coord] : candidates)
+    {
+        if (loadedSize() <= _settings.memoryBudget)
+            return;
+        Cell &cell = _cells.at(coord);
+        loadedEntities -= cell.entities.size();
+        _UnloadCell(core, coord, cell);
+    }
+    // Warned once, until the active cells fit again.
+    if (const size_t size = loadedSize(); size > _settings.memoryBudget && !std::exchange(_isOverBudget, true))
+    {
+        Log::Warning(fmt::format("WorldGrid: the active cells use {} bytes, above the memory budget of {} bytes.",
+                                 size, _settings.memoryBudget));
+    }
+}
+
+void WorldGrid::_SetBodiesActive(Engine::Core &core, std::span<const Engine::EntityId> entities, bool isActive)
+{
+    if (!core.HasResource<Physics::Resource::PhysicsManager>())
+        return;
+
+    auto &registry = core.GetRegistry();
+    std::vector<JPH::BodyID> bodies;
+    for (auto entity : entities)
+    {
+        const auto *internal = registry.try_get<Physics::Component::RigidBodyInternal>(entity);
+        if (internal == nullptr || !internal->IsValid())
+            continue;
+        // Static bodies are never simulated.
+        const auto *rigidBody = registry.try_get<Physics::Component::RigidBody>(entity);
+        if (rigidBody != nullptr && rigidBody->motionType == Physics::Component::MotionType::Static)
+            continue;
+        bodies.push_back(internal->bodyID);
+    }
+    if (bodies.empty())
+        return;
+
+    auto &bodyInterface = core.GetResource<Physics::Resource::PhysicsManager>().GetBodyInterface();
+    if (isActive)
+        bodyInterface.ActivateBodies(bodies.data(), static_cast<int>(bodies.size()));
+    else
+        bodyInterface.DeactivateBodies(bodies.data(), static_cast<int>(bodies.size()));
+}
+
+} // namespace WorldPartition::Resource
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Engine.hpp"
+
+#include "utils/CellCoord.hpp"
+#include "utils/CellScene.hpp"
+
+namespace WorldPartition::Resource {
+
+enum class CellState {
+    /** @brief Saved as a snapshot, its entities are destroyed. */
+    Unloaded,
+    /** @brief Streamed back by the scene manager. */
+    Loading,
+    /** @brief Loaded, but its rigid bodies are deactivated. */
+    Dormant,
+    /** @brief Loaded and simulated. */
+    Active,
+};
+
+/**
+ * @brief Splits the world into square cells on the X/Z plane, and streams the entities with a
+ * Component::Partitioned around the streaming sources: the cameras and the entities with a
+ * Component::StreamingSource.
+ *
+ * - Cells within the active radius of a source are simulated.
+ * - Cells within the load radius are loaded, but their rigid bodies are deactivated.
+ * - Cells beyond the unload radius are saved as snapshots in memory and their entities are destroyed. They are
+ *   loaded back as additive scenes by the Scene::Resource::SceneManager, which merges them over several frames.
+ *
+ * The memory used by the loaded cells is estimated from the size of their snapshots. Beyond the memory budget, the
+ * farthest dormant cells are unloaded and no dormant cell is loaded. Active cells are always loaded.
+ *
+ * @note Nothing is streamed while there is no source.
+ *
+ * @example "Streaming a large world"
+ * @code
+ * core.AddPlugins<WorldPartition::Plugin>();
+ * core.GetResource<WorldPartition::Resource::WorldGrid>().SetSettings({.cellSize = 32.0f,
+ *                                                                      .activeRadius = 64.0f,
+ *                                                                      .loadRadius = 128.0f,
+ *                                                                      .unloadRadius = 160.0f});
+ *
+ * auto rock = core.CreateEntity();
+ * rock.AddComponent<Object::Component::Transform>(glm::vec3(1000.0f, 0.0f, 250.0f));
+ * rock.AddComponent<WorldPartition::Component::Partitioned>();
+ * @endcode
+ */
+class WorldGrid {
+  public:
+    struct Settings {
+        /** @brief Size of the side of a cell. */
+        float cellSize = 64.0f;
+        /** @brief Distance from a source to the cells that are simulated. */
+        float activeRadius = 128.0f;
+        /** @brief Distance from a source to the cells that are loaded. */
+        float loadRadius = 256.0f;
+        /** @brief Distance from a source to the cells that are unloaded, beyond the load radius so that the cells on
+         * the border are not unloaded and loaded again each time a source moves a bit. */
+        float unloadRadius = 320.0f;
+        /** @brief Estimated memory used by the loaded cells, in bytes. */
+        size_t memoryBudget = 256 * 1024 * 1024;
+    };
+
+    struct Cell {
+        /** @brief A new cell is loaded, its bodies are simulated until it is updated. */
+        CellState state = CellState::Active;
+        /** @brief Entities in the cell, once loaded. */
+        std::vector<Engine::EntityId> entities;
+        /** @brief Scene loading the cell back, registered the first time the cell is unloaded. */
+        Utils::CellScene *scene = nullptr;
+        /** @brief Size of the snapshot of the cell while it is unloaded or loading. */
+        size_t snapshotSize = 0;
+        /** @brief Whether the scene of the cell is loaded in the scene manager, and must be unloaded from it. */
+        bool isInSceneManager = false;
+        /** @brief Distance to the nearest source at the last update. */
+        float distance = 0.0f;
+    };
+
+    /** @brief Estimated size of an entity, until a cell is unloaded. */
+    static inline constexpr size_t DEFAULT_ENTITY_SIZE = 256;
+
+    WorldGrid() = default;
+    explicit WorldGrid(const Settings &settings);
+    ~WorldGrid() = default;
+
+    WorldGrid(const WorldGrid &) = delete;
+    WorldGrid &operator=(const WorldGrid &) = delete;
+    WorldGrid(WorldGrid &&) noexcept = default;
+    WorldGrid &operator=(WorldGrid &&) noexcept = default;
+
+    /**
+     * @brief Assign the moved entities to their cell, then load, activate, deactivate and unload the cells
+     * according to their distance to the sources.
+     *
+     * @param core  core that contains all components
+     */
+    void Update(Engine::Core &core);
+
+    /**
+     * @brief Set the settings used by the next updates. The radii are clamped so that the unload radius is not below
+     * the load radius.
+     */
+    void SetSettings(const Settings &settings);
+    [[nodiscard]] const Settings &GetSettings() const { return _settings; }
+
+    [[nodiscard]] Utils::CellCoord GetCellCoord(const glm::vec3 &position) const;
+
+    /** @return the cell, or nullptr if no partitioned entity was ever in it */
+    [[nodiscard]] const Cell *FindCell(Utils::CellCoord coord) const;
+
+    [[nodiscard]] size_t GetCellCount() const { return _cells.size(); }
+
+    /** @brief Estimated memory used by the loaded and loading cells, in bytes. */
+    [[nodiscard]] size_t GetLoadedSize() const;
+
+    /** @brief Memory used by the snapshots of the unloaded cells, in bytes. */
+    [[nodiscard]] size_t GetUnloadedSize() const;
+
+    /** @brief Name of the scene loading a cell back in the Scene::Resource::SceneManager. */
+    [[nodiscard]] static std::string GetSceneName(Utils::CellCoord coord);
+
+  private:
+    using Cells = std::unordered_map<Utils::CellCoord, Cell, Utils::CellCoordHash>;
+
+    static void _OnPartitionedConstruct(Engine::Core &core, Engine::EntityId entity);
+    static void _OnPartitionedDestroy(Engine::Core &core, Engine::EntityId entity);
+    void _Connect(Engine::Core &core);
+
+    void _AssignEntities(Engine::Core &core);
+    void _AddToCell(Engine::Core &core, Engine::EntityId entity, Utils::CellCoord coord);
+    void _RemoveFromCell(Engine::EntityId entity, Utils::CellCoord coord);
+
+    [[nodiscard]] std::vector<glm::vec3> _GetSources(Engine::Core &core) const;
+    [[nodiscard]] float _GetDistance(Utils::CellCoord coord, const std::vector<glm::vec3> &sources) const;
+    /** @brief Estimated size of a loaded entity, from the snapshots saved so far. */
+    [[nodiscard]] size_t _GetEntitySize() const;
+    [[nodiscard]] size_t _GetCellSize(const Cell &cell) const;
+
+    void _FinishLoading(Engine::Core &core);
+    void _LoadCells(Engine::Core &core);
+    void _UnloadCell(Engine::Core &core, Utils::CellCoord coord, Cell &cell);
+    void _WarnUnsavedComponents(Engine::Core &core, std::span<const Engine::EntityId> entities);
+    void _EvictCells(Engine::Core &core);
+    static void _SetBodiesActive(Engine::Core &core, std::span<const Engine::EntityId> entities, bool isActive);
+
+    Settings _settings;
+    Cells _cells;
+    /** @brief Partitioned entities created since the last update, e.g. by a cell being loaded. */
+    std::vector<Engine::EntityId> _unassigned;
+    /** @brief Bytes and entities of the snapshots saved so far, to estimate the size of the loaded cells. */
+    size_t _savedBytes = 0;
+    size_t _savedEntities = 0;
+    /** @brief Component types already reported as lost when unloading a cell, so each is reported once. */
+    std::unordered_set<entt::id_type> _unsavedTypes;
+    bool _isOverBudget = false;
+    bool _isConnected = false;
+};
+
+} // namespace WorldPartition::Resource
@@ -0,0 +1,8 @@
+#include "system/UpdateWorldPartition.hpp"
+
+#include "resource/WorldGrid.hpp"
+
+void WorldPartition::System::UpdateWorldPartition(Engine::Core &core)
+{
+    core.GetResource<Resource::WorldGrid>().Update(core);
+}
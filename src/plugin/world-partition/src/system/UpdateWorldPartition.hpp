@@ -0,0 +1,12 @@
+#pragma once
+
+#include "Engine.hpp"
+
+namespace WorldPartition::System {
+/**
+ * @brief Streams the cells of the world grid around the cameras and the streaming sources.
+ *
+ * @param   core The core to stream the cells of.
+ */
+void UpdateWorldPartition(Engine::Core &core);
+} // namespace WorldPartition::System
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace WorldPartition::Utils {
+
+/**
+ * @brief Coordinates of a cell of the world grid, on the horizontal X/Z plane. Cell (x, z) covers the positions from
+ * (x * cellSize, z * cellSize) included to ((x + 1) * cellSize, (z + 1) * cellSize) excluded.
+ */
+struct CellCoord {
+    int32_t x = 0;
+    int32_t z = 0;
+
+    bool operator==(const CellCoord &) const = default;
+};
+
+struct CellCoordHash {
+    std::size_t operator()(const CellCoord &coord) const noexcept
+    {
+        const uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(coord.x)) << 32) |
+                             static_cast<uint64_t>(static_cast<uint32_t>(coord.z));
+        return std::hash<uint64_t>{}(key);
+    }
+};
+
+} // namespace WorldPartition::Utils
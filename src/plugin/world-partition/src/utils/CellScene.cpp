@@ -0,0 +1,14 @@
+#include "utils/CellScene.hpp"
+
+#include <sstream>
+#include <utility>
+
+std::unique_ptr<std::istream> WorldPartition::Utils::CellScene::Prepare(const Scene::Resource::SnapshotSerializers &)
+{
+    return std::make_unique<std::istringstream>(std::exchange(_snapshot, {}));
+}
+
+void WorldPartition::Utils::CellScene::_onDestroy(Engine::Core &)
+{
+    // The world grid destroys the entities of a cell when it unloads it.
+}
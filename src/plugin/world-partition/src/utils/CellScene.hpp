@@ -0,0 +1,32 @@
+#pragma once
+
+#include "utils/AStreamedScene.hpp"
+#include <string>
+
+namespace WorldPartition::Utils {
+
+/**
+ * @brief Unloaded cell of the world grid, kept as a snapshot in memory until the scene manager streams it back.
+ * The entities belong to Resource::WorldGrid once merged: unloading the scene does not destroy them.
+ */
+class CellScene : public Scene::Utils::AStreamedScene {
+  public:
+    CellScene(void) = default;
+    ~CellScene() override = default;
+
+    void SetSnapshot(std::string snapshot) { _snapshot = std::move(snapshot); }
+
+    /**
+     * @brief Hand the snapshot over to the scene manager, without copying it.
+     */
+    [[nodiscard]] std::unique_ptr<std::istream>
+    Prepare(const Scene::Resource::SnapshotSerializers &serializers) override;
+
+  protected:
+    void _onDestroy(Engine::Core &core) override;
+
+  private:
+    std::string _snapshot;
+};
+
+} // namespace WorldPartition::Utils
@@ -0,0 +1,208 @@
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include "Engine.hpp"
+
+#include "WorldPartition.hpp"
+#include "component/BoxCollider.hpp"
+#include "component/GlobalTransform.hpp"
+#include "component/RigidBody.hpp"
+#include "component/RigidBodyInternal.hpp"
+#include "component/Transform.hpp"
+#include "resource/PhysicsManager.hpp"
+#include "resource/SceneManager.hpp"
+
+#include <Jolt/Physics/Body/BodyInterface.h>
+
+using namespace WorldPartition;
+
+namespace {
+Resource::WorldGrid::Settings TestSettings()
+{
+    return Resource::WorldGrid::Settings{
+        .cellSize = 10.0f, .activeRadius = 15.0f, .loadRadius = 30.0f, .unloadRadius = 40.0f};
+}
+
+void SetUpCore(Engine::Core &core, const Resource::WorldGrid::Settings &settings)
+{
+    core.AddPlugins<WorldPartition::Plugin>();
+    core.GetResource<Resource::WorldGrid>().SetSettings(settings);
+    // The first frame initializes the physics.
+    core.RunSystems();
+}
+
+Engine::Entity CreateSource(Engine::Core &core, const glm::vec3 &position)
+{
+    auto entity = core.CreateEntity();
+    entity.AddComponent<Object::Component::Transform>(position);
+    entity.AddComponent<Component::StreamingSource>();
+    return entity;
+}
+
+Engine::Entity CreatePartitioned(Engine::Core &core, const glm::vec3 &position)
+{
+    auto entity = core.CreateEntity();
+    entity.AddComponent<Object::Component::Transform>(position);
+    entity.AddComponent<Component::Partitioned>();
+    return entity;
+}
+
+void CreateCell(Engine::Core &core, float x, int count)
+{
+    for (int i = 0; i < count; ++i)
+        CreatePartitioned(core, {x, static_cast<float>(i), 5.0f});
+}
+
+size_t CountPartitioned(Engine::Core &core) { return core.GetRegistry().view<Component::Partitioned>().size(); }
+
+Resource::CellState GetState(Engine::Core &core, int32_t x)
+{
+    const auto *cell = core.GetResource<Resource::WorldGrid>().FindCell({.x = x, .z = 0});
+    return cell == nullptr ? Resource::CellState::Unloaded : cell->state;
+}
+
+/** @brief Run until the requested cells are merged, and the grid has seen them loaded. */
+void RunUntilLoaded(Engine::Core &core)
+{
+    while (core.GetResource<Scene::Resource::SceneManager>().IsLoading())
+        core.RunSystems();
+    core.RunSystems();
+}
+} // namespace
+
+TEST(WorldGrid, FarCellsAreUnloadedAndLoadedBack)
+{
+    Engine::Core core;
+    SetUpCore(core, TestSettings());
+    auto source = CreateSource(core, {5.0f, 0.0f, 5.0f});
+    CreateCell(core, 5.0f, 10);
+    CreateCell(core, 105.0f, 50);
+
+    core.RunSystems();
+    auto &grid = core.GetResource<Resource::WorldGrid>();
+    EXPECT_EQ(GetState(core, 0), Resource::CellState::Active);
+    EXPECT_EQ(GetState(core, 10), Resource::CellState::Unloaded);
+    EXPECT_EQ(CountPartitioned(core), 10u);
+    EXPECT_EQ(grid.GetUnloadedSize(), grid.FindCell({.x = 10, .z = 0})->snapshotSize);
+    EXPECT_GT(grid.GetUnloadedSize(), 0u);
+
+    source.GetComponents<Object::Component::Transform>().SetPosition(105.0f, 0.0f, 5.0f);
+    core.RunSystems();
+    RunUntilLoaded(core);
+
+    EXPECT_EQ(GetState(core, 0), Resource::CellState::Unloaded);
+    EXPECT_EQ(GetState(core, 10), Resource::CellState::Active);
+    EXPECT_EQ(CountPartitioned(core), 50u);
+    EXPECT_EQ(grid.FindCell({.x = 10, .z = 0})->entities.size(), 50u);
+    for (auto [entity, partitioned, transform] :
+         core.GetRegistry().view<Component::Partitioned, Object::Component::Transform>().each())
+        EXPECT_EQ(transform.GetPosition().x, 105.0f);
+}
+
+TEST(WorldGrid, EntitiesFollowTheirCell)
+{
+    Engine::Core core;
+    SetUpCore(core, TestSettings());
+    CreateSource(core, {5.0f, 0.0f, 5.0f});
+    auto entity = CreatePartitioned(core, {5.0f, 0.0f, 5.0f});
+
+    core.RunSystems();
+    EXPECT_EQ(entity.GetComponents<Component::Partitioned>().cell, (Utils::CellCoord{.x = 0, .z = 0}));
+
+    // Moved far away, the entity is unloaded with its new cell.
+    entity.GetComponents<Object::Component::Transform>().SetPosition(-95.0f, 0.0f, 5.0f);
+    core.RunSystems();
+    auto &grid = core.GetResource<Resource::WorldGrid>();
+    EXPECT_TRUE(grid.FindCell({.x = 0, .z = 0})->entities.empty());
+    EXPECT_EQ(GetState(core, -10), Resource::CellState::Unloaded);
+    EXPECT_EQ(CountPartitioned(core), 0u);
+}
+
+TEST(WorldGrid, DormantCellsDeactivateTheirBodies)
+{
+    Engine::Core core;
+    SetUpCore(core, TestSettings());
+    auto source = CreateSource(core, {5.0f, 0.0f, 5.0f});
+    auto body = CreatePartitioned(core, {35.0f, 0.0f, 5.0f});
+    body.AddComponent<Physics::Component::BoxCollider>(glm::vec3(0.5f));
+    body.AddComponent<Physics::Component::RigidBody>(Physics::Component::RigidBody::CreateDynamic());
+
+    core.RunSystems();
+    auto &bodyInterface = core.GetResource<Physics::Resource::PhysicsManager>().GetBodyInterface();
+    const JPH::BodyID bodyID = body.GetComponents<Physics::Component::RigidBodyInternal>().bodyID;
+    EXPECT_EQ(GetState(core, 3), Resource::CellState::Dormant);
+    EXPECT_FALSE(bodyInterface.IsActive(bodyID));
+
+    source.GetComponents<Object::Component::Transform>().SetPosition(35.0f, 0.0f, 5.0f);
+    core.RunSystems();
+    EXPECT_EQ(GetState(core, 3), Resource::CellState::Active);
+    EXPECT_TRUE(bodyInterface.IsActive(bodyID));
+}
+
+TEST(WorldGrid, MemoryBudgetKeepsTheNearestCells)
+{
+    Engine::Core core;
+    auto settings = TestSettings();
+    settings.loadRadius = 100.0f;
+    settings.unloadRadius = 120.0f;
+    settings.memoryBudget = 0;
+    SetUpCore(core, settings);
+    CreateSource(core, {5.0f, 0.0f, 5.0f});
+    CreateCell(core, 5.0f, 10);
+    CreateCell(core, 35.0f, 10);
+    CreateCell(core, 55.0f, 10);
+    CreateCell(core, 75.0f, 10);
+
+    // Without memory, only the active cell is kept.
+    core.RunSystems();
+    auto &grid = core.GetResource<Resource::WorldGrid>();
+    EXPECT_EQ(GetState(core, 0), Resource::CellState::Active);
+    EXPECT_EQ(GetState(core, 3), Resource::CellState::Unloaded);
+    EXPECT_EQ(GetState(core, 5), Resource::CellState::Unloaded);
+    EXPECT_EQ(GetState(core, 7), Resource::CellState::Unloaded);
+    EXPECT_EQ(CountPartitioned(core), 10u);
+
+    // Memory for two cells and a half: the two nearest ones are loaded.
+    const size_t cellSize = grid.FindCell({.x = 3, .z = 0})->snapshotSize;
+    settings.memoryBudget = grid.GetLoadedSize() + cellSize * 5 / 2;
+    grid.SetSettings(settings);
+    core.RunSystems();
+    RunUntilLoaded(core);
+    EXPECT_EQ(GetState(core, 3), Resource::CellState::Dormant);
+    EXPECT_EQ(GetState(core, 5), Resource::CellState::Dormant);
+    EXPECT_EQ(GetState(core, 7), Resource::CellState::Unloaded);
+    EXPECT_EQ(CountPartitioned(core), 30u);
+    EXPECT_LE(grid.GetLoadedSize(), settings.memoryBudget);
+
+    // Less memory: the farthest dormant cell is unloaded first.
+    settings.memoryBudget = grid.GetLoadedSize() - cellSize / 2;
+    grid.SetSettings(settings);
+    core.RunSystems();
+    EXPECT_EQ(GetState(core, 3), Resource::CellState::Dormant);
+    EXPECT_EQ(GetState(core, 5), Resource::CellState::Unloaded);
+    EXPECT_EQ(CountPartitioned(core), 20u);
+
+    settings.memoryBudget = std::numeric_limits<size_t>::max();
+    grid.SetSettings(settings);
+    core.RunSystems();
+    RunUntilLoaded(core);
+    EXPECT_EQ(CountPartitioned(core), 40u);
+}
+
+TEST(WorldGrid, SourcesStreamAroundTheirWorldPosition)
+{
+    Engine::Core core;
+    SetUpCore(core, TestSettings());
+    // Near the origin in its parent, but far away in the world.
+    auto source = CreateSource(core, {5.0f, 0.0f, 5.0f});
+    source.AddComponent<Object::Component::GlobalTransform>(
+        Object::Component::GlobalTransform{.matrix = glm::translate(glm::mat4(1.0f), glm::vec3(105.0f, 0.0f, 5.0f))});
+    CreateCell(core, 5.0f, 10);
+    CreateCell(core, 105.0f, 20);
+
+    core.RunSystems();
+    EXPECT_EQ(GetState(core, 0), Resource::CellState::Unloaded);
+    EXPECT_EQ(GetState(core, 10), Resource::CellState::Active);
+    EXPECT_EQ(CountPartitioned(core), 20u);
+}
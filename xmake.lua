@@ -60,6 +60,7 @@ target("EngineSquared")
     add_deps("PluginEvent")
     add_deps("PluginDefaultPipeline")
     add_deps("PluginRmlui")
+    add_deps("PluginWorldPartition")
 
     add_packages("entt", "glfw", "glm", "spdlog", "tinyobjloader", "fmt", "stb", "joltphysics", "wgpu-native",
                  "rmlui", "freetype", "zlib")